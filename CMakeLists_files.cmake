@@ -173,6 +173,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/EclipseState/Tables/BrineDensityTable.cpp
   opm/input/eclipse/EclipseState/Tables/SolventDensityTable.cpp
   opm/input/eclipse/EclipseState/Tables/Tabdims.cpp
+  opm/input/eclipse/Parser/DeckCache.cpp
   opm/input/eclipse/Parser/ErrorGuard.cpp
   opm/input/eclipse/Parser/InputErrorAction.cpp
   opm/input/eclipse/Parser/ParseContext.cpp
@@ -216,6 +217,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/Source.cpp
   opm/input/eclipse/Schedule/SummaryState.cpp
   opm/input/eclipse/Schedule/Tuning.cpp
+  opm/input/eclipse/Schedule/VFPEvaluator.cpp
   opm/input/eclipse/Schedule/VFPInjTable.cpp
   opm/input/eclipse/Schedule/VFPProdTable.cpp
   opm/input/eclipse/Schedule/WriteRestartFileEvents.cpp
@@ -229,6 +231,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/Action/ActionValue.cpp
   opm/input/eclipse/Schedule/Action/ASTNode.cpp
   opm/input/eclipse/Schedule/Action/Condition.cpp
+  opm/input/eclipse/Schedule/Action/ConditionCache.cpp
   opm/input/eclipse/Schedule/Action/Enums.cpp
   opm/input/eclipse/Schedule/Action/PyAction.cpp
   opm/input/eclipse/Schedule/Action/State.cpp
@@ -283,6 +286,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/UDQ/UDQInput.cpp
   opm/input/eclipse/Schedule/UDQ/UDQParams.cpp
   opm/input/eclipse/Schedule/UDQ/UDQParser.cpp
+  opm/input/eclipse/Schedule/UDQ/UDQProgram.cpp
   opm/input/eclipse/Schedule/UDQ/UDQSet.cpp
   opm/input/eclipse/Schedule/UDQ/UDQState.cpp
   opm/input/eclipse/Schedule/UDQ/UDQToken.cpp
@@ -323,6 +327,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/input/eclipse/Schedule/Well/WDFAC.cpp
   opm/input/eclipse/Schedule/Well/WVFPDP.cpp
   opm/input/eclipse/Schedule/Well/WVFPEXP.cpp
+  opm/input/eclipse/Schedule/WellTraj/CellSearchTree.cpp
   opm/input/eclipse/Schedule/WellTraj/RigEclipseWellLogExtractor.cpp
   opm/input/eclipse/Units/Dimension.cpp
   opm/input/eclipse/Units/UnitSystem.cpp
@@ -340,6 +345,10 @@ list(APPEND MAIN_SOURCE_FILES
   opm/io/eclipse/ESmry_write_rsm.cpp
   opm/io/eclipse/OutputStream.cpp
   opm/io/eclipse/ExtSmryOutput.cpp
+  opm/io/eclipse/ChunkedESmry.cpp
+  opm/io/eclipse/ChunkedSmryFormat.cpp
+  opm/io/eclipse/ChunkedSmryOutput.cpp
+  opm/io/eclipse/MappedFile.cpp
   opm/io/eclipse/RestartFileView.cpp
   opm/io/eclipse/SummaryNode.cpp
   opm/io/eclipse/rst/action.cpp
@@ -367,6 +376,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/material/fluidmatrixinteractions/EclHysteresisConfig.cpp
   opm/material/fluidmatrixinteractions/EclMaterialLawInitParams.cpp
   opm/material/fluidmatrixinteractions/EclMaterialLawHystParams.cpp
+  opm/material/fluidmatrixinteractions/EclMaterialLawDenseParams.cpp
   opm/material/fluidmatrixinteractions/EclMaterialLawManager.cpp
   opm/material/fluidmatrixinteractions/EclMaterialLawReadEffectiveParams.cpp
   opm/material/fluidsystems/BlackOilFluidSystem.cpp
@@ -424,6 +434,7 @@ list(APPEND MAIN_SOURCE_FILES
   opm/output/eclipse/LinearisedOutputTable.cpp
   opm/output/eclipse/LoadRestart.cpp
   opm/output/eclipse/LogiHEAD.cpp
+  opm/output/eclipse/OutputQueue.cpp
   opm/output/eclipse/RestartIO.cpp
   opm/output/eclipse/Inplace.cpp
   opm/output/eclipse/Summary.cpp
@@ -523,6 +534,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_ERst.cpp
   tests/test_ESmry.cpp
   tests/test_ExtESmry.cpp
+  tests/test_ChunkedSmry.cpp
   tests/test_FastSmallVector.cpp
   tests/test_FIPRegionStatistics.cpp
   tests/test_GroupSatelliteInjection.cpp
@@ -538,12 +550,14 @@ list(APPEND TEST_SOURCE_FILES
   tests/test_nonuniformtablelinear.cpp
   tests/test_OpmInputError_format.cpp
   tests/test_OpmLog.cpp
+  tests/test_OutputQueue.cpp
   tests/test_OutputStream.cpp
   tests/test_PhaseUsageInfo.cpp
   tests/test_PaddedOutputString.cpp
   tests/test_param.cpp
   tests/test_PAvgCalculator.cpp
   tests/test_PAvgDynamicSourceData.cpp
+  tests/test_PersistentHashMap.cpp
   tests/test_regionCache.cpp
   tests/test_RegionSetMatcher.cpp
   tests/test_Restart.cpp
@@ -579,6 +593,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/material/test_eclmateriallawmanager.cpp
   tests/material/test_hysteresis.cpp
   tests/material/test_spline.cpp
+  tests/material/test_tabulated1dfunction.cpp
   tests/ml/test_ml_model.cpp
   tests/ml/test_ml_layer.cpp
   tests/parser/ACTIONX.cpp
@@ -657,6 +672,7 @@ list(APPEND TEST_SOURCE_FILES
   tests/parser/UDQTests.cpp
   tests/parser/UDTTests.cpp
   tests/parser/UnitTests.cpp
+  tests/parser/VFPEvaluatorTests.cpp
   tests/parser/integration/NNCTests.cpp
   tests/parser/integration/NNCTestsLGR.cpp
   tests/parser/WellSolventTests.cpp
@@ -852,6 +868,14 @@ list(APPEND TEST_DATA_FILES
 )
 
 list(APPEND EXAMPLE_SOURCE_FILES
+  examples/benchmark_cell_search.cpp
+  examples/benchmark_deck_parse.cpp
+  examples/benchmark_eclio_decode.cpp
+  examples/benchmark_ml_model.cpp
+  examples/benchmark_satfunc.cpp
+  examples/benchmark_schedule_snapshots.cpp
+  examples/benchmark_tabulated1d.cpp
+  examples/validate_brine_pvt_tables.cpp
   examples/wellgraph.cpp
   examples/networkgraph.cpp
 )
@@ -864,6 +888,7 @@ list(APPEND PROGRAM_SOURCE_FILES
   examples/opmhash.cpp
   examples/rst_deck.cpp
   examples/make_ext_smry.cpp
+  examples/make_chunked_smry.cpp
   examples/co2brinepvt.cpp
   examples/hysteresis.cpp
   examples/plot_ms_wells.cpp
@@ -894,6 +919,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/common/utility/FileSystem.hpp
   opm/common/utility/MemPacker.hpp
   opm/common/utility/OpmInputError.hpp
+  opm/common/utility/PersistentHashMap.hpp
   opm/common/utility/Serializer.hpp
   opm/common/utility/String.hpp
   opm/common/utility/SymmTensor.hpp
@@ -1101,6 +1127,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/EclipseState/checkDeck.hpp
   opm/input/eclipse/Generator/KeywordGenerator.hpp
   opm/input/eclipse/Generator/KeywordLoader.hpp
+  opm/input/eclipse/Parser/DeckCache.hpp
   opm/input/eclipse/Parser/ErrorGuard.hpp
   opm/input/eclipse/Parser/InputErrorAction.hpp
   opm/input/eclipse/Parser/ParseContext.hpp
@@ -1120,6 +1147,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/Action/ActionX.hpp
   opm/input/eclipse/Schedule/Action/Actions.hpp
   opm/input/eclipse/Schedule/Action/Condition.hpp
+  opm/input/eclipse/Schedule/Action/ConditionCache.hpp
   opm/input/eclipse/Schedule/Action/Enums.hpp
   opm/input/eclipse/Schedule/Action/PyAction.hpp
   opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp
@@ -1193,10 +1221,12 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp
   opm/input/eclipse/Schedule/UDQ/UDQInput.hpp
   opm/input/eclipse/Schedule/UDQ/UDQParams.hpp
+  opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp
   opm/input/eclipse/Schedule/UDQ/UDQSet.hpp
   opm/input/eclipse/Schedule/UDQ/UDQState.hpp
   opm/input/eclipse/Schedule/UDQ/UDQToken.hpp
   opm/input/eclipse/Schedule/UDQ/UDT.hpp
+  opm/input/eclipse/Schedule/VFPEvaluator.hpp
   opm/input/eclipse/Schedule/VFPInjTable.hpp
   opm/input/eclipse/Schedule/VFPProdTable.hpp
   opm/input/eclipse/Schedule/Well/Connection.hpp
@@ -1241,6 +1271,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/io/eclipse/ERft.hpp
   opm/io/eclipse/ERsm.hpp
   opm/io/eclipse/ERst.hpp
+  opm/io/eclipse/EclArrayView.hpp
   opm/io/eclipse/ESmry.hpp
   opm/io/eclipse/EclFile.hpp
   opm/io/eclipse/EclIOdata.hpp
@@ -1248,8 +1279,13 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/io/eclipse/EclUtil.hpp
   opm/io/eclipse/ExtESmry.hpp
   opm/io/eclipse/ExtSmryOutput.hpp
+  opm/io/eclipse/ChunkedESmry.hpp
+  opm/io/eclipse/ChunkedSmryFormat.hpp
+  opm/io/eclipse/ChunkedSmryOutput.hpp
+  opm/io/eclipse/MappedFile.hpp
   opm/io/eclipse/OutputStream.hpp
   opm/io/eclipse/PaddedOutputString.hpp
+  opm/io/eclipse/SmryQuery.hpp
   opm/io/eclipse/RestartFileView.hpp
   opm/io/eclipse/SummaryNode.hpp
   opm/io/eclipse/SummaryNode.hpp
@@ -1366,6 +1402,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidmatrixinteractions/EclHysteresisConfig.hpp
   opm/material/fluidmatrixinteractions/EclHysteresisTwoPhaseLaw.hpp
   opm/material/fluidmatrixinteractions/EclHysteresisTwoPhaseLawParams.hpp
+  opm/material/fluidmatrixinteractions/EclMaterialLawDenseParams.hpp
   opm/material/fluidmatrixinteractions/EclMaterialLawHystParams.hpp
   opm/material/fluidmatrixinteractions/EclMaterialLawInitParams.hpp
   opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp
@@ -1462,6 +1499,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/material/fluidsystems/blackoilpvt/NullOilPvt.hpp
   opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp
   opm/material/fluidsystems/blackoilpvt/OilPvtThermal.hpp
+  opm/material/fluidsystems/blackoilpvt/SaturatedBrineTables.hpp
   opm/material/fluidsystems/blackoilpvt/SolventPvt.hpp
   opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp
   opm/material/fluidsystems/blackoilpvt/WaterPvtThermal.hpp
@@ -1522,6 +1560,7 @@ list(APPEND PUBLIC_HEADER_FILES
   opm/output/eclipse/LgrHEADQ.hpp
   opm/output/eclipse/LinearisedOutputTable.hpp
   opm/output/eclipse/LogiHEAD.hpp
+  opm/output/eclipse/OutputQueue.hpp
   opm/output/eclipse/RegionCache.hpp
   opm/output/eclipse/RestartIO.hpp
   opm/output/eclipse/RestartValue.hpp
@@ -1620,6 +1659,7 @@ list(APPEND PRIVATE_HEADER_FILES
   external/resinsight/cafPdmCore/cafSignal.h
   opm/input/eclipse/Schedule/HandlerContext.hpp
   opm/input/eclipse/Schedule/Well/WellTrajInfo.hpp
+  opm/input/eclipse/Schedule/WellTraj/CellSearchTree.hpp
   opm/input/eclipse/Schedule/WellTraj/RigEclipseWellLogExtractor.hpp
 )
 
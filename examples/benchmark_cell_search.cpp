@@ -0,0 +1,198 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+#include <opm/input/eclipse/Schedule/WellTraj/CellSearchTree.hpp>
+
+#include <external/resinsight/LibCore/cvfVector3.h>
+#include <external/resinsight/LibGeometry/cvfBoundingBox.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <iterator>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark for the cell search tree used to intersect well\n"
+              << "trajectories (WELTRAJ/COMPTRAJ) with the grid.  Forms the tree once and\n"
+              << "queries the candidate cells of a number of deviated trajectories, one\n"
+              << "segment at a time and in batches of whole trajectories.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-x Number of cells in X direction.  Default 200.\n"
+              << "-y Number of cells in Y direction.  Default 200.\n"
+              << "-z Number of cells in Z direction.  Default 50.\n"
+              << "-w Number of well trajectories.  Default 400.\n"
+              << "-s Number of segments per trajectory.  Default 50.\n"
+              << "-r Number of repetitions, best time is reported.  Default 3.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestTime(const int repeat, const std::function<void()>& f)
+{
+    auto best = std::chrono::duration<double>::max();
+
+    for (int i = 0; i < repeat; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double> {
+                std::chrono::steady_clock::now() - start
+            });
+    }
+
+    return best.count();
+}
+
+void report(const std::string& what, const double seconds)
+{
+    std::cout << fmt::format("{:<36} {:10.4f} s\n", what, seconds);
+}
+
+using Trajectory = std::vector<external::cvf::Vec3d>;
+
+// Deviated trajectories from the top of the grid, drifting laterally with
+// depth.
+std::vector<Trajectory>
+makeTrajectories(const std::size_t numWells,
+                 const std::size_t numSegments,
+                 const double      lx,
+                 const double      ly,
+                 const double      lz)
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> x(0.0, lx);
+    std::uniform_real_distribution<double> y(0.0, ly);
+    std::normal_distribution<double> drift(0.0, 0.05 * std::min(lx, ly) / numSegments);
+
+    auto trajectories = std::vector<Trajectory>(numWells);
+    for (auto& trajectory : trajectories) {
+        auto p = external::cvf::Vec3d { x(gen), y(gen), 0.0 };
+        trajectory.push_back(p);
+
+        for (std::size_t segment = 0; segment < numSegments; ++segment) {
+            p = external::cvf::Vec3d {
+                std::clamp(p.x() + drift(gen), 0.0, lx),
+                std::clamp(p.y() + drift(gen), 0.0, ly),
+                lz * (segment + 1) / numSegments
+            };
+
+            trajectory.push_back(p);
+        }
+    }
+
+    return trajectories;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t nx = 200, ny = 200, nz = 50;
+    std::size_t numWells = 400;
+    std::size_t numSegments = 50;
+    int repeat = 3;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "x:y:z:w:s:r:h")) != -1) {
+        switch (c) {
+        case 'x':
+            nx = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'y':
+            ny = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'z':
+            nz = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'w':
+            numWells = std::atoll(optarg);
+            break;
+        case 's':
+            numSegments = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'r':
+            repeat = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const double dx = 50.0, dy = 50.0, dz = 2.0;
+    const Opm::EclipseGrid grid(nx, ny, nz, dx, dy, dz, 2000.0);
+
+    const auto trajectories = makeTrajectories(numWells, numSegments,
+                                               nx*dx, ny*dy, 2000.0 + nz*dz);
+
+    std::cout << "Grid:         " << nx << 'x' << ny << 'x' << nz << '\n'
+              << "Trajectories: " << numWells << " with " << numSegments
+              << " segments each\n\n";
+
+    std::optional<Opm::CellSearchTree> tree;
+    report("Form search tree", bestTime(repeat, [&]() { tree.emplace(grid); }));
+
+    auto reference = std::vector<std::vector<std::size_t>>{};
+    report("Per-segment queries", bestTime(repeat, [&]() {
+        reference.clear();
+        for (const auto& trajectory : trajectories) {
+            for (std::size_t segment = 0; segment + 1 < trajectory.size(); ++segment) {
+                auto bb = external::cvf::BoundingBox{};
+                bb.add(trajectory[segment + 0]);
+                bb.add(trajectory[segment + 1]);
+
+                reference.push_back(tree->findIntersectingCells(bb));
+            }
+        }
+    }));
+
+    auto result = std::vector<std::vector<std::size_t>>{};
+    report("Batched queries", bestTime(repeat, [&]() {
+        result.clear();
+        for (const auto& trajectory : trajectories) {
+            auto segmentCells = tree->findSegmentCells(trajectory);
+            result.insert(result.end(),
+                          std::make_move_iterator(segmentCells.begin()),
+                          std::make_move_iterator(segmentCells.end()));
+        }
+    }));
+
+    if (result != reference) {
+        std::cerr << "Batched queries differ from per-segment queries\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,196 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <optional>
+#include <string>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <fmt/format.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark for parsing large grid property keywords (ZCORN, PERMX,\n"
+              << "ACTNUM) and many small schedule records (COMPDAT) from a synthetic deck.\n"
+              << "Reports parse time, throughput in MB/s of deck text, and the heap memory\n"
+              << "held by the parsed Deck.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-n Number of cells in synthetic grid.  Default 10000000.\n"
+              << "-c Number of COMPDAT records.  Default 1000000.\n"
+              << "-r Number of repetitions, best time is reported.  Default 3.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestTime(const int repeat, const std::function<void()>& f)
+{
+    auto best = std::chrono::duration<double>::max();
+
+    for (int i = 0; i < repeat; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double> {
+                std::chrono::steady_clock::now() - start
+            });
+    }
+
+    return best.count();
+}
+
+void report(const std::string& what, const std::uint64_t bytes, const double seconds)
+{
+    std::cout << fmt::format("{:<36} {:10.4f} s {:10.3f} MB/s\n",
+                             what, seconds, bytes / seconds / 1.0e6);
+}
+
+// Values formatted like typical GRDECL export, eight per line, with
+// occasional repeat counts.
+template <typename Value>
+std::string keyword(const std::string& name,
+                    const std::int64_t num,
+                    const std::string& repeated,
+                    Value&& value)
+{
+    std::string text = name + '\n';
+
+    std::int64_t i = 0;
+    while (i < num) {
+        if ((i % 1000 == 999) && (i + 4 <= num)) {
+            text += "4*" + repeated + ' ';
+            i += 4;
+        }
+        else {
+            text += value(i);
+            text += (i % 8 == 7) ? '\n' : ' ';
+            ++i;
+        }
+    }
+
+    return text + "\n/\n\n";
+}
+
+// Heap memory in use, if the C library can tell.
+std::optional<std::size_t> heapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 33))
+    return mallinfo2().uordblks;
+#else
+    return std::nullopt;
+#endif
+}
+
+// Connection data in the form of a typical COMPDAT export, a few
+// connections per well.
+std::string compdat(const std::int64_t num)
+{
+    std::string text = "COMPDAT\n";
+
+    for (std::int64_t i = 0; i < num; ++i) {
+        text += fmt::format("  'P{}' {} {} {} {} 'OPEN' 1* {:.3f} 0.2159 1* 0 1* 'Z' /\n",
+                            i / 8, 1 + (i / 8) % 100, 1 + (i / 800) % 100,
+                            1 + i % 8, 1 + i % 8, 1.0 + 0.01*(i % 97));
+    }
+
+    return text + "/\n\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::int64_t num = 10'000'000;
+    std::int64_t numCompdat = 1'000'000;
+    int repeat = 3;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:c:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::max(std::int64_t{1}, static_cast<std::int64_t>(std::atoll(optarg)));
+            break;
+        case 'c':
+            numCompdat = std::max(std::int64_t{0}, static_cast<std::int64_t>(std::atoll(optarg)));
+            break;
+        case 'r':
+            repeat = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::string deck = "GRID\n\n"
+        + keyword("ZCORN", 8 * num, "2000.0",
+                  [](const std::int64_t i) { return fmt::format("{:.4f}", 2000.0 + 0.137*(i % 1000)); })
+        + keyword("PERMX", num, "100",
+                  [](const std::int64_t i) { return fmt::format("{:.6g}", 1.0 + 0.5*(i % 777)); })
+        + keyword("ACTNUM", num, "0",
+                  [](const std::int64_t i) { return (i % 17 == 0) ? "0" : "1"; })
+        + "SCHEDULE\n\n"
+        + compdat(numCompdat);
+
+    std::cout << "Cells:     " << num << '\n'
+              << "COMPDAT:   " << numCompdat << '\n'
+              << "Deck size: " << deck.size() / 1000000 << " MB\n\n";
+
+    Opm::Parser parser;
+    Opm::ParseContext parseContext;
+    Opm::ErrorGuard errors;
+
+    std::size_t numValues = 0;
+
+    std::optional<std::size_t> deckMemory;
+
+    report("Parser::parseString()", deck.size(), bestTime(repeat, [&]() {
+        const auto before = heapInUse();
+        const auto parsed = parser.parseString(deck, parseContext, errors);
+        const auto after = heapInUse();
+
+        numValues = parsed["ZCORN"].back().getRecord(0).getItem(0).data_size();
+        if (before.has_value() && after.has_value()) {
+            deckMemory = *after - *before;
+        }
+    }));
+
+    if (deckMemory.has_value()) {
+        std::cout << fmt::format("{:<36} {:10.1f} MB\n", "Heap held by Deck", *deckMemory / 1.0e6);
+    }
+
+    return (numValues == static_cast<std::size_t>(8 * num)) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
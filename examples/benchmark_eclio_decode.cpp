@@ -0,0 +1,176 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/io/eclipse/EclFile.hpp>
+#include <opm/io/eclipse/EclOutput.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#if _OPENMP
+#include <omp.h>
+#endif
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark for conversion of binary ECLIPSE REAL arrays between\n"
+              << "on-disk (big-endian, record structured) and in-memory representation.\n"
+              << "Reports throughput in GB/s of array payload.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-n Number of cells in synthetic array.  Default 100000000.\n"
+              << "-r Number of repetitions, best time is reported.  Default 3.\n"
+              << "-t Number of threads.  Default OpenMP setting.\n"
+              << "-o Also measure file output and input through this file.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestTime(const int repeat, const std::function<void()>& f)
+{
+    auto best = std::chrono::duration<double>::max();
+
+    for (int i = 0; i < repeat; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double> {
+                std::chrono::steady_clock::now() - start
+            });
+    }
+
+    return best.count();
+}
+
+void report(const std::string& what, const std::uint64_t bytes, const double seconds)
+{
+    std::cout << fmt::format("{:<36} {:10.4f} s {:10.3f} GB/s\n",
+                             what, seconds, bytes / seconds / 1.0e9);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::int64_t num = 100'000'000;
+    int repeat = 3;
+    std::string fileName;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:r:t:o:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::atoll(optarg);
+            break;
+        case 'r':
+            repeat = std::max(1, std::atoi(optarg));
+            break;
+        case 't':
+#if _OPENMP
+            omp_set_num_threads(std::atoi(optarg));
+#else
+            std::cerr << "OpenMP is disabled - using single thread only\n";
+#endif
+            break;
+        case 'o':
+            fileName = optarg;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    using namespace Opm::EclIO;
+
+    const int elementsPerBlock = MaxBlockSizeReal / sizeOfReal;
+    const auto payload = static_cast<std::uint64_t>(num) * sizeOfReal;
+
+    std::vector<float> values(num);
+    for (std::int64_t i = 0; i < num; ++i) {
+        values[i] = 1.0e-3f * static_cast<float>(i % 100'000) + 200.0f;
+    }
+
+    std::vector<float> flipped(num);
+    std::vector<char> encoded(sizeOnDiskBinary(num, REAL, sizeOfReal));
+    std::vector<float> decoded(num);
+
+#if _OPENMP
+    std::cout << "Threads: " << omp_get_max_threads() << '\n';
+#endif
+    std::cout << "Cells:   " << num << "\n\n";
+
+    report("Per-element flipEndianFloat()", payload, bestTime(repeat, [&]() {
+        std::transform(values.begin(), values.end(), flipped.begin(), flipEndianFloat);
+    }));
+
+    report("Bulk flipEndianArray()", payload, bestTime(repeat, [&]() {
+        flipEndianArray(values.data(), flipped.data(), values.size(), sizeOfReal);
+    }));
+
+    report("encodeBinaryBlocks()", payload, bestTime(repeat, [&]() {
+        encodeBinaryBlocks(values.data(), num, sizeOfReal, elementsPerBlock, encoded.data());
+    }));
+
+    report("decodeBinaryBlocks()", payload, bestTime(repeat, [&]() {
+        decodeBinaryBlocks(encoded.data(), num, sizeOfReal, elementsPerBlock, decoded.data());
+    }));
+
+    if (decoded != values) {
+        std::cerr << "Decoded array differs from input\n";
+        return EXIT_FAILURE;
+    }
+
+    if (fileName.empty()) {
+        return EXIT_SUCCESS;
+    }
+
+    report("EclOutput::write()", payload, bestTime(repeat, [&]() {
+        EclOutput output(fileName, false);
+        output.write("PRESSURE", values);
+    }));
+
+    report("EclFile::get() stream", payload, bestTime(repeat, [&]() {
+        EclFile file(fileName);
+        decoded = file.get<float>("PRESSURE");
+    }));
+
+    report("EclFile::get() memory mapped", payload, bestTime(repeat, [&]() {
+        EclFile file(fileName, EclFile::MemoryMapped{true});
+        decoded = file.get<float>("PRESSURE");
+    }));
+
+    std::remove(fileName.c_str());
+
+    return (decoded == values) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
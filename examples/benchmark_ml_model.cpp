@@ -0,0 +1,244 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/ml/ml_model.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <unistd.h>
+#include <vector>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark for evaluating a dense neural network on many samples,\n"
+              << "comparing per-sample NNModel::apply() with the batched applyBatch().\n"
+              << "The network has tanh hidden layers and a linear output layer, with\n"
+              << "random weights.  Samples are plain doubles and AD evaluations with\n"
+              << "three derivatives.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-n Number of samples.  Default 100000.\n"
+              << "-i Number of input features.  Default 8.\n"
+              << "-w Width of hidden layers.  Default 64.\n"
+              << "-l Number of hidden layers.  Default 2.\n"
+              << "-o Number of outputs.  Default 4.\n"
+              << "-r Number of repetitions, best time is reported.  Default 3.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+template <class T>
+void write(std::ofstream& os, const T& x)
+{
+    os.write(reinterpret_cast<const char*>(&x), sizeof(T));
+}
+
+// Writes a model file in the format read by NNModel::loadModel().
+void writeModel(const std::filesystem::path& filename,
+                const std::vector<unsigned int>& sizes)
+{
+    using LayerType = Opm::ML::NNModel<double>::LayerType;
+    using Opm::ML::ActivationType;
+
+    std::mt19937 gen(1234);
+    std::vector<float> weights;
+
+    std::ofstream os(filename, std::ios::binary);
+    write(os, static_cast<unsigned int>(sizes.size() - 1));
+
+    for (std::size_t layer = 0; layer + 1 < sizes.size(); ++layer) {
+        const unsigned int rows = sizes[layer];
+        const unsigned int cols = sizes[layer + 1];
+
+        // Glorot uniform initialisation
+        const float limit = std::sqrt(6.0f / (rows + cols));
+        std::uniform_real_distribution<float> dist(-limit, limit);
+
+        write(os, static_cast<unsigned int>(LayerType::kDense));
+        write(os, rows);
+        write(os, cols);
+        write(os, cols);
+
+        weights.resize(rows * cols);
+        std::ranges::generate(weights, [&]() { return dist(gen); });
+        os.write(reinterpret_cast<const char*>(weights.data()), sizeof(float) * weights.size());
+
+        weights.resize(cols);
+        std::ranges::generate(weights, [&]() { return 0.1f * dist(gen); });
+        os.write(reinterpret_cast<const char*>(weights.data()), sizeof(float) * weights.size());
+
+        const auto activation = (layer + 2 == sizes.size())
+            ? ActivationType::kLinear : ActivationType::kTanh;
+        write(os, static_cast<unsigned int>(activation));
+    }
+}
+
+double bestTime(const int repeat, const std::function<void()>& f)
+{
+    float best = std::numeric_limits<float>::max();
+
+    for (int i = 0; i < repeat; ++i) {
+        Opm::ML::NNTimer timer;
+        timer.start();
+        f();
+        best = std::min(best, timer.stop());
+    }
+
+    return 1.0e-3 * best;
+}
+
+void report(const std::string& what, const std::size_t num, const double seconds)
+{
+    std::cout << fmt::format("{:<36} {:10.4f} s {:10.2f} ns/sample\n",
+                             what, seconds, 1.0e9 * seconds / num);
+}
+
+template <class Evaluation>
+bool runBenchmark(const std::string& name,
+                  const std::filesystem::path& filename,
+                  const int num, const int num_in, const int repeat)
+{
+    using Opm::ML::Tensor;
+
+    Opm::ML::NNModel<Evaluation> model;
+    model.loadModel(filename);
+
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+    Tensor<Evaluation> in(num, num_in);
+    for (auto& x : in.data_) {
+        x = dist(gen);
+        if constexpr (!std::is_floating_point_v<Evaluation>) {
+            for (int d = 0; d < Evaluation::numVars; ++d) {
+                x.setDerivative(d, dist(gen));
+            }
+        }
+    }
+
+    Tensor<Evaluation> reference;
+    report(name + " apply()", num, bestTime(repeat, [&]() {
+        Tensor<Evaluation> sample(num_in), out;
+        for (int r = 0; r < num; ++r) {
+            std::copy_n(in.data_.begin() + static_cast<std::ptrdiff_t>(r) * num_in,
+                        num_in, sample.data_.begin());
+            model.apply(sample, out);
+
+            if (r == 0) {
+                reference.resizeI(std::vector<int>{num, out.dims_[0]});
+            }
+            std::ranges::copy(out.data_, reference.data_.begin() +
+                              static_cast<std::ptrdiff_t>(r) * out.dims_[0]);
+        }
+    }));
+
+    Tensor<Evaluation> result;
+    Opm::ML::NNWorkspace<Evaluation> workspace;
+    report(name + " applyBatch()", num, bestTime(repeat, [&]() {
+        model.applyBatch(in, result, workspace);
+    }));
+
+    double max_diff = 0.0;
+    for (std::size_t k = 0; k < result.data_.size(); ++k) {
+        max_diff = std::max(max_diff, std::abs(Opm::getValue(result.data_[k]) -
+                                               Opm::getValue(reference.data_[k])));
+    }
+
+    if (result.dims_ != reference.dims_ || max_diff > 1.0e-9) {
+        std::cerr << name << ": batched evaluation differs from per-sample evaluation\n";
+        return false;
+    }
+
+    return true;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    int num = 100'000;
+    unsigned int num_in = 8;
+    unsigned int width = 64;
+    int num_hidden = 2;
+    unsigned int num_out = 4;
+    int repeat = 3;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:i:w:l:o:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::max(1, std::atoi(optarg));
+            break;
+        case 'i':
+            num_in = std::max(1, std::atoi(optarg));
+            break;
+        case 'w':
+            width = std::max(1, std::atoi(optarg));
+            break;
+        case 'l':
+            num_hidden = std::max(0, std::atoi(optarg));
+            break;
+        case 'o':
+            num_out = std::max(1, std::atoi(optarg));
+            break;
+        case 'r':
+            repeat = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<unsigned int> sizes { num_in };
+    sizes.insert(sizes.end(), num_hidden, width);
+    sizes.push_back(num_out);
+
+    const auto filename = std::filesystem::temp_directory_path() /
+        fmt::format("benchmark_ml_model_{}.model", ::getpid());
+    writeModel(filename, sizes);
+
+    std::cout << "Layer sizes: " << fmt::format("{}", fmt::join(sizes, " x ")) << '\n'
+              << "Samples:     " << num << "\n\n";
+
+    bool ok = runBenchmark<double>("double", filename, num, num_in, repeat);
+    ok = runBenchmark<Opm::DenseAd::Evaluation<double, 3>>("Evaluation<double, 3>",
+                                                           filename, num, num_in, repeat) && ok;
+
+    std::filesystem::remove(filename);
+
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,344 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawDenseParams.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
+#include <opm/material/fluidstates/SimpleModularFluidState.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+constexpr int waterPhaseIdx = 0;
+constexpr int oilPhaseIdx = 1;
+constexpr int gasPhaseIdx = 2;
+constexpr int numPhases = 3;
+
+using Traits = Opm::ThreePhaseMaterialTraits<double,
+                                             waterPhaseIdx,
+                                             oilPhaseIdx,
+                                             gasPhaseIdx,
+                                             /*enableHysteresis=*/true,
+                                             /*enableEndpointScaling=*/true>;
+
+using Manager = Opm::EclMaterialLaw::Manager<Traits>;
+using MaterialLaw = Manager::MaterialLaw;
+using DenseParams = Opm::EclMaterialLaw::DenseParams<Traits>;
+
+using Evaluation = Opm::DenseAd::Evaluation<double, 3>;
+using SatArray = std::array<Evaluation, numPhases>;
+
+using FluidState = Opm::SimpleModularFluidState<Evaluation,
+                                                numPhases,
+                                                /*numComponents=*/3,
+                                                void,
+                                                /*storePressure=*/false,
+                                                /*storeTemperature=*/false,
+                                                /*storeComposition=*/false,
+                                                /*storeFugacity=*/false,
+                                                /*storeSaturation=*/true,
+                                                /*storeDensity=*/false,
+                                                /*storeViscosity=*/false,
+                                                /*storeEnthalpy=*/false>;
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark for evaluating saturation functions with end point\n"
+              << "scaling in all cells of a synthetic model, comparing the per-cell\n"
+              << "parameters of EclMaterialLaw::Manager with the dense copy in\n"
+              << "EclMaterialLaw::DenseParams.  Reports the memory per cell and the time\n"
+              << "per cell for relative permeabilities and capillary pressures of AD\n"
+              << "evaluations with three derivatives.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-x Number of cells in X direction.  Default 100.\n"
+              << "-y Number of cells in Y direction.  Default 100.\n"
+              << "-z Number of cells in Z direction.  Default 100.\n"
+              << "-s Number of saturation regions.  Default 4.\n"
+              << "-m Three-phase model, one of DEFAULT, STONE1 or STONE2.  Default DEFAULT.\n"
+              << "-r Number of repetitions, best time is reported.  Default 3.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestTime(const int repeat, const std::function<void()>& f)
+{
+    auto best = std::chrono::duration<double>::max();
+
+    for (int i = 0; i < repeat; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double> {
+                std::chrono::steady_clock::now() - start
+            });
+    }
+
+    return best.count();
+}
+
+void report(const std::string& what, const std::size_t num, const double seconds)
+{
+    std::cout << fmt::format("{:<36} {:10.4f} s {:10.2f} ns/cell\n",
+                             what, seconds, 1.0e9 * seconds / num);
+}
+
+// Resident set size of this process in bytes.
+std::size_t residentBytes()
+{
+    std::size_t pages = 0, resident = 0;
+    std::ifstream("/proc/self/statm") >> pages >> resident;
+
+    return resident * static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+}
+
+// Deck with one set of SWOF/SGOF tables per saturation region, regions and
+// SWL, KRW and PCW varying by layer.
+std::string makeDeck(const std::size_t nx, const std::size_t ny, const std::size_t nz,
+                     const std::size_t numRegions, const std::string& model)
+{
+    const auto n = nx * ny * nz;
+    const auto layer = nx * ny;
+
+    auto deck = fmt::format("RUNSPEC\n"
+                            "DIMENS\n {} {} {} /\n"
+                            "TABDIMS\n {} /\n"
+                            "OIL\nGAS\nWATER\n"
+                            "METRIC\n"
+                            "ENDSCALE\n/\n"
+                            "GRID\n"
+                            "DX\n {}*100 /\n"
+                            "DY\n {}*100 /\n"
+                            "DZ\n {}*5 /\n"
+                            "TOPS\n {}*2000 /\n"
+                            "PORO\n {}*0.2 /\n"
+                            "PROPS\n",
+                            nx, ny, nz, numRegions, n, n, n, layer, n);
+
+    if (model != "DEFAULT") {
+        deck += model + "\n";
+    }
+
+    std::string swof = "SWOF\n", sgof = "SGOF\n";
+    for (std::size_t region = 0; region < numRegions; ++region) {
+        const double swco = 0.1 + 0.1 * region / numRegions;
+        const double sorw = 0.15;
+        for (int i = 0; i <= 20; ++i) {
+            const double s = i / 20.0;
+            swof += fmt::format("{:.6f} {:.6f} {:.6f} {:.6f}\n",
+                                swco + s * (1.0 - swco), std::pow(s, 2.5),
+                                std::pow(std::max(0.0, 1.0 - s / (1.0 - sorw)), 2), 2.0 * (1.0 - s));
+            sgof += fmt::format("{:.6f} {:.6f} {:.6f} {:.6f}\n",
+                                s * (1.0 - swco), std::pow(s, 2),
+                                std::pow(1.0 - s, 3), 0.5 * s);
+        }
+        swof += "/\n";
+        sgof += "/\n";
+    }
+    deck += swof + sgof;
+
+    std::string swl = "SWL\n", krw = "KRW\n", pcw = "PCW\n", satnum = "SATNUM\n";
+    for (std::size_t k = 0; k < nz; ++k) {
+        const auto region = k % numRegions;
+        const double swco = 0.1 + 0.1 * region / numRegions;
+        const double f = static_cast<double>(k) / nz;
+
+        swl += fmt::format(" {}*{:.6f}", layer, swco + 0.05 * f);
+        krw += fmt::format(" {}*{:.6f}", layer, 0.7 + 0.3 * f);
+        pcw += fmt::format(" {}*{:.6f}", layer, 1.0 + 2.0 * f);
+        satnum += fmt::format(" {}*{}", layer, region + 1);
+    }
+    deck += swl + " /\n" + krw + " /\n" + pcw + " /\n";
+    deck += "REGIONS\n" + satnum + " /\n";
+
+    return deck;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t nx = 100, ny = 100, nz = 100;
+    std::size_t numRegions = 4;
+    std::string model = "DEFAULT";
+    int repeat = 3;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "x:y:z:s:m:r:h")) != -1) {
+        switch (c) {
+        case 'x':
+            nx = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'y':
+            ny = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'z':
+            nz = std::max(1ll, std::atoll(optarg));
+            break;
+        case 's':
+            numRegions = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'm':
+            model = optarg;
+            break;
+        case 'r':
+            repeat = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (model != "DEFAULT" && model != "STONE1" && model != "STONE2") {
+        std::cerr << "Unsupported three-phase model " << model << '\n';
+        return EXIT_FAILURE;
+    }
+
+    const auto n = nx * ny * nz;
+    const auto eclState = Opm::EclipseState {
+        Opm::Parser{}.parseString(makeDeck(nx, ny, nz, numRegions, model))
+    };
+
+    auto lookupIntProperty = [](const Opm::FieldPropsManager& fieldProps,
+                                const std::string& name, const bool needsTranslation)
+    {
+        auto values = fieldProps.get_int(name);
+        std::ranges::for_each(values, [needsTranslation](int& v) { v -= needsTranslation; });
+        return values;
+    };
+    auto identity = [](const unsigned elemIdx) { return elemIdx; };
+
+    const auto rss0 = residentBytes();
+    Manager manager;
+    manager.initFromState(eclState);
+    manager.initParamsForElements(eclState, n, lookupIntProperty, identity);
+    const auto rss1 = residentBytes();
+
+    if (!DenseParams::supports(manager)) {
+        std::cerr << "Dense parameters not supported for this model\n";
+        return EXIT_FAILURE;
+    }
+
+    const DenseParams dense(manager, n);
+    const auto rss2 = residentBytes();
+
+    std::cout << fmt::format("Cells:         {}\n"
+                             "Regions:       {}\n"
+                             "Model:         {}\n\n", n, numRegions, model);
+    std::cout << fmt::format("{:<36} {:10.1f} bytes/cell (resident)\n",
+                             "Manager parameters", static_cast<double>(rss1 - rss0) / n);
+    std::cout << fmt::format("{:<36} {:10.1f} bytes/cell (resident), {:.1f} allocated\n\n",
+                             "Dense parameters", static_cast<double>(rss2 - rss1) / n,
+                             static_cast<double>(dense.allocatedBytes()) / n);
+
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+
+    std::vector<SatArray> saturations(n);
+    for (auto& s : saturations) {
+        const double sw = dist(gen);
+        const double sg = (1.0 - sw) * dist(gen);
+        s[waterPhaseIdx] = Evaluation::createVariable(sw, 0);
+        s[gasPhaseIdx] = Evaluation::createVariable(sg, 1);
+        s[oilPhaseIdx] = 1.0 - s[waterPhaseIdx] - s[gasPhaseIdx];
+    }
+
+    std::vector<SatArray> krCell(n), pcCell(n), krDense(n), pcDense(n);
+
+    report("Manager relativePermeabilities()", n, bestTime(repeat, [&]() {
+        FluidState fs;
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                fs.setSaturation(phaseIdx, saturations[elemIdx][phaseIdx]);
+            }
+            MaterialLaw::relativePermeabilities(krCell[elemIdx],
+                                                manager.materialLawParams(elemIdx), fs);
+        }
+    }));
+
+    report("DenseParams relativePermeabilities()", n, bestTime(repeat, [&]() {
+        dense.relativePermeabilities<Evaluation>(0, saturations, krDense);
+    }));
+
+    report("Manager capillaryPressures()", n, bestTime(repeat, [&]() {
+        FluidState fs;
+        for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+            for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+                fs.setSaturation(phaseIdx, saturations[elemIdx][phaseIdx]);
+            }
+            MaterialLaw::capillaryPressures(pcCell[elemIdx],
+                                            manager.materialLawParams(elemIdx), fs);
+        }
+    }));
+
+    report("DenseParams capillaryPressures()", n, bestTime(repeat, [&]() {
+        dense.capillaryPressures<Evaluation>(0, saturations, pcDense);
+    }));
+
+    // Relative difference, capillary pressures are in Pascal.
+    double maxDiff = 0.0;
+    auto compare = [&maxDiff](const SatArray& a, const SatArray& b)
+    {
+        for (int phaseIdx = 0; phaseIdx < numPhases; ++phaseIdx) {
+            const double scale = 1.0 + std::abs(b[phaseIdx].value());
+            maxDiff = std::max(maxDiff, std::abs(a[phaseIdx].value() - b[phaseIdx].value()) / scale);
+            for (int d = 0; d < Evaluation::numVars; ++d) {
+                maxDiff = std::max(maxDiff, std::abs(a[phaseIdx].derivative(d) -
+                                                     b[phaseIdx].derivative(d)) / scale);
+            }
+        }
+    };
+
+    for (std::size_t elemIdx = 0; elemIdx < n; ++elemIdx) {
+        compare(krCell[elemIdx], krDense[elemIdx]);
+        compare(pcCell[elemIdx], pcDense[elemIdx]);
+    }
+
+    if (maxDiff > 1.0e-9) {
+        std::cerr << "Dense evaluation differs from per-cell evaluation by " << maxDiff << '\n';
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
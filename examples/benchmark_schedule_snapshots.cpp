@@ -0,0 +1,214 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <opm/input/eclipse/Schedule/ScheduleState.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+// Total number of bytes requested from operator new.
+std::size_t allocatedBytes = 0;
+
+} // Anonymous namespace
+
+void* operator new(std::size_t size)
+{
+    allocatedBytes += size;
+    if (void* p = std::malloc(std::max(size, std::size_t{1}))) {
+        return p;
+    }
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace {
+
+// Stand-in for the per-well objects of the Schedule.  Using a real member
+// type of ScheduleState, the injection streams, keeps the serialized form
+// representative without having to set up complete Well objects.
+using Value = std::vector<double>;
+using Member = Opm::ScheduleState::map_member<std::string, Value>;
+
+void printHelp()
+{
+    std::cout << "\nBenchmark for storing and serializing a history of Schedule snapshots,\n"
+              << "each holding a map of wells of which only a few change per report step.\n"
+              << "Compares full copies of an unordered_map in every snapshot with the\n"
+              << "structurally shared map_member, and full with delta-encoded serialization.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-s Number of report steps.  Default 4000.\n"
+              << "-w Number of wells.  Default 3000.\n"
+              << "-c Number of wells changing per report step.  Default 5.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+struct FullHistory
+{
+    std::vector<Member>* snapshots;
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        serializer(*this->snapshots);
+    }
+};
+
+struct DeltaHistory
+{
+    std::vector<Member>* snapshots;
+
+    template <class Serializer>
+    void serializeOp(Serializer& serializer)
+    {
+        auto& snapshots = *this->snapshots;
+        serializer(snapshots.front());
+        for (std::size_t i = 1; i < snapshots.size(); ++i) {
+            snapshots[i].serializeDeltaOp(serializer, snapshots[i - 1]);
+        }
+    }
+};
+
+template <typename History>
+void reportPackSize(const std::string& what, History history)
+{
+    Opm::Serialization::MemPacker packer;
+    Opm::Serializer serializer(packer);
+
+    const auto start = std::chrono::steady_clock::now();
+    serializer.pack(history);
+    const auto seconds = std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    }.count();
+
+    std::cout << fmt::format("{:<40} {:12.2f} MiB {:10.4f} s\n", what,
+                             serializer.position() / (1024.0 * 1024.0), seconds);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t numSteps = 4000;
+    std::size_t numWells = 3000;
+    std::size_t numChanged = 5;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "s:w:c:h")) != -1) {
+        switch (c) {
+        case 's':
+            numSteps = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'w':
+            numWells = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'c':
+            numChanged = std::atoll(optarg);
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::vector<std::string> names(numWells);
+    for (std::size_t w = 0; w < numWells; ++w) {
+        names[w] = fmt::format("WELL-{:05}", w);
+    }
+
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<std::size_t> pick(0, numWells - 1);
+    auto newValue = [](const std::size_t step) { return std::make_shared<Value>(8, step); };
+
+    std::cout << "Report steps:  " << numSteps << '\n'
+              << "Wells:         " << numWells << '\n'
+              << "Changed/step:  " << numChanged << "\n\n";
+
+    // Full unordered_map in every snapshot.
+    {
+        const auto before = allocatedBytes;
+
+        std::vector<std::unordered_map<std::string, std::shared_ptr<Value>>> snapshots(numSteps);
+        for (const auto& name : names) {
+            snapshots[0].emplace(name, newValue(0));
+        }
+        for (std::size_t step = 1; step < numSteps; ++step) {
+            snapshots[step] = snapshots[step - 1];
+            for (std::size_t i = 0; i < numChanged; ++i) {
+                snapshots[step].insert_or_assign(names[pick(gen)], newValue(step));
+            }
+        }
+
+        std::cout << fmt::format("{:<40} {:12.2f} MiB\n", "Memory, unordered_map snapshots",
+                                 (allocatedBytes - before) / (1024.0 * 1024.0));
+    }
+
+    gen.seed(1234);
+
+    const auto before = allocatedBytes;
+
+    std::vector<Member> snapshots(numSteps);
+    for (const auto& name : names) {
+        snapshots[0].update(name, newValue(0));
+    }
+    for (std::size_t step = 1; step < numSteps; ++step) {
+        snapshots[step] = snapshots[step - 1];
+        for (std::size_t i = 0; i < numChanged; ++i) {
+            snapshots[step].update(names[pick(gen)], newValue(step));
+        }
+    }
+
+    std::cout << fmt::format("{:<40} {:12.2f} MiB\n\n", "Memory, map_member snapshots",
+                             (allocatedBytes - before) / (1024.0 * 1024.0));
+
+    reportPackSize("Serialized size, full", FullHistory { &snapshots });
+    reportPackSize("Serialized size, delta-encoded", DeltaHistory { &snapshots });
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,140 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nMicro-benchmark for evaluating a Tabulated1DFunction at many positions,\n"
+              << "comparing per-point eval() with the batched eval() over spans.\n"
+              << "Positions follow a random walk, like pressures of neighbouring cells.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-n Number of positions.  Default 10000000.\n"
+              << "-s Number of sampling points in table.  Default 20.\n"
+              << "-r Number of repetitions, best time is reported.  Default 3.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double bestTime(const int repeat, const std::function<void()>& f)
+{
+    auto best = std::chrono::duration<double>::max();
+
+    for (int i = 0; i < repeat; ++i) {
+        const auto start = std::chrono::steady_clock::now();
+        f();
+        best = std::min(best, std::chrono::duration<double> {
+                std::chrono::steady_clock::now() - start
+            });
+    }
+
+    return best.count();
+}
+
+void report(const std::string& what, const std::size_t num, const double seconds)
+{
+    std::cout << fmt::format("{:<36} {:10.4f} s {:10.2f} ns/point\n",
+                             what, seconds, 1.0e9 * seconds / num);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t num = 10'000'000;
+    std::size_t tableSize = 20;
+    int repeat = 3;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "n:s:r:h")) != -1) {
+        switch (c) {
+        case 'n':
+            num = std::atoll(optarg);
+            break;
+        case 's':
+            tableSize = std::max(2ll, std::atoll(optarg));
+            break;
+        case 'r':
+            repeat = std::max(1, std::atoi(optarg));
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Table resembling a PVT curve: dense sampling at low pressure.
+    std::vector<double> xs(tableSize), ys(tableSize);
+    for (std::size_t i = 0; i < tableSize; ++i) {
+        const double t = static_cast<double>(i) / (tableSize - 1);
+        xs[i] = 1.0e5 + 5.0e7*t*t;
+        ys[i] = 1.0 + 0.3*std::log1p(10.0*t);
+    }
+    const Opm::Tabulated1DFunction<double> table(xs, ys, /*sortInputs=*/false);
+
+    std::mt19937 gen(1234);
+    std::normal_distribution<double> step(0.0, 1.0e4);
+    std::vector<double> x(num);
+    double p = 2.0e7;
+    for (auto& xi : x) {
+        p = std::clamp(p + step(gen), table.xMin(), table.xMax());
+        xi = p;
+    }
+
+    std::vector<double> reference(num);
+    std::vector<double> result(num);
+
+    std::cout << "Table size: " << tableSize << '\n'
+              << "Positions:  " << num << "\n\n";
+
+    report("Per-point eval()", num, bestTime(repeat, [&]() {
+        for (std::size_t i = 0; i < num; ++i)
+            reference[i] = table.eval(x[i]);
+    }));
+
+    report("Batched eval()", num, bestTime(repeat, [&]() {
+        table.eval(std::span<const double>(x), std::span<double>(result));
+    }));
+
+    if (result != reference) {
+        std::cerr << "Batched evaluation differs from per-point evaluation\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
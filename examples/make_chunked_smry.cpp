@@ -0,0 +1,152 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <getopt.h>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "config.h"
+
+#if _OPENMP
+#include <omp.h>
+#endif
+
+#include <opm/io/eclipse/ChunkedSmryOutput.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+
+
+static void printHelp() {
+
+    std::cout << "\nThis program creates chunked, column oriented summary files (CSMRY), designed for\n"
+              << "loading time ranges of individual summary vectors from very large summary results.\n"
+              << "Input is one or more SMSPEC or ESMRY files.\n"
+              << "\nIn addition, the program takes these options (which must be given before the arguments):\n\n"
+              << "-c Maximum number of time steps per chunk.  Default no limit other than that of -m.\n"
+              << "-m Maximum memory in MiB used for buffering the time steps of a chunk.  Default 4.\n"
+              << "-f if CSMRY file exist, this will be replaced. Default behaviour is that existing file is kept.\n"
+              << "-n Maximum number of threads to be used if mulitple files should be created.\n"
+              << "-u Store summary vectors uncompressed.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+
+int main(int argc, char **argv) {
+
+    int c                          = 0;
+#ifdef _OPENMP
+    int max_threads = -1;
+#endif
+    bool force                     = false;
+
+    Opm::EclIO::ChunkedSmry::WriteOptions options;
+
+    while ((c = getopt(argc, argv, "c:fm:n:uh")) != -1) {
+        switch (c) {
+        case 'c':
+            options.chunkSize = std::max(1, atoi(optarg));
+            break;
+        case 'f':
+            force = true;
+            break;
+        case 'h':
+            printHelp();
+            return 0;
+        case 'm':
+            options.chunkBytes = static_cast<std::size_t>(std::max(1, atoi(optarg))) * 1024 * 1024;
+            break;
+        case 'n':
+#ifdef _OPENMP
+            max_threads = atoi(optarg);
+#else
+            std::cerr << "OpenMP is disabled - using single thread only\n";
+#endif
+            break;
+        case 'u':
+            options.codec = Opm::EclIO::ChunkedSmry::Codec::None;
+            break;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    int argOffset = optind;
+
+#ifdef _OPENMP
+    int available_threads = omp_get_max_threads();
+
+    if (max_threads < 0)
+        max_threads = available_threads-2;
+    else if (max_threads > (available_threads - 1))
+        max_threads = available_threads-1;
+
+    if (max_threads > (argc-argOffset))
+        max_threads = argc-argOffset;
+
+    omp_set_num_threads(std::max(max_threads, 1));
+#endif
+
+    auto lap0 = std::chrono::system_clock::now();
+
+    int num_files = argc-argOffset;
+    std::vector<bool> status(num_files, false);
+
+    #pragma omp parallel for
+    for (int f = 0; f < num_files; f ++){
+        std::filesystem::path inputFileName = argv[f + argOffset];
+
+        std::filesystem::path csmryFileName = inputFileName.parent_path() / inputFileName.stem();
+        csmryFileName = csmryFileName += ".CSMRY";
+
+        if (Opm::EclIO::fileExists(csmryFileName) && !force) {
+            std::cerr << "\n! Warning, " << csmryFileName.string()
+                      << " already exists, existing kept use option -f to replace this\n";
+            continue;
+        }
+
+        try {
+            if (inputFileName.extension() == ".ESMRY") {
+                Opm::EclIO::ExtESmry smry{ inputFileName.string() };
+                Opm::EclIO::makeChunkedSmryFile(smry, csmryFileName.string(), options);
+            } else {
+                Opm::EclIO::ESmry smry{ inputFileName.string() };
+                Opm::EclIO::makeChunkedSmryFile(smry, csmryFileName.string(), options);
+            }
+
+            status[f] = true;
+        } catch (const std::exception& e) {
+            std::cerr << "\n! Warning, could not convert summary file " << argv[f + argOffset]
+                      << ": " << e.what() << '\n';
+        }
+    }
+
+    const auto n_converted = std::ranges::count(status, true);
+
+    auto lap1 = std::chrono::system_clock::now();
+    std::chrono::duration<double> elapsed_seconds1 = lap1-lap0;
+    std::cout << "\nruntime for creating " << n_converted << " CSMRY files: " << elapsed_seconds1.count() << " seconds\n" << std::endl;
+
+    return 0;
+}
@@ -33,9 +33,55 @@
 
 #include <opm/msim/msim.hpp>
 
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <getopt.h>
+#include <iostream>
+#include <string>
 
-int main(int /* argc */, char** argv) {
-    std::string deck_file = argv[1];
+namespace {
+
+void printHelp()
+{
+    std::cout << "\nUsage: msim [-a <pending>] [-t] DECK\n"
+              << "\nRuns the mock simulator on DECK and writes its output files.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-a Write output on a background thread, with at most <pending>\n"
+              << "   time steps queued for output.\n"
+              << "-t Print the wall clock time of the simulation loop.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    int max_pending = 0;
+    bool report_time = false;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "a:th")) != -1) {
+        switch (c) {
+        case 'a':
+            max_pending = std::max(1, std::atoi(optarg));
+            break;
+        case 't':
+            report_time = true;
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (optind >= argc) {
+        printHelp();
+        return EXIT_FAILURE;
+    }
+
+    std::string deck_file = argv[optind];
     Opm::Parser parser;
     Opm::ParseContext parse_context;
     Opm::ErrorGuard error_guard;
@@ -55,5 +101,15 @@ int main(int /* argc */, char** argv) {
 
     Opm::msim msim(state, schedule);
     Opm::EclipseIO io(state, state.getInputGrid(), schedule, summary_config);
+    if (max_pending > 0) {
+        io.enableAsyncOutput(max_pending);
+    }
+
+    const auto start = std::chrono::steady_clock::now();
     msim.run(io, false);
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    if (report_time) {
+        std::cout << "Simulation loop: " << elapsed.count() << " s\n";
+    }
 }
@@ -0,0 +1,206 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#include <opm/material/densead/Evaluation.hpp>
+#include <opm/material/densead/Math.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <getopt.h>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+using Evaluation = Opm::DenseAd::Evaluation<double, 2>;
+using Options = Opm::SaturatedBrineTables<double>::Options;
+
+void printHelp()
+{
+    std::cout << "\nValidates the tabulated saturated properties of the CO2-brine and\n"
+              << "H2-brine PVT models against the analytic solubility model.  Tabulates\n"
+              << "the dissolution factor, inverse formation volume factor and viscosity\n"
+              << "and reports the largest relative error, in values and in pressure\n"
+              << "derivatives, at random temperatures and pressures within the tables,\n"
+              << "as well as the time per evaluation of both.\n"
+              << "\nThe program takes these options:\n\n"
+              << "-s Salinity, mass fraction of NaCl.  Default 0.1.\n"
+              << "-t Minimum temperature in degrees Celsius.  Default 20.\n"
+              << "-T Maximum temperature in degrees Celsius.  Default 150.\n"
+              << "-p Minimum pressure in bar.  Default 20.\n"
+              << "-P Maximum pressure in bar.  Default 600.\n"
+              << "-e Relative error tolerance of the tables.  Default 1e-4.\n"
+              << "-m Maximum number of points along each table axis.  Default 513.\n"
+              << "-n Number of random validation points.  Default 100000.\n"
+              << "-h Print help and exit.\n\n";
+}
+
+double elapsed(const std::function<void()>& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    f();
+    return std::chrono::duration<double> {
+        std::chrono::steady_clock::now() - start
+    }.count();
+}
+
+template <class Pvt>
+std::array<Evaluation, 3> saturatedProperties(const Pvt& pvt,
+                                              const Evaluation& T,
+                                              const Evaluation& p)
+{
+    return {
+        pvt.saturatedGasDissolutionFactor(0u, T, p),
+        pvt.saturatedInverseFormationVolumeFactor(0u, T, p),
+        pvt.saturatedViscosity(0u, T, p),
+    };
+}
+
+template <class Pvt>
+void validate(const std::string& name, const Pvt& analytic,
+              const Options& options, const std::size_t num)
+{
+    Pvt tabulated = analytic;
+    const double buildTime = elapsed([&]() { tabulated.tabulateSaturatedProperties(options); });
+    const auto& tables = tabulated.saturatedTables(0);
+
+    std::cout << fmt::format("{}\n"
+                             "  Table size:          {} x {} (temperature x pressure)\n"
+                             "  Tabulation time:     {:.3f} s\n"
+                             "  Midpoint error:      {:.3e}\n",
+                             name, tables.numTemperatures(), tables.numPressures(),
+                             buildTime, tables.maxError());
+
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> temperature(options.minTemperature, options.maxTemperature);
+    std::uniform_real_distribution<double> pressure(options.minPressure, options.maxPressure);
+
+    std::vector<std::array<Evaluation, 2>> points(num);
+    for (auto& [T, p] : points) {
+        T = Evaluation::createVariable(temperature(gen), 0);
+        p = Evaluation::createVariable(pressure(gen), 1);
+    }
+
+    std::vector<std::array<Evaluation, 3>> exact(num), approx(num);
+    const double analyticTime = elapsed([&]() {
+        for (std::size_t k = 0; k < num; ++k) {
+            exact[k] = saturatedProperties(analytic, points[k][0], points[k][1]);
+        }
+    });
+    const double tabulatedTime = elapsed([&]() {
+        for (std::size_t k = 0; k < num; ++k) {
+            approx[k] = saturatedProperties(tabulated, points[k][0], points[k][1]);
+        }
+    });
+
+    // Derivative errors are relative to the largest derivative found, as
+    // derivatives may vanish inside the range.
+    std::array<double, 3> valueError{}, derivError{}, derivScale{};
+    for (std::size_t k = 0; k < num; ++k) {
+        for (std::size_t i = 0; i < 3; ++i) {
+            derivScale[i] = std::max(derivScale[i], std::abs(exact[k][i].derivative(1)));
+        }
+    }
+    for (std::size_t k = 0; k < num; ++k) {
+        for (std::size_t i = 0; i < 3; ++i) {
+            valueError[i] = std::max(valueError[i],
+                                     std::abs(approx[k][i].value() - exact[k][i].value()) /
+                                     std::abs(exact[k][i].value()));
+            if (derivScale[i] > 0.0) {
+                derivError[i] = std::max(derivError[i],
+                                         std::abs(approx[k][i].derivative(1) - exact[k][i].derivative(1)) /
+                                         derivScale[i]);
+            }
+        }
+    }
+
+    const std::array<std::string, 3> properties { "Rs", "1/B", "viscosity" };
+    for (std::size_t i = 0; i < 3; ++i) {
+        std::cout << fmt::format("  Max error {:<10} {:.3e} (value) {:.3e} (d/dp)\n",
+                                 properties[i], valueError[i], derivError[i]);
+    }
+
+    std::cout << fmt::format("  Analytic:            {:10.2f} ns/point\n"
+                             "  Tabulated:           {:10.2f} ns/point\n\n",
+                             1.0e9 * analyticTime / num, 1.0e9 * tabulatedTime / num);
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv)
+{
+    double salinity = 0.1;
+    Options options { 273.15 + 20.0, 273.15 + 150.0, 20.0e5, 600.0e5 };
+    std::size_t num = 100'000;
+
+    int c = 0;
+    while ((c = getopt(argc, argv, "s:t:T:p:P:e:m:n:h")) != -1) {
+        switch (c) {
+        case 's':
+            salinity = std::atof(optarg);
+            break;
+        case 't':
+            options.minTemperature = 273.15 + std::atof(optarg);
+            break;
+        case 'T':
+            options.maxTemperature = 273.15 + std::atof(optarg);
+            break;
+        case 'p':
+            options.minPressure = 1.0e5 * std::atof(optarg);
+            break;
+        case 'P':
+            options.maxPressure = 1.0e5 * std::atof(optarg);
+            break;
+        case 'e':
+            options.tolerance = std::atof(optarg);
+            break;
+        case 'm':
+            options.maxPoints = std::max(3, std::atoi(optarg));
+            break;
+        case 'n':
+            num = std::max(1ll, std::atoll(optarg));
+            break;
+        case 'h':
+            printHelp();
+            return EXIT_SUCCESS;
+        default:
+            return EXIT_FAILURE;
+        }
+    }
+
+    const std::vector<double> regionSalinity { salinity };
+
+    validate("CO2-brine", Opm::BrineCo2Pvt<double>(regionSalinity), options, num);
+    validate("H2-brine", Opm::BrineH2Pvt<double>(regionSalinity), options, num);
+
+    return EXIT_SUCCESS;
+}
@@ -2,6 +2,7 @@
 #define ISIM_MAIN_HPP
 
 #include <opm/input/eclipse/EclipseState/EclipseState.hpp>
+#include <opm/input/eclipse/Schedule/Action/ConditionCache.hpp>
 #include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
@@ -75,6 +76,10 @@ private:
     std::map<std::string, std::map<data::Rates::opt, std::function<well_rate_function>>> well_rates;
     std::map<std::string, std::function<solution_function>> solutions;
 
+    // Operands and results of the last evaluation of each ACTIONX
+    // condition, used to skip re-evaluating unchanged conditions.
+    Action::ConditionCache action_conditions;
+
 public:
     Schedule schedule;
     Action::State action_state;
@@ -107,15 +107,23 @@ bool msim::run(EclipseIO& io, bool report_only)
                      report_step, time_step, io);
         }
 
+        if (! this->schedule[report_step].actions.get().empty()) {
+            // Actions may change the Schedule, which is read by pending
+            // asynchronous output.
+            io.flush();
+        }
+
         const auto sim_time = TimeService::from_time_t(schedule.simTime(report_step));
         auto action_applied = post_step(sol, well_data, group_nwrk_data, report_step, sim_time);
         any_actions_applied = any_actions_applied || action_applied;
 
         const auto& exit_status = schedule.exitStatus();
         if (exit_status.has_value()) {
+            io.flush();
             return any_actions_applied;
         }
     }
+    io.flush();
     return any_actions_applied;
 }
 
@@ -143,7 +151,7 @@ bool msim::post_step(data::Solution& /* sol */,
     };
 
     for (const auto& action : actions.pending(this->action_state, std::chrono::system_clock::to_time_t(sim_time))) {
-        const auto result = action->eval(context);
+        const auto result = this->action_conditions.eval(*action, context);
         if (result.conditionSatisfied()) {
             this->schedule.applyAction(report_step, *action, result.matches(),
                                        std::unordered_map<std::string,double>{}, true);
@@ -5,6 +5,7 @@ find_package(Boost REQUIRED)
 find_package(cJSON)
 find_package(fmt)
 find_package(QuadMath)
+find_package(Threads)
 
 if(TARGET opmcommon)
   get_property(opm-common_EMBEDDED_PYTHON TARGET opmcommon PROPERTY EMBEDDED_PYTHON)
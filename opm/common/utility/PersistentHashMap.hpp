@@ -0,0 +1,562 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_PERSISTENT_HASH_MAP_HPP
+#define OPM_PERSISTENT_HASH_MAP_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace Opm {
+
+/// Associative container with structural sharing between copies.
+///
+/// Implemented as a hash array mapped trie (HAMT).  Each trie level
+/// consumes five bits of the key's hash value and every node stores only
+/// its occupied slots.  Nodes are immutable once created and shared
+/// between all copies of a map, so copying a map is O(1) and an insertion
+/// or removal copies only the O(log n) nodes on the path to the affected
+/// element.  Typical use is a sequence of snapshots, each of which differs
+/// from its predecessor in only a few elements.
+///
+/// Iteration order is unspecified.  Maps holding the same keys iterate
+/// in the same order, except for keys with identical hash values.  Those
+/// are stored in a collision list whose order depends on the history of
+/// insertions and removals.
+///
+/// \tparam Key Key type.
+/// \tparam Value Mapped type.  Must be equality comparable for the
+/// purpose of diff().
+/// \tparam Hash Hash function for keys.
+/// \tparam KeyEqual Equality predicate for keys.
+template <typename Key,
+          typename Value,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class PersistentHashMap
+{
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<const Key, Value>;
+    using size_type = std::size_t;
+
+    class const_iterator;
+
+    /// Number of elements in map.
+    size_type size() const { return this->size_; }
+
+    /// Whether or not map is empty.
+    bool empty() const { return this->size_ == 0; }
+
+    /// Look up element by key.
+    ///
+    /// \param[in] key Element key.
+    ///
+    /// \return Mapped value of element.  Nullptr if no such element.
+    const Value* find(const Key& key) const
+    {
+        const auto hash = Hash{}(key);
+
+        const Node* node = this->root_.get();
+        for (auto depth = std::size_t{0}; node != nullptr; ++depth) {
+            if (depth == maxDepth) {
+                for (const auto& slot : node->slots) {
+                    if (KeyEqual{}(slot.entry->value.first, key)) {
+                        return &slot.entry->value.second;
+                    }
+                }
+
+                return nullptr;
+            }
+
+            const auto bit = bitAt(hash, depth);
+            if ((node->bitmap & bit) == 0) {
+                return nullptr;
+            }
+
+            const auto& slot = node->slots[slotIndex(node->bitmap, bit)];
+            if (slot.child == nullptr) {
+                return KeyEqual{}(slot.entry->value.first, key)
+                    ? &slot.entry->value.second : nullptr;
+            }
+
+            node = slot.child.get();
+        }
+
+        return nullptr;
+    }
+
+    /// Whether or not map contains an element with a particular key.
+    ///
+    /// \param[in] key Element key.
+    bool contains(const Key& key) const
+    {
+        return this->find(key) != nullptr;
+    }
+
+    /// Insert new element or replace value of existing element.
+    ///
+    /// \param[in] key Element key.
+    ///
+    /// \param[in] value Mapped value of element.
+    void insert_or_assign(const Key& key, Value value)
+    {
+        const auto hash = Hash{}(key);
+        auto entry = std::make_shared<const Entry>(Entry { hash, value_type { key, std::move(value) } });
+
+        auto added = false;
+        this->root_ = insert(this->root_.get(), 0, std::move(entry), added);
+
+        if (added) {
+            ++this->size_;
+        }
+    }
+
+    /// Remove element.
+    ///
+    /// \param[in] key Element key.
+    ///
+    /// \return Whether or not an element was removed.
+    bool erase(const Key& key)
+    {
+        auto root = NodePtr{};
+        if (! remove(this->root_, 0, Hash{}(key), key, root)) {
+            return false;
+        }
+
+        this->root_ = std::move(root);
+        --this->size_;
+
+        return true;
+    }
+
+    /// Remove all elements.
+    void clear()
+    {
+        this->root_.reset();
+        this->size_ = 0;
+    }
+
+    /// Start of element sequence.
+    const_iterator begin() const { return const_iterator { this->root_.get() }; }
+
+    /// End of element sequence.
+    const_iterator end() const { return const_iterator{}; }
+
+    /// Whether or not two maps are the same object, i.e., one is an
+    /// unmodified copy of the other.
+    ///
+    /// \param[in] that Other map.
+    bool isSameAs(const PersistentHashMap& that) const
+    {
+        return this->root_ == that.root_;
+    }
+
+    /// Enumerate differences between two maps.
+    ///
+    /// Skips all sub-trees which the maps have in common, so the cost is
+    /// proportional to the number of differences, rather than the number
+    /// of elements, when one map is derived from the other.
+    ///
+    /// \param[in] base Map from which to compute differences.
+    ///
+    /// \param[in] self Map to compare against \p base.
+    ///
+    /// \param[in] upsert Callback invoked as \code upsert(elem) \endcode
+    /// for each element in \p self which either does not exist or has a
+    /// different value in \p base.
+    ///
+    /// \param[in] erase Callback invoked as \code erase(key) \endcode for
+    /// each key in \p base which does not exist in \p self.
+    template <typename Upsert, typename Erase>
+    static void diff(const PersistentHashMap& base,
+                     const PersistentHashMap& self,
+                     Upsert&&                 upsert,
+                     Erase&&                  erase)
+    {
+        diffNodes(base.root_.get(), self.root_.get(), 0, upsert, erase);
+    }
+
+private:
+    /// Element along with its hash value.
+    struct Entry
+    {
+        std::size_t hash{};
+        value_type value;
+    };
+
+    struct Node;
+    using NodePtr = std::shared_ptr<const Node>;
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    /// Occupied position in trie node.  Exactly one of 'entry' and 'child'
+    /// is non-null.
+    struct Slot
+    {
+        EntryPtr entry{};
+        NodePtr child{};
+    };
+
+    /// Trie node.
+    ///
+    /// Nodes at maxDepth hold all elements with the same hash value in
+    /// 'slots', and do not use the 'bitmap'.
+    struct Node
+    {
+        /// Set of occupied positions.
+        std::uint32_t bitmap{0};
+
+        /// Occupied positions, ordered by position.
+        std::vector<Slot> slots{};
+    };
+
+    static constexpr std::size_t bitsPerLevel = 5;
+    static constexpr std::size_t maxDepth =
+        (std::numeric_limits<std::size_t>::digits + bitsPerLevel - 1) / bitsPerLevel;
+
+    NodePtr root_{};
+    size_type size_{0};
+
+    static std::uint32_t bitAt(const std::size_t hash, const std::size_t depth)
+    {
+        return std::uint32_t{1} << ((hash >> (bitsPerLevel * depth)) & ((1u << bitsPerLevel) - 1));
+    }
+
+    static std::size_t slotIndex(const std::uint32_t bitmap, const std::uint32_t bit)
+    {
+        return std::popcount(bitmap & (bit - 1));
+    }
+
+    static NodePtr insert(const Node*       node,
+                          const std::size_t depth,
+                          EntryPtr&&        entry,
+                          bool&             added)
+    {
+        auto copy = (node != nullptr)
+            ? std::make_shared<Node>(*node)
+            : std::make_shared<Node>();
+
+        if (depth == maxDepth) {
+            for (auto& slot : copy->slots) {
+                if (KeyEqual{}(slot.entry->value.first, entry->value.first)) {
+                    slot.entry = std::move(entry);
+                    return copy;
+                }
+            }
+
+            copy->slots.push_back(Slot { std::move(entry), {} });
+            added = true;
+
+            return copy;
+        }
+
+        const auto bit = bitAt(entry->hash, depth);
+        const auto idx = slotIndex(copy->bitmap, bit);
+
+        if ((copy->bitmap & bit) == 0) {
+            copy->bitmap |= bit;
+            copy->slots.insert(copy->slots.begin() + idx, Slot { std::move(entry), {} });
+            added = true;
+
+            return copy;
+        }
+
+        auto& slot = copy->slots[idx];
+        if (slot.child != nullptr) {
+            slot.child = insert(slot.child.get(), depth + 1, std::move(entry), added);
+        }
+        else if (KeyEqual{}(slot.entry->value.first, entry->value.first)) {
+            slot.entry = std::move(entry);
+        }
+        else {
+            // Two distinct keys in the same position.  Push both one level
+            // down.
+            auto existing = std::move(slot.entry);
+            auto ignore = false;
+
+            auto child = insert(nullptr, depth + 1, std::move(existing), ignore);
+            slot = Slot { {}, insert(child.get(), depth + 1, std::move(entry), added) };
+        }
+
+        return copy;
+    }
+
+    static bool remove(const NodePtr&    node,
+                       const std::size_t depth,
+                       const std::size_t hash,
+                       const Key&        key,
+                       NodePtr&          result)
+    {
+        if (node == nullptr) {
+            return false;
+        }
+
+        auto copy = std::shared_ptr<Node>{};
+
+        if (depth == maxDepth) {
+            auto pos = std::find_if(node->slots.begin(), node->slots.end(),
+                                    [&key](const Slot& slot)
+                                    { return KeyEqual{}(slot.entry->value.first, key); });
+
+            if (pos == node->slots.end()) {
+                return false;
+            }
+
+            copy = std::make_shared<Node>(*node);
+            copy->slots.erase(copy->slots.begin() + (pos - node->slots.begin()));
+        }
+        else {
+            const auto bit = bitAt(hash, depth);
+            if ((node->bitmap & bit) == 0) {
+                return false;
+            }
+
+            const auto idx = slotIndex(node->bitmap, bit);
+            const auto& slot = node->slots[idx];
+
+            auto child = NodePtr{};
+            if (slot.child != nullptr) {
+                if (! remove(slot.child, depth + 1, hash, key, child)) {
+                    return false;
+                }
+            }
+            else if (! KeyEqual{}(slot.entry->value.first, key)) {
+                return false;
+            }
+
+            copy = std::make_shared<Node>(*node);
+
+            if (child == nullptr) {
+                copy->bitmap &= ~bit;
+                copy->slots.erase(copy->slots.begin() + idx);
+            }
+            else if ((child->slots.size() == 1) && (child->slots.front().child == nullptr)) {
+                // Single remaining element in sub-tree.  Pull it up.
+                copy->slots[idx] = child->slots.front();
+            }
+            else {
+                copy->slots[idx].child = std::move(child);
+            }
+        }
+
+        if (! copy->slots.empty()) {
+            result = std::move(copy);
+        }
+
+        return true;
+    }
+
+    template <typename Function>
+    static void forEach(const Slot& slot, Function&& f)
+    {
+        if (slot.child == nullptr) {
+            f(slot.entry->value);
+            return;
+        }
+
+        forEach(slot.child.get(), f);
+    }
+
+    template <typename Function>
+    static void forEach(const Node* node, Function&& f)
+    {
+        if (node == nullptr) {
+            return;
+        }
+
+        for (const auto& slot : node->slots) {
+            forEach(slot, f);
+        }
+    }
+
+    template <typename Subtree>
+    static std::vector<const value_type*> elements(const Subtree& subtree)
+    {
+        auto elems = std::vector<const value_type*>{};
+        forEach(subtree, [&elems](const value_type& elem) { elems.push_back(&elem); });
+
+        return elems;
+    }
+
+    /// Differences between two small sets of elements, typically a
+    /// single element in one map and a sub-tree of elements sharing a
+    /// hash prefix in the other, or two collision lists.
+    template <typename Upsert, typename Erase>
+    static void diffElements(const std::vector<const value_type*>& baseElems,
+                             const std::vector<const value_type*>& selfElems,
+                             Upsert&                               upsert,
+                             Erase&                                erase)
+    {
+        auto findIn = [](const auto& elems, const Key& key) -> const value_type*
+        {
+            for (const auto* elem : elems) {
+                if (KeyEqual{}(elem->first, key)) {
+                    return elem;
+                }
+            }
+
+            return nullptr;
+        };
+
+        for (const auto* elem : selfElems) {
+            const auto* prev = findIn(baseElems, elem->first);
+            if ((prev == nullptr) || !(prev->second == elem->second)) {
+                upsert(*elem);
+            }
+        }
+
+        for (const auto* elem : baseElems) {
+            if (findIn(selfElems, elem->first) == nullptr) {
+                erase(elem->first);
+            }
+        }
+    }
+
+    template <typename Upsert, typename Erase>
+    static void diffNodes(const Node*       base,
+                          const Node*       self,
+                          const std::size_t depth,
+                          Upsert&           upsert,
+                          Erase&            erase)
+    {
+        if (base == self) {
+            return;
+        }
+
+        if ((base == nullptr) || (self == nullptr) || (depth == maxDepth)) {
+            diffElements(elements(base), elements(self), upsert, erase);
+            return;
+        }
+
+        for (auto bits = base->bitmap | self->bitmap; bits != 0; bits &= bits - 1) {
+            const auto bit = bits & (~bits + 1);
+
+            const auto* b = ((base->bitmap & bit) != 0)
+                ? &base->slots[slotIndex(base->bitmap, bit)] : nullptr;
+
+            const auto* s = ((self->bitmap & bit) != 0)
+                ? &self->slots[slotIndex(self->bitmap, bit)] : nullptr;
+
+            if (b == nullptr) {
+                forEach(*s, upsert);
+            }
+            else if (s == nullptr) {
+                forEach(*b, [&erase](const value_type& elem) { erase(elem.first); });
+            }
+            else if ((b->child != nullptr) && (s->child != nullptr)) {
+                diffNodes(b->child.get(), s->child.get(), depth + 1, upsert, erase);
+            }
+            else if (b->entry != s->entry) {
+                diffElements(elements(*b), elements(*s), upsert, erase);
+            }
+        }
+    }
+
+public:
+    /// Forward iterator over map elements.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = typename PersistentHashMap::value_type;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        /// Default constructor.  Creates end iterator.
+        const_iterator() = default;
+
+        reference operator*() const { return *this->current(); }
+        pointer operator->() const { return this->current(); }
+
+        const_iterator& operator++()
+        {
+            ++this->path_.back().second;
+            this->settle();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const const_iterator& that) const
+        {
+            return this->current() == that.current();
+        }
+
+    private:
+        friend class PersistentHashMap;
+
+        /// Nodes on path from root to current element, and position within
+        /// each node.
+        std::vector<std::pair<const Node*, std::size_t>> path_{};
+
+        explicit const_iterator(const Node* root)
+        {
+            if (root != nullptr) {
+                this->path_.emplace_back(root, 0);
+                this->settle();
+            }
+        }
+
+        pointer current() const
+        {
+            return this->path_.empty() ? nullptr
+                : &this->path_.back().first->slots[this->path_.back().second].entry->value;
+        }
+
+        /// Advance to first element at or after current position.
+        void settle()
+        {
+            while (! this->path_.empty()) {
+                const auto [node, idx] = this->path_.back();
+
+                if (idx == node->slots.size()) {
+                    this->path_.pop_back();
+                    if (! this->path_.empty()) {
+                        ++this->path_.back().second;
+                    }
+                }
+                else if (const auto& child = node->slots[idx].child; child != nullptr) {
+                    this->path_.emplace_back(child.get(), 0);
+                }
+                else {
+                    return;
+                }
+            }
+        }
+    };
+};
+
+} // namespace Opm
+
+#endif // OPM_PERSISTENT_HASH_MAP_HPP
@@ -266,4 +266,22 @@ const DeckView& Deck::global_view() const {
         return this->global_view().has_keyword(keyword);
     }
 
+    std::size_t Deck::releaseKeywords() {
+        auto bytes = this->keywordList.capacity() * sizeof(DeckKeyword);
+        for (const auto& keyword : this->keywordList) {
+            bytes += keyword.size() * sizeof(DeckRecord);
+            for (const auto& record : keyword) {
+                bytes += record.size() * sizeof(DeckItem);
+                for (const auto& item : record) {
+                    bytes += item.allocatedBytes();
+                }
+            }
+        }
+
+        std::vector<DeckKeyword>{}.swap(this->keywordList);
+        this->m_global_view.reset();
+
+        return bytes;
+    }
+
 }
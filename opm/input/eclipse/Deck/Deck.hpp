@@ -126,6 +126,12 @@ namespace Opm {
 
             void remove_keywords(int from, int to) { keywordList.erase(keywordList.begin() +from, keywordList.begin() + to); };
 
+            // Release all keywords, e.g. once the EclipseState and Schedule
+            // objects have been created.  The unit systems and the input
+            // path are kept.  Returns the approximate number of bytes
+            // released.
+            std::size_t releaseKeywords();
+
         private:
 
             std::vector< DeckKeyword > keywordList;
@@ -31,6 +31,9 @@
 #include <ostream>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
 
 namespace Opm {
 
@@ -46,13 +49,13 @@ const std::vector< int >& DeckItem::value_ref< int >() const {
     if( this->type != get_type< int >() )
         throw std::invalid_argument( "DeckItem::value_ref<int> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->ival;
+    return std::get< std::vector< int > >(this->values);
 }
 
 template<>
 const std::vector< double >& DeckItem::value_ref< double >() const {
     if (this->type == get_type<double>())
-        return this->dval;
+        return std::get< std::vector< double > >(this->values);
 
     throw std::invalid_argument( "DeckItem::value_ref<double> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 }
@@ -62,7 +65,7 @@ const std::vector< std::string >& DeckItem::value_ref< std::string >() const {
     if( this->type != get_type< std::string >() )
         throw std::invalid_argument( "DeckItem::value_ref<std::string> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->sval;
+    return std::get< std::vector< std::string > >(this->values);
 }
 
 template<>
@@ -70,7 +73,7 @@ const std::vector< RawString >& DeckItem::value_ref< RawString >() const {
     if( this->type != get_type< RawString >() )
         throw std::invalid_argument( "DeckItem::value_ref<RawString> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->rsval;
+    return std::get< std::vector< RawString > >(this->values);
 }
 
 template<>
@@ -78,58 +81,97 @@ const std::vector< UDAValue >& DeckItem::value_ref< UDAValue >() const {
     if( this->type != get_type< UDAValue >() )
         throw std::invalid_argument( "DeckItem::value_ref<UDAValue> Item of wrong type. this->type: " + tag_name(this->type) + " " + this->name());
 
-    return this->uval;
+    return std::get< std::vector< UDAValue > >(this->values);
 }
 
 
+namespace {
+
+std::shared_ptr<DeckItem::Descriptor>
+makeDescriptor(const std::string& name,
+               const std::vector<Dimension>& active_dim = {},
+               const std::vector<Dimension>& default_dim = {})
+{
+    return std::make_shared<DeckItem::Descriptor>(DeckItem::Descriptor {
+        name, active_dim, default_dim
+    });
+}
+
+const std::vector<Dimension> no_dimensions{};
+
+}
+
 DeckItem::DeckItem( const std::string& nm, int) :
+    values( std::vector< int >{} ),
     type( get_type< int >() ),
-    item_name( nm )
+    descriptor( makeDescriptor(nm) )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, std::string) :
+    values( std::vector< std::string >{} ),
     type( get_type< std::string >() ),
-    item_name( nm )
+    descriptor( makeDescriptor(nm) )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, RawString) :
+    values( std::vector< RawString >{} ),
     type( get_type< RawString >() ),
-    item_name( nm )
+    descriptor( makeDescriptor(nm) )
 {
 }
 
 
 DeckItem::DeckItem( const std::string& nm, double, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    values( std::vector< double >{} ),
     type( get_type< double >() ),
-    item_name( nm ),
-    active_dimensions(active_dim),
-    default_dimensions(default_dim)
+    descriptor( makeDescriptor(nm, active_dim, default_dim) )
 {
 }
 
 DeckItem::DeckItem( const std::string& nm, UDAValue, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim) :
+    values( std::vector< UDAValue >{} ),
     type( get_type< UDAValue >() ),
-    item_name( nm ),
-    active_dimensions(active_dim),
-    default_dimensions(default_dim)
+    descriptor( makeDescriptor(nm, active_dim, default_dim) )
+{
+}
+
+DeckItem::DeckItem( std::shared_ptr<Descriptor> desc, type_tag type_arg ) :
+    type( type_arg ),
+    descriptor( std::move(desc) )
 {
+    switch( this->type ) {
+    case type_tag::integer:
+        this->values = std::vector< int >{};
+        break;
+    case type_tag::fdouble:
+        this->values = std::vector< double >{};
+        break;
+    case type_tag::string:
+        this->values = std::vector< std::string >{};
+        break;
+    case type_tag::raw_string:
+        this->values = std::vector< RawString >{};
+        break;
+    case type_tag::uda:
+        this->values = std::vector< UDAValue >{};
+        break;
+    default:
+        throw std::invalid_argument( "DeckItem: Unsupported item type " + tag_name(this->type) );
+    }
 }
 
 DeckItem DeckItem::serializationTestObject()
 {
     DeckItem result;
-    result.dval = {1.0};
-    result.ival = {2};
-    result.sval = {"test1"};
-    result.uval = {UDAValue(3.0)};
+    result.values = std::vector< std::string >{"test1"};
     result.type = type_tag::string;
-    result.item_name = "test2";
+    result.descriptor = makeDescriptor("test2",
+                                       {Dimension::serializationTestObject()},
+                                       {Dimension::serializationTestObject()});
     result.value_status = {value::status::deck_value};
     result.raw_data = false;
-    result.active_dimensions = {Dimension::serializationTestObject()};
-    result.default_dimensions = {Dimension::serializationTestObject()};
 
     return result;
 }
@@ -138,11 +180,7 @@ DeckItem DeckItem::emptyStructuralCopy() const
 {
     auto ret = *this;
 
-    ret.dval .clear();
-    ret.ival .clear();
-    ret.sval .clear();
-    ret.rsval.clear();
-    ret.uval .clear();
+    std::visit([](auto& vals) { vals.clear(); }, ret.values);
 
     ret.value_status.clear();
     ret.raw_data = true;
@@ -151,7 +189,20 @@ DeckItem DeckItem::emptyStructuralCopy() const
 }
 
 const std::string& DeckItem::name() const {
-    return this->item_name;
+    static const std::string no_name{};
+    return this->descriptor ? this->descriptor->name : no_name;
+}
+
+const std::vector<Dimension>& DeckItem::getActiveDimensions() const {
+    return this->active_dimensions();
+}
+
+const std::vector<Dimension>& DeckItem::active_dimensions() const {
+    return this->descriptor ? this->descriptor->active_dimensions : no_dimensions;
+}
+
+const std::vector<Dimension>& DeckItem::default_dimensions() const {
+    return this->descriptor ? this->descriptor->default_dimensions : no_dimensions;
 }
 
 bool DeckItem::defaultApplied( std::size_t index ) const {
@@ -188,36 +239,36 @@ T DeckItem::get( std::size_t index ) const {
 template<>
 UDAValue DeckItem::get( std::size_t index ) const {
     auto value = this->value_ref<UDAValue>().at(index);
-    if (this->active_dimensions.empty())
+    if (this->active_dimensions().empty())
         return value;
 
     // The UDA value held internally by the DeckItem does not have dimension set
     // correctly we therefor need to create a new one with the correct dimension
     // attached before returning.
-    std::size_t dim_index = index % this->active_dimensions.size();
+    std::size_t dim_index = index % this->active_dimensions().size();
     if (value::defaulted(this->value_status[index])) {
         if (value.is<std::string>())
-            return UDAValue(value.get<std::string>(), this->default_dimensions[dim_index]);
+            return UDAValue(value.get<std::string>(), this->default_dimensions()[dim_index]);
         else
-            return UDAValue(this->default_dimensions[dim_index]);
+            return UDAValue(this->default_dimensions()[dim_index]);
     } else {
         if (value.is<std::string>())
-            return UDAValue(value.get<std::string>(), this->active_dimensions[dim_index]);
+            return UDAValue(value.get<std::string>(), this->active_dimensions()[dim_index]);
         else if (value.is<double>())
-            return UDAValue(value.get<double>(), this->active_dimensions[dim_index]);
+            return UDAValue(value.get<double>(), this->active_dimensions()[dim_index]);
         else
-            return UDAValue(this->active_dimensions[dim_index]);
+            return UDAValue(this->active_dimensions()[dim_index]);
     }
 }
 
 template <>
 void DeckItem::shrink_to_fit<int>() {
-    this->ival.shrink_to_fit();
+    this->value_ref< int >().shrink_to_fit();
 }
 
 template <>
 void DeckItem::shrink_to_fit<double>() {
-    this->dval.shrink_to_fit();
+    this->value_ref< double >().shrink_to_fit();
 }
 
 template <typename T>
@@ -322,6 +373,22 @@ void DeckItem::push_backDummyDefault( std::size_t n ) {
     this->value_status.insert( this->value_status.end(), n, value::status::empty_default );
 }
 
+template<typename T>
+void DeckItem::push_back( std::vector<T>&& new_values, std::vector<value::status>&& status ) {
+    if( new_values.size() != status.size() )
+        throw std::logic_error("Number of values and value status flags must match");
+
+    auto& val = this->value_ref< T >();
+    if( val.empty() && this->value_status.empty() ) {
+        val = std::move( new_values );
+        this->value_status = std::move( status );
+        return;
+    }
+
+    val.insert( val.end(), new_values.begin(), new_values.end() );
+    this->value_status.insert( this->value_status.end(), status.begin(), status.end() );
+}
+
 std::string DeckItem::getTrimmedString( std::size_t index ) const {
     return trim_copy(this->value_ref< std::string >().at(index));
 }
@@ -336,14 +403,14 @@ const std::vector<double>& DeckItem::getData() const {
     if (this->raw_data)
         return data;
 
-    const auto dim_size = this->active_dimensions.size();
+    const auto dim_size = this->active_dimensions().size();
     for( std::size_t index = 0; index < data.size(); index++ ) {
         const auto dimIndex = index % dim_size;
         if (value::defaulted(this->value_status[index])) {
-            const auto& dim = this->default_dimensions[dimIndex];
+            const auto& dim = this->default_dimensions()[dimIndex];
             data[ index ] = dim.convertSiToRaw( data[ index ] );
         } else {
-            const auto& dim = this->active_dimensions[dimIndex];
+            const auto& dim = this->active_dimensions()[dimIndex];
             data[ index ] = dim.convertSiToRaw( data[ index ] );
         }
     }
@@ -358,7 +425,7 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
         return data;
     }
 
-    if (this->active_dimensions.empty()) {
+    if (this->active_dimensions().empty()) {
         throw std::invalid_argument {
             "No dimension defined for item '"
             + this->name()
@@ -369,12 +436,12 @@ const std::vector<double>& DeckItem::getSIDoubleData() const
     // This is an unobservable state change - SIData is lazily converted to
     // SI units, so externally the object still behaves as const.
 
-    const auto dim_size = this->active_dimensions.size();
+    const auto dim_size = this->active_dimensions().size();
     const auto sz = data.size();
     for (auto index = 0*sz; index < sz; ++index) {
         const auto& dim = value::defaulted(this->value_status[index])
-            ? this->default_dimensions
-            : this->active_dimensions;
+            ? this->default_dimensions()
+            : this->active_dimensions();
 
         data[index] = dim[index % dim_size].convertRawToSi(data[index]);
     }
@@ -389,6 +456,28 @@ type_tag DeckItem::getType() const {
     return this->type;
 }
 
+std::size_t DeckItem::allocatedBytes() const {
+    auto bytes = this->value_status.capacity() * sizeof(value::status);
+
+    std::visit([&bytes](const auto& vals)
+    {
+        using T = typename std::decay_t<decltype(vals)>::value_type;
+
+        bytes += vals.capacity() * sizeof(T);
+
+        if constexpr (std::is_base_of_v<std::string, T>) {
+            const auto local_capacity = std::string{}.capacity();
+            for (const auto& value : vals) {
+                if (value.capacity() > local_capacity) {
+                    bytes += value.capacity() + 1;
+                }
+            }
+        }
+    }, this->values);
+
+    return bytes;
+}
+
 
 
 template< typename T >
@@ -405,7 +494,7 @@ void DeckItem::write_vector(DeckOutput& stream, const std::vector<T>& data) cons
 void DeckItem::write(DeckOutput& stream) const {
     switch( this->type ) {
     case type_tag::integer:
-        this->write_vector( stream, this->ival );
+        this->write_vector( stream, this->value_ref< int >() );
         break;
     case type_tag::fdouble:
         {
@@ -414,13 +503,13 @@ void DeckItem::write(DeckOutput& stream) const {
             break;
         }
     case type_tag::string:
-        this->write_vector( stream,  this->sval );
+        this->write_vector( stream, this->value_ref< std::string >() );
         break;
     case type_tag::raw_string:
-        this->write_vector( stream,  this->rsval );
+        this->write_vector( stream, this->value_ref< RawString >() );
         break;
     case type_tag::uda:
-        this->write_vector( stream,  this->uval );
+        this->write_vector( stream, this->value_ref< UDAValue >() );
         break;
     default:
         throw std::logic_error( "DeckItem::write: Type not set." );
@@ -457,7 +546,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
     if (this->data_size() != other.data_size())
         return false;
 
-    if (this->item_name != other.item_name)
+    if (this->name() != other.name())
         return false;
 
     if (cmp_default)
@@ -466,11 +555,11 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
 
     switch( this->type ) {
     case type_tag::integer:
-        if (this->ival != other.ival)
+        if (this->value_ref< int >() != other.value_ref< int >())
             return false;
         break;
     case type_tag::string:
-        if (this->sval != other.sval)
+        if (this->value_ref< std::string >() != other.value_ref< std::string >())
             return false;
         break;
     case type_tag::fdouble:
@@ -485,7 +574,7 @@ bool DeckItem::equal(const DeckItem& other, bool cmp_default, bool cmp_numeric)
             }
         } else {
             if (this->raw_data == other.raw_data)
-                return (this->dval == other.dval);
+                return (this->value_ref< double >() == other.value_ref< double >());
             else {
                 const auto& this_data = this->getData<double>();
                 const auto& other_data = other.getData<double>();
@@ -549,7 +638,8 @@ bool DeckItem::to_bool(std::string string_value) {
 
 void DeckItem::reserve_additionalRawString(std::size_t n)
 {
-    this->rsval.reserve(rsval.size() + n);
+    auto& rsval = this->value_ref< RawString >();
+    rsval.reserve(rsval.size() + n);
 }
 
 /*
@@ -568,6 +658,9 @@ template void DeckItem::push_backDummyDefault<std::string>( std::size_t );
 template void DeckItem::push_backDummyDefault<RawString>( std::size_t );
 template void DeckItem::push_backDummyDefault<UDAValue>( std::size_t );
 
+template void DeckItem::push_back<int>( std::vector<int>&&, std::vector<value::status>&& );
+template void DeckItem::push_back<double>( std::vector<double>&&, std::vector<value::status>&& );
+
 template std::vector<int>& DeckItem::getData<int>();
 template std::vector<double>& DeckItem::getData<double>();
 
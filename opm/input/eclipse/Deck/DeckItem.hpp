@@ -29,7 +29,9 @@
 
 #include <cstddef>
 #include <iosfwd>
+#include <memory>
 #include <string>
+#include <variant>
 #include <vector>
 
 namespace Opm {
@@ -37,6 +39,27 @@ namespace Opm {
 
     class DeckItem {
     public:
+        /*
+          The name and unit dimensions of an item.  All items scanned from
+          the same ParserItem, with the same unit systems, share a single
+          Descriptor instead of holding their own copies.  A Descriptor is
+          never modified once it is shared between items.
+        */
+        struct Descriptor {
+            std::string name{};
+            std::vector<Dimension> active_dimensions{};
+            std::vector<Dimension> default_dimensions{};
+
+            bool operator==(const Descriptor& other) const = default;
+
+            template<class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                serializer(name);
+                serializer(active_dimensions);
+                serializer(default_dimensions);
+            }
+        };
 
         DeckItem() = default;
         DeckItem( const std::string&, int);
@@ -46,6 +69,7 @@ namespace Opm {
         DeckItem( const std::string&, UDAValue) = delete;
         DeckItem( const std::string&, UDAValue, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim);
         DeckItem( const std::string&, double, const std::vector<Dimension>& active_dim, const std::vector<Dimension>& default_dim);
+        DeckItem( std::shared_ptr<Descriptor> descriptor, type_tag type );
 
         static DeckItem serializationTestObject();
         DeckItem emptyStructuralCopy() const;
@@ -79,10 +103,7 @@ namespace Opm {
 
         const std::vector< double >& getSIDoubleData() const;
         const std::vector<value::status>& getValueStatus() const;
-        const std::vector<Dimension>& getActiveDimensions() const
-        {
-            return this->active_dimensions;
-        }
+        const std::vector<Dimension>& getActiveDimensions() const;
 
         template< typename T>
         void shrink_to_fit();
@@ -106,8 +127,16 @@ namespace Opm {
         template <typename T>
         void push_backDummyDefault( std::size_t n = 1 );
 
+        // append values scanned in bulk, one status per value
+        template <typename T>
+        void push_back( std::vector<T>&& new_values, std::vector<value::status>&& status );
+
         type_tag getType() const;
 
+        // approximate heap memory held by the item's values, in bytes; the
+        // shared descriptor is not included
+        std::size_t allocatedBytes() const;
+
         void write(DeckOutput& writer) const;
         friend std::ostream& operator<<(std::ostream& os, const DeckItem& item);
 
@@ -137,45 +166,46 @@ namespace Opm {
         bool is_string() { return  type == get_type< std::string >(); };
         bool is_raw_string() { return  type == get_type< RawString >(); };
 
-        UDAValue& get_uda() { return uval[0]; };
+        UDAValue& get_uda() { return std::get< std::vector< UDAValue > >(values)[0]; };
 
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
-            serializer(dval);
-            serializer(ival);
-            serializer(sval);
-            serializer(rsval);
-            serializer(uval);
+            serializer(values);
             serializer(type);
-            serializer(item_name);
+            serializer(descriptor);
             serializer(value_status);
             serializer(raw_data);
-            serializer(active_dimensions);
-            serializer(default_dimensions);
         }
 
         void reserve_additionalRawString(std::size_t);
 
     private:
-        mutable std::vector< double > dval;
-        std::vector< int > ival;
-        std::vector< std::string > sval;
-        std::vector< RawString > rsval;
-        std::vector< UDAValue > uval;
+        /*
+          Only the vector matching the item's type is ever used, so the
+          values are held in a variant rather than in one vector per type.
+        */
+        using Values = std::variant< std::vector< double >,
+                                     std::vector< int >,
+                                     std::vector< std::string >,
+                                     std::vector< RawString >,
+                                     std::vector< UDAValue > >;
+
+        mutable Values values;
 
         type_tag type = type_tag::unknown;
 
-        std::string item_name;
+        std::shared_ptr<Descriptor> descriptor;
         std::vector<value::status> value_status;
         /*
-          To save space we mutate the dval object in place when asking for SI
-          data; the current state of of the dval member is tracked with the
+          To save space we mutate the double values in place when asking for
+          SI data; the current state of the values is tracked with the
           raw_data bool member.
         */
         mutable bool raw_data = true;
-        std::vector< Dimension > active_dimensions;
-        std::vector< Dimension > default_dimensions;
+
+        const std::vector< Dimension >& active_dimensions() const;
+        const std::vector< Dimension >& default_dimensions() const;
 
         template< typename T > std::vector< T >& value_ref();
         template< typename T > const std::vector< T >& value_ref() const;
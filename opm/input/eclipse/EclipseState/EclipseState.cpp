@@ -43,6 +43,8 @@
 #include <opm/input/eclipse/EclipseState/SimulationConfig/SimulationConfig.hpp>
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 
+#include <opm/input/eclipse/Schedule/Schedule.hpp>
+
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
@@ -383,6 +385,29 @@ namespace Opm {
         this->field_props.prune_global_for_schedule_run();
     }
 
+    EclipseState::CompactionReport EclipseState::compact(const Schedule& schedule)
+    {
+        auto report = CompactionReport{};
+
+        if (! schedule.isFullyLoaded()) {
+            return report;
+        }
+
+        report.field_props = this->field_props.compact();
+        report.grid = this->m_inputGrid.compact();
+
+        return report;
+    }
+
+    EclipseState::CompactionReport EclipseState::compact(const Schedule& schedule, Deck& deck)
+    {
+        auto report = this->compact(schedule);
+
+        report.deck = deck.releaseKeywords();
+
+        return report;
+    }
+
     void EclipseState::reset_actnum(const std::vector<int>& new_actnum) {
         this->field_props.reset_actnum(new_actnum);
     }
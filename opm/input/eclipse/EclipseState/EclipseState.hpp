@@ -54,6 +54,7 @@ namespace Opm {
     class InitConfig;
     class IOConfig;
     class DeckSection;
+    class Schedule;
 } // namespace Opm
 
 namespace Opm { namespace RestartIO {
@@ -72,6 +73,25 @@ namespace Opm {
             AllProperties = IntProperties | DoubleProperties
         };
 
+        /// Heap memory released by compact(), in bytes per subsystem.
+        struct CompactionReport
+        {
+            /// Keywords of the input deck.
+            std::size_t deck{0};
+
+            /// Field properties.
+            std::size_t field_props{0};
+
+            /// Input grid.
+            std::size_t grid{0};
+
+            /// Total over all subsystems.
+            std::size_t total() const
+            {
+                return this->deck + this->field_props + this->grid;
+            }
+        };
+
         EclipseState() = default;
         explicit EclipseState(const Deck& deck);
         virtual ~EclipseState() = default;
@@ -139,6 +159,25 @@ namespace Opm {
         const Co2StoreConfig& getCo2StoreConfig() const;
 
         void prune_global_for_schedule_run();
+
+        /// Release input data which the simulator does not need once the
+        /// simulation grid and the Schedule have been built and the EGRID
+        /// and INIT files have been written.
+        ///
+        /// Releases the global copies of field properties which are local
+        /// in the SCHEDULE section, capacity left behind by reset_actnum(),
+        /// and the unprocessed COORD/ZCORN arrays of the input grid.
+        ///
+        /// A lazily loaded Schedule reads the field properties and the
+        /// input grid when it loads its remaining report steps, so these
+        /// are left alone until all report steps of the Schedule have been
+        /// loaded.
+        ///
+        /// \param[in] schedule Schedule built from this EclipseState.
+        CompactionReport compact(const Schedule& schedule);
+
+        /// Like compact(), and also release the keywords of the input deck.
+        CompactionReport compact(const Schedule& schedule, Deck& deck);
         void reset_actnum(const std::vector<int>& new_actnum);
         void set_active_indices(const std::vector<int>& indices);
         void pruneDeactivatedAquiferConnections(const std::vector<std::size_t>& deactivated_cells);
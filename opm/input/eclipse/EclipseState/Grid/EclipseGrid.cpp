@@ -621,6 +621,21 @@ EclipseGrid::EclipseGrid(const Deck& deck, const int * actnum)
     }
 
 
+    std::size_t EclipseGrid::compact() {
+        auto release = [](std::optional<std::vector<double>>& array)
+        {
+            const auto bytes = array.has_value()
+                ? array->capacity() * sizeof(double) : std::size_t{0};
+
+            array.reset();
+            return bytes;
+        };
+
+        return release(this->m_input_coord)
+            +  release(this->m_input_zcorn)
+            +  release(this->active_volume);
+    }
+
     const std::vector<double>& EclipseGrid::getMinpvVector( ) const {
         return m_minpvVector;
     }
@@ -1781,6 +1796,19 @@ std::vector<double> EclipseGrid::createDVector(const std::array<int,3>& dims, st
         }
     }
 
+    std::array<std::array<double, 3>, 8> EclipseGrid::getCornerPositions(std::size_t globalIndex) const {
+        std::array<double,8> X;
+        std::array<double,8> Y;
+        std::array<double,8> Z;
+        this->getCellCorners(globalIndex, X, Y, Z);
+
+        std::array<std::array<double, 3>, 8> corners;
+        for (std::size_t c = 0; c < 8; c++)
+            corners[c] = {{X[c], Y[c], Z[c]}};
+
+        return corners;
+    }
+
     bool EclipseGrid::isValidCellGeomtry(const std::size_t globalIndex,
                                          const UnitSystem& usys) const
     {
@@ -246,6 +246,8 @@ namespace Opm {
         std::array<double, 3> getCellCenter(std::size_t i,std::size_t j, std::size_t k) const;
         std::array<double, 3> getCellCenter(std::size_t globalIndex) const;
         std::array<double, 3> getCornerPos(std::size_t i,std::size_t j, std::size_t k, std::size_t corner_index) const;
+        /// \brief get all eight corners of a cell, in the order of getCornerPos()
+        std::array<std::array<double, 3>, 8> getCornerPositions(std::size_t globalIndex) const;
         const std::vector<double>& activeVolume() const;
         double getCellVolume(std::size_t globalIndex) const;
         double getCellVolume(std::size_t i , std::size_t j , std::size_t k) const;
@@ -301,6 +303,16 @@ namespace Opm {
         void resetACTNUM();
         void resetACTNUM( const std::vector<int>& actnum);
 
+        /// Release memory not needed once the simulation grid is built.
+        ///
+        /// Drops the unprocessed COORD and ZCORN input arrays and the cache
+        /// of active cell volumes, which is recomputed on demand.  An EGRID
+        /// file written afterwards holds the processed corner-point
+        /// geometry, like one written after an earlier call to save().
+        ///
+        /// \return Number of bytes released.
+        std::size_t compact();
+
         /// \brief Sets MINPVV if MINPV and MINPORV are not used
         void setMINPVV(const std::vector<double>& minpvv);
         /// \brief Sets DEPTH values for active cells if present in EDIT.
@@ -151,6 +151,38 @@ namespace Opm::Fieldprops {
             Fieldprops::compress(this->value_status, active_map, this->numValuePerCell());
         }
 
+        /// Heap memory allocated for the values and their status, in bytes.
+        std::size_t allocatedBytes() const
+        {
+            auto bytes = this->data.capacity() * sizeof(T)
+                + this->value_status.capacity() * sizeof(value::status);
+
+            if (this->global_data) {
+                bytes += this->global_data->capacity() * sizeof(T);
+            }
+
+            if (this->global_value_status) {
+                bytes += this->global_value_status->capacity() * sizeof(value::status);
+            }
+
+            return bytes;
+        }
+
+        /// Release unused capacity, e.g., left behind by compress().
+        void shrink_to_fit()
+        {
+            this->data.shrink_to_fit();
+            this->value_status.shrink_to_fit();
+
+            if (this->global_data) {
+                this->global_data->shrink_to_fit();
+            }
+
+            if (this->global_value_status) {
+                this->global_value_status->shrink_to_fit();
+            }
+        }
+
         void checkInitialisedCopy(const FieldData&                    src,
                                   const std::vector<Box::cell_index>& index_list,
                                   const std::string&                  from,
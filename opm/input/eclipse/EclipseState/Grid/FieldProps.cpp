@@ -1037,6 +1037,41 @@ void FieldProps::prune_global_for_schedule_run()
         }
     }
 }
+
+std::size_t FieldProps::compact()
+{
+    auto allocated_bytes = [this]()
+    {
+        auto bytes = this->cell_volume.capacity() * sizeof(double);
+
+        for (const auto& data : this->double_data) {
+            bytes += data.second.allocatedBytes();
+        }
+
+        for (const auto& data : this->int_data) {
+            bytes += data.second.allocatedBytes();
+        }
+
+        return bytes;
+    };
+
+    const auto before = allocated_bytes();
+
+    this->prune_global_for_schedule_run();
+
+    for (auto& data : this->double_data) {
+        data.second.shrink_to_fit();
+    }
+
+    for (auto& data : this->int_data) {
+        data.second.shrink_to_fit();
+    }
+
+    this->cell_volume.shrink_to_fit();
+
+    return before - allocated_bytes();
+}
+
 void FieldProps::distribute_toplayer(Fieldprops::FieldData<double>& field_data,
                                      const std::vector<double>& deck_data,
                                      const Box& box)
@@ -539,6 +539,15 @@ public:
 
     void prune_global_for_schedule_run();
 
+    /// Release memory not needed once the simulation has started.
+    ///
+    /// Prunes the global copies of keywords which are local in the
+    /// SCHEDULE section, like prune_global_for_schedule_run(), and
+    /// releases capacity left behind by reset_actnum().
+    ///
+    /// \return Number of bytes released.
+    std::size_t compact();
+
     void apply_numerical_aquifers(const NumericalAquifers& numerical_aquifers);
 
     const std::string& default_region() const;
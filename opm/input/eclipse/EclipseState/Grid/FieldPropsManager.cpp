@@ -247,6 +247,11 @@ void FieldPropsManager::prune_global_for_schedule_run()
     this->fp->prune_global_for_schedule_run();
 }
 
+std::size_t FieldPropsManager::compact()
+{
+    return this->fp->compact();
+}
+
 
 void FieldPropsManager::set_active_indices(const std::vector<int>& indices)
 {
@@ -19,6 +19,7 @@
 #ifndef FIELDPROPS_MANAGER_HPP
 #define FIELDPROPS_MANAGER_HPP
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -255,6 +256,11 @@ public:
 
     void prune_global_for_schedule_run();
 
+    /// Release memory not needed once the simulation has started.
+    ///
+    /// \return Number of bytes released.
+    std::size_t compact();
+
     void set_active_indices(const std::vector<int>& indices);
 
 private:
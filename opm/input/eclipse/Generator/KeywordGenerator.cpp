@@ -25,14 +25,17 @@
 
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
+#include <algorithm>
 #include <cctype>
 #include <filesystem>
 #include <fstream>
 #include <map>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include <fmt/format.h>
+#include <fmt/ranges.h>
 
 namespace {
 
@@ -253,8 +256,20 @@ void Opm::ParserKeywords::addDefaultKeywords{0}([[maybe_unused]] Parser& p)
 )",
                                      first_char);
 
+            // Keywords are constructed on first lookup, except those which
+            // match a regular expression or delimit code blocks since the
+            // parser needs them before any lookup by deck name.
             for (const auto& kw : keywords) {
-                sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                if (kw.hasMatchRegex() || kw.isCodeKeyword() || kw.deck_names().empty()) {
+                    sourceStr << fmt::format("    p.addParserKeyword({}{{}});", kw.className()) << '\n';
+                    continue;
+                }
+
+                auto deck_names = std::vector<std::string>(kw.deck_names().begin(), kw.deck_names().end());
+                std::ranges::sort(deck_names);
+
+                sourceStr << fmt::format("    p.addLazyParserKeyword({{\"{}\"}}, []() -> ParserKeyword {{ return {}{{}}; }});",
+                                         fmt::join(deck_names, "\", \""), kw.className()) << '\n';
             }
 
             // End of Opm::ParserKeywords::addDefaultKeywords{0}()
@@ -0,0 +1,307 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+
+#include <opm/common/utility/FileSystem.hpp>
+#include <opm/common/utility/MemPacker.hpp>
+#include <opm/common/utility/Serializer.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // Bump the last character whenever the layout of the file, or of the
+    // serialized Deck, changes.
+    constexpr auto magic = std::array<char, 8> { 'O', 'P', 'M', 'D', 'E', 'C', 'K', '3' };
+
+    // Identifies the digest of the input files, stored in the header.
+    // 1: 64-bit FNV-1a over the file's bytes and then its size as eight
+    //    little endian bytes.
+    constexpr std::uint32_t digest_algorithm = 1;
+
+    /// Serializer with access to its buffer, so that the packed data can
+    /// be written to and read from file.
+    class BufferSerializer : public Opm::Serializer<Opm::Serialization::MemPacker>
+    {
+    public:
+        BufferSerializer()
+            : Opm::Serializer<Opm::Serialization::MemPacker>(packer_)
+        {}
+
+        std::vector<char>& buffer() { return this->m_buffer; }
+
+    private:
+        inline static const Opm::Serialization::MemPacker packer_{};
+    };
+
+    struct Header
+    {
+        std::uint32_t digest_algorithm{};
+        std::uint64_t config_hash{};
+        std::vector<Opm::DeckCache::InputFile> input_files{};
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(digest_algorithm);
+            serializer(config_hash);
+            serializer(input_files);
+        }
+    };
+
+    std::optional<std::string> readContent(const std::filesystem::path& path)
+    {
+        std::ifstream is(path, std::ios::binary);
+        if (! is)
+            return std::nullopt;
+
+        return std::string { std::istreambuf_iterator<char>(is),
+                             std::istreambuf_iterator<char>() };
+    }
+
+    /// Whether or not an input file is unchanged since it was recorded.
+    bool isCurrent(const Opm::DeckCache::InputFile& file)
+    {
+        std::error_code ec;
+        const auto size = std::filesystem::file_size(file.path, ec);
+        if (ec || (size != file.size))
+            return false;
+
+        const auto mtime = std::filesystem::last_write_time(file.path, ec);
+        if (ec)
+            return false;
+
+        if (mtime.time_since_epoch().count() == file.mtime)
+            return true;
+
+        const auto content = readContent(file.path);
+        return content.has_value()
+            && (Opm::DeckCache::digest(*content) == file.hash);
+    }
+
+    bool readBlock(std::istream& is, std::vector<char>& block)
+    {
+        std::uint64_t size{};
+        if (! is.read(reinterpret_cast<char*>(&size), sizeof size))
+            return false;
+
+        // A corrupt length must not make us allocate more than the file
+        // can possibly hold.
+        const auto pos = is.tellg();
+        if (! is.seekg(0, std::ios::end))
+            return false;
+
+        const auto end = is.tellg();
+        if ((pos < 0) || (end < pos) || ! is.seekg(pos))
+            return false;
+
+        if (size > static_cast<std::uint64_t>(end - pos))
+            return false;
+
+        block.resize(size);
+        return static_cast<bool>(is.read(block.data(), size));
+    }
+
+    void writeBlock(std::ostream& os, const std::vector<char>& block)
+    {
+        const std::uint64_t size = block.size();
+        os.write(reinterpret_cast<const char*>(&size), sizeof size);
+        os.write(block.data(), block.size());
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+DeckCache::DeckCache(const std::filesystem::path& cacheFile)
+    : cache_file(cacheFile)
+{}
+
+std::uint64_t DeckCache::digest(std::string_view content)
+{
+    constexpr auto offset_basis = std::uint64_t{14695981039346656037ULL};
+    constexpr auto prime = std::uint64_t{1099511628211ULL};
+
+    auto hash = offset_basis;
+    auto add_byte = [&hash](const unsigned char byte)
+    {
+        hash ^= byte;
+        hash *= prime;
+    };
+
+    for (const auto c : content) {
+        add_byte(static_cast<unsigned char>(c));
+    }
+
+    const auto size = static_cast<std::uint64_t>(content.size());
+    for (auto i = 0; i < 8; ++i) {
+        add_byte(static_cast<unsigned char>((size >> (8 * i)) & 0xFF));
+    }
+
+    return hash;
+}
+
+std::optional<DeckCache::InputFile>
+DeckCache::inputFile(const std::filesystem::path& path,
+                     const std::filesystem::file_time_type mtime,
+                     std::string_view content)
+{
+    std::error_code ec;
+    const auto abs_path = std::filesystem::absolute(path, ec);
+    if (ec)
+        return std::nullopt;
+
+    return InputFile {
+        abs_path.generic_string(),
+        static_cast<std::uint64_t>(content.size()),
+        static_cast<std::int64_t>(mtime.time_since_epoch().count()),
+        digest(content)
+    };
+}
+
+std::optional<DeckCache::InputFile>
+DeckCache::inputFile(const std::filesystem::path& path)
+{
+    std::error_code ec;
+    const auto mtime = std::filesystem::last_write_time(path, ec);
+    if (ec)
+        return std::nullopt;
+
+    const auto content = readContent(path);
+    if (! content.has_value())
+        return std::nullopt;
+
+    return inputFile(path, mtime, *content);
+}
+
+std::filesystem::path
+DeckCache::cacheFileName(const std::filesystem::path& cacheDirectory,
+                         const std::filesystem::path& dataFile)
+{
+    std::error_code ec;
+    auto full_path = std::filesystem::weakly_canonical(dataFile, ec);
+    if (ec)
+        full_path = std::filesystem::absolute(dataFile);
+
+    const auto path_hash = digest(full_path.generic_string());
+
+    return cacheDirectory / fmt::format("{}-{:016x}.OPMDECK",
+                                        dataFile.stem().string(), path_hash);
+}
+
+std::optional<Deck> DeckCache::load(const std::size_t configHash) const
+{
+    std::ifstream is(this->cache_file, std::ios::binary);
+    if (! is)
+        return std::nullopt;
+
+    auto file_magic = std::array<char, magic.size()>{};
+    if (! is.read(file_magic.data(), file_magic.size()) || (file_magic != magic))
+        return std::nullopt;
+
+    try {
+        BufferSerializer ser;
+
+        Header header;
+        if (! readBlock(is, ser.buffer()))
+            return std::nullopt;
+
+        ser.unpack(header);
+        if ((header.digest_algorithm != digest_algorithm) ||
+            (header.config_hash != configHash))
+        {
+            return std::nullopt;
+        }
+
+        for (const auto& file : header.input_files) {
+            if (! isCurrent(file))
+                return std::nullopt;
+        }
+
+        if (! readBlock(is, ser.buffer()))
+            return std::nullopt;
+
+        Deck deck;
+        ser.unpack(deck);
+        return deck;
+    }
+    catch (const std::exception&) {
+        // Truncated or otherwise corrupt cache file.  Treat as a miss.
+        return std::nullopt;
+    }
+}
+
+bool DeckCache::store(const Deck& deck,
+                      const std::vector<InputFile>& inputFiles,
+                      const std::size_t configHash) const
+{
+    const Header header { digest_algorithm, configHash, inputFiles };
+
+    const auto tmp_file = std::filesystem::path {
+        this->cache_file.string() + "." + unique_path("%%%%%%%%")
+    };
+
+    {
+        std::ofstream os(tmp_file, std::ios::binary);
+        if (! os)
+            return false;
+
+        os.write(magic.data(), magic.size());
+
+        BufferSerializer ser;
+        ser.pack(header);
+        writeBlock(os, ser.buffer());
+
+        ser.pack(deck);
+        writeBlock(os, ser.buffer());
+
+        if (! os) {
+            os.close();
+            std::error_code ec;
+            std::filesystem::remove(tmp_file, ec);
+            return false;
+        }
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tmp_file, this->cache_file, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_file, ec);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace Opm
@@ -0,0 +1,152 @@
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_DECK_CACHE_HPP
+#define OPM_DECK_CACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Opm {
+
+    class Deck;
+
+    /// Persistent binary copy of a parsed Deck.
+    ///
+    /// The cache file holds the serialized deck together with a record
+    /// of every input file that went into it: the main .DATA file and all
+    /// INCLUDE files.  Each record stores the file's size, modification
+    /// time and a digest of the contents which the parser read.  The
+    /// digest is the 64-bit FNV-1a hash of the file's bytes followed by
+    /// the file size as eight little endian bytes, so it is the same on
+    /// every platform and in every build.  A cached deck is only returned
+    /// if
+    ///
+    ///   1. The configuration hash matches.  The parser uses this for
+    ///      everything besides the input files which changes the deck,
+    ///      like the set of sections to read, the known keywords, the
+    ///      ParseContext settings and the library version.
+    ///
+    ///   2. Every recorded input file still exists with the same size.
+    ///      Files whose modification time changed are read and digested
+    ///      again, so touching a file does not invalidate the cache but
+    ///      editing it does.
+    ///
+    /// The parser does not cache decks which triggered any ParseContext
+    /// error handler, so loading a deck from the cache never hides
+    /// diagnostic messages.
+    class DeckCache
+    {
+    public:
+        /// Record of a single input file.
+        struct InputFile
+        {
+            std::string path{};
+            std::uint64_t size{};
+            std::int64_t mtime{};
+            std::uint64_t hash{};
+
+            bool operator==(const InputFile& other) const = default;
+
+            template<class Serializer>
+            void serializeOp(Serializer& serializer)
+            {
+                serializer(path);
+                serializer(size);
+                serializer(mtime);
+                serializer(hash);
+            }
+        };
+
+        /// \param[in] cacheFile Name of cache file.  Need not exist.
+        explicit DeckCache(const std::filesystem::path& cacheFile);
+
+        /// Digest of an input file's contents.
+        ///
+        /// \param[in] content All bytes of the file.
+        static std::uint64_t digest(std::string_view content);
+
+        /// Record of an input file from the contents read for parsing.
+        ///
+        /// \param[in] path Input file.
+        /// \param[in] mtime Modification time of \p path, queried before
+        /// the file was read.
+        /// \param[in] content All bytes of \p path.
+        ///
+        /// \return Record of \p path, or nullopt if the absolute path of
+        /// the file cannot be determined.
+        static std::optional<InputFile>
+        inputFile(const std::filesystem::path& path,
+                  std::filesystem::file_time_type mtime,
+                  std::string_view content);
+
+        /// Record of an input file which the parser does not read as
+        /// text, e.g., files loaded by the IMPORT keyword.  Must be called
+        /// before the file is read.
+        ///
+        /// \param[in] path Input file.
+        ///
+        /// \return Record of \p path, or nullopt if the file cannot be
+        /// read.
+        static std::optional<InputFile> inputFile(const std::filesystem::path& path);
+
+        /// Name of the cache file used for a particular data file in a
+        /// cache directory.  Decks with the same base name in different
+        /// directories get different cache files.
+        static std::filesystem::path
+        cacheFileName(const std::filesystem::path& cacheDirectory,
+                      const std::filesystem::path& dataFile);
+
+        /// Load cached deck.
+        ///
+        /// \param[in] configHash Hash of parser configuration.  Must match
+        /// the value passed to store().
+        ///
+        /// \return Cached deck, or nullopt if the cache file does not
+        /// exist, is unreadable or out of date.
+        std::optional<Deck> load(std::size_t configHash) const;
+
+        /// Write deck to cache file.
+        ///
+        /// The file is written to a temporary name and renamed into place,
+        /// so concurrent readers see either the old or the new cache.
+        /// Failure to write the cache is not an error.
+        ///
+        /// \param[in] deck Parsed deck.
+        /// \param[in] inputFiles Records of all files read while parsing
+        /// \p deck, made when the files were read.
+        /// \param[in] configHash Hash of parser configuration.
+        ///
+        /// \return Whether or not the cache file was written.
+        bool store(const Deck& deck,
+                   const std::vector<InputFile>& inputFiles,
+                   std::size_t configHash) const;
+
+        const std::filesystem::path& path() const { return this->cache_file; }
+
+    private:
+        std::filesystem::path cache_file;
+    };
+
+} // namespace Opm
+
+#endif // OPM_DECK_CACHE_HPP
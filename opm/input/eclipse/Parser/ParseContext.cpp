@@ -29,7 +29,9 @@
 #include <opm/common/utility/shmatch.hpp>
 #include <opm/common/utility/String.hpp>
 
+#include <cstddef>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <string>
@@ -360,6 +362,26 @@ namespace Opm {
         this->m_input_skip_mode = skip_mode;
     }
 
+    std::size_t ParseContext::hash() const
+    {
+        std::size_t seed = 0;
+        const auto combine = [&seed](const std::size_t h)
+        { seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+
+        for (const auto& [key, action] : this->m_errorContexts) {
+            combine(std::hash<std::string>{}(key));
+            combine(static_cast<std::size_t>(action));
+        }
+
+        for (const auto& keyword : this->ignore_keywords) {
+            combine(std::hash<std::string>{}(keyword));
+        }
+
+        combine(std::hash<std::string>{}(this->m_input_skip_mode));
+
+        return seed;
+    }
+
     bool ParseContext::isActiveSkipKeyword(const std::string& deck_name) const
     {
         if (deck_name.compare(0, 4, "SKIP") != 0) {
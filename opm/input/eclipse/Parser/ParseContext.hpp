@@ -20,6 +20,7 @@
 #ifndef OPM_PARSE_CONTEXT_HPP
 #define OPM_PARSE_CONTEXT_HPP
 
+#include <cstddef>
 #include <map>
 #include <optional>
 #include <set>
@@ -298,6 +299,13 @@ namespace Opm {
         /// mode defined through setInputSkipMode().
         bool isActiveSkipKeyword(const std::string& deck_name) const;
 
+        /// Hash of all settings of this context object.
+        ///
+        /// Combines the actions of all context categories, the ignored
+        /// keywords and the input skip mode.  Context objects which parse
+        /// input differently have different hash values.
+        std::size_t hash() const;
+
         /// The PARSE_EXTRA_RECORDS field controls the parser's response to
         /// keywords whose size has been defined in an earlier keyword.
         ///
@@ -17,12 +17,15 @@
   along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 */
 
+#include "project-version.h"
+
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
 #include <opm/common/OpmLog/OpmLog.hpp>
 #include <opm/common/OpmLog/LogUtil.hpp>
 #include <opm/common/utility/OpmInputError.hpp>
 
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/ParserItem.hpp>
@@ -58,18 +61,28 @@
 #include "raw/StarToken.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cctype>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdio>
+#include <deque>
 #include <filesystem>
 #include <iostream>
 #include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <regex>
+#include <set>
 #include <stack>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -483,22 +496,396 @@ void InputStack::push( std::string&& input, std::filesystem::path p ) {
     this->emplace( p, this->string_storage.back() );
 }
 
-class ParserState {
+/*
+ * Read the whole input file into memory. Returns false if the file cannot
+ * be opened. If inputRecord is not null, it receives the deck cache record
+ * of the bytes read, or nullopt if no record can be made.
+ */
+bool readInputFile( const std::filesystem::path& inputFile, std::string& buffer,
+                    std::optional<DeckCache::InputFile>* inputRecord = nullptr ) {
+    // The modification time is queried before reading, so that any later
+    // change to the file is detected by the cache.
+    std::error_code mtime_ec;
+    const auto mtime = inputRecord
+        ? std::filesystem::last_write_time( inputFile, mtime_ec )
+        : std::filesystem::file_time_type{};
+
+    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
+    std::unique_ptr<std::FILE, decltype(closer)> ufp{
+        std::fopen( inputFile.generic_string().c_str(), "rb" ),
+        closer
+    };
+
+    if( !ufp )
+        return false;
+
+    /*
+     * read the input file C-style. This is done for performance
+     * reasons, as streams are slow
+     */
+
+    auto* fp = ufp.get();
+    std::fseek( fp, 0, SEEK_END );
+    buffer.resize( std::ftell( fp ) + 1 );
+    std::rewind( fp );
+    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
+    buffer.back() = '\n';
+
+    if( std::ferror( fp ) || readc != buffer.size() - 1 )
+        throw std::runtime_error( "Error when reading input file '"
+                                  + inputFile.string() + "'" );
+
+    if( inputRecord ) {
+        *inputRecord = mtime_ec
+            ? std::nullopt
+            : DeckCache::inputFile( inputFile, mtime,
+                                    std::string_view( buffer ).substr( 0, readc ) );
+    }
+
+    return true;
+}
+
+/*
+ * Reads and cleans INCLUDE files on worker threads ahead of the parser.
+ *
+ * Cleaned input files are scanned for INCLUDE statements, and the included
+ * files are scheduled for loading in the order they appear in the deck.
+ * The parser itself still processes the input files sequentially, and only
+ * picks up the prefetched text when it reaches the corresponding INCLUDE
+ * keyword, so the resulting deck is the same as for a serial parse.
+ *
+ * The scan is a best effort one. Include paths using PATHS aliases are not
+ * prefetched, and any file which can not be prefetched is loaded by the
+ * parser as usual--including reporting of errors.
+ *
+ * Workers do not start on another file while the prefetched text which the
+ * parser has not yet picked up exceeds maxBufferedBytes.  Files which the
+ * parser has moved past, like INCLUDE statements in SKIP blocks or in files
+ * which the parser has finished, are dropped together with the files they
+ * include.
+ */
+class IncludePrefetcher {
     public:
-        ParserState( const std::vector<std::pair<std::string,std::string>>&,
-                     const ParseContext&, ErrorGuard&,
-                     std::shared_ptr<Python> python,
-                     const std::set<Opm::Ecl::SectionType>& ignore = {});
+        IncludePrefetcher( const std::vector<std::pair<std::string, std::string>>& code_keywords,
+                           const std::filesystem::path& rootPath,
+                           std::size_t numThreads,
+                           bool recordInputFiles );
+        ~IncludePrefetcher();
+
+        IncludePrefetcher( const IncludePrefetcher& ) = delete;
+        IncludePrefetcher& operator=( const IncludePrefetcher& ) = delete;
+
+        /// Schedule loading of files included from cleaned input of file
+        /// \p parent.
+        void scan( std::string_view input, const std::filesystem::path& parent );
+
+        /// Cleaned content of file, if prefetched. Waits for the file if it
+        /// is being loaded. Drops the files included before \p inputFile
+        /// from the same parent, which the parser has skipped. Sets
+        /// \p inputRecord to the deck cache record of the file if the
+        /// prefetcher records input files.
+        std::optional<std::string> take( const std::filesystem::path& inputFile,
+                                         std::optional<DeckCache::InputFile>& inputRecord );
+
+        /// Parser has processed all of \p inputFile. Drops the files it
+        /// includes which have not been picked up.
+        void finished( const std::filesystem::path& inputFile );
+
+        /// Upper limit of prefetched text not yet picked up by the parser.
+        /// Each worker may exceed it by the size of the file it is loading.
+        static constexpr std::size_t maxBufferedBytes = std::size_t{256} << 20;
+
+    private:
+        enum class Status { Queued, Loading, Done };
+
+        struct Entry {
+            Status status = Status::Queued;
+            std::optional<std::string> content;
+            std::optional<DeckCache::InputFile> input_record;
+            std::filesystem::path parent;
+            std::size_t index = 0;
+            std::size_t bytes = 0;
+            bool dropped = false;
+        };
+
+        using EntryIter = std::map<std::filesystem::path, Entry>::iterator;
+
+        std::vector<std::filesystem::path> includePaths( std::string_view input ) const;
+        void drop( EntryIter entry );
+        void dropIncludedFrom( const std::filesystem::path& parent, std::size_t end_index );
+        void work();
+
+        const std::vector<std::pair<std::string, std::string>> code_keywords;
+        const std::filesystem::path rootPath;
+        const bool record_input_files;
+
+        std::mutex mutex;
+        std::condition_variable queued;
+        std::condition_variable loaded;
+
+        std::deque<std::filesystem::path> queue;
+        std::map<std::filesystem::path, Entry> entries;
+        std::set<std::filesystem::path> scheduled;
+        std::size_t next_index = 0;
+        std::size_t buffered_bytes = 0;
+        bool stop = false;
+
+        std::vector<std::thread> workers;
+};
+
+IncludePrefetcher::IncludePrefetcher( const std::vector<std::pair<std::string, std::string>>& code_keywords_arg,
+                                      const std::filesystem::path& rootPath_arg,
+                                      const std::size_t numThreads,
+                                      const bool recordInputFiles ) :
+    code_keywords( code_keywords_arg ),
+    rootPath( rootPath_arg ),
+    record_input_files( recordInputFiles )
+{
+    for( std::size_t i = 0; i < numThreads; ++i )
+        this->workers.emplace_back( [this]() { this->work(); } );
+}
+
+IncludePrefetcher::~IncludePrefetcher() {
+    {
+        std::lock_guard<std::mutex> lock( this->mutex );
+        this->stop = true;
+        this->queue.clear();
+    }
+
+    this->queued.notify_all();
+
+    for( auto& worker : this->workers )
+        worker.join();
+}
+
+void IncludePrefetcher::scan( std::string_view input, const std::filesystem::path& parent ) {
+    const auto paths = this->includePaths( input );
+    if( paths.empty() )
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock( this->mutex );
+        for( const auto& path : paths ) {
+            if( !this->scheduled.insert( path ).second )
+                continue;
+
+            auto& entry = this->entries.emplace( path, Entry{} ).first->second;
+            entry.parent = parent;
+            entry.index = this->next_index++;
+
+            this->queue.push_back( path );
+        }
+    }
+
+    this->queued.notify_all();
+}
+
+std::optional<std::string> IncludePrefetcher::take( const std::filesystem::path& inputFile,
+                                                     std::optional<DeckCache::InputFile>& inputRecord ) {
+    std::unique_lock<std::mutex> lock( this->mutex );
+
+    // A dropped file is still being loaded, and is removed by its worker.
+    auto entry = this->entries.find( inputFile );
+    if( ( entry == this->entries.end() ) || entry->second.dropped )
+        return {};
+
+    this->dropIncludedFrom( entry->second.parent, entry->second.index );
+
+    if( entry->second.status == Status::Queued ) {
+        // Not started yet. Cheaper for the parser to load it directly than
+        // to wait for the files ahead of it in the queue.
+        this->queue.erase( std::find( this->queue.begin(), this->queue.end(), inputFile ) );
+        this->entries.erase( entry );
+        return {};
+    }
+
+    this->loaded.wait( lock, [entry]() { return entry->second.status == Status::Done; } );
+
+    auto content = std::move( entry->second.content );
+    inputRecord = std::move( entry->second.input_record );
+    this->buffered_bytes -= entry->second.bytes;
+    this->entries.erase( entry );
+
+    lock.unlock();
+    this->queued.notify_all();
+
+    return content;
+}
+
+void IncludePrefetcher::finished( const std::filesystem::path& inputFile ) {
+    {
+        std::lock_guard<std::mutex> lock( this->mutex );
+        this->dropIncludedFrom( inputFile, this->next_index );
+    }
+
+    this->queued.notify_all();
+}
+
+/*
+ * Drop files included from parent and scheduled before end_index, along
+ * with the files they include. Mutex must be held.
+ */
+void IncludePrefetcher::dropIncludedFrom( const std::filesystem::path& parent,
+                                          const std::size_t end_index ) {
+    auto entry = this->entries.begin();
+    while( entry != this->entries.end() ) {
+        auto next = std::next( entry );
+
+        if( ( entry->second.parent == parent ) &&
+            ( entry->second.index < end_index ) &&
+            !entry->second.dropped )
+        {
+            this->drop( entry );
+
+            // Dropping may have removed any number of entries.
+            next = this->entries.begin();
+        }
+
+        entry = next;
+    }
+}
+
+/*
+ * Drop single file and the files it includes. A file being loaded is
+ * dropped by the worker when done. Mutex must be held.
+ */
+void IncludePrefetcher::drop( const EntryIter entry ) {
+    entry->second.dropped = true;
+
+    if( entry->second.status == Status::Loading )
+        return;
+
+    const auto path = entry->first;
+    if( entry->second.status == Status::Queued )
+        this->queue.erase( std::find( this->queue.begin(), this->queue.end(), path ) );
+
+    this->buffered_bytes -= entry->second.bytes;
+    this->entries.erase( entry );
+
+    this->dropIncludedFrom( path, this->next_index );
+}
+
+std::vector<std::filesystem::path> IncludePrefetcher::includePaths( std::string_view input ) const {
+    std::vector<std::filesystem::path> paths;
+    std::string_view line;
+
+    while( str::getline( input, line ) ) {
+        if( line.empty() || std::toupper( line.front() ) != RawConsts::include.front() )
+            continue;
+
+        if( str::make_deck_name( line ) != RawConsts::include )
+            continue;
+
+        // The include path is the first item of the keyword's record.
+        while( str::getline( input, line ) && line.empty() ) {}
+
+        std::string path;
+        if( !line.empty() && RawConsts::is_quote()( line.front() ) ) {
+            const auto end = line.find( line.front(), 1 );
+            if( end == std::string_view::npos )
+                continue;
+
+            path = line.substr( 1, end - 1 );
+        }
+        else {
+            const auto end = std::find_if( line.begin(), line.end(), []( const char c )
+            { return RawConsts::is_separator()( c ) || c == RawConsts::slash; } );
+
+            path = std::string( line.begin(), end );
+        }
+
+        path = std::string( str::trim( path ) );
+        if( path.empty() || path.find( '$' ) != std::string::npos )
+            continue;
+
+        std::replace( path.begin(), path.end(), '\\', '/' );
+
+        std::filesystem::path includeFilePath( path );
+        if( includeFilePath.is_relative() )
+            includeFilePath = this->rootPath / includeFilePath;
 
+        std::error_code ec;
+        includeFilePath = std::filesystem::canonical( includeFilePath, ec );
+        if( !ec )
+            paths.push_back( std::move( includeFilePath ) );
+    }
+
+    return paths;
+}
+
+void IncludePrefetcher::work() {
+    std::unique_lock<std::mutex> lock( this->mutex );
+
+    while( true ) {
+        this->queued.wait( lock, [this]() {
+            return this->stop ||
+                ( !this->queue.empty() && ( this->buffered_bytes < maxBufferedBytes ) );
+        } );
+
+        if( this->stop )
+            return;
+
+        const auto inputFile = std::move( this->queue.front() );
+        this->queue.pop_front();
+
+        auto entry = this->entries.find( inputFile );
+        entry->second.status = Status::Loading;
+
+        // Reserve the file's size in the budget until the cleaned size is
+        // known.
+        std::error_code ec;
+        const auto file_size = std::filesystem::file_size( inputFile, ec );
+        entry->second.bytes = ec ? std::size_t{0} : static_cast<std::size_t>( file_size );
+        this->buffered_bytes += entry->second.bytes;
+
+        lock.unlock();
+
+        std::optional<std::string> content;
+        std::optional<DeckCache::InputFile> input_record;
+        try {
+            std::string buffer;
+            if( readInputFile( inputFile, buffer,
+                               this->record_input_files ? &input_record : nullptr ) ) {
+                content = str::clean( this->code_keywords, buffer );
+                this->scan( *content, inputFile );
+            }
+        } catch( ... ) {
+            // Left to the parser to load the file and report the error.
+            content.reset();
+        }
+
+        lock.lock();
+
+        const auto bytes = content.has_value() ? content->size() : std::size_t{0};
+        this->buffered_bytes += bytes;
+        this->buffered_bytes -= entry->second.bytes;
+        entry->second.bytes = bytes;
+
+        entry->second.content = std::move( content );
+        entry->second.input_record = std::move( input_record );
+        entry->second.status = Status::Done;
+
+        if( entry->second.dropped ) {
+            this->drop( entry );
+            this->queued.notify_all();
+        }
+
+        this->loaded.notify_all();
+    }
+}
+
+class ParserState {
+    public:
         ParserState( const std::vector<std::pair<std::string,std::string>>&,
                      const ParseContext&, ErrorGuard&,
-                     const std::filesystem::path&,
                      std::shared_ptr<Python> python,
                      const std::set<Opm::Ecl::SectionType>& ignore = {});
 
         void loadString( const std::string& );
         void loadFile( const std::filesystem::path& );
+        void addInputFile( std::optional<DeckCache::InputFile> inputRecord );
         void openRootFile( const std::filesystem::path& );
+        void prefetchIncludes( std::size_t numThreads );
 
         void setRestartedRun() { this->is_restarted_ = true; }
 
@@ -533,7 +920,17 @@ class ParserState {
         bool is_restarted_{false};
         Ecl::SectionType current_section_{Ecl::SectionType::RUNSPEC};
 
+        std::unique_ptr<IncludePrefetcher> prefetcher;
+
     public:
+        // Records of all files read into the deck, in order, and whether
+        // the deck depends only on those files.  Used by the binary deck
+        // cache, and only collected if record_input_files is set before
+        // the root file is opened.
+        bool record_input_files = false;
+        std::vector<DeckCache::InputFile> input_files;
+        bool cacheable = true;
+
         ParserKeywordSizeEnum lastSizeType = SLASH_TERMINATED;
         std::string lastKeyWord;
 
@@ -557,7 +954,7 @@ bool ParserState::done() const {
 
     while( !this->input_stack.empty() &&
             this->input_stack.top().input.empty() )
-        const_cast< ParserState* >( this )->input_stack.pop();
+        const_cast< ParserState* >( this )->closeFile();
 
     return this->input_stack.empty();
 }
@@ -589,6 +986,9 @@ void ParserState::ungetline(const std::string_view& line) {
 
 
 void ParserState::closeFile() {
+    if (this->prefetcher)
+        this->prefetcher->finished( this->input_stack.top().path );
+
     this->input_stack.pop();
 }
 
@@ -604,22 +1004,6 @@ ParserState::ParserState(const std::vector<std::pair<std::string, std::string>>&
     errors( errors_arg )
 {}
 
-ParserState::ParserState( const std::vector<std::pair<std::string, std::string>>& code_keywords_arg,
-                          const ParseContext& context,
-                          ErrorGuard& errors_arg,
-                          const std::filesystem::path& p,
-                          std::shared_ptr<Python> interpreter,
-                          const std::set<Opm::Ecl::SectionType>& ignore ) :
-    code_keywords(code_keywords_arg),
-    ignore_sections(ignore),
-    rootPath( std::filesystem::canonical( p ).parent_path() ),
-    python( std::move(interpreter) ),
-    parseContext( context ),
-    errors( errors_arg )
-{
-    openRootFile( p );
-}
-
 bool ParserState::check_section_keywords(bool& has_edit, bool& has_regions, bool& has_summary) {
 
     std::string_view root_file_str = this->input_stack.top().input;
@@ -667,37 +1051,59 @@ void ParserState::loadString(const std::string& input) {
 
 void ParserState::loadFile(const std::filesystem::path& inputFile) {
 
-    const auto closer = []( std::FILE* f ) { std::fclose( f ); };
-    std::unique_ptr<std::FILE, decltype(closer)> ufp{
-        std::fopen( inputFile.generic_string().c_str(), "rb" ),
-        closer
-    };
+    std::optional<DeckCache::InputFile> input_record;
+
+    if (this->prefetcher) {
+        auto content = this->prefetcher->take(inputFile, input_record);
+        if (content.has_value()) {
+            this->input_stack.push( std::move(*content), inputFile );
+            this->addInputFile( std::move(input_record) );
+            return;
+        }
+    }
+
+    std::string buffer;
 
     // make sure the file we'd like to parse is readable
-    if( !ufp ) {
+    if( !readInputFile( inputFile, buffer,
+                        this->record_input_files ? &input_record : nullptr ) ) {
         std::string msg = "Could not read from file: " + inputFile.string();
         parseContext.handleError( ParseContext::PARSE_MISSING_INCLUDE , msg, {}, errors);
+        this->cacheable = false;
         return;
     }
 
-    /*
-     * read the input file C-style. This is done for performance
-     * reasons, as streams are slow
-     */
+    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    this->addInputFile( std::move(input_record) );
 
-    auto* fp = ufp.get();
-    std::string buffer;
-    std::fseek( fp, 0, SEEK_END );
-    buffer.resize( std::ftell( fp ) + 1 );
-    std::rewind( fp );
-    const auto readc = std::fread( &buffer[ 0 ], 1, buffer.size() - 1, fp );
-    buffer.back() = '\n';
+    if (this->prefetcher)
+        this->prefetcher->scan( this->input_stack.top().input, inputFile );
+}
 
-    if( std::ferror( fp ) || readc != buffer.size() - 1 )
-        throw std::runtime_error( "Error when reading input file '"
-                                  + inputFile.string() + "'" );
+void ParserState::addInputFile( std::optional<DeckCache::InputFile> inputRecord ) {
+    if (! this->record_input_files)
+        return;
 
-    this->input_stack.push( str::clean( this->code_keywords, buffer ), inputFile );
+    if (inputRecord.has_value())
+        this->input_files.push_back( std::move(*inputRecord) );
+    else
+        this->cacheable = false;
+}
+
+/*
+ * Start loading the files included from the root file on worker threads.
+ */
+void ParserState::prefetchIncludes(const std::size_t numThreads) {
+    if (this->input_stack.empty())
+        return;
+
+    this->prefetcher = std::make_unique<IncludePrefetcher>( this->code_keywords,
+                                                            this->rootPath,
+                                                            numThreads,
+                                                            this->record_input_files );
+
+    this->prefetcher->scan( this->input_stack.top().input,
+                            this->input_stack.top().path );
 }
 
 /*
@@ -1530,6 +1936,7 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
             }
             try {
                 if (rawKeyword->getKeywordName() ==  Opm::RawConsts::pyinput) {
+                    parserState.cacheable = false;
                     if (parserState.python) {
                         std::string python_string = rawKeyword->getFirstRecord().getRecordString();
                         parserState.python->exec(python_string, parser, parserState.deck);
@@ -1547,6 +1954,8 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
                     if (deck_keyword.name() == ParserKeywords::IMPORT::keywordName) {
                         bool formatted = deck_keyword.getRecord(0).getItem(1).get<std::string>(0)[0] == 'F';
                         const auto& import_file = parserState.getIncludeFilePath(deck_keyword.getRecord(0).getItem(0).getTrimmedString(0));
+                        if (parserState.record_input_files)
+                            parserState.addInputFile(DeckCache::inputFile(import_file.value()));
 
                         ImportContainer import(parser, parserState.deck.getActiveUnitSystem(), import_file.value().string(), formatted, parserState.deck.size());
                         for (auto kw : import)
@@ -1584,6 +1993,38 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
     return true;
 }
 
+/*
+ * Hash of everything besides the input files which affects the deck
+ * produced by Parser::parseFile().  Used to validate the binary deck
+ * cache.  The library version stands in for the definitions of the
+ * builtin keywords, which are too many to hash on every parse.
+ */
+std::size_t deckCacheConfigHash(const Parser& parser,
+                                const ParseContext& parseContext,
+                                const std::string& dataFile,
+                                const std::set<Opm::Ecl::SectionType>& ignore)
+{
+    std::size_t seed = 0;
+    const auto combine = [&seed](const std::size_t h)
+    { seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2); };
+
+    combine(std::hash<std::string>{}(PROJECT_VERSION));
+    combine(parseContext.hash());
+    combine(std::hash<std::string>{}(dataFile));
+    for (const auto& section : ignore)
+        combine(static_cast<std::size_t>(section));
+
+    for (const auto& name : parser.getAllDeckNames())
+        combine(std::hash<std::string>{}(name));
+
+    for (const auto& [code_keyword, end_marker] : parser.codeKeywords()) {
+        combine(std::hash<std::string>{}(code_keyword));
+        combine(std::hash<std::string>{}(end_marker));
+    }
+
+    return seed;
+}
+
 }
 
 
@@ -1611,6 +2052,59 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
         }
     }
 
+    Parser::Parser(const Parser& rhs)
+        : m_python           { rhs.m_python }
+        , silentMode         { rhs.silentMode }
+        , includeThreadCount { rhs.includeThreadCount }
+        , deckCacheDir       { rhs.deckCacheDir }
+        , code_keywords      { rhs.code_keywords }
+    {
+        // The keyword maps refer to keyword objects, and deck names, owned
+        // by rhs.  Rebuild them to refer to this parser's copies instead.
+        std::lock_guard<std::mutex> lock { *rhs.keyword_mutex };
+
+        auto keywords = std::unordered_map<const ParserKeyword*, const ParserKeyword*>{};
+        for (const auto& keyword : rhs.keyword_storage) {
+            keywords.emplace(&keyword, &this->keyword_storage.emplace_back(keyword));
+        }
+
+        auto entries = std::unordered_map<const KeywordEntry*, KeywordEntry*>{};
+        for (const auto& entry : rhs.keyword_entries) {
+            const auto* keyword = entry.keyword.load(std::memory_order_relaxed);
+            auto& copy = this->keyword_entries
+                .emplace_back(entry.factory, (keyword == nullptr) ? nullptr : keywords.at(keyword));
+
+            entries.emplace(&entry, &copy);
+        }
+
+        for (const auto& [deck_name, entry] : rhs.m_deckParserKeywords) {
+            auto* copy = entries.at(entry);
+
+            // Deck names of lazily added keywords are string literals.
+            auto name = deck_name;
+            if (copy->factory == nullptr) {
+                name = *copy->keyword.load(std::memory_order_relaxed)
+                    ->deck_names().find(std::string { deck_name });
+            }
+
+            this->m_deckParserKeywords.emplace(name, copy);
+        }
+
+        for (const auto& [name, keyword] : rhs.m_wildCardKeywords) {
+            const auto* copy = keywords.at(keyword);
+            this->m_wildCardKeywords.emplace(std::string_view { copy->getName() }, copy);
+        }
+    }
+
+    Parser& Parser::operator=(const Parser& rhs)
+    {
+        if (this != &rhs) {
+            *this = Parser { rhs };
+        }
+
+        return *this;
+    }
+
     /*
      About INCLUDE: Observe that the ECLIPSE parser is slightly unlogical
      when it comes to nested includes; the path to an included file is always
@@ -1706,15 +2200,35 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
         else
             data_file = std::filesystem::proximate(std::filesystem::canonical(dataFileName)).generic_string();
 
+        auto cache = std::optional<DeckCache>{};
+        auto config_hash = std::size_t{0};
+        if (! this->deckCacheDirectory().empty()) {
+            cache.emplace(DeckCache::cacheFileName(this->deckCacheDirectory(), data_file));
+            config_hash = deckCacheConfigHash(*this, parseContext, data_file, ignore_sections);
+
+            auto deck = cache->load(config_hash);
+            if (deck.has_value()) {
+                OpmLog::info(fmt::format("Loaded deck {} from cache {}",
+                                         data_file, cache->path().generic_string()));
+                return std::move(*deck);
+            }
+        }
+
+        const auto num_messages = errors.size();
         ParserState parserState {
             this->codeKeywords(),
             parseContext,
             errors,
-            data_file,
             this->m_python,
             ignore_sections
         };
 
+        parserState.record_input_files = cache.has_value();
+        parserState.openRootFile(data_file);
+
+        if (this->includeThreads() > 1)
+            parserState.prefetchIncludes(this->includeThreads());
+
         parseState(parserState, *this, errors);
 
         auto ignore = parserState.get_ignore();
@@ -1722,6 +2236,16 @@ bool parseState( ParserState& parserState, const Parser& parser, ErrorGuard& err
         if (ignore.size() > 0)
             cleanup_deck_keyword_list(parserState, ignore);
 
+        // Decks which triggered any error handler are not cached, so that
+        // the messages are repeated on the next run and so that a deck
+        // accepted by a lenient ParseContext is never handed to a stricter
+        // one.
+        if (cache.has_value() && parserState.cacheable && (errors.size() == num_messages)) {
+            std::error_code ec;
+            std::filesystem::create_directories(this->deckCacheDirectory(), ec);
+            cache->store(parserState.deck, parserState.input_files, config_hash);
+        }
+
         return std::move( parserState.deck );
     }
 
@@ -1815,9 +2339,10 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
 
     this->keyword_storage.push_back( std::move( parserKeyword ) );
     const ParserKeyword * ptr = std::addressof(this->keyword_storage.back());
+    auto* entry = std::addressof(this->keyword_entries.emplace_back(nullptr, ptr));
     for (const auto& deck_name : ptr->deck_names())
     {
-        m_deckParserKeywords[deck_name] = ptr;
+        m_deckParserKeywords[deck_name] = entry;
     }
 
     if (ptr->hasMatchRegex()) {
@@ -1829,6 +2354,35 @@ void Parser::addParserKeyword( ParserKeyword parserKeyword ) {
         this->code_keywords.emplace_back( ptr->getName(), ptr->codeEnd() );
 }
 
+void Parser::addLazyParserKeyword(std::initializer_list<std::string_view> deckNames,
+                                  ParserKeyword (*factory)())
+{
+    auto* entry = std::addressof(this->keyword_entries.emplace_back(factory, nullptr));
+    for (const auto& deck_name : deckNames) {
+        m_deckParserKeywords[deck_name] = entry;
+    }
+}
+
+const ParserKeyword& Parser::materialize(KeywordEntry& entry) const
+{
+    // Keywords are never replaced once constructed, so the lock is needed
+    // only for the first lookup.
+    if (const auto* keyword = entry.keyword.load(std::memory_order_acquire);
+        keyword != nullptr)
+    {
+        return *keyword;
+    }
+
+    std::lock_guard<std::mutex> lock { *this->keyword_mutex };
+    if (entry.keyword.load(std::memory_order_relaxed) == nullptr) {
+        this->keyword_storage.push_back(entry.factory());
+        entry.keyword.store(std::addressof(this->keyword_storage.back()),
+                            std::memory_order_release);
+    }
+
+    return *entry.keyword.load(std::memory_order_relaxed);
+}
+
 
 void Parser::addParserKeyword(const Json::JsonObject& jsonKeyword) {
     addParserKeyword( ParserKeyword( jsonKeyword ) );
@@ -1846,7 +2400,7 @@ const ParserKeyword& Parser::getKeyword( const std::string& name ) const {
 const ParserKeyword& Parser::getParserKeywordFromDeckName(const std::string_view& name ) const {
     auto candidate = m_deckParserKeywords.find( name );
 
-    if( candidate != m_deckParserKeywords.end() ) return *candidate->second;
+    if( candidate != m_deckParserKeywords.end() ) return materialize( *candidate->second );
 
     const auto* wildCardKeyword = matchingKeyword( name );
 
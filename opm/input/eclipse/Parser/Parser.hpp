@@ -22,13 +22,18 @@
 
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 
+#include <atomic>
 #include <cstddef>
+#include <deque>
 #include <filesystem>
+#include <initializer_list>
 #include <iosfwd>
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -62,6 +67,13 @@ namespace Opm {
         explicit Parser(bool addDefault = true);
         explicit Parser(std::shared_ptr<Python> python, bool addDefault = true);
 
+        Parser(const Parser& rhs);
+        Parser(Parser&& rhs) = default;
+        ~Parser() = default;
+
+        Parser& operator=(const Parser& rhs);
+        Parser& operator=(Parser&& rhs) = default;
+
         static std::string stripComments(const std::string& inputString);
 
         /// The starting point of the parsing process. The supplied file is parsed, and the resulting Deck is returned.
@@ -92,6 +104,19 @@ namespace Opm {
         void addParserKeyword(const Json::JsonObject& jsonKeyword);
         void addParserKeyword(ParserKeyword parserKeyword);
 
+        /// Add keyword which is constructed the first time it is looked up.
+        ///
+        /// Used for the builtin keywords, most of which are never seen in
+        /// any one deck.  Keywords with a match regex or code keywords
+        /// must be added with addParserKeyword().
+        ///
+        /// \param[in] deckNames Deck names of the keyword.  Must remain
+        /// valid for the lifetime of the parser, e.g., string literals.
+        ///
+        /// \param[in] factory Function constructing the keyword.
+        void addLazyParserKeyword(std::initializer_list<std::string_view> deckNames,
+                                  ParserKeyword (*factory)());
+
         /*!
          * \brief Returns whether the parser knows about a keyword
          */
@@ -172,18 +197,56 @@ namespace Opm {
         bool silent() const { return silentMode; }
         void silent(bool newSilentMode) { silentMode = newSilentMode; }
 
+        /// Number of threads reading and cleaning INCLUDE files ahead of
+        /// the parser in parseFile().  The deck is the same regardless of
+        /// this setting.  Values less than two mean serial parsing.
+        std::size_t includeThreads() const { return includeThreadCount; }
+        void includeThreads(std::size_t numThreads) { includeThreadCount = numThreads; }
+
+        /// Directory of binary deck caches used by parseFile().  If set,
+        /// parseFile() loads the deck from the cache when none of the
+        /// input files changed since it was stored, and otherwise parses
+        /// the text deck and stores the result.  Decks which triggered
+        /// any error handler, including ignored ones, or which run PYINPUT
+        /// code, are not cached.  A cached deck is only used with the same
+        /// ParseContext settings and library version.  Empty, the default,
+        /// disables the cache.
+        const std::filesystem::path& deckCacheDirectory() const { return deckCacheDir; }
+        void deckCacheDirectory(const std::filesystem::path& directory) { deckCacheDir = directory; }
+
         static constexpr int SILENT_MODE_MIN_DEBUG_VERBOSITY_LEVEL {3}; // Debug level at which to emit silenced messeages to the debug log
 
     private:
         std::shared_ptr<Python> m_python{};
 
         bool silentMode {false}; // Silence information messages (warnings and errors are still emitted)
+        std::size_t includeThreadCount {1}; // Threads prefetching INCLUDE files
+        std::filesystem::path deckCacheDir{}; // Binary deck cache, disabled if empty
+
+        // Keyword known by its deck names.  Keywords added through
+        // addLazyParserKeyword() hold a factory and are constructed into
+        // keyword_storage on first lookup.
+        struct KeywordEntry
+        {
+            KeywordEntry(ParserKeyword (*factory_arg)(), const ParserKeyword* keyword_arg)
+                : factory { factory_arg }
+                , keyword { keyword_arg }
+            {}
+
+            ParserKeyword (*factory)() {nullptr};
+            std::atomic<const ParserKeyword*> keyword {nullptr};
+        };
 
         // std::vector< std::unique_ptr< const ParserKeyword > > keyword_storage;
-        std::list<ParserKeyword> keyword_storage{};
+        mutable std::list<ParserKeyword> keyword_storage{};
+        std::deque<KeywordEntry> keyword_entries{};
+
+        // Serialises construction of lazily added keywords.  Held through
+        // a pointer to keep the parser movable.
+        std::unique_ptr<std::mutex> keyword_mutex { std::make_unique<std::mutex>() };
 
-        // associative map of deck names and the corresponding ParserKeyword object
-        std::map<std::string_view, const ParserKeyword*> m_deckParserKeywords{};
+        // associative map of deck names and the corresponding keyword entry
+        std::map<std::string_view, KeywordEntry*> m_deckParserKeywords{};
 
         // associative map of the parser internal names and the corresponding
         // ParserKeyword object for keywords which match a regular expression
@@ -194,6 +257,7 @@ namespace Opm {
         bool hasWildCardKeyword(const std::string& keyword) const;
 
         const ParserKeyword* matchingKeyword(const std::string_view& keyword) const;
+        const ParserKeyword& materialize(KeywordEntry& entry) const;
         void addDefaultKeywords();
     };
 
@@ -25,13 +25,22 @@
 
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <cstddef>
+#include <iterator>
+#include <mutex>
 #include <ostream>
 #include <sstream>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+#include <vector>
 
 #include <fmt/format.h>
 
+#include "raw/RawConsts.hpp"
 #include "raw/RawRecord.hpp"
 #include "raw/StarToken.hpp"
 
@@ -111,9 +120,23 @@ T& ParserItem::value_ref() {
             );
 }
 
+struct ParserItem::DescriptorCache
+{
+    struct Entry
+    {
+        UnitSystem::UnitType active_type;
+        UnitSystem::UnitType default_type;
+        std::shared_ptr<DeckItem::Descriptor> descriptor;
+    };
+
+    std::mutex mutex{};
+    std::vector<Entry> entries{};
+};
+
 ParserItem::ParserItem( const std::string& itemName, ParserItem::itype input_type_arg) :
     m_name(itemName),
-    m_defaultSet(false)
+    m_defaultSet(false),
+    m_descriptors(std::make_shared<DescriptorCache>())
 {
     this->setInputType(input_type_arg);
 }
@@ -128,7 +151,8 @@ ParserItem::ParserItem( const Json::JsonObject& json ) :
                  : "" ),
     data_type( get_data_type_json( json.get_string( "value_type" ) ) ),
     input_type( ParserItem::from_string( json.get_string("value_type"))),
-    m_defaultSet( false )
+    m_defaultSet( false ),
+    m_descriptors( std::make_shared<DescriptorCache>() )
 {
     if( json.has_item( "dimension" ) ) {
         const auto& dim = json.get_item( "dimension" );
@@ -183,6 +207,7 @@ void ParserItem::setDefault( T val ) {
 
 void ParserItem::setInputType(ParserItem::itype input_type_arg) {
     this->input_type = input_type_arg;
+    this->m_descriptors = std::make_shared<DescriptorCache>();
 
     if (input_type == itype::INT)
         this->setDataType(int());
@@ -241,6 +266,39 @@ void ParserItem::push_backDimension( const std::string& dim ) {
     }
 
     this->m_dimensions.push_back( dim );
+    this->m_descriptors = std::make_shared<DescriptorCache>();
+}
+
+/// Descriptor shared by the DeckItems scanned with the given unit systems.
+/// The dimensions depend on the unit systems only through their types.
+std::shared_ptr<DeckItem::Descriptor>
+ParserItem::descriptor(UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const
+{
+    const auto active_type = active_unitsystem.getType();
+    const auto default_type = default_unitsystem.getType();
+
+    std::lock_guard<std::mutex> lock(this->m_descriptors->mutex);
+
+    auto& entries = this->m_descriptors->entries;
+    if (this->m_dimensions.empty() && !entries.empty())
+        return entries.front().descriptor;
+
+    auto pos = std::ranges::find_if(entries, [active_type, default_type](const auto& entry) {
+        return (entry.active_type == active_type) && (entry.default_type == default_type);
+    });
+
+    if (pos != entries.end())
+        return pos->descriptor;
+
+    auto desc = std::make_shared<DeckItem::Descriptor>();
+    desc->name = this->name();
+    for (const auto& dim_string : this->m_dimensions) {
+        desc->active_dimensions.push_back( active_unitsystem.getNewDimension(dim_string) );
+        desc->default_dimensions.push_back( default_unitsystem.getNewDimension(dim_string) );
+    }
+
+    entries.push_back({ active_type, default_type, desc });
+    return desc;
 }
 
     const std::string& ParserItem::name() const {
@@ -438,11 +496,117 @@ std::string ParserItem::createCode(const std::string& indent) const {
 
 namespace {
 
+template< typename F >
+void for_each_token( std::string_view input, F&& f ) {
+    const auto is_separator = RawConsts::is_separator();
+    const auto end = input.end();
+
+    auto current = input.begin();
+    while( true ) {
+        current = std::find_if_not( current, end, is_separator );
+        if( current == end )
+            return;
+
+        const auto token_end = std::find_if( current, end, is_separator );
+        f( std::string_view( &*current, std::distance( current, token_end ) ) );
+        current = token_end;
+    }
+}
+
+/*
+ * Repeat count of "N*value" tokens, or zero if the token does not start
+ * with a valid repeat count.
+ */
+std::size_t repeat_count( std::string_view token, std::size_t star ) {
+    std::size_t count = 0;
+    const auto [ptr, ec] = std::from_chars( token.data(), token.data() + star, count );
+
+    if( star == 0 || ec != std::errc{} || ptr != token.data() + star )
+        return 0;
+
+    return count;
+}
+
+/*
+ * Bulk scanning of numeric items of size type ALL, i.e., the data of
+ * keywords like ZCORN, COORD and PERMX. The record string is scanned in
+ * place, rather than split into tokens, and the values are written into
+ * vectors sized for the whole record up front.  Returns false, leaving the
+ * record alone, if the record has already been split or holds quoted
+ * strings.
+ */
+template< typename T >
+bool scan_bulk( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
+    const auto input = record.unsplitRecordString();
+    if( !input.has_value() || input->find( RawConsts::quote ) != std::string_view::npos )
+        return false;
+
+    std::size_t size = 0;
+    for_each_token( *input, [&size]( std::string_view token ) {
+        const auto star = token.find( '*' );
+        size += (star == std::string_view::npos)
+            ? 1 : std::max( repeat_count( token, star ), std::size_t{1} );
+    });
+
+    std::vector< T > values;
+    std::vector< value::status > status;
+    values.reserve( size );
+    status.reserve( size );
+
+    for_each_token( *input, [&]( std::string_view token ) {
+        const auto star = token.find( '*' );
+        if( star == std::string_view::npos ) {
+            values.push_back( readValueToken< T >( token ) );
+            status.push_back( value::status::deck_value );
+            return;
+        }
+
+        auto count = repeat_count( token, star );
+        if( count == 0 ) {
+            // Lone '*' or malformed token. The generic handling reports
+            // errors the same way as for other items.
+            std::string countString;
+            std::string valueString;
+            if( !isStarToken( token, countString, valueString ) ) {
+                values.push_back( readValueToken< T >( token ) );
+                status.push_back( value::status::deck_value );
+                return;
+            }
+
+            count = StarToken( token, countString, valueString ).count();
+        }
+
+        const auto valueString = token.substr( star + 1 );
+        if( !valueString.empty() ) {
+            values.insert( values.end(), count, readValueToken< T >( valueString ) );
+            status.insert( status.end(), count, value::status::deck_value );
+        }
+        else if( parser_item.hasDefault() ) {
+            values.insert( values.end(), count, parser_item.getDefault< T >() );
+            status.insert( status.end(), count, value::status::valid_default );
+        }
+        else {
+            values.insert( values.end(), count, T() );
+            status.insert( status.end(), count, value::status::empty_default );
+        }
+    });
+
+    deck_item.push_back( std::move( values ), std::move( status ) );
+    record.consumeAll();
+
+    return true;
+}
+
 template< typename T >
 void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& record ) {
     bool parse_raw = parser_item.parseRaw();
 
     if( parser_item.sizeType() == ParserItem::item_size::ALL ) {
+        if constexpr (std::is_same_v<T, int> || std::is_same_v<T, double>) {
+            if (!parse_raw && scan_bulk< T >( deck_item, parser_item, record ))
+                return;
+        }
+
         if (parse_raw) {
             deck_item.reserve_additionalRawString(record.size());
             while (record.size()) {
@@ -544,61 +708,31 @@ void scan_item( DeckItem& deck_item, const ParserItem& parser_item, RawRecord& r
 /// returns a DeckItem object.
 /// NOTE: data are popped from the records deque!
 DeckItem ParserItem::scan( RawRecord& record, UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const {
+    DeckItem item( this->descriptor(active_unitsystem, default_unitsystem), this->data_type );
+
     switch( this->data_type ) {
     case type_tag::integer:
-        {
-            DeckItem item( this->name(), int());
-            scan_item< int >( item, *this, record );
-            item.shrink_to_fit<int>();
-            return item;
-        }
+        scan_item< int >( item, *this, record );
+        item.shrink_to_fit<int>();
         break;
     case type_tag::fdouble:
-        {
-            std::vector<Dimension> active_dimensions;
-            std::vector<Dimension> default_dimensions;
-            for (const auto& dim_string : this->m_dimensions) {
-                active_dimensions.push_back( active_unitsystem.getNewDimension(dim_string) );
-                default_dimensions.push_back( default_unitsystem.getNewDimension(dim_string) );
-            }
-
-            DeckItem item(this->name(), double(), active_dimensions, default_dimensions);
-            scan_item< double >( item, *this, record );
-            item.shrink_to_fit<double>();
-            return item;
-        }
+        scan_item< double >( item, *this, record );
+        item.shrink_to_fit<double>();
         break;
     case type_tag::string:
-        {
-            DeckItem item(this->name(), std::string());
-            scan_item< std::string >( item, *this, record );
-            return item;
-        }
+        scan_item< std::string >( item, *this, record );
         break;
     case type_tag::raw_string:
-        {
-            DeckItem item(this->name(), RawString());
-            scan_item<RawString>( item, *this, record );
-            return item;
-        }
+        scan_item<RawString>( item, *this, record );
         break;
     case type_tag::uda:
-        {
-            std::vector<Dimension> active_dimensions;
-            std::vector<Dimension> default_dimensions;
-            for (const auto& dim_string : this->m_dimensions) {
-                active_dimensions.push_back( active_unitsystem.getNewDimension(dim_string) );
-                default_dimensions.push_back( default_unitsystem.getNewDimension(dim_string) );
-            }
-
-            DeckItem item(this->name(), UDAValue(), active_dimensions, default_dimensions);
-            scan_item<UDAValue>(item, *this, record);
-            return item;
-        }
+        scan_item<UDAValue>(item, *this, record);
         break;
     default:
         throw std::logic_error( "ParserItem::scan: Fatal error; should not be reachable" );
     }
+
+    return item;
 }
 
 std::ostream& ParserItem::inlineClass( std::ostream& stream, const std::string& indent ) const {
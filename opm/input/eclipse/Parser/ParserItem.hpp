@@ -20,6 +20,7 @@
 #define PARSER_ITEM_H
 
 #include <iosfwd>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -118,6 +119,15 @@ namespace Opm {
         itype input_type = itype::UNKNOWN;
         bool m_defaultSet;
 
+        // Descriptors of the DeckItems created by scan(), one per pair of
+        // unit system types.  Shared with copies of this item, and replaced
+        // when the item's type or dimensions change.
+        struct DescriptorCache;
+        std::shared_ptr<DescriptorCache> m_descriptors;
+
+        std::shared_ptr<DeckItem::Descriptor>
+        descriptor(UnitSystem& active_unitsystem, UnitSystem& default_unitsystem) const;
+
         template< typename T > T& value_ref();
         template< typename T > const T& value_ref() const;
         template< typename T > void setDataType( T );
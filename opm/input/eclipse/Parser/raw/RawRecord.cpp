@@ -84,24 +84,29 @@ inline bool even_quotes( const T& str ) {
         m_sanitizedRecordString( singleRecordString )
     {
 
-        if (text)
+        if (text) {
             this->m_recordItems.push_back(this->m_sanitizedRecordString);
-        else {
-            this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
-
-            if( !even_quotes( singleRecordString ) ) {
-                std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
-                throw OpmInputError(error, location);
-            }
+            this->m_max_size = this->m_recordItems.size();
+            this->m_split = true;
+        }
+        else if( !even_quotes( singleRecordString ) ) {
+            std::string error = fmt::format("Quotes are not balanced in: \"{}\"", std::string(singleRecordString));
+            throw OpmInputError(error, location);
         }
-        this->m_max_size = this->m_recordItems.size();
     }
 
     RawRecord::RawRecord(const std::string_view& singleRecordString, const KeywordLocation& location) :
         RawRecord(singleRecordString, location, false)
     {}
 
+    void RawRecord::splitRecordString() const {
+        this->m_recordItems = splitSingleRecordString( m_sanitizedRecordString );
+        this->m_max_size = this->m_recordItems.size();
+        this->m_split = true;
+    }
+
     void RawRecord::push_front( std::string_view tok, std::size_t count ) {
+        this->split();
         this->m_recordItems.insert( this->m_recordItems.begin(), count, tok );
         this->m_max_size += count;
     }
@@ -111,6 +116,26 @@ inline bool even_quotes( const T& str ) {
     }
 
     std::size_t RawRecord::max_size() const {
+        this->split();
         return this->m_max_size;
     }
+
+    bool RawRecord::empty() const {
+        if (this->m_split)
+            return this->m_recordItems.empty();
+
+        return std::ranges::all_of(this->m_sanitizedRecordString, RawConsts::is_separator());
+    }
+
+    std::optional<std::string_view> RawRecord::unsplitRecordString() const {
+        if (this->m_split)
+            return {};
+
+        return this->m_sanitizedRecordString;
+    }
+
+    void RawRecord::consumeAll() {
+        this->m_recordItems.clear();
+        this->m_split = true;
+    }
 }
@@ -24,6 +24,7 @@
 #include <deque>
 #include <list>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
 
@@ -44,35 +45,59 @@ class KeywordLocation;
         void push_front( std::string_view token, std::size_t count );
         inline std::size_t size() const;
         std::size_t max_size() const;
+        bool empty() const;
 
         std::string getRecordString() const;
         inline std::string_view getItem(std::size_t index) const;
 
+        /// The record string, provided the record has not yet been split
+        /// into items.  Lets numeric data be scanned in bulk, without
+        /// splitting the record into individual tokens.
+        std::optional<std::string_view> unsplitRecordString() const;
+
+        /// Mark all items of the record as consumed.
+        void consumeAll();
+
     private:
         std::string_view m_sanitizedRecordString;
-        std::deque< std::string_view > m_recordItems;
-        std::size_t m_max_size;
+
+        // The record is split into items on first access.
+        mutable bool m_split = false;
+        mutable std::deque< std::string_view > m_recordItems;
+        mutable std::size_t m_max_size = 0;
+
+        inline void split() const;
+        void splitRecordString() const;
     };
 
     /*
      * These are frequently called, but fairly trivial in implementation, and
      * inlining the calls gives a decent low-effort performance benefit.
      */
+    void RawRecord::split() const {
+        if (! this->m_split)
+            this->splitRecordString();
+    }
+
     std::string_view RawRecord::pop_front() {
+        this->split();
         auto result = m_recordItems.front();
         this->m_recordItems.pop_front();
         return result;
     }
 
     std::string_view RawRecord::front() const {
+        this->split();
         return this->m_recordItems.front();
     }
 
     std::size_t RawRecord::size() const {
+        this->split();
         return m_recordItems.size();
     }
 
     std::string_view RawRecord::getItem(std::size_t index) const {
+        this->split();
         return this->m_recordItems.at( index );
     }
 }
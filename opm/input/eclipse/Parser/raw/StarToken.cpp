@@ -25,10 +25,13 @@
 #include <boost/spirit/include/qi.hpp>
 
 #include <cctype>
+#include <charconv>
+#include <cmath>
 #include <cstddef>
 #include <cstdlib>
 #include <stdexcept>
 #include <string>
+#include <system_error>
 
 namespace qi = boost::spirit::qi;
 
@@ -80,6 +83,14 @@ namespace Opm {
     template<>
     int readValueToken< int >( std::string_view view ) {
         int n = 0;
+
+        // Fast path for the common case.  Anything std::from_chars() does
+        // not accept, e.g., a leading '+', is left to the generic parser.
+        {
+            const auto [ptr, ec] = std::from_chars( view.data(), view.data() + view.size(), n );
+            if( ec == std::errc{} && ptr == view.data() + view.size() ) return n;
+        }
+
         auto cursor = view.begin();
         const bool ok = qi::parse( cursor, view.end(), qi::int_, n );
 
@@ -105,11 +116,28 @@ namespace Opm {
     template<>
     double readValueToken< double >( std::string_view view ) {
         double n = 0;
+
+        // Both parsers accept spellings like 'inf' and 'nan', which are
+        // never valid deck data.
+        auto finite = [view]( const double value ) {
+            if( ! std::isfinite( value ) )
+                throw std::invalid_argument( "Non-finite floating point number '" + std::string(view) + "'" );
+
+            return value;
+        };
+
+        // Fast path for the common case.  Fortran style exponents ('D')
+        // and leading '+' signs are left to the generic parser.
+        {
+            const auto [ptr, ec] = std::from_chars( view.data(), view.data() + view.size(), n );
+            if( ec == std::errc{} && ptr == view.data() + view.size() ) return finite( n );
+        }
+
         qi::real_parser< double, fortran_double< double > > double_;
         auto cursor = view.begin();
         const auto ok = qi::parse( cursor, view.end(), double_, n );
 
-        if( ok && cursor == view.end() ) return n;
+        if( ok && cursor == view.end() ) return finite( n );
         throw std::invalid_argument( "Malformed floating point number '" + std::string(view) + "'" );
     }
 
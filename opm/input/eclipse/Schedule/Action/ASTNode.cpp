@@ -21,10 +21,7 @@
 
 #include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
-#include <opm/input/eclipse/Schedule/Well/WList.hpp>
-#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
 
-#include <opm/common/utility/shmatch.hpp>
 #include <opm/common/utility/String.hpp>
 
 #include <algorithm>
@@ -186,6 +183,15 @@ void Opm::Action::ASTNode::add_child(ASTNode&& child)
 
 Opm::Action::Result
 Opm::Action::ASTNode::eval(const Context& context) const
+{
+    auto values = std::vector<Value>{};
+    this->collect_values(context, values);
+
+    return this->eval(values);
+}
+
+void Opm::Action::ASTNode::collect_values(const Context&      context,
+                                          std::vector<Value>& values) const
 {
     if (this->empty()) {
         throw std::invalid_argument {
@@ -196,10 +202,30 @@ Opm::Action::ASTNode::eval(const Context& context) const
     if ((this->type == TokenType::op_or) ||
         (this->type == TokenType::op_and))
     {
-        return this->evalLogicalOperation(context);
+        for (const auto& child : this->children) {
+            child.collect_values(context, values);
+        }
+
+        return;
+    }
+
+    this->collectComparisonValues(context, values);
+}
+
+Opm::Action::Result
+Opm::Action::ASTNode::eval(const std::vector<Value>& values) const
+{
+    auto pos = std::size_t{0};
+    auto result = this->evalNode(values, pos);
+
+    if (pos != values.size()) {
+        throw std::invalid_argument {
+            fmt::format("Expression uses {} comparison operands, "
+                        "but {} operands were provided", pos, values.size())
+        };
     }
 
-    return this->evalComparison(context);
+    return result;
 }
 
 void Opm::Action::ASTNode::
@@ -240,7 +266,27 @@ bool Opm::Action::ASTNode::empty() const
 // ===========================================================================
 
 Opm::Action::Result
-Opm::Action::ASTNode::evalLogicalOperation(const Context& context) const
+Opm::Action::ASTNode::evalNode(const std::vector<Value>& values,
+                               std::size_t&              pos) const
+{
+    if (this->empty()) {
+        throw std::invalid_argument {
+            "ASTNode::eval() should not reach leaf nodes"
+        };
+    }
+
+    if ((this->type == TokenType::op_or) ||
+        (this->type == TokenType::op_and))
+    {
+        return this->evalLogicalOperation(values, pos);
+    }
+
+    return this->evalComparison(values, pos);
+}
+
+Opm::Action::Result
+Opm::Action::ASTNode::evalLogicalOperation(const std::vector<Value>& values,
+                                           std::size_t&              pos) const
 {
     auto result = Result { this->type == TokenType::op_and };
 
@@ -250,14 +296,31 @@ Opm::Action::ASTNode::evalLogicalOperation(const Context& context) const
 
     // Recursive evaluation down tree.
     for (const auto& child : this->children) {
-        (result.*setOp)(child.eval(context));
+        (result.*setOp)(child.evalNode(values, pos));
     }
 
     return result;
 }
 
 Opm::Action::Result
-Opm::Action::ASTNode::evalComparison(const Context& context) const
+Opm::Action::ASTNode::evalComparison(const std::vector<Value>& values,
+                                     std::size_t&              pos) const
+{
+    if (values.size() < pos + 2) {
+        throw std::invalid_argument {
+            "Too few comparison operands for expression"
+        };
+    }
+
+    const auto& lhs = values[pos + 0];
+    const auto& rhs = values[pos + 1];
+    pos += 2;
+
+    return lhs.eval_cmp(this->type, rhs);
+}
+
+void Opm::Action::ASTNode::collectComparisonValues(const Context&      context,
+                                                   std::vector<Value>& values) const
 {
     auto v2 = Value {};
 
@@ -287,7 +350,8 @@ Opm::Action::ASTNode::evalComparison(const Context& context) const
         v2 = this->children[1].nodeValue(context);
     }
 
-    return this->children.front().nodeValue(context).eval_cmp(this->type, v2);
+    values.push_back(this->children.front().nodeValue(context));
+    values.push_back(std::move(v2));
 }
 
 Opm::Action::Value
@@ -343,52 +407,7 @@ Opm::Action::ASTNode::evalScalarExpression(const Context& context) const
 Opm::Action::Value
 Opm::Action::ASTNode::evalWellExpression(const Context& context) const
 {
-    auto well_values = Value{};
-
-    for (const auto& wname : this->getWellList(context)) {
-        well_values.add_well(wname, context.get(this->func, wname));
-    }
-
-    return well_values;
-}
-
-namespace {
-    std::string normalisePattern(const std::string& patt)
-    {
-        if (patt.front() == '\\') {
-            // Trim leading '\' character since the 'patt' might be
-            // something like
-            //
-            //    '\*P*'
-            //
-            // which denotes all wells (typically) whose names contain at
-            // least one 'P' anywhere in the name.  Without the leading
-            // backslash, the pattern would match all well lists whose names
-            // begin with 'P'.
-            return patt.substr(1);
-        }
-
-        return patt;
-    }
-} // Anonymous namespace
-
-std::vector<std::string>
-Opm::Action::ASTNode::getWellList(const Context& context) const
-{
-    if (this->argListIsWellList()) {
-        return context.wlist_manager().wells(this->arg_list.front());
-    }
-
-    const auto& wells = context.wells(this->func);
-
-    auto wnames = std::vector<std::string>{};
-    wnames.reserve(wells.size());
-
-    std::ranges::copy_if(wells, std::back_inserter(wnames),
-                         [wpatt = normalisePattern(this->arg_list.front())]
-                         (const auto& well) { return shmatch(wpatt, well); });
-
-    return wnames;
+    return context.wellValues(this->func, this->arg_list.front());
 }
 
 bool Opm::Action::ASTNode::argListIsPattern() const
@@ -396,10 +415,3 @@ bool Opm::Action::ASTNode::argListIsPattern() const
     return (this->arg_list.size() == 1)
         && (this->arg_list.front().find("*") != std::string::npos);
 }
-
-bool Opm::Action::ASTNode::argListIsWellList() const
-{
-    const auto& well_arg = this->arg_list.front();
-
-    return (well_arg.size() > 1) && (well_arg.front() == '*');
-}
@@ -126,6 +126,27 @@ public:
     /// true will be included in the result set.
     Result eval(const Context& context) const;
 
+    /// Collect operands of all comparisons in logical expression.
+    ///
+    /// Together with eval(const std::vector<Value>&), splits eval() into
+    /// reading the current dynamic state and evaluating the expression.
+    ///
+    /// \param[in] context Current summary vector values and well query
+    /// object.
+    ///
+    /// \param[in,out] values Comparison operands.  On exit, also contains
+    /// the left and right-hand sides of all comparisons in this node and,
+    /// recursively, its children in evaluation order.
+    void collect_values(const Context& context, std::vector<Value>& values) const;
+
+    /// Evaluate logical expression from comparison operands.
+    ///
+    /// \param[in] values Comparison operands formed by collect_values().
+    ///
+    /// \return Expression value.  Any wells for which the expression is
+    /// true will be included in the result set.
+    Result eval(const std::vector<Value>& values) const;
+
     /// Export all summary vectors needed to compute values for the
     /// current collection of user defined quantities.
     ///
@@ -182,28 +203,48 @@ private:
     /// Child nodes of this AST node.
     std::vector<ASTNode> children{};
 
+    /// Evaluate node from comparison operands.
+    ///
+    /// \param[in] values Comparison operands formed by collect_values().
+    ///
+    /// \param[in,out] pos Position of this node's first operand in \p
+    /// values.  On exit, position of the first operand following those
+    /// of this node.
+    ///
+    /// \return Expression value.  Any wells for which the expression is
+    /// true will be included in the result set.
+    Result evalNode(const std::vector<Value>& values, std::size_t& pos) const;
+
     /// Evaluate a conjunction/disjunction ('AND'/'OR') node.
     ///
-    /// This is a top-level entry point for eval().
+    /// \param[in] values Comparison operands formed by collect_values().
     ///
-    /// \param[in] context Current summary vector values and well query
-    /// object.
+    /// \param[in,out] pos Position of this node's first operand in \p
+    /// values.
     ///
     /// \return Expression value.  Any wells for which the expression is
     /// true will be included in the result set.
-    Result evalLogicalOperation(const Context& context) const;
+    Result evalLogicalOperation(const std::vector<Value>& values, std::size_t& pos) const;
 
     /// Evaluate a leaf-level comparison ('<', '=', '>=' &c) node.
     ///
-    /// This is a top-level entry point for eval() when the node itself is a
-    /// leaf-level condition.
+    /// \param[in] values Comparison operands formed by collect_values().
     ///
-    /// \param[in] context Current summary vector values and well query
-    /// object.
+    /// \param[in,out] pos Position of this node's left-hand side in \p
+    /// values.
     ///
     /// \return Expression value.  Any wells for which the expression is
     /// true will be included in the result set.
-    Result evalComparison(const Context& context) const;
+    Result evalComparison(const std::vector<Value>& values, std::size_t& pos) const;
+
+    /// Compute left and right-hand sides of a leaf-level comparison node.
+    ///
+    /// \param[in] context Current summary vector values and well query
+    /// object.
+    ///
+    /// \param[in,out] values Comparison operands.  On exit, also contains
+    /// the left and right-hand sides, in that order, of this comparison.
+    void collectComparisonValues(const Context& context, std::vector<Value>& values) const;
 
     /// Compute numeric value of leaf node and collect associated entities.
     ///
@@ -260,24 +301,9 @@ private:
     /// the function argument list.
     Value evalWellExpression(const Context& context) const;
 
-    /// Compute list of well names matching a name pattern.
-    ///
-    /// \param[in] context Current summary vector values and well query
-    /// object.
-    ///
-    /// \return Names of all wells matching the well name pattern in \code
-    /// arg_list.front() \endcode, irrespective of whether the pattern is a
-    /// well template, a well list, or a well list template.
-    std::vector<std::string> getWellList(const Context& context) const;
-
     /// Query whether or not the front of the function argument list (\code
     /// arg_list.front() \endcode) is a name pattern.
     bool argListIsPattern() const;
-
-    /// Query whether or not the front of the function argument list (\code
-    /// arg_list.front() \endcode) is the name of a well list or a well list
-    /// template (pattern).
-    bool argListIsWellList() const;
 };
 
 } // namespace Opm::Action
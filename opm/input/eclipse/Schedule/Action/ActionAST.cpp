@@ -91,6 +91,26 @@ Opm::Action::AST::eval(const Action::Context& context) const
     return this->condition->eval(context);
 }
 
+void Opm::Action::AST::collect_values(const Context&      context,
+                                      std::vector<Value>& values) const
+{
+    if ((this->condition == nullptr) || this->condition->empty()) {
+        return;
+    }
+
+    this->condition->collect_values(context, values);
+}
+
+Opm::Action::Result
+Opm::Action::AST::eval(const std::vector<Value>& values) const
+{
+    if ((this->condition == nullptr) || this->condition->empty()) {
+        return Result { false };
+    }
+
+    return this->condition->eval(values);
+}
+
 bool Opm::Action::AST::operator==(const AST& data) const
 {
     const auto isNull = this->condition == nullptr;
@@ -31,6 +31,7 @@ namespace Opm::Action {
 
 class Context;
 class ASTNode;
+class Value;
 
 } // namespace Opm::Action
 
@@ -102,6 +103,23 @@ public:
     /// included in the result set.  A 'false' result has no matching wells.
     Result eval(const Context& context) const;
 
+    /// Collect operands of all comparisons in the expression tree.
+    ///
+    /// \param[in] context Current summary vectors and wells
+    ///
+    /// \param[in,out] values Comparison operands.  On exit, also contains
+    /// the operands of all comparisons in this expression tree in
+    /// evaluation order.
+    void collect_values(const Context& context, std::vector<Value>& values) const;
+
+    /// Evaluate the expression tree from comparison operands.
+    ///
+    /// \param[in] values Comparison operands formed by collect_values().
+    ///
+    /// \return Condition value.  Same as eval(const Context&) for the
+    /// context from which \p values were collected.
+    Result eval(const std::vector<Value>& values) const;
+
     /// Equality predicate.
     ///
     /// \param[in] data Object against which \code *this \endcode will
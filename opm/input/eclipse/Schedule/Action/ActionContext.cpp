@@ -21,14 +21,20 @@
 
 #include <opm/common/utility/TimeService.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/Well/WListManager.hpp>
+
+#include <opm/common/utility/shmatch.hpp>
 
 #include <fmt/format.h>
 
+#include <cstddef>
 #include <functional>
 #include <map>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace {
@@ -37,6 +43,29 @@ namespace {
     {
         return fmt::format("{}:{}", function, argument);
     }
+
+    std::string normalisePattern(const std::string& patt)
+    {
+        if (patt.front() == '\\') {
+            // Trim leading '\' character since the 'patt' might be
+            // something like
+            //
+            //    '\*P*'
+            //
+            // which denotes all wells (typically) whose names contain at
+            // least one 'P' anywhere in the name.  Without the leading
+            // backslash, the pattern would match all well lists whose names
+            // begin with 'P'.
+            return patt.substr(1);
+        }
+
+        return patt;
+    }
+
+    bool isWellList(const std::string& wellSet)
+    {
+        return (wellSet.size() > 1) && (wellSet.front() == '*');
+    }
 }
 
 Opm::Action::Context::Context(const SummaryState& summary_state,
@@ -60,6 +89,7 @@ void Opm::Action::Context::add(const std::string& func,
                                const double       value)
 {
     this->values_.insert_or_assign(func, value);
+    this->wellSelections_.clear();
 }
 
 double Opm::Action::Context::get(std::string_view func,
@@ -82,3 +112,70 @@ Opm::Action::Context::wells(const std::string& key) const
 {
     return this->summaryState_.get().wells(key);
 }
+
+Opm::Action::Value
+Opm::Action::Context::wellValues(const std::string& func,
+                                 const std::string& wellSet) const
+{
+    if (isWellList(wellSet)) {
+        auto wells = this->wListMgr_.get().wells(wellSet);
+
+        auto values = std::vector<double>(wells.size());
+        for (auto i = std::size_t{0}; i < wells.size(); ++i) {
+            values[i] = this->get(func, wells[i]);
+        }
+
+        return Value { std::move(wells), std::move(values) };
+    }
+
+    const auto& selection = this->wellSelection(func, wellSet);
+    const auto& st = this->summaryState_.get();
+
+    auto values = std::vector<double>(selection.wells.size());
+    for (auto i = std::size_t{0}; i < values.size(); ++i) {
+        const auto& handle = selection.handles[i];
+
+        values[i] = (! selection.assigned && st.has(handle))
+            ? st.get(handle)
+            : this->get(func, selection.wells[i]);
+    }
+
+    return Value { selection.wells, std::move(values) };
+}
+
+const Opm::Action::Context::WellSelection&
+Opm::Action::Context::wellSelection(const std::string& func,
+                                    const std::string& pattern) const
+{
+    const auto& st = this->summaryState_.get();
+
+    auto& selection = this->wellSelections_[combinedKey(func, pattern)];
+    if ((selection.wellSetVersion == st.well_set_version()) &&
+        (selection.handles.empty() || st.is_valid(selection.handles.front())))
+    {
+        return selection;
+    }
+
+    const auto wpatt = normalisePattern(pattern);
+
+    selection.wells.clear();
+    selection.handles.clear();
+    selection.assigned = false;
+
+    for (const auto& well : this->wells(func)) {
+        if (! shmatch(wpatt, well)) {
+            continue;
+        }
+
+        const auto key = combinedKey(func, well);
+
+        selection.wells.push_back(well);
+        selection.handles.push_back(st.find(key));
+        selection.assigned = selection.assigned
+            || (this->values_.find(key) != this->values_.end());
+    }
+
+    selection.wellSetVersion = st.well_set_version();
+
+    return selection;
+}
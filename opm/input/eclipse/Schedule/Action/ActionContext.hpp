@@ -20,15 +20,19 @@
 #ifndef ActionContext_HPP
 #define ActionContext_HPP
 
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+
+#include <cstdint>
 #include <functional>
 #include <map>
+#include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 namespace Opm {
 
-class SummaryState;
 class WListManager;
 
 } // namespace Opm
@@ -95,6 +99,26 @@ public:
     /// \return All wells for which the named summary function is defined.
     std::vector<std::string> wells(const std::string& func) const;
 
+    /// Retrieve function values for a set of wells.
+    ///
+    /// The set of wells matching a well name pattern is formed once and
+    /// reused until the wells for which the function is defined change,
+    /// and the values are read through interned summary vector handles.
+    /// Conditions such as
+    ///
+    ///   WOPR 'OP*' > 1000
+    ///
+    /// therefore do not match well names on every evaluation.
+    ///
+    /// \param[in] func Named well-level summary function, e.g., WOPR or
+    /// WMCTL.
+    ///
+    /// \param[in] wellSet Well name pattern, well list, or well list
+    /// pattern.
+    ///
+    /// \return Function values for all wells in \p wellSet.
+    Value wellValues(const std::string& func, const std::string& wellSet) const;
+
     /// Get read-only access to run's well lists.
     ///
     /// Convenience method.
@@ -115,6 +139,38 @@ private:
     /// Primary source for get() requests, and only object for which add()
     /// requests are destined.
     std::map<std::string, double> values_{};
+
+    /// Wells matching a well name pattern.
+    struct WellSelection
+    {
+        /// Version of the summary state's well set when the selection was
+        /// formed.  Nullopt if the selection has not yet been formed.
+        std::optional<std::uint64_t> wellSetVersion{};
+
+        /// Wells matching the pattern.
+        std::vector<std::string> wells{};
+
+        /// Summary vector handles of function values.  One handle for
+        /// each well in \c wells.
+        std::vector<SummaryState::Handle> handles{};
+
+        /// Whether or not any function value is assigned through add().
+        bool assigned{false};
+    };
+
+    /// Well selections, keyed by function and well name pattern.
+    ///
+    /// Cleared whenever a function value is assigned through add().
+    mutable std::map<std::string, WellSelection> wellSelections_{};
+
+    /// Retrieve, and if needed form, selection of wells matching a
+    /// pattern.
+    ///
+    /// \param[in] func Named well-level summary function.
+    ///
+    /// \param[in] pattern Well name pattern.
+    const WellSelection&
+    wellSelection(const std::string& func, const std::string& pattern) const;
 };
 
 } // namespace Opm::Action
@@ -21,10 +21,15 @@
 
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -73,6 +78,49 @@ bool scalarComparisonHolds(const double                 lhs,
     }
 }
 
+/// Evaluate comparison for all elements of a dense value array.
+///
+/// The comparison operator is resolved once, outside the loop, so that
+/// the compiler is free to vectorise the loop body.
+template <typename Compare>
+void compareAll(const std::vector<double>&  lhs,
+                const double                rhs,
+                Compare&&                   cmp,
+                std::vector<unsigned char>& holds)
+{
+    const auto n = lhs.size();
+    for (auto i = std::size_t{0}; i < n; ++i) {
+        holds[i] = cmp(lhs[i], rhs);
+    }
+}
+
+void compareAll(const std::vector<double>&   lhs,
+                const Opm::Action::TokenType op,
+                const double                 rhs,
+                std::vector<unsigned char>&  holds)
+{
+    switch (op) {
+    case Opm::Action::TokenType::op_gt: compareAll(lhs, rhs, std::greater<>{},       holds); break;
+    case Opm::Action::TokenType::op_ge: compareAll(lhs, rhs, std::greater_equal<>{}, holds); break;
+    case Opm::Action::TokenType::op_lt: compareAll(lhs, rhs, std::less<>{},          holds); break;
+    case Opm::Action::TokenType::op_le: compareAll(lhs, rhs, std::less_equal<>{},    holds); break;
+    case Opm::Action::TokenType::op_eq: compareAll(lhs, rhs, std::equal_to<>{},      holds); break;
+    case Opm::Action::TokenType::op_ne: compareAll(lhs, rhs, std::not_equal_to<>{},  holds); break;
+
+    default:
+        throw std::invalid_argument {
+            fmt::format("Unexpected operator '{}' -- expected comparison",
+                        tokenString(op))
+        };
+    }
+}
+
+bool closeValues(const double x, const double y, const double tolerance)
+{
+    return (x == y)
+        || (std::abs(x - y) <= tolerance * std::max(std::abs(x), std::abs(y)));
+}
+
 bool isComparisonOperator(const Opm::Action::TokenType op)
 {
     // Alternatives listed in order of increasing enumerator values in
@@ -100,6 +148,22 @@ Opm::Action::Value::Value(std::string_view wname,
     this->add_well(wname, value);
 }
 
+Opm::Action::Value::Value(std::vector<std::string> wells,
+                          std::vector<double>      values)
+    : scalar_value_ { 0.0 }
+    , well_names_   { std::move(wells) }
+    , well_values_  { std::move(values) }
+{
+    if (this->well_names_.size() != this->well_values_.size()) {
+        throw std::invalid_argument {
+            fmt::format("Number of well values ({}) does not "
+                        "match number of wells ({})",
+                        this->well_values_.size(),
+                        this->well_names_.size())
+        };
+    }
+}
+
 Opm::Action::Result
 Opm::Action::Value::eval_cmp(const TokenType op, const Value& rhs) const
 {
@@ -134,7 +198,8 @@ void Opm::Action::Value::add_well(std::string_view well, const double value)
         };
     }
 
-    this->well_values_.emplace_back(well, value);
+    this->well_names_.emplace_back(well);
+    this->well_values_.push_back(value);
 }
 
 double Opm::Action::Value::scalar() const
@@ -149,6 +214,22 @@ double Opm::Action::Value::scalar() const
     return this->scalar_value_;
 }
 
+bool Opm::Action::Value::isClose(const Value& other, const double tolerance) const
+{
+    if (this->is_scalar_ != other.is_scalar_) {
+        return false;
+    }
+
+    if (this->is_scalar_) {
+        return closeValues(this->scalar_value_, other.scalar_value_, tolerance);
+    }
+
+    return (this->well_names_ == other.well_names_)
+        && std::ranges::equal(this->well_values_, other.well_values_,
+                              [tolerance](const double x, const double y)
+                              { return closeValues(x, y, tolerance); });
+}
+
 // ===========================================================================
 // Private member functions
 // ===========================================================================
@@ -157,11 +238,14 @@ Opm::Action::Result
 Opm::Action::Value::evalWellComparisons(const TokenType op,
                                         const double    rhs) const
 {
+    auto holds = std::vector<unsigned char>(this->well_values_.size());
+    compareAll(this->well_values_, op, rhs, holds);
+
     auto matching_wells = std::vector<std::string> {};
 
-    for (const auto& [well, value] : this->well_values_) {
-        if (scalarComparisonHolds(value, op, rhs)) {
-            matching_wells.push_back(well);
+    for (auto i = std::size_t{0}; i < holds.size(); ++i) {
+        if (holds[i]) {
+            matching_wells.push_back(this->well_names_[i]);
         }
     }
 
@@ -139,6 +139,16 @@ public:
     /// Creates a non-scalar Value object associated to a single well.
     Value(std::string_view wname, double value);
 
+    /// Constructor.
+    ///
+    /// Creates a non-scalar Value object associated to a set of wells.
+    ///
+    /// \param[in] wells Well names.
+    ///
+    /// \param[in] values Numeric function values.  One value for each
+    /// well in \p wells.
+    Value(std::vector<std::string> wells, std::vector<double> values);
+
     /// Compare current Value to another Value.
     ///
     /// \param[in] op Comparison operator.  Must be one of
@@ -180,6 +190,21 @@ public:
     /// \endcode was not created as a scalar object.
     double scalar() const;
 
+    /// Whether or not the current Value is numerically close to another.
+    ///
+    /// Two scalar values are close if they differ by no more than \p
+    /// tolerance relative to the larger magnitude.  Two non-scalar values
+    /// are close if they refer to the same wells, in the same order, and
+    /// the values of each well are close.  A zero \p tolerance demands
+    /// exact equality, which means that comparisons against either value
+    /// produce identical results.
+    ///
+    /// \param[in] other Value object against which \code *this \endcode
+    /// will be compared.
+    ///
+    /// \param[in] tolerance Relative tolerance.
+    bool isClose(const Value& other, double tolerance) const;
+
 private:
     /// Numeric value of scalar Value object.
     ///
@@ -189,8 +214,12 @@ private:
     /// Whether or not current Value represents a scalar.
     double is_scalar_{false};
 
-    /// Collection of function values associated to individual wells.
-    std::vector<std::pair<std::string, double>> well_values_{};
+    /// Names of wells with function values.
+    std::vector<std::string> well_names_{};
+
+    /// Function values associated to individual wells.  One value for
+    /// each well in \c well_names_.
+    std::vector<double> well_values_{};
 
     /// Compare current list of well values to another Value
     ///
@@ -232,6 +232,17 @@ Result ActionX::eval(const Action::Context& context) const
     return this->condition.eval(context);
 }
 
+void ActionX::collect_values(const Action::Context& context,
+                             std::vector<Value>&    values) const
+{
+    this->condition.collect_values(context, values);
+}
+
+Result ActionX::eval(const std::vector<Value>& values) const
+{
+    return this->condition.eval(values);
+}
+
 std::vector<std::string>
 ActionX::wellpi_wells(const WellMatcher&              well_matcher,
                       const Result::MatchingEntities& matches) const
@@ -22,6 +22,7 @@
 
 #include <opm/input/eclipse/Schedule/Action/ActionAST.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
 #include <opm/input/eclipse/Schedule/Action/Condition.hpp>
 
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
@@ -197,6 +198,23 @@ public:
     /// wells.
     Result eval(const Context& context) const;
 
+    /// Collect operands of all comparisons in the action's conditions.
+    ///
+    /// \param[in] context Current summary vectors and wells
+    ///
+    /// \param[in,out] values Comparison operands.  On exit, also contains
+    /// the operands of all comparisons in the condition block in
+    /// evaluation order.
+    void collect_values(const Context& context, std::vector<Value>& values) const;
+
+    /// Evaluate the action's conditions from comparison operands.
+    ///
+    /// \param[in] values Comparison operands formed by collect_values().
+    ///
+    /// \return Condition value.  Same as eval(const Context&) for the
+    /// context from which \p values were collected.
+    Result eval(const std::vector<Value>& values) const;
+
     /// Retrive list of well names used in action block WELPI keywords
     ///
     /// \param[in] well_matcher Final arbiter for wells currently known to
@@ -0,0 +1,77 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/Action/ConditionCache.hpp>
+
+#include <opm/input/eclipse/Schedule/Action/ActionContext.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <utility>
+#include <vector>
+
+Opm::Action::ConditionCache::ConditionCache(const double tolerance)
+    : tolerance_ { tolerance }
+{}
+
+Opm::Action::Result
+Opm::Action::ConditionCache::eval(const ActionX& action, const Context& context)
+{
+    auto values = std::vector<Value>{};
+    action.collect_values(context, values);
+
+    auto pos = this->entries_.find(action.name());
+    if ((pos != this->entries_.end()) &&
+        (pos->second.id == action.id()) &&
+        this->unchanged(pos->second, values))
+    {
+        ++this->num_reused_;
+        return pos->second.result;
+    }
+
+    auto result = action.eval(values);
+    ++this->num_evaluated_;
+
+    this->entries_.insert_or_assign(action.name(),
+                                    Entry { action.id(), std::move(values), result });
+
+    return result;
+}
+
+void Opm::Action::ConditionCache::clear()
+{
+    this->entries_.clear();
+}
+
+// ===========================================================================
+// Private member functions
+// ===========================================================================
+
+bool Opm::Action::ConditionCache::unchanged(const Entry&              entry,
+                                            const std::vector<Value>& values) const
+{
+    return std::ranges::equal(entry.values, values,
+                              [tol = this->tolerance_]
+                              (const Value& prev, const Value& curr)
+                              { return curr.isClose(prev, tol); });
+}
@@ -0,0 +1,121 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef ACTION_CONDITION_CACHE_HPP
+#define ACTION_CONDITION_CACHE_HPP
+
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionValue.hpp>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm::Action {
+
+class ActionX;
+class Context;
+
+} // namespace Opm::Action
+
+namespace Opm::Action {
+
+/// Incremental evaluation of ACTIONX conditions.
+///
+/// Records the operands of every comparison in an action's condition
+/// block--e.g., the current WWCT values of the wells matching 'OP*'--along
+/// with the resulting condition value.  On subsequent evaluations the
+/// previous result is reused if none of the operands changed by more than
+/// a relative tolerance.  Reading the operands is typically much cheaper
+/// than forming the result, which involves combining sets of matching
+/// wells, so this pays off for runs with many actions watching a few
+/// slowly varying quantities.
+///
+/// With the default tolerance of zero, the result is always the same as
+/// that of ActionX::eval().  A positive tolerance trades accuracy for
+/// speed and may delay triggering an action whose operands drift slowly
+/// across a threshold.
+class ConditionCache
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] tolerance Relative tolerance within which a changed
+    /// comparison operand is considered unchanged.
+    explicit ConditionCache(double tolerance = 0.0);
+
+    /// Evaluate an action's conditions at current dynamic state.
+    ///
+    /// \param[in] action Action object.
+    ///
+    /// \param[in] context Current summary vectors and wells.
+    ///
+    /// \return Condition value.  Same as \code action.eval(context)
+    /// \endcode, subject to the tolerance.
+    Result eval(const ActionX& action, const Context& context);
+
+    /// Forget all recorded operands and results.
+    void clear();
+
+    /// Number of eval() calls which reused a previous result.
+    std::size_t numReused() const { return this->num_reused_; }
+
+    /// Number of eval() calls which evaluated the condition block.
+    std::size_t numEvaluated() const { return this->num_evaluated_; }
+
+private:
+    /// Operands and result from the last evaluation of a single action.
+    struct Entry
+    {
+        /// Distinguishing numeric ID of the action object.  Changes when
+        /// the action is redefined.
+        std::size_t id{};
+
+        /// Comparison operands.
+        std::vector<Value> values{};
+
+        /// Condition value.
+        Result result{false};
+    };
+
+    /// Relative tolerance for comparison operands.
+    double tolerance_{0.0};
+
+    /// Last evaluation of each action, keyed by action name.
+    std::unordered_map<std::string, Entry> entries_{};
+
+    /// Number of eval() calls which reused a previous result.
+    std::size_t num_reused_{0};
+
+    /// Number of eval() calls which evaluated the condition block.
+    std::size_t num_evaluated_{0};
+
+    /// Whether or not a set of comparison operands is close to the
+    /// operands recorded for an action.
+    ///
+    /// \param[in] entry Last evaluation of action.
+    ///
+    /// \param[in] values Current comparison operands.
+    bool unchanged(const Entry& entry, const std::vector<Value>& values) const;
+};
+
+} // namespace Opm::Action
+
+#endif // ACTION_CONDITION_CACHE_HPP
@@ -816,11 +816,12 @@ void handleNODEPROP(HandlerContext& handlerContext)
         }
 
         if (handlerContext.state().groups.has(name)) {
-            auto& group = handlerContext.state().groups.get(name);
+            auto group = handlerContext.state().groups.get(name);
             node.set_efficiency(group.getGroupEfficiencyFactor(/*network*/ true));
 
             if (as_choke) {
                 group.as_choke(name);
+                handlerContext.state().groups.update(group);
                 if (group.wellgroup()) {
                     // Wells belong to a group with autochoke enabled are to be run on a common THP and should not have guide rates
                     for (const std::string& wellName : group.wells()) {
@@ -134,10 +134,66 @@ namespace {
                                    [&name](const auto& pattern)
                                    { return Opm::shmatch(pattern, name); });
     }
+
+    // Marks a lazily loaded Schedule as loading while in scope, such that
+    // queries see only the report steps loaded so far and do not load more.
+    class LoadingScope
+    {
+    public:
+        explicit LoadingScope(bool* loading)
+            : loading_ { loading }
+        {
+            if (this->loading_ != nullptr) {
+                this->previous_ = std::exchange(*this->loading_, true);
+            }
+        }
+
+        ~LoadingScope()
+        {
+            if (this->loading_ != nullptr) {
+                *this->loading_ = this->previous_;
+            }
+        }
+
+        LoadingScope(const LoadingScope&) = delete;
+        LoadingScope& operator=(const LoadingScope&) = delete;
+
+    private:
+        bool* loading_{nullptr};
+        bool previous_{false};
+    };
 }
 
 namespace Opm {
 
+    struct Schedule::LazyLoad
+    {
+        const EclipseGrid* grid{nullptr};
+        const FieldPropsManager* fp{nullptr};
+        const NumericalAquifers* numAquifers{nullptr};
+        ParseContext parseContext{};
+        bool keepKeywords{true};
+
+        // Well PI targets passed to the most recent action.  Report steps
+        // loaded after the action use these, as do the report steps which
+        // an eagerly loaded Schedule re-runs after the action.
+        std::optional<std::unordered_map<std::string, double>> target_wellpi{};
+
+        // Multisegment well keywords seen in all report steps loaded so far,
+        // for the consistency checks in iterateScheduleSection().
+        WelSegsSet welsegs_wells{};
+        std::set<std::string> compsegs_wells{};
+        std::set<std::string> comptraj_wells{};
+
+        // Report steps before this one have been released.
+        std::size_t first_retained{0};
+
+        // Whether or not report steps are being loaded.  Queries made while
+        // loading see the report steps loaded so far, as when constructing
+        // the Schedule up front.
+        bool loading{false};
+    };
+
     Schedule::Schedule( const Deck& deck,
                         const EclipseGrid& ecl_grid,
                         const FieldPropsManager& fp,
@@ -151,7 +207,8 @@ namespace Opm {
                         bool keepKeywords,
                         const std::optional<int>& output_interval,
                         const RestartIO::RstState * rst,
-                        const TracerConfig * tracer_config)
+                        const TracerConfig * tracer_config,
+                        const bool lazyLoad)
     try :
         m_static(python, ScheduleRestartInfo(rst, deck), deck, runspec,
                  output_interval, parseContext, errors, slave_mode)
@@ -183,22 +240,45 @@ namespace Opm {
                            section.has_keyword("PYACTION");
         }
 
+        if (rst && !keepKeywords) {
+            keepKeywords = !rst->actions.empty();
+        }
+
+        // In lazy mode only the first report step to be simulated is loaded
+        // here, and the remaining report steps on first access.
+        auto load_end = this->m_sched_deck.size();
+        if (lazyLoad) {
+            this->lazy_load = std::make_shared<LazyLoad>();
+            this->lazy_load->grid = &ecl_grid;
+            this->lazy_load->fp = &fp;
+            this->lazy_load->numAquifers = (numAquifers.size() > 0) ? &numAquifers : nullptr;
+            this->lazy_load->parseContext = parseContext;
+            this->lazy_load->keepKeywords = keepKeywords;
+            this->lazy_load->loading = true;
+
+            // Room for all report steps, so that loading report steps
+            // later does not invalidate references to loaded ones.
+            this->snapshots.reserve(this->m_sched_deck.size());
+
+            // Connections which actions may open in the future are needed
+            // up front, e.g., by the grid partitioner.
+            this->prefetchActionConnections(grid, parseContext, errors);
+
+            load_end = std::min(load_end, (rst ? this->m_static.rst_info.report_step : 0) + std::size_t{1});
+        }
+
         if (rst) {
             if (!tracer_config) {
                 throw std::logic_error("Bug: when loading from restart a valid TracerConfig object must be supplied");
             }
 
-            if (!keepKeywords) {
-                keepKeywords = !rst->actions.empty();
-            }
-
             auto restart_step = this->m_static.rst_info.report_step;
             this->iterateScheduleSection(0, restart_step, parseContext, errors,
                                          grid, nullptr, "", keepKeywords);
             this->load_rst(*rst, *tracer_config, grid, fp);
             if (! this->restart_output.writeRestartFile(restart_step))
                 this->restart_output.addRestartOutput(restart_step);
-            this->iterateScheduleSection(restart_step, this->m_sched_deck.size(),
+            this->iterateScheduleSection(restart_step, load_end,
                                          parseContext, errors, grid, nullptr, "", keepKeywords);
             // Events added during restart reading well be added to previous step, but need to be active at the
             // restart step to ensure well potentials and guide rates are available at the first step.
@@ -207,9 +287,13 @@ namespace Opm {
             this->snapshots[restart_step].wellcompletion_events().merge(this->snapshots[prev_step].wellcompletion_events());
             this->snapshots[restart_step].events().merge(this->snapshots[prev_step].events());
         } else {
-            this->iterateScheduleSection(0, this->m_sched_deck.size(),
+            this->iterateScheduleSection(0, load_end,
                                          parseContext, errors, grid, nullptr, "", keepKeywords);
         }
+
+        if (this->lazy_load) {
+            this->lazy_load->loading = false;
+        }
     }
     catch (const OpmInputError& opm_error) {
         OpmLog::error(opm_error.what());
@@ -235,7 +319,8 @@ namespace Opm {
                         const bool keepKeywords,
                         const std::optional<int>& output_interval,
                         const RestartIO::RstState * rst,
-                        const TracerConfig* tracer_config)
+                        const TracerConfig* tracer_config,
+                        const bool lazyLoad)
         : Schedule(deck,
                    grid,
                    fp,
@@ -249,7 +334,8 @@ namespace Opm {
                    keepKeywords,
                    output_interval,
                    rst,
-                   tracer_config)
+                   tracer_config,
+                   lazyLoad)
     {}
 
     Schedule::Schedule( const Deck& deck,
@@ -414,8 +500,8 @@ namespace Opm {
     std::time_t Schedule::posixEndTime() const {
         // This should indeed access the start_time() property of the last
         // snapshot.
-        if (this->snapshots.size() > 0)
-            return std::chrono::system_clock::to_time_t(this->snapshots.back().start_time());
+        if (this->size() > 0)
+            return std::chrono::system_clock::to_time_t(this->reportStepStart(this->size() - 1));
         else
             return this->posixStartTime( );
     }
@@ -686,9 +772,15 @@ void Schedule::iterateScheduleSection(std::size_t load_start, std::size_t load_e
                                location.lineno));
         }
 
-        std::set<std::string> compsegs_wells;
-        std::set<std::string> comptraj_wells;
-        WelSegsSet welsegs_wells;
+        // Lazily loaded Schedules check multisegment well keywords across
+        // all report steps loaded so far, not only those of this call.
+        std::set<std::string> local_compsegs_wells;
+        std::set<std::string> local_comptraj_wells;
+        WelSegsSet local_welsegs_wells;
+
+        auto& compsegs_wells = this->lazy_load ? this->lazy_load->compsegs_wells : local_compsegs_wells;
+        auto& comptraj_wells = this->lazy_load ? this->lazy_load->comptraj_wells : local_comptraj_wells;
+        auto& welsegs_wells = this->lazy_load ? this->lazy_load->welsegs_wells : local_welsegs_wells;
 
         const auto matches = Action::Result { false }.matches();
 
@@ -946,6 +1038,29 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
         }
     }
 
+    void Schedule::prefetchActionConnections(const ScheduleGrid& grid,
+                                             const ParseContext& parseContext,
+                                             ErrorGuard& errors)
+    {
+        for (std::size_t report_step = 0; report_step < this->m_sched_deck.size(); ++report_step) {
+            auto in_action = false;
+            for (const auto& keyword : this->m_sched_deck[report_step]) {
+                if (keyword.is<ParserKeywords::ACTIONX>()) {
+                    in_action = true;
+                }
+                else if (keyword.is<ParserKeywords::ENDACTIO>()) {
+                    in_action = false;
+                }
+                else if (in_action &&
+                         (this->m_lowActionParsingStrictness ||
+                          Action::ActionX::valid_keyword(keyword.name())))
+                {
+                    this->prefetchPossibleFutureConnections(grid, keyword, parseContext, errors);
+                }
+            }
+        }
+    }
+
     void Schedule::shut_well(const std::string& well_name, std::size_t report_step) {
         this->internalWELLSTATUSACTIONXFromPYACTION(well_name, report_step, "SHUT");
     }
@@ -1009,7 +1124,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
         if (status != Well::Status::SHUT) {
             this->potential_wellopen_patterns.insert(well_name);
         }
-        auto& snapshot = this->snapshots[reportStep];
+        auto& snapshot = this->mutableSnapshot(reportStep);
         auto well2 = snapshot.wells.get(well_name);
         if (well2.getConnections().empty() && status == Well::Status::OPEN) {
             if (location) {
@@ -1054,32 +1169,36 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     void Schedule::clear_event(ScheduleEvents::Events event, std::size_t report_step) {
-        auto events = this->snapshots[report_step].events();
+        auto& sched_state = this->mutableSnapshot(report_step);
+        auto events = sched_state.events();
         events.clearEvent(event);
-        this->snapshots[report_step].update_events(events);
+        sched_state.update_events(events);
     }
 
     void Schedule::add_event(ScheduleEvents::Events event, std::size_t report_step)
     {
-        auto events = this->snapshots[report_step].events();
+        auto& sched_state = this->mutableSnapshot(report_step);
+        auto events = sched_state.events();
         events.addEvent(event);
-        this->snapshots[report_step].update_events(events);
+        sched_state.update_events(events);
     }
 
     void Schedule::clearEvents(const std::size_t report_step)
     {
-        this->snapshots[report_step].events().reset();
-        this->snapshots[report_step].wellgroup_events().reset();
-        this->snapshots[report_step].wellcompletion_events().reset();
+        auto& sched_state = this->mutableSnapshot(report_step);
+        sched_state.events().reset();
+        sched_state.wellgroup_events().reset();
+        sched_state.wellcompletion_events().reset();
     }
 
 
     bool Schedule::updateWPAVE(const std::string& wname, std::size_t report_step, const PAvg& pavg) {
         const auto& well = this->getWell(wname, report_step);
         if (well.pavg() != pavg) {
-            auto new_well = this->snapshots[report_step].wells.get(wname);
+            auto& sched_state = this->mutableSnapshot(report_step);
+            auto new_well = sched_state.wells.get(wname);
             new_well.updateWPAVE( pavg );
-            this->snapshots[report_step].wells.update( std::move(new_well) );
+            sched_state.wells.update( std::move(new_well) );
             return true;
         }
         return false;
@@ -1089,8 +1208,8 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
 
     std::optional<std::size_t> Schedule::first_RFT() const {
-        for (std::size_t report_step = 0; report_step < this->snapshots.size(); report_step++) {
-            if (this->snapshots[report_step].rft_config().active())
+        for (std::size_t report_step = 0; report_step < this->size(); report_step++) {
+            if (this->snapshot(report_step).rft_config().active())
                 return report_step;
         }
         return {};
@@ -1236,7 +1355,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
 
     std::size_t Schedule::numWells() const {
-        return this->snapshots.back().wells.size();
+        return this->wellNames().size();
     }
 
     std::size_t Schedule::numWells(std::size_t timestep) const {
@@ -1245,15 +1364,16 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     bool Schedule::hasWell(const std::string& wellName) const {
-        return this->snapshots.back().wells.has(wellName);
+        const auto names = this->wellNames();
+        return std::ranges::find(names, wellName) != names.end();
     }
 
     bool Schedule::hasWell(const std::string& wellName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].wells.has(wellName);
+        return this->snapshot(timeStep).wells.has(wellName);
     }
 
     bool Schedule::hasGroup(const std::string& groupName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].groups.has(groupName);
+        return this->snapshot(timeStep).groups.has(groupName);
     }
 
     // This function will return a list of wells which have changed
@@ -1265,7 +1385,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     {
         auto changedWells = std::vector<std::string> {};
 
-        const auto& currWells = this->snapshots[report_step].wells;
+        const auto& currWells = this->snapshot(report_step).wells;
 
         changedWells.reserve(currWells.size());
 
@@ -1276,7 +1396,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
                                    { return wellPair.first; });
         }
         else {
-            const auto& prevWells = this->snapshots[report_step - 1].wells;
+            const auto& prevWells = this->snapshot(report_step - 1).wells;
 
             for (const auto& [wname, wellPtr] : currWells) {
                 if (! prevWells.has(wname) ||
@@ -1294,11 +1414,11 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
                                     const std::size_t initialStep) const
     {
         if (report_step == initialStep) {
-            return this->snapshots[report_step]
+            return this->snapshot(report_step)
                 .wlist_manager().WListSize() > 0;
         }
 
-        return this->snapshots[report_step]
+        return this->snapshot(report_step)
             .wlist_tracker().changedLists();
     }
 
@@ -1306,17 +1426,18 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     {
         auto wells = std::vector<Well>{};
 
-        if (timeStep >= this->snapshots.size()) {
+        if (timeStep >= this->size()) {
             throw std::invalid_argument {
                 fmt::format("timeStep {} exceeds simulation run's "
                             "number of report steps ({})",
-                            timeStep, this->snapshots.size())
+                            timeStep, this->size())
             };
         }
 
-        const auto& well_order = this->snapshots[timeStep].well_order();
+        const auto& sched_state = this->snapshot(timeStep);
+        const auto& well_order = sched_state.well_order();
         std::ranges::transform(well_order, std::back_inserter(wells),
-                               [&wells = this->snapshots[timeStep].wells]
+                               [&wells = sched_state.wells]
                                (const auto& wname) -> decltype(auto)
                                { return wells.get(wname); });
 
@@ -1324,16 +1445,16 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     std::vector<Well> Schedule::getWellsatEnd() const {
-        return this->getWells(this->snapshots.size() - 1);
+        return this->getWells(this->size() - 1);
     }
 
     std::vector<Well> Schedule::getActiveWellsAtEnd() const {
         std::vector<Well> wells;
-        const auto lastStep = this->snapshots.size() - 1;
-        const auto& well_order = this->snapshots[lastStep].well_order();
+        const auto& sched_state = this->snapshot(this->size() - 1);
+        const auto& well_order = sched_state.well_order();
 
         for (const auto& wname : well_order) {
-            const auto& well = this->snapshots[lastStep].wells.get(wname);
+            const auto& well = sched_state.wells.get(wname);
             if (well.hasProduced() || well.hasInjected() || name_match_any(this->potential_wellopen_patterns, wname))
                 wells.push_back(well);
         }
@@ -1343,11 +1464,11 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
     std::vector<std::string> Schedule::getInactiveWellNamesAtEnd() const {
         std::vector<std::string> well_names;
-        const auto lastStep = this->snapshots.size() - 1;
-        const auto& well_order = this->snapshots[lastStep].well_order();
+        const auto& sched_state = this->snapshot(this->size() - 1);
+        const auto& well_order = sched_state.well_order();
 
         for (const auto& wname : well_order) {
-            const auto& well = this->snapshots[lastStep].wells.get(wname);
+            const auto& well = sched_state.wells.get(wname);
             if (well.hasProduced() || well.hasInjected() || name_match_any(this->potential_wellopen_patterns, wname))
                 continue;
             well_names.push_back(wname);
@@ -1358,7 +1479,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
 
 
     const Well& Schedule::getWellatEnd(const std::string& well_name) const {
-        return this->getWell(well_name, this->snapshots.size() - 1);
+        return this->getWell(well_name, this->size() - 1);
     }
 
     const std::unordered_map<std::string, std::set<int>>&
@@ -1368,6 +1489,8 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     std::unordered_set<int> Schedule::getAquiferFluxSchedule() const {
+        this->loadAllSnapshots();
+
         std::unordered_set<int> ids;
         for (const auto& snapshot : this->snapshots) {
             const auto& aquflux = snapshot.aqufluxs;
@@ -1379,7 +1502,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     const Well& Schedule::getWell(const std::string& wellName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].wells.get(wellName);
+        return this->snapshot(timeStep).wells.get(wellName);
     }
 
     const Well& Schedule::getWell(std::size_t well_index, std::size_t timeStep) const {
@@ -1388,7 +1511,7 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
             return well_pair.second->seqIndex() == well_index;
         };
 
-        auto well_ptr = this->snapshots[timeStep].wells.find( find_pred );
+        auto well_ptr = this->snapshot(timeStep).wells.find( find_pred );
         if (well_ptr == nullptr)
             throw std::invalid_argument(fmt::format("There is no well with well_index:{} at report_step:{}", well_index, timeStep));
 
@@ -1396,13 +1519,14 @@ Defaulted grid coordinates is not allowed for COMPDAT as part of ACTIONX)"
     }
 
     const Group& Schedule::getGroup(const std::string& groupName, std::size_t timeStep) const {
-        return this->snapshots[timeStep].groups.get(groupName);
+        return this->snapshot(timeStep).groups.get(groupName);
     }
 
     void Schedule::updateGuideRateModel(const GuideRateModel& new_model, std::size_t report_step) {
-        auto new_config = this->snapshots[report_step].guide_rate();
+        auto& sched_state = this->mutableSnapshot(report_step);
+        auto new_config = sched_state.guide_rate();
         if (new_config.update_model(new_model))
-            this->snapshots[report_step].guide_rate.update( std::move(new_config) );
+            sched_state.guide_rate.update( std::move(new_config) );
     }
 
     // There are many SCHEDULE keywords which operate on well names.  In
@@ -1467,9 +1591,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
     WellMatcher Schedule::wellMatcher(const std::size_t report_step) const
     {
-        const auto& schedState = (report_step < this->snapshots.size())
-            ? this->snapshots[report_step]
-            : this->snapshots.back();
+        const auto& schedState = (report_step < this->size())
+            ? this->snapshot(report_step)
+            : this->snapshot(this->size() - 1);
 
         return { &schedState.well_order(), schedState.wlist_manager() };
     }
@@ -1492,38 +1616,93 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
     std::vector<std::string> Schedule::wellNames(std::size_t timeStep) const
     {
-        return this->snapshots[timeStep].well_order().names();
+        return this->snapshot(timeStep).well_order().names();
     }
 
     std::vector<std::string> Schedule::wellNames() const
     {
-        return this->snapshots.back().well_order().names();
+        if (auto names = this->unloadedWellNames(); names.has_value()) {
+            return *names;
+        }
+
+        return this->snapshot(this->size() - 1).well_order().names();
+    }
+
+    std::optional<std::vector<std::string>> Schedule::unloadedWellNames() const
+    {
+        if (!this->lazy_load || this->lazy_load->loading ||
+            this->snapshots.empty() || this->isFullyLoaded())
+        {
+            return std::nullopt;
+        }
+
+        // Wells are only ever added, so the wells at the end of the Schedule
+        // are those of the last loaded report step followed by the wells
+        // which WELSPECS/WELSPECL create in the remaining report steps.
+        // Keywords in ACTIONX blocks take effect only when the action runs,
+        // at which point they become part of a loaded report step.
+        auto names = this->snapshots.back().well_order().names();
+        auto known = std::unordered_set<std::string>(names.begin(), names.end());
+
+        for (auto report_step = this->snapshots.size(); report_step < this->m_sched_deck.size(); ++report_step) {
+            auto in_action = false;
+            for (const auto& keyword : this->m_sched_deck[report_step]) {
+                if (keyword.is<ParserKeywords::ACTIONX>()) {
+                    in_action = true;
+                }
+                else if (keyword.is<ParserKeywords::ENDACTIO>()) {
+                    in_action = false;
+                }
+                else if (!in_action &&
+                         (keyword.is<ParserKeywords::WELSPECS>() ||
+                          keyword.is<ParserKeywords::WELSPECL>()))
+                {
+                    for (const auto& record : keyword) {
+                        auto wname = trim_copy(record.getItem("WELL").get<std::string>(0));
+
+                        // A pattern or well list may refer to existing
+                        // wells, which needs the loaded report steps.
+                        if (wname.empty() || (wname.front() == '*') ||
+                            (wname.find_first_of("*?[") != std::string::npos))
+                        {
+                            return std::nullopt;
+                        }
+
+                        if (known.insert(wname).second) {
+                            names.push_back(std::move(wname));
+                        }
+                    }
+                }
+            }
+        }
+
+        return names;
     }
 
     std::vector<std::string> Schedule::groupNames(const std::string& pattern,
                                                   const std::size_t timeStep) const
     {
-        return this->snapshots[timeStep].group_order().names(pattern);
+        return this->snapshot(timeStep).group_order().names(pattern);
     }
 
     const std::vector<std::string>& Schedule::groupNames(std::size_t timeStep) const
     {
-        return this->snapshots[timeStep].group_order().names();
+        return this->snapshot(timeStep).group_order().names();
     }
 
     std::vector<std::string> Schedule::groupNames(const std::string& pattern) const
     {
-        return this->groupNames(pattern, this->snapshots.size() - 1);
+        return this->groupNames(pattern, this->size() - 1);
     }
 
     const std::vector<std::string>& Schedule::groupNames() const
     {
-        return this->snapshots.back().group_order().names();
+        return this->snapshot(this->size() - 1).group_order().names();
     }
 
     std::vector<const Group*> Schedule::restart_groups(std::size_t timeStep) const
     {
-        const auto restart_groups = this->snapshots[timeStep].group_order().restart_groups();
+        const auto restart_groups = this->snapshot(timeStep).group_order().restart_groups();
 
         std::vector<const Group*> rst_groups(restart_groups.size(), nullptr);
         for (std::size_t restart_index = 0;
@@ -1594,7 +1773,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         // applicable field-wide GCONPROD and/or GCONINJE settings stored in
         // the restart file.  Happens at most once per run.
 
-        auto& field = this->snapshots.back().groups.get("FIELD");
+        auto field = this->snapshots.back().groups.get("FIELD");
         if (new_group.isProductionGroup())
             // Initialise field-wide GCONPROD settings from restart.
             field.updateProduction(new_group.productionProperties());
@@ -1602,6 +1781,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             if (new_group.hasInjectionControl(phase))
                 // Initialise field-wide GCONINJE settings (phase) from restart.
                 field.updateInjection(new_group.injectionProperties(phase));
+
+        this->snapshots.back().groups.update(std::move(field));
     }
 
 
@@ -1687,7 +1868,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     const UDQConfig& Schedule::getUDQConfig(std::size_t timeStep) const {
-        return this->snapshots[timeStep].udq.get();
+        return this->snapshot(timeStep).udq.get();
     }
 
     std::optional<int> Schedule::exitStatus() const {
@@ -1695,29 +1876,183 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     }
 
     std::size_t Schedule::size() const {
+        if (this->lazy_load && !this->lazy_load->loading)
+            return this->m_sched_deck.size();
+
         return this->snapshots.size();
     }
 
+    bool Schedule::isFullyLoaded() const {
+        return this->snapshots.size() == this->size();
+    }
+
+    void Schedule::loadAll() {
+        this->loadAllSnapshots();
+    }
+
+    void Schedule::releaseBefore(const std::size_t report_step) {
+        if (!this->lazy_load || this->snapshots.empty())
+            return;
+
+        auto& first_retained = this->mutableLazyLoad().first_retained;
+        const auto release_end = std::min(report_step, this->snapshots.size() - 1);
+        for (; first_retained < release_end; ++first_retained) {
+            const auto& released = this->snapshots[first_retained];
+            this->snapshots[first_retained] = ScheduleState { released.start_time(), released.end_time() };
+        }
+    }
+
+    void Schedule::loadSnapshots(const std::size_t report_step) const {
+        if (!this->lazy_load) {
+            return;
+        }
+
+        // Copies of a Schedule do not inherit the reserved capacity.  Reserve
+        // room for all report steps before any reference into snapshots is
+        // handed out, so that loading does not invalidate those references.
+        if (this->snapshots.capacity() < this->m_sched_deck.size()) {
+            const_cast<Schedule*>(this)->snapshots.reserve(this->m_sched_deck.size());
+        }
+
+        if (this->lazy_load->loading || (report_step < this->snapshots.size())) {
+            return;
+        }
+
+        // Loading report steps does not change the observable state of the
+        // Schedule, only which of its report steps are held in memory.
+        const auto load_end = std::min(report_step + 1, this->m_sched_deck.size());
+        const_cast<Schedule*>(this)->loadReportSteps(load_end);
+    }
+
+    void Schedule::loadAllSnapshots() const {
+        if (!this->lazy_load)
+            return;
+
+        if (this->lazy_load->first_retained > 0)
+            throw std::logic_error("Cannot access all report steps of a Schedule after releasing some of them");
+
+        this->loadSnapshots(this->m_sched_deck.size() - 1);
+    }
+
+    void Schedule::loadReportSteps(const std::size_t load_end) {
+        if (load_end <= this->snapshots.size())
+            return;
+
+        auto& lazy = this->mutableLazyLoad();
+        auto grid = ScheduleGrid {
+            *lazy.grid, *lazy.fp,
+            this->completed_cells,
+            this->completed_cells_lgr,
+            this->completed_cells_lgr_map
+        };
+
+        if (lazy.numAquifers != nullptr) {
+            grid.include_numerical_aquifers(*lazy.numAquifers);
+        }
+
+        // Report steps loaded on demand are parsed long after the deck was
+        // accepted, so input errors must reach the caller as exceptions
+        // rather than through the ErrorGuard, whose destructor terminates
+        // the process.
+        const auto load_begin = this->snapshots.size();
+        ErrorGuard errors;
+        try {
+            const LoadingScope loading { &lazy.loading };
+            const auto* target_wellpi = lazy.target_wellpi.has_value()
+                ? &*lazy.target_wellpi : nullptr;
+
+            this->iterateScheduleSection(load_begin, load_end,
+                                         lazy.parseContext, errors, grid,
+                                         target_wellpi, "", lazy.keepKeywords,
+                                         /* log_to_debug = */ true);
+        }
+        catch (...) {
+            errors.clear();
+            throw;
+        }
+
+        if (errors) {
+            const auto message = errors.formattedErrors();
+            errors.clear();
+
+            throw OpmInputError {
+                fmt::format("Problem loading report steps {}-{} of the "
+                            "SCHEDULE section\n{}", load_begin, load_end - 1, message),
+                this->m_sched_deck[load_begin].location()
+            };
+        }
+    }
+
+    Schedule::LazyLoad& Schedule::mutableLazyLoad() {
+        // Copies of a Schedule share the lazy loading state until one of
+        // them changes it.
+        if (this->lazy_load.use_count() > 1) {
+            this->lazy_load = std::make_shared<LazyLoad>(*this->lazy_load);
+        }
+
+        return *this->lazy_load;
+    }
+
+    bool* Schedule::loadingFlag() {
+        return this->lazy_load ? &this->mutableLazyLoad().loading : nullptr;
+    }
+
+    void Schedule::checkRetained(const std::size_t report_step) const {
+        if (this->lazy_load && (report_step < this->lazy_load->first_retained)) {
+            throw std::logic_error {
+                fmt::format("Report step {} of the Schedule has been released", report_step)
+            };
+        }
+    }
+
+    const ScheduleState& Schedule::snapshot(const std::size_t report_step) const {
+        this->loadSnapshots(report_step);
+        this->checkRetained(report_step);
+
+        return this->snapshots[report_step];
+    }
+
+    ScheduleState& Schedule::mutableSnapshot(const std::size_t report_step) {
+        // Load the following report step too, so that it is not later
+        // created from the modified report step.
+        this->loadSnapshots(report_step + 1);
+        this->checkRetained(report_step);
+
+        return this->snapshots[report_step];
+    }
+
+    time_point Schedule::reportStepStart(const std::size_t report_step) const {
+        return (report_step < this->snapshots.size())
+            ? this->snapshots[report_step].start_time()
+            : this->m_sched_deck[report_step].start_time();
+    }
+
+    time_point Schedule::reportStepEnd(const std::size_t report_step) const {
+        return (report_step < this->snapshots.size())
+            ? this->snapshots[report_step].end_time()
+            : this->m_sched_deck[report_step].end_time().value();
+    }
+
 
     double Schedule::seconds(std::size_t timeStep) const {
-        if (this->snapshots.empty())
+        if (this->size() == 0)
             return 0;
 
-        if (timeStep >= this->snapshots.size())
-            throw std::logic_error(fmt::format("seconds({}) - invalid timeStep. Valid range [0,{}>", timeStep, this->snapshots.size()));
+        if (timeStep >= this->size())
+            throw std::logic_error(fmt::format("seconds({}) - invalid timeStep. Valid range [0,{}>", timeStep, this->size()));
 
-        auto elapsed = this->snapshots[timeStep].start_time() - this->snapshots[0].start_time();
+        auto elapsed = this->reportStepStart(timeStep) - this->reportStepStart(0);
         using DurationInSeconds = std::chrono::duration<double>; // Tick is 1 second, stored in double.
         return DurationInSeconds(elapsed).count();
     }
 
     std::time_t Schedule::simTime(std::size_t timeStep) const {
-        return std::chrono::system_clock::to_time_t( this->snapshots[timeStep].start_time() );
+        return std::chrono::system_clock::to_time_t( this->reportStepStart(timeStep) );
     }
 
     double Schedule::stepLength(std::size_t timeStep) const {
-        const auto start_time = this->snapshots[timeStep].start_time();
-        const auto end_time = this->snapshots[timeStep].end_time();
+        const auto start_time = this->reportStepStart(timeStep);
+        const auto end_time = this->reportStepEnd(timeStep);
         if (start_time > end_time) {
             throw std::invalid_argument {
                     fmt::format(" Report step {} has start time after end time,\n"
@@ -1763,6 +2098,10 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         const auto matches = Action::Result{false}.matches();
         const std::string prefix = "| "; // logger prefix string
 
+        // A lazily loaded Schedule drops the report steps after reportStep
+        // and loads them again, from the modified report step, on demand.
+        this->loadSnapshots(reportStep);
+        const LoadingScope loading { this->loadingFlag() };
         this->snapshots.resize(reportStep + 1);
 
         auto& input_block = this->m_sched_deck.mutableKeywordBlock(reportStep);
@@ -1807,7 +2146,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         this->applyGlobalWPIMULT(wpimult_global_factor);
         this->end_report(reportStep);
 
-        if (reportStep < this->m_sched_deck.size() - 1) {
+        if ((reportStep < this->m_sched_deck.size() - 1) && !this->lazy_load) {
             this->iterateScheduleSection(reportStep + 1,
                                          this->m_sched_deck.size(),
                                          parseContext,
@@ -1820,6 +2159,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             this->simUpdateFromPython->delayed_iteration =
                 SimulatorUpdate::DelayedIteration::Off;
         }
+        else if (this->lazy_load) {
+            this->mutableLazyLoad().target_wellpi = target_wellpi;
+        }
 
         this->simUpdateFromPython->append(sim_update);
     }
@@ -1870,6 +2212,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                   "keywords and\n{0}rerun Schedule section.\n{0}",
                                   prefix, action.name()));
 
+        this->loadSnapshots(reportStep);
+        const LoadingScope loading { this->loadingFlag() };
         this->snapshots.resize(reportStep + 1);
         auto& input_block = this->m_sched_deck.mutableKeywordBlock(reportStep);
 
@@ -1909,13 +2253,16 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             }
         }
 
-        if (reportStep < this->m_sched_deck.size() - 1 && iterateSchedule) {
+        if (reportStep < this->m_sched_deck.size() - 1 && iterateSchedule && !this->lazy_load) {
             const auto keepKeywords = true;
             const auto log_to_debug = true;
             this->iterateScheduleSection(reportStep + 1, this->m_sched_deck.size(),
                                          parseContext, errors, grid, &target_wellpi,
                                          prefix, keepKeywords, log_to_debug);
         }
+        else if (this->lazy_load) {
+            this->mutableLazyLoad().target_wellpi = target_wellpi;
+        }
 
         OpmLog::debug("\\----------------------------------------------------------------------");
 
@@ -1928,15 +2275,16 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
     {
         SimulatorUpdate sim_update{};
 
+        this->loadSnapshots(reportStep);
+        const LoadingScope loading { this->loadingFlag() };
         this->snapshots.resize(reportStep + 1);
         for (const auto& [well, newConns] : extraConns) {
             if (newConns.empty()) { continue; }
 
-            // Note: We go through map_member::get() here rather than
-            // map_member::operator() because the latter returns a reference
-            // to const whereas we need a reference to mutable.
-            auto& conns = this->snapshots[reportStep]
-                .wells.get(well).getConnections();
+            // The well's connections are modified through a copy of the
+            // well, which is then stored back into the current state.
+            auto updated_well = this->snapshots[reportStep].wells.get(well);
+            auto& conns = updated_well.getConnections();
 
             auto new_frac_wconns = std::vector<std::size_t>{};
             for (const auto& newConn : newConns) {
@@ -1971,6 +2319,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                 }
             }
 
+            this->snapshots[reportStep].wells.update(std::move(updated_well));
+
             if (new_frac_wconns.empty()) {
                 sim_update.welpi_wells.insert(well);
             }
@@ -1981,7 +2331,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
             }
         }
 
-        if (reportStep < this->m_sched_deck.size() - 1) {
+        if ((reportStep < this->m_sched_deck.size() - 1) && !this->lazy_load) {
             ParseContext parseContext{};
             if (this->m_treat_critical_as_non_critical) {
                 // Continue with invalid names if parsing strictness is set
@@ -2014,7 +2364,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                           const std::string& action_name,
                                           const std::vector<std::string>& matching_wells)
     {
-        const auto& actions = this->snapshots[reportStep].actions();
+        const auto& actions = this->snapshot(reportStep).actions();
         if (actions.has(action_name)) {
             std::vector<std::string> well_names;
             for (const auto& wname : matching_wells) {
@@ -2138,7 +2488,8 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
 
         if (this->simUpdateFromPython->delayed_iteration ==
                 SimulatorUpdate::DelayedIteration::On &&
-            reportStep < this->m_sched_deck.size() - 1)
+            reportStep < this->m_sched_deck.size() - 1 &&
+            !this->lazy_load)
         {
             const auto keepKeywords = true;
             const auto log_to_debug = true;
@@ -2158,43 +2509,64 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
                                          parseContext, errors, grid, &target_wellpi,
                                          prefix, keepKeywords, log_to_debug);
         }
+        else if (this->lazy_load) {
+            this->mutableLazyLoad().target_wellpi = target_wellpi;
+        }
 
         // The whole pyaction script was executed, now the simUpdateFromPython is returned.
         return *(this->simUpdateFromPython);
     }
 
     void Schedule::applyWellProdIndexScaling(const std::string& well_name, const std::size_t reportStep, const double newWellPI) {
+        // The scaling applies to the well in all subsequent report steps.
+        this->loadSnapshots(this->m_sched_deck.size() - 1);
+        this->checkRetained(reportStep);
+
         if (reportStep >= this->snapshots.size())
             return;
 
         if (!this->snapshots[reportStep].wells.has(well_name))
             return;
 
-        std::vector<Well *> unique_wells;
+        std::vector<const Well *> unique_wells;
         for (std::size_t step = reportStep; step < this->snapshots.size(); step++) {
-            auto& well = this->snapshots[step].wells.get(well_name);
+            const auto& well = this->snapshots[step].wells.get(well_name);
             if (unique_wells.empty() || (!(*unique_wells.back() == well)))
                 unique_wells.push_back( &well );
         }
 
+        // The scaling is applied to the connection objects, which are
+        // shared between the copies made here and the wells stored in the
+        // snapshots.
         std::vector<bool> scalingApplicable;
         const auto targetPI = this->snapshots[reportStep].target_wellpi.at(well_name);
         auto prev_well = unique_wells[0];
         auto scalingFactor = prev_well->convertDeckPI(targetPI) / newWellPI;
-        prev_well->applyWellProdIndexScaling(scalingFactor, scalingApplicable);
+        Well{ *prev_well }.applyWellProdIndexScaling(scalingFactor, scalingApplicable);
 
         for (std::size_t well_index = 1; well_index < unique_wells.size(); well_index++) {
             auto wellPtr = unique_wells[well_index];
             if (! wellPtr->hasSameConnectionsPointers(*prev_well)) {
-                wellPtr->applyWellProdIndexScaling(scalingFactor, scalingApplicable);
+                Well{ *wellPtr }.applyWellProdIndexScaling(scalingFactor, scalingApplicable);
                 prev_well = wellPtr;
             }
         }
+
+        // Store the wells again so that every affected report step
+        // records the change.
+        for (std::size_t step = reportStep; step < this->snapshots.size(); step++) {
+            auto& wells = this->snapshots[step].wells;
+            wells.update(Well{ wells.get(well_name) });
+        }
     }
 
     bool Schedule::write_rst_file(const std::size_t report_step) const
     {
-        return this->restart_output.writeRestartFile(report_step) || this->operator[](report_step).save();
+        // Load the report step first, since that may add restart output
+        // requests for it.
+        const auto& state = (*this)[report_step];
+
+        return this->restart_output.writeRestartFile(report_step) || state.save();
     }
 
     bool Schedule::must_write_rst_file(const std::size_t report_step) const
@@ -2240,7 +2612,7 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         if (report_step == 0)
             return this->m_static.rst_config.keywords;
 
-        const auto& keywords = this->snapshots[report_step - 1].rst_config().keywords;
+        const auto& keywords = this->snapshot(report_step - 1).rst_config().keywords;
         return keywords;
     }
 
@@ -2254,6 +2626,9 @@ File {} line {}.)", pattern, location.keyword, location.filename, location.linen
         bool simUpdateFromPythonIsEqual = !this->simUpdateFromPython ||
              (*(this->simUpdateFromPython) == *(data.simUpdateFromPython));
 
+        this->loadAllSnapshots();
+        data.loadAllSnapshots();
+
         return this->m_static == data.m_static
             && this->m_treat_critical_as_non_critical == data.m_treat_critical_as_non_critical
             && this->m_sched_deck == data.m_sched_deck
@@ -2543,7 +2918,7 @@ namespace {
         }
 
         for (const auto& rst_group : rst_state.groups) {
-            auto& group = this->snapshots.back().groups.get( rst_group.name );
+            auto group = this->snapshots.back().groups.get( rst_group.name );
 
             if (group.isProductionGroup()) {
                 auto new_config = this->snapshots.back().guide_rate();
@@ -2578,6 +2953,8 @@ namespace {
                         inj_prop.voidage_group = groupNamePos->second;
                         group.updateInjection(inj_prop);
                     }
+
+                    this->snapshots.back().groups.update(group);
                 }
             }
 
@@ -2615,7 +2992,7 @@ namespace {
 
             for (const auto& [control, value, wgname, ig_phase] : uda_records) {
                 if (UDQ::well_control(control)) {
-                    auto& well = this->snapshots.back().wells.get(wgname);
+                    auto well = this->snapshots.back().wells.get(wgname);
 
                     if (UDQ::is_well_injection_control(control, well.isInjector())) {
                         auto injection_properties = std::make_shared<Well::WellInjectionProperties>(well.getInjectionProperties());
@@ -2628,8 +3005,10 @@ namespace {
                         production_properties->update_uda(udq_config, udq_active, control, value);
                         well.updateProduction(std::move(production_properties));
                     }
+
+                    this->snapshots.back().wells.update(std::move(well));
                 } else {
-                    auto& group = this->snapshots.back().groups.get(wgname);
+                    auto group = this->snapshots.back().groups.get(wgname);
                     if (UDQ::is_group_injection_control(control)) {
                         auto injection_properties = group.injectionProperties(ig_phase.value());
                         injection_properties.update_uda(udq_config, udq_active, control, value);
@@ -2641,6 +3020,8 @@ namespace {
                         production_properties.update_uda(udq_config, udq_active, control, value);
                         group.updateProduction(production_properties);
                     }
+
+                    this->snapshots.back().groups.update(std::move(group));
                 }
             }
             this->snapshots.back().udq_active.update( std::move(udq_active) );
@@ -2733,7 +3114,7 @@ namespace {
     }
 
     const GasLiftOpt& Schedule::glo(std::size_t report_step) const {
-        return this->snapshots[report_step].glo();
+        return this->snapshot(report_step).glo();
     }
 
 namespace {
@@ -2977,18 +3358,23 @@ bool Schedule::cmp(const Schedule& sched1, const Schedule& sched2, std::size_t r
 }
 
 const ScheduleState& Schedule::back() const {
-    return this->snapshots.back();
+    return this->snapshot(this->size() - 1);
 }
 
 const ScheduleState& Schedule::operator[](std::size_t index) const {
+    this->loadSnapshots(index);
+    this->checkRetained(index);
+
     return this->snapshots.at(index);
 }
 
 std::vector<ScheduleState>::const_iterator Schedule::begin() const {
+    this->loadAllSnapshots();
     return this->snapshots.begin();
 }
 
 std::vector<ScheduleState>::const_iterator Schedule::end() const {
+    this->loadAllSnapshots();
     return this->snapshots.end();
 }
 
@@ -3080,20 +3466,22 @@ void Schedule::dump_deck(std::ostream& os) const
 void Schedule::markSlaveProductionGroup(const std::size_t report_step,
                                         const std::string& group_name)
 {
-    auto grp = this->snapshots[report_step].groups(group_name);
+    auto& sched_state = this->mutableSnapshot(report_step);
+    auto grp = sched_state.groups(group_name);
     if (!grp.isProductionGroup()) {
         grp.setSlaveProductionGroup();
-        this->snapshots[report_step].groups.update(std::move(grp));
+        sched_state.groups.update(std::move(grp));
     }
 }
 
 void Schedule::markSlaveInjectionGroup(const std::size_t report_step,
                                        const std::string& group_name)
 {
-    auto grp = this->snapshots[report_step].groups(group_name);
+    auto& sched_state = this->mutableSnapshot(report_step);
+    auto grp = sched_state.groups(group_name);
     if (!grp.isInjectionGroup()) {
         grp.setSlaveInjectionGroup();
-        this->snapshots[report_step].groups.update(std::move(grp));
+        sched_state.groups.update(std::move(grp));
     }
 }
 
@@ -121,6 +121,20 @@ namespace Opm {
          *  \param output_interval Output interval to use
          *  \param rst Restart state to use
          *  \param tracer_config Tracer configuration to use
+         *  \param lazyLoad Load report steps on first access rather than
+         *         up front.  The grid, field properties and numerical
+         *         aquifers must then outlive the Schedule, or at least the
+         *         loading of its last report step, and EclipseState::compact()
+         *         leaves them alone until then.  Const member functions
+         *         may then load report steps, so a lazily loaded Schedule
+         *         must not be accessed concurrently from several threads.
+         *         Input errors in report steps loaded on demand are
+         *         reported by throwing OpmInputError.  The well name
+         *         queries numWells(), hasWell(name) and wellNames() are
+         *         answered from the deck where possible, while queries
+         *         spanning the entire Schedule, such as groupNames(),
+         *         getWellsatEnd(), getActiveWellsAtEnd(), back(), begin(),
+         *         end(), unique() and operator==, load all report steps.
          */
         Schedule(const Deck& deck,
                  const EclipseGrid& grid,
@@ -135,7 +149,8 @@ namespace Opm {
                  const bool keepKeywords = true,
                  const std::optional<int>& output_interval = {},
                  const RestartIO::RstState* rst = nullptr,
-                 const TracerConfig* tracer_config = nullptr);
+                 const TracerConfig* tracer_config = nullptr,
+                 const bool lazyLoad = false);
 
         template<typename T>
         Schedule(const Deck& deck,
@@ -151,7 +166,8 @@ namespace Opm {
                  const bool keepKeywords = true,
                  const std::optional<int>& output_interval = {},
                  const RestartIO::RstState* rst = nullptr,
-                 const TracerConfig* tracer_config = nullptr);
+                 const TracerConfig* tracer_config = nullptr,
+                 const bool lazyLoad = false);
 
         Schedule(const Deck& deck,
                  const EclipseGrid& grid,
@@ -373,6 +389,26 @@ namespace Opm {
         std::optional<std::size_t> first_RFT() const;
         std::size_t size() const;
 
+        /// Whether or not all report steps have been loaded.
+        ///
+        /// Always true unless the Schedule was created with lazy loading,
+        /// in which case each report step is loaded on first access.
+        bool isFullyLoaded() const;
+
+        /// Load all report steps which have not yet been loaded.
+        void loadAll();
+
+        /// Release report steps which are no longer needed.
+        ///
+        /// Only applies to Schedules created with lazy loading.  Released
+        /// report steps retain their start and end times, but any other
+        /// access to them, and any query spanning the entire Schedule,
+        /// throws an exception of type std::logic_error.  The last loaded
+        /// report step is never released.
+        ///
+        /// \param[in] report_step First report step to retain.
+        void releaseBefore(std::size_t report_step);
+
         bool write_rst_file(std::size_t report_step) const;
         const std::map< std::string, int >& rst_keywords( std::size_t timestep ) const;
 
@@ -458,12 +494,18 @@ namespace Opm {
         template<class Serializer>
         void serializeOp(Serializer& serializer)
         {
+            // Lazily loaded Schedules are serialized with all report steps
+            // loaded, and are fully loaded once unpacked.
+            if (serializer.isSerializing()) {
+                this->loadAll();
+            }
+
             serializer(this->m_static);
             serializer(this->m_sched_deck);
             serializer(this->action_wgnames);
             serializer(this->potential_wellopen_patterns);
             serializer(this->exit_status);
-            serializer(this->snapshots);
+            this->serializeSnapshots(serializer);
             serializer(this->restart_output);
             serializer(this->completed_cells);
             serializer(this->completed_cells_lgr);
@@ -480,6 +522,8 @@ namespace Opm {
             // with multiple pointers to any given instance, but it is not
             // significant so let's keep it simple.
             if (!serializer.isSerializing()) {
+                this->lazy_load.reset();
+
                 for (auto& snapshot : snapshots) {
                     for (auto& well : snapshot.wells) {
                         well.second->updateUnitSystem(&m_static.m_unit_system);
@@ -491,6 +535,8 @@ namespace Opm {
         template <typename T>
         std::vector<std::pair<std::size_t,  T>> unique() const
         {
+            this->loadAllSnapshots();
+
             std::vector<std::pair<std::size_t, T>> values;
             for (std::size_t index = 0; index < this->snapshots.size(); index++) {
                 const auto& member = this->snapshots[index].get<T>();
@@ -552,6 +598,54 @@ namespace Opm {
         // The copy constructor is needed for creating a mocked simulator (msim).
         std::shared_ptr<SimulatorUpdate> simUpdateFromPython{};
 
+        // State needed to materialize the remaining report steps of a
+        // lazily loaded Schedule.  Null when all steps are loaded.  When set,
+        // snapshots holds the steps loaded so far and changes made by actions
+        // discard the later loaded steps instead of re-running them.  Copies
+        // of a Schedule share this state until one of them changes it.
+        struct LazyLoad;
+        std::shared_ptr<LazyLoad> lazy_load{};
+
+        // The first snapshot is serialized in full and every subsequent
+        // snapshot as differences relative to its predecessor.
+        template<class Serializer>
+        void serializeSnapshots(Serializer& serializer)
+        {
+            auto num_snapshots = this->snapshots.size();
+            serializer(num_snapshots);
+
+            if (!serializer.isSerializing()) {
+                this->snapshots.resize(num_snapshots);
+            }
+
+            for (std::size_t i = 0; i < num_snapshots; ++i) {
+                if (i == 0) {
+                    serializer(this->snapshots[i]);
+                }
+                else {
+                    this->snapshots[i].serializeDeltaOp(serializer, this->snapshots[i - 1]);
+                }
+            }
+        }
+
+        // Lazy loading.  loadSnapshots() materializes all report steps up
+        // to and including report_step, and snapshot()/mutableSnapshot()
+        // return a loaded, non-released step.
+        void loadSnapshots(std::size_t report_step) const;
+        void loadAllSnapshots() const;
+        void loadReportSteps(std::size_t load_end);
+        std::optional<std::vector<std::string>> unloadedWellNames() const;
+        void checkRetained(std::size_t report_step) const;
+        LazyLoad& mutableLazyLoad();
+        bool* loadingFlag();
+        const ScheduleState& snapshot(std::size_t report_step) const;
+        ScheduleState& mutableSnapshot(std::size_t report_step);
+        void prefetchActionConnections(const ScheduleGrid& grid,
+                                       const ParseContext& parseContext,
+                                       ErrorGuard& errors);
+        time_point reportStepStart(std::size_t report_step) const;
+        time_point reportStepEnd(std::size_t report_step) const;
+
         void init_completed_cells_lgr(const EclipseGrid& ecl_grid);
         void init_completed_cells_lgr_map(const EclipseGrid& ecl_grid);
 
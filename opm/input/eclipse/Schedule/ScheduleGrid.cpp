@@ -25,10 +25,13 @@
 #include <opm/input/eclipse/EclipseState/Grid/FieldPropsManager.hpp>
 
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
+#include <opm/input/eclipse/Schedule/WellTraj/CellSearchTree.hpp>
 
 #include <cassert>
 #include <cstddef>
 #include <functional>
+#include <memory>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -131,6 +134,21 @@ const Opm::EclipseGrid* Opm::ScheduleGrid::get_grid() const
     return this->grid;
 }
 
+const Opm::CellSearchTree& Opm::ScheduleGrid::get_cell_search_tree() const
+{
+    if (this->grid == nullptr) {
+        throw std::logic_error {
+            "Cannot search for intersected cells without a grid object"
+        };
+    }
+
+    if (this->cell_search_tree == nullptr) {
+        this->cell_search_tree = std::make_shared<const CellSearchTree>(*this->grid);
+    }
+
+    return *this->cell_search_tree;
+}
+
 int Opm::ScheduleGrid::get_lgr_grid_number(const std::optional<std::string>& lgr_label) const
 {
     return lgr_label.has_value()
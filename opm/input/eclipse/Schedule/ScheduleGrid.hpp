@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <memory>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -30,6 +31,7 @@
 
 namespace Opm {
 
+class CellSearchTree;
 class EclipseGrid;
 class FieldPropsManager;
 class NumericalAquifers;
@@ -171,6 +173,13 @@ public:
     /// grid object.
     const EclipseGrid* get_grid() const;
 
+    /// Retrieve search structure for the cells of the underlying grid.
+    ///
+    /// Formed on first use and then reused by all subsequent calls,
+    /// including those for other wells and report steps.  Usable only if
+    /// the ScheduleGrid was created with a reference to a grid object.
+    const CellSearchTree& get_cell_search_tree() const;
+
     /// Translate LGR name into a numeric grid index.
     ///
     /// Will throw an exception if the name identifies an unknown LGR.
@@ -202,6 +211,11 @@ private:
     /// Reference to an immutable object that must outlive the ScheduleGrid.
     std::reference_wrapper<const std::unordered_map<std::string, std::size_t>> label_to_index;
 
+    /// Bounding volume hierarchy of the cells of the underlying grid.
+    ///
+    /// Null until first requested.
+    mutable std::shared_ptr<const CellSearchTree> cell_search_tree{};
+
     /// Run's cells, including property data, in numerical aquifers.
     ///
     /// Keyed by Cartesian cell index.
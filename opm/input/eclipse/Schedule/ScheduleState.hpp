@@ -21,6 +21,7 @@
 #define SCHEDULE_TSTEP_HPP
 
 #include <opm/common/utility/gpuDecorators.hpp>
+#include <opm/common/utility/PersistentHashMap.hpp>
 #include <opm/common/utility/TimeService.hpp>
 
 #include <opm/input/eclipse/EclipseState/Aquifer/AquiferFlux.hpp>
@@ -45,6 +46,7 @@
 #include <opm/input/eclipse/Deck/DeckKeyword.hpp>
 
 #include <array>
+#include <atomic>
 #include <cstddef>
 #include <iterator>
 #include <memory>
@@ -177,11 +179,27 @@ namespace Opm {
               const K& T::name() const;
 
           Which is used to get the storage key for the objects.
+
+          The map itself is a PersistentHashMap, so copying a map_member from
+          one ScheduleState to the next shares the entire map structure and
+          updating a single element copies only the path to that element.
+          The serializeDeltaOp() method exploits this to serialize only the
+          elements which differ from the corresponding map in a preceding
+          ScheduleState.
+
+          Elements are only accessible through references to const, and
+          every operation which changes the map's elements, i.e., update()
+          and deserialization, assigns the map a new version number.  To
+          modify an element, copy it and pass the modified copy to update().
+          Version numbers are unique across all map_member objects, so two
+          maps with the same version hold the same elements.
          */
 
         template <typename K, typename T>
         class map_member {
         public:
+            using storage_type = PersistentHashMap<K, std::shared_ptr<T>>;
+
             std::vector<K> keys() const {
                 std::vector<K> key_vector;
                 std::ranges::transform(this->m_data, std::back_inserter(key_vector),
@@ -201,33 +219,36 @@ namespace Opm {
             }
 
 
-            const std::shared_ptr<T> get_ptr(const K& key) const {
-                auto iter = this->m_data.find(key);
-                if (iter != this->m_data.end())
-                    return iter->second;
+            std::shared_ptr<const T> get_ptr(const K& key) const {
+                const auto* ptr = this->m_data.find(key);
+                if (ptr != nullptr)
+                    return *ptr;
 
                 return {};
             }
 
 
             bool has(const K& key) const {
-                auto ptr = this->get_ptr(key);
-                return (ptr != nullptr);
+                return this->m_data.contains(key);
             }
 
             void update(const K& key, std::shared_ptr<T> value) {
                 this->m_data.insert_or_assign(key, std::move(value));
+                this->touch();
             }
 
             void update(T object) {
                 auto key = object.name();
-                this->m_data[key] = std::make_shared<T>( std::move(object) );
+                this->m_data.insert_or_assign(key, std::make_shared<T>( std::move(object) ));
+                this->touch();
             }
 
             void update(const K& key, const map_member<K,T>& other) {
-                auto other_ptr = other.get_ptr(key);
-                if (other_ptr)
-                    this->m_data[key] = other.get_ptr(key);
+                const auto* other_ptr = other.m_data.find(key);
+                if (other_ptr != nullptr) {
+                    this->m_data.insert_or_assign(key, *other_ptr);
+                    this->touch();
+                }
                 else
                     throw std::logic_error(std::string{"Tried to update member: "} + as_string(key) + std::string{"with uninitialized object"});
             }
@@ -237,11 +258,7 @@ namespace Opm {
             }
 
             const T& get(const K& key) const {
-                return *this->m_data.at(key);
-            }
-
-            T& get(const K& key) {
-                return *this->m_data.at(key);
+                return *this->at(key);
             }
 
 
@@ -255,16 +272,6 @@ namespace Opm {
             }
 
 
-            std::vector<std::reference_wrapper<T>> operator()() {
-                std::vector<std::reference_wrapper<T>> as_vector;
-                for (const auto& [_, elm_ptr] : this->m_data) {
-                    (void)_;
-                    as_vector.push_back( std::ref(*elm_ptr));
-                }
-                return as_vector;
-            }
-
-
             bool operator==(const map_member<K,T>& other) const {
                 if (this->m_data.size() != other.m_data.size())
                     return false;
@@ -285,11 +292,15 @@ namespace Opm {
                 return this->m_data.size();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator begin() const {
+            std::size_t version() const {
+                return this->m_version;
+            }
+
+            typename storage_type::const_iterator begin() const {
                 return this->m_data.begin();
             }
 
-            typename std::unordered_map<K, std::shared_ptr<T>>::const_iterator end() const {
+            typename storage_type::const_iterator end() const {
                 return this->m_data.end();
             }
 
@@ -298,18 +309,75 @@ namespace Opm {
                 map_member<K,T> map_object;
                 T value_object = T::serializationTestObject();
                 K key = value_object.name();
-                map_object.m_data.emplace( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.m_data.insert_or_assign( key, std::make_shared<T>( std::move(value_object) ));
+                map_object.touch();
                 return map_object;
             }
 
             template<class Serializer>
             void serializeOp(Serializer& serializer)
             {
-                serializer(m_data);
+                std::vector<std::pair<K, std::shared_ptr<T>>> elements;
+                if (serializer.isSerializing())
+                    elements.assign(this->m_data.begin(), this->m_data.end());
+
+                serializer(elements);
+
+                if (!serializer.isSerializing()) {
+                    this->m_data.clear();
+                    for (auto& [key, ptr] : elements)
+                        this->m_data.insert_or_assign(key, std::move(ptr));
+                    this->touch();
+                }
+            }
+
+            /*
+              Serialize only the differences relative to @base, which is
+              typically the same member of the preceding ScheduleState.
+              When unpacking, @base must hold the same elements as when
+              packing.
+            */
+            template<class Serializer>
+            void serializeDeltaOp(Serializer& serializer, const map_member<K,T>& base)
+            {
+                std::vector<K> erased;
+                std::vector<std::pair<K, std::shared_ptr<T>>> changed;
+                if (serializer.isSerializing()) {
+                    storage_type::diff(base.m_data, this->m_data,
+                                       [&changed](const auto& elm) { changed.emplace_back(elm.first, elm.second); },
+                                       [&erased](const K& key) { erased.push_back(key); });
+                }
+
+                serializer(erased);
+                serializer(changed);
+
+                if (!serializer.isSerializing()) {
+                    this->m_data = base.m_data;
+                    for (const auto& key : erased)
+                        this->m_data.erase(key);
+
+                    for (auto& [key, ptr] : changed)
+                        this->m_data.insert_or_assign(key, std::move(ptr));
+                    this->touch();
+                }
             }
 
         private:
-            std::unordered_map<K, std::shared_ptr<T>> m_data;
+            storage_type m_data;
+            std::size_t m_version{0};
+
+            void touch() {
+                static std::atomic<std::size_t> last_version{0};
+                this->m_version = ++last_version;
+            }
+
+            const std::shared_ptr<T>& at(const K& key) const {
+                const auto* ptr = this->m_data.find(key);
+                if (ptr == nullptr)
+                    throw std::out_of_range("map_member::get(): no such key");
+
+                return *ptr;
+            }
         };
 
         struct BHPDefaults {
@@ -655,6 +723,27 @@ namespace Opm {
 
         template<class Serializer>
         void serializeOp(Serializer& serializer)
+        {
+            this->serializeMembers(serializer, nullptr);
+        }
+
+        /*
+          Like serializeOp(), but the map members are serialized as
+          differences relative to @previous, typically the preceding
+          ScheduleState in the Schedule. Consecutive states usually share
+          nearly all wells, groups and VFP tables, so this greatly reduces
+          the size of serialized Schedules. When unpacking, @previous must
+          already be unpacked.
+        */
+        template<class Serializer>
+        void serializeDeltaOp(Serializer& serializer, const ScheduleState& previous)
+        {
+            this->serializeMembers(serializer, &previous);
+        }
+
+    private:
+        template<class Serializer>
+        void serializeMembers(Serializer& serializer, const ScheduleState* previous)
         {
             serializer(gconsale);
             serializer(gconsump);
@@ -681,17 +770,17 @@ namespace Opm {
             serializer(source);
             serializer(wcycle);
             serializer(this->wlist_tracker);
-            serializer(vfpprod);
-            serializer(vfpinj);
-            serializer(gptable);
-            serializer(groups);
-            serializer(wells);
-            serializer(this->satelliteInjection);
-            serializer(this->injectionNetwork);
-            serializer(wseed);
+            serializeMap(serializer, &ScheduleState::vfpprod, previous);
+            serializeMap(serializer, &ScheduleState::vfpinj, previous);
+            serializeMap(serializer, &ScheduleState::gptable, previous);
+            serializeMap(serializer, &ScheduleState::groups, previous);
+            serializeMap(serializer, &ScheduleState::wells, previous);
+            serializeMap(serializer, &ScheduleState::satelliteInjection, previous);
+            serializeMap(serializer, &ScheduleState::injectionNetwork, previous);
+            serializeMap(serializer, &ScheduleState::wseed, previous);
             serializer(aqufluxs);
             serializer(bcprop);
-            serializer(inj_streams);
+            serializeMap(serializer, &ScheduleState::inj_streams, previous);
             serializer(target_wellpi);
             serializer(this->next_tstep);
             serializer(m_start_time);
@@ -715,7 +804,17 @@ namespace Opm {
             serializer(this->m_rptonly);
         }
 
-    private:
+        template<class Serializer, class K, class T>
+        void serializeMap(Serializer& serializer,
+                          map_member<K,T> ScheduleState::* member,
+                          const ScheduleState* previous)
+        {
+            if (previous == nullptr)
+                serializer(this->*member);
+            else
+                (this->*member).serializeDeltaOp(serializer, previous->*member);
+        }
+
         time_point m_start_time{};
         std::optional<time_point> m_end_time{};
 
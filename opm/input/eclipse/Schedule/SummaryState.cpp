@@ -28,11 +28,14 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <ctime>
 #include <iomanip>
+#include <iterator>
 #include <limits>
 #include <ostream>
 #include <regex>
@@ -40,6 +43,7 @@
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_map>
 #include <vector>
 
@@ -143,59 +147,57 @@ namespace {
             return is_total(key.substr(0,sep_pos));
     }
 
-    template <class T>
-    using map2 = std::unordered_map<std::string, std::unordered_map<std::string, T>>;
-
-    template <class T>
-    bool has_var(const map2<T>& values,
-                 const std::string& var1,
-                 const std::string& var2)
+    template <class Map, class Key>
+    const typename Map::mapped_type* lookup(const Map& map, const Key& key)
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return false;
-
-        const auto& var2_iter = var1_iter->second.find(var2);
-        if (var2_iter == var1_iter->second.end())
-            return false;
-
-        return true;
+        auto pos = map.find(key);
+        return (pos == map.end()) ? nullptr : &pos->second;
     }
 
-    template <class T>
-    void erase_var(map2<T>& values,
-                   std::set<std::string>& var2_set,
-                   const std::string& var1,
-                   const std::string& var2)
+    // Nested key table with slots replaced by the values in those slots.
+    // Unassigned values are omitted.
+    template <class Index>
+    auto materialise(const Index&                      index,
+                     const std::vector<double>&        value,
+                     const std::vector<unsigned char>& defined)
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return;
+        using Key = typename Index::key_type;
+        using Mapped = typename Index::mapped_type;
+
+        if constexpr (std::is_same_v<Mapped, std::size_t>) {
+            std::unordered_map<Key, double> result;
+            for (const auto& [key, slot] : index) {
+                if (defined[slot]) {
+                    result.emplace(key, value[slot]);
+                }
+            }
 
-        var1_iter->second.erase(var2);
-        var2_set.clear();
-        for (const auto& [_, var2_map] : values) {
-            (void)_;
-            for (const auto& [v2, __] : var2_map) {
-                (void)__;
-                var2_set.insert(v2);
+            return result;
+        }
+        else {
+            using Inner = decltype(materialise(std::declval<const Mapped&>(), value, defined));
+
+            std::unordered_map<Key, Inner> result;
+            for (const auto& [key, inner] : index) {
+                result.emplace(key, materialise(inner, value, defined));
             }
+
+            return result;
         }
     }
 
-    template <class T>
-    std::vector<std::string>
-    var2_list(const map2<T>& values, const std::string& var1)
+    std::uint64_t next_layout_id()
     {
-        const auto& var1_iter = values.find(var1);
-        if (var1_iter == values.end())
-            return {};
+        static std::atomic<std::uint64_t> id{0};
 
-        std::vector<std::string> l;
-        std::ranges::transform(var1_iter->second, std::back_inserter(l),
-                               [](const auto& pair) { return pair.first; });
+        return ++id;
+    }
 
-        return l;
+    std::uint64_t next_well_set_version()
+    {
+        static std::atomic<std::uint64_t> version{0};
+
+        return ++version;
     }
 
     std::string normalise_encoded_well_completion_quantity(const std::string& keyword)
@@ -254,10 +256,27 @@ namespace {
 namespace Opm
 {
 
+    SummaryState::SlotLayout::SlotLayout()
+        : id { next_layout_id() }
+    {}
+
+    SummaryState::SlotLayout::SlotLayout(const SlotLayout& rhs)
+        : id       { next_layout_id() }
+        , total    { rhs.total }
+        , key_slot { rhs.key_slot }
+        , keys     { rhs.keys }
+        , wells    { rhs.wells }
+        , groups   { rhs.groups }
+        , conns    { rhs.conns }
+        , segments { rhs.segments }
+        , regions  { rhs.regions }
+    {}
+
     SummaryState::SummaryState(const time_point sim_start_arg,
                                const double     udqUndefined)
         : sim_start     { sim_start_arg }
         , udq_undefined { udqUndefined }
+        , layout_       { std::make_shared<SlotLayout>() }
     {
         this->update_elapsed(0);
     }
@@ -269,11 +288,21 @@ namespace Opm
 
     void SummaryState::set(const std::string& key, double value)
     {
-        this->values.insert_or_assign(key, value);
+        const auto slot = this->general_slot(key, is_total(key));
+
+        this->slot_value_[slot] = value;
+        this->define_slot(slot);
     }
 
-    bool SummaryState::erase(const std::string& key) {
-        return (this->values.erase(key) > 0);
+    bool SummaryState::erase(const std::string& key)
+    {
+        const auto* slot = lookup(this->layout_->keys, key);
+        if ((slot == nullptr) || ! this->is_defined(*slot)) {
+            return false;
+        }
+
+        this->undefine_slot(*slot);
+        return true;
     }
 
     bool SummaryState::erase_well_var(const std::string& well, const std::string& var)
@@ -282,8 +311,12 @@ namespace Opm
         if (!this->erase(key))
             return false;
 
-        erase_var(this->well_values, this->m_wells, var, well);
-        this->well_names.reset();
+        const auto handle = this->find_well_var(well, var);
+        if (this->is_valid(handle)) {
+            this->undefine_slot(handle.slot_);
+        }
+
+        this->reset_well_names();
         return true;
     }
 
@@ -293,37 +326,41 @@ namespace Opm
         if (!this->erase(key))
             return false;
 
-        erase_var(this->group_values, this->m_groups, var, group);
+        const auto handle = this->find_group_var(group, var);
+        if (this->is_valid(handle)) {
+            this->undefine_slot(handle.slot_);
+        }
+
         this->group_names.reset();
         return true;
     }
 
     bool SummaryState::has(const std::string& key) const
     {
-        return (this->values.find(key) != this->values.end()) || is_udq(key);
+        return this->has(this->find(key)) || is_udq(key);
     }
 
     bool SummaryState::has_well_var(const std::string& well,
                                     const std::string& var) const
     {
-        return has_var(this->well_values, var, well)
+        return this->has(this->find_well_var(well, var))
             || is_well_udq(var);
     }
 
     bool SummaryState::has_well_var(const std::string& var) const
     {
-        return (this->well_values.count(var) != 0) || is_well_udq(var);
+        return this->is_assigned(this->layout_->wells, var) || is_well_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& group,
                                      const std::string& var) const
     {
-        return has_var(this->group_values, var, group) || is_group_udq(var);
+        return this->has(this->find_group_var(group, var)) || is_group_udq(var);
     }
 
     bool SummaryState::has_group_var(const std::string& var) const
     {
-        return (this->group_values.count(var) != 0) || is_group_udq(var);
+        return this->is_assigned(this->layout_->groups, var) || is_group_udq(var);
     }
 
     bool SummaryState::has_conn_var(const std::string& well,
@@ -332,17 +369,18 @@ namespace Opm
     {
         // Connection Values = [var][well][index] -> double
 
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
+        const auto* varPos = lookup(this->layout_->conns, var);
+        if (varPos == nullptr) {
             return false;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* wellPos = lookup(*varPos, well);
+        if (wellPos == nullptr) {
             return false;
         }
 
-        return wellPos->second.find(global_index) != wellPos->second.end();
+        const auto* slot = lookup(*wellPos, global_index);
+        return (slot != nullptr) && this->is_defined(*slot);
     }
 
     bool SummaryState::has_segment_var(const std::string& well,
@@ -351,17 +389,18 @@ namespace Opm
     {
         // Segment Values = [var][well][segment] -> double
 
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
+        const auto* varPos = lookup(this->layout_->segments, var);
+        if (varPos == nullptr) {
             return false;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* wellPos = lookup(*varPos, well);
+        if (wellPos == nullptr) {
             return false;
         }
 
-        return (wellPos->second.find(segment) != wellPos->second.end())
+        const auto* slot = lookup(*wellPos, segment);
+        return ((slot != nullptr) && this->is_defined(*slot))
             || is_segment_udq(var);
     }
 
@@ -371,50 +410,22 @@ namespace Opm
     {
         // Region Values = [var][regSet][region] -> double
 
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
-            return false;
-        }
-
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
-            return false;
-        }
-
-        return regSetPos->second.find(region) != regSetPos->second.end();
+        return this->has(this->find_region_var(regSet, var, region));
     }
 
     void SummaryState::update(const std::string& key, double value)
     {
-        auto& val_ref = this->values[key];
+        const auto total = is_total(key);
 
-        if (is_total(key)) {
-            val_ref += value;
-        }
-        else {
-            val_ref = value;
-        }
+        this->update_slots(this->general_slot(key, total), total, value);
     }
 
     void SummaryState::update_well_var(const std::string& well,
                                        const std::string& var,
                                        const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, well)];
-        auto& wval_ref = this->well_values[var][well];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            wval_ref += value;
-        }
-        else {
-            val_ref = wval_ref = value;
-        }
-
-        if (this->m_wells.count(well) == 0) {
-            this->m_wells.insert(well);
-            this->well_names.reset();
-        }
+        this->update_slots(this->resolve_well_var(well, var).slot_,
+                           is_total(var), value);
     }
 
     void SummaryState::update_group_var(const std::string& group,
@@ -429,21 +440,8 @@ namespace Opm
                                         const SummaryConfigNode::Type type,
                                         const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}", var, group)];
-        auto& gval_ref = this->group_values[var][group];
-
-        if (type == SummaryConfigNode::Type::Total) {
-            val_ref  += value;
-            gval_ref += value;
-        }
-        else {
-            val_ref = gval_ref = value;
-        }
-
-        if (this->m_groups.count(group) == 0) {
-            this->m_groups.insert(group);
-            this->group_names.reset();
-        }
+        this->update_slots(this->resolve_group_var(group, var, type).slot_,
+                           type == SummaryConfigNode::Type::Total, value);
     }
 
     void SummaryState::update_elapsed(double delta)
@@ -495,18 +493,8 @@ namespace Opm
                                        const std::size_t  global_index,
                                        const double       value)
     {
-        this->conn_key_buffer_.clear();
-        fmt::format_to(std::back_inserter(this->conn_key_buffer_), "{}:{}:{}", var, well, global_index);
-        auto& val_ref  = this->values[this->conn_key_buffer_];
-        auto& cval_ref = this->conn_values[var][well][global_index];
-
-        if (type == SummaryConfigNode::Type::Total) {
-            val_ref  += value;
-            cval_ref += value;
-        }
-        else {
-            val_ref = cval_ref = value;
-        }
+        this->update_slots(this->resolve_conn_var(well, var, type, global_index).slot_,
+                           type == SummaryConfigNode::Type::Total, value);
     }
 
     void SummaryState::update_segment_var(const std::string& well,
@@ -514,16 +502,8 @@ namespace Opm
                                           const std::size_t  segment,
                                           const double       value)
     {
-        auto& val_ref  = this->values[fmt::format("{}:{}:{}", var, well, segment)];
-        auto& sval_ref = this->segment_values[var][well][segment];
-
-        if (is_total(var)) {
-            val_ref  += value;
-            sval_ref += value;
-        }
-        else {
-            val_ref = sval_ref = value;
-        }
+        this->update_slots(this->resolve_segment_var(well, var, segment).slot_,
+                           is_total(var), value);
     }
 
     void SummaryState::update_region_var(const std::string& regSet,
@@ -533,23 +513,14 @@ namespace Opm
     {
         const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
 
-        auto& val_ref  = this->values[region_key(regKw, regSet, region)];
-        auto& rval_ref = this->region_values[regKw][normalise_region_set_name(regSet)][region];
-
-        if (is_total(regKw)) {
-            val_ref  += value;
-            rval_ref += value;
-        }
-        else {
-            val_ref = rval_ref = value;
-        }
+        this->update_slots(this->resolve_region_var(regSet, var, region).slot_,
+                           is_total(regKw), value);
     }
 
     double SummaryState::get(const std::string& key) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
+        if (const auto handle = this->find(key); this->has(handle)) {
+            return this->get(handle);
         }
 
         if (is_udq(key)) {
@@ -557,10 +528,9 @@ namespace Opm
         }
 
         if (is_encoded_well_completion_quantity(key)) {
-            auto key1 = normalise_encoded_well_completion_quantity(key);
-            auto iter1 = this->values.find(key1);
-            if (iter1 != this->values.end()) {
-                return iter1->second;
+            const auto handle = this->find(normalise_encoded_well_completion_quantity(key));
+            if (this->has(handle)) {
+                return this->get(handle);
             }
         }
 
@@ -572,9 +542,8 @@ namespace Opm
     double SummaryState::get(const std::string& key,
                              const double       default_value) const
     {
-        auto iter = this->values.find(key);
-        if (iter != this->values.end()) {
-            return iter->second;
+        if (const auto handle = this->find(key); this->has(handle)) {
+            return this->get(handle);
         }
 
         if (is_udq(key)) {
@@ -594,8 +563,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_well_udq(var);
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
+        const auto* varPos = lookup(this->layout_->wells, var);
+        if (varPos == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -606,8 +575,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* slot = lookup(*varPos, well);
+        if ((slot == nullptr) || ! this->is_defined(*slot)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -619,7 +588,7 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return wellPos->second;
+        return this->slot_value_[*slot];
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -627,8 +596,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_group_udq(var);
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
+        const auto* varPos = lookup(this->layout_->groups, var);
+        if (varPos == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -639,8 +608,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto groupPos = varPos->second.find(group);
-        if (groupPos == varPos->second.end()) {
+        const auto* slot = lookup(*varPos, group);
+        if ((slot == nullptr) || ! this->is_defined(*slot)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -652,23 +621,23 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return groupPos->second;
+        return this->slot_value_[*slot];
     }
 
     double SummaryState::get_conn_var(const std::string& well,
                                       const std::string& var,
                                       const std::size_t  global_index) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
+        const auto* varPos = lookup(this->layout_->conns, var);
+        if (varPos == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the connection level", var)
             };
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* wellPos = lookup(*varPos, well);
+        if (wellPos == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the connection "
@@ -677,8 +646,8 @@ namespace Opm
             };
         }
 
-        auto connPos = wellPos->second.find(global_index);
-        if (connPos == wellPos->second.end()) {
+        const auto* slot = lookup(*wellPos, global_index);
+        if ((slot == nullptr) || ! this->is_defined(*slot)) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist for connection {} "
@@ -687,7 +656,7 @@ namespace Opm
             };
         }
 
-        return connPos->second;
+        return this->slot_value_[*slot];
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -696,8 +665,8 @@ namespace Opm
     {
         const auto use_udq_fallback = is_segment_udq(var);
 
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
+        const auto* varPos = lookup(this->layout_->segments, var);
+        if (varPos == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -708,8 +677,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
+        const auto* wellPos = lookup(*varPos, well);
+        if (wellPos == nullptr) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -722,8 +691,8 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        auto segPos = wellPos->second.find(segment);
-        if (segPos == wellPos->second.end()) {
+        const auto* slot = lookup(*wellPos, segment);
+        if ((slot == nullptr) || ! this->is_defined(*slot)) {
             if (! use_udq_fallback) {
                 throw std::invalid_argument {
                     fmt::format("Summary vector {} does not "
@@ -736,23 +705,24 @@ namespace Opm
             return this->udq_undefined;
         }
 
-        return segPos->second;
+        return this->slot_value_[*slot];
     }
 
     double SummaryState::get_region_var(const std::string& regSet,
                                         const std::string& var,
                                         const std::size_t  region) const
     {
-        auto varPos = this->region_values.find(EclIO::SummaryNode::normalise_region_keyword(var));
-        if (varPos == this->region_values.end()) {
+        const auto* varPos = lookup(this->layout_->regions,
+                                    EclIO::SummaryNode::normalise_region_keyword(var));
+        if (varPos == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the region level", var)
             };
         }
 
-        auto regSetPos = varPos->second.find(normalise_region_set_name(regSet));
-        if (regSetPos == varPos->second.end()) {
+        const auto* regSetPos = lookup(*varPos, normalise_region_set_name(regSet));
+        if (regSetPos == nullptr) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist at the region "
@@ -761,8 +731,8 @@ namespace Opm
             };
         }
 
-        auto regionPos = regSetPos->second.find(region);
-        if (regionPos == regSetPos->second.end()) {
+        const auto* slot = lookup(*regSetPos, region);
+        if ((slot == nullptr) || ! this->is_defined(*slot)) {
             throw std::invalid_argument {
                 fmt::format("Summary vector {} does not "
                             "exist for region {} "
@@ -771,7 +741,7 @@ namespace Opm
             };
         }
 
-        return regionPos->second;
+        return this->slot_value_[*slot];
     }
 
     double SummaryState::get_well_var(const std::string& well,
@@ -782,15 +752,8 @@ namespace Opm
             ? this->udq_undefined
             : default_value;
 
-        auto varPos = this->well_values.find(var);
-        if (varPos == this->well_values.end()) {
-            return fallback;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        return (wellPos == varPos->second.end())
-            ? fallback
-            : wellPos->second;
+        const auto handle = this->find_well_var(well, var);
+        return this->has(handle) ? this->get(handle) : fallback;
     }
 
     double SummaryState::get_group_var(const std::string& group,
@@ -801,15 +764,8 @@ namespace Opm
             ? this->udq_undefined
             : default_value;
 
-        auto varPos = this->group_values.find(var);
-        if (varPos == this->group_values.end()) {
-            return fallback;
-        }
-
-        auto groupPos = varPos->second.find(group);
-        return (groupPos == varPos->second.end())
-            ? fallback
-            : groupPos->second;
+        const auto handle = this->find_group_var(group, var);
+        return this->has(handle) ? this->get(handle) : fallback;
     }
 
     double SummaryState::get_conn_var(const std::string& well,
@@ -817,20 +773,9 @@ namespace Opm
                                       const std::size_t  global_index,
                                       const double       default_value) const
     {
-        auto varPos = this->conn_values.find(var);
-        if (varPos == this->conn_values.end()) {
-            return default_value;
-        }
-
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
-        }
-
-        auto connPos = wellPos->second.find(global_index);
-        return (connPos == wellPos->second.end())
-            ? default_value
-            : connPos->second;
+        return this->has_conn_var(well, var, global_index)
+            ? this->get_conn_var(well, var, global_index)
+            : default_value;
     }
 
     double SummaryState::get_segment_var(const std::string& well,
@@ -838,26 +783,221 @@ namespace Opm
                                          const std::size_t  segment,
                                          const double       default_value) const
     {
-        auto varPos = this->segment_values.find(var);
-        if (varPos == this->segment_values.end()) {
-            return default_value;
+        const auto handle = this->find_segment_var(well, var, segment);
+        return this->has(handle) ? this->get(handle) : default_value;
+    }
+
+    SummaryState::Handle SummaryState::resolve(const std::string& key)
+    {
+        return this->make_handle(this->general_slot(key, is_total(key)));
+    }
+
+    SummaryState::Handle
+    SummaryState::resolve_well_var(const std::string& well,
+                                   const std::string& var)
+    {
+        if (const auto handle = this->find_well_var(well, var); this->is_valid(handle)) {
+            return handle;
+        }
+
+        const auto total = is_total(var);
+        const auto key_slot = this->general_slot(fmt::format("{}:{}", var, well), total);
+        const auto slot = this->allocate_slot(total, key_slot);
+
+        this->layout_->wells[var][well] = slot;
+
+        return this->make_handle(slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::resolve_group_var(const std::string&            group,
+                                    const std::string&            var,
+                                    const SummaryConfigNode::Type type)
+    {
+        if (const auto handle = this->find_group_var(group, var); this->is_valid(handle)) {
+            return handle;
+        }
+
+        const auto total = type == SummaryConfigNode::Type::Total;
+        const auto key_slot = this->general_slot(fmt::format("{}:{}", var, group), total);
+        const auto slot = this->allocate_slot(total, key_slot);
+
+        this->layout_->groups[var][group] = slot;
+
+        return this->make_handle(slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::resolve_conn_var(const std::string&            well,
+                                   const std::string&            var,
+                                   const SummaryConfigNode::Type type,
+                                   const std::size_t             global_index)
+    {
+        if (const auto* varPos = lookup(this->layout_->conns, var); varPos != nullptr) {
+            if (const auto* wellPos = lookup(*varPos, well); wellPos != nullptr) {
+                if (const auto* slot = lookup(*wellPos, global_index); slot != nullptr) {
+                    return this->make_handle(*slot);
+                }
+            }
+        }
+
+        const auto total = type == SummaryConfigNode::Type::Total;
+        const auto key_slot = this->general_slot(fmt::format("{}:{}:{}", var, well, global_index), total);
+        const auto slot = this->allocate_slot(total, key_slot);
+
+        this->layout_->conns[var][well][global_index] = slot;
+
+        return this->make_handle(slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::resolve_segment_var(const std::string& well,
+                                      const std::string& var,
+                                      const std::size_t  segment)
+    {
+        if (const auto handle = this->find_segment_var(well, var, segment); this->is_valid(handle)) {
+            return handle;
+        }
+
+        const auto total = is_total(var);
+        const auto key_slot = this->general_slot(fmt::format("{}:{}:{}", var, well, segment), total);
+        const auto slot = this->allocate_slot(total, key_slot);
+
+        this->layout_->segments[var][well][segment] = slot;
+
+        return this->make_handle(slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::resolve_region_var(const std::string& regSet,
+                                     const std::string& var,
+                                     const std::size_t  region)
+    {
+        if (const auto handle = this->find_region_var(regSet, var, region); this->is_valid(handle)) {
+            return handle;
+        }
+
+        const auto regKw = EclIO::SummaryNode::normalise_region_keyword(var);
+
+        const auto total = is_total(regKw);
+        const auto key_slot = this->general_slot(region_key(regKw, regSet, region), total);
+        const auto slot = this->allocate_slot(total, key_slot);
+
+        this->layout_->regions[regKw][normalise_region_set_name(regSet)][region] = slot;
+
+        return this->make_handle(slot);
+    }
+
+    SummaryState::Handle SummaryState::find(const std::string& key) const
+    {
+        const auto* slot = lookup(this->layout_->keys, key);
+
+        return (slot == nullptr) ? Handle{} : this->make_handle(*slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::find_well_var(const std::string& well,
+                                const std::string& var) const
+    {
+        const auto* varPos = lookup(this->layout_->wells, var);
+        if (varPos == nullptr) {
+            return {};
+        }
+
+        const auto* slot = lookup(*varPos, well);
+        return (slot == nullptr) ? Handle{} : this->make_handle(*slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::find_group_var(const std::string& group,
+                                 const std::string& var) const
+    {
+        const auto* varPos = lookup(this->layout_->groups, var);
+        if (varPos == nullptr) {
+            return {};
+        }
+
+        const auto* slot = lookup(*varPos, group);
+        return (slot == nullptr) ? Handle{} : this->make_handle(*slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::find_segment_var(const std::string& well,
+                                   const std::string& var,
+                                   const std::size_t  segment) const
+    {
+        const auto* varPos = lookup(this->layout_->segments, var);
+        if (varPos == nullptr) {
+            return {};
+        }
+
+        const auto* wellPos = lookup(*varPos, well);
+        if (wellPos == nullptr) {
+            return {};
+        }
+
+        const auto* slot = lookup(*wellPos, segment);
+        return (slot == nullptr) ? Handle{} : this->make_handle(*slot);
+    }
+
+    SummaryState::Handle
+    SummaryState::find_region_var(const std::string& regSet,
+                                  const std::string& var,
+                                  const std::size_t  region) const
+    {
+        const auto* varPos = lookup(this->layout_->regions,
+                                    EclIO::SummaryNode::normalise_region_keyword(var));
+        if (varPos == nullptr) {
+            return {};
+        }
+
+        const auto* regSetPos = lookup(*varPos, normalise_region_set_name(regSet));
+        if (regSetPos == nullptr) {
+            return {};
+        }
+
+        const auto* slot = lookup(*regSetPos, region);
+        return (slot == nullptr) ? Handle{} : this->make_handle(*slot);
+    }
+
+    bool SummaryState::is_valid(const Handle& handle) const
+    {
+        return handle.layout_ == this->layout_->id;
+    }
+
+    bool SummaryState::has(const Handle& handle) const
+    {
+        return this->is_valid(handle) && this->is_defined(handle.slot_);
+    }
+
+    double SummaryState::get(const Handle& handle) const
+    {
+        if (! this->has(handle)) {
+            throw std::invalid_argument {
+                "Summary value handle does not refer to an assigned value"
+            };
         }
 
-        auto wellPos = varPos->second.find(well);
-        if (wellPos == varPos->second.end()) {
-            return default_value;
+        return this->slot_value_[handle.slot_];
+    }
+
+    void SummaryState::update(const Handle& handle, const double value)
+    {
+        if (! this->is_valid(handle)) {
+            throw std::invalid_argument {
+                "Summary value handle does not refer to this summary state"
+            };
         }
 
-        auto valPos = wellPos->second.find(segment);
-        return (valPos == wellPos->second.end())
-            ? default_value
-            : valPos->second;
+        this->update_slots(handle.slot_,
+                           this->layout_->total[handle.slot_] != 0,
+                           value);
     }
 
     const std::vector<std::string>& SummaryState::wells() const
     {
         if (!this->well_names.has_value()) {
-            this->well_names.emplace(this->m_wells.begin(), this->m_wells.end());
+            this->well_names.emplace(this->entity_names(this->layout_->wells));
         }
 
         return *this->well_names;
@@ -865,13 +1005,13 @@ namespace Opm
 
     std::vector<std::string> SummaryState::wells(const std::string& var) const
     {
-        return var2_list(this->well_values, var);
+        return this->entity_names(this->layout_->wells, var);
     }
 
     const std::vector<std::string>& SummaryState::groups() const
     {
         if (!this->group_names.has_value()) {
-            this->group_names.emplace(this->m_groups.begin(), this->m_groups.end());
+            this->group_names.emplace(this->entity_names(this->layout_->groups));
         }
 
         return *this->group_names;
@@ -879,71 +1019,157 @@ namespace Opm
 
     std::vector<std::string> SummaryState::groups(const std::string& var) const
     {
-        return var2_list(this->group_values, var);
+        return this->entity_names(this->layout_->groups, var);
     }
 
     void SummaryState::append(const SummaryState& buffer)
     {
         this->sim_start = buffer.sim_start;
         this->elapsed = buffer.elapsed;
-        this->values = buffer.values;
-        this->well_names.reset();
+        this->reset_well_names();
         this->group_names.reset();
 
-        this->m_wells.insert(buffer.m_wells.begin(), buffer.m_wells.end());
-        for (const auto& [var, vals] : buffer.well_values) {
-            this->well_values.insert_or_assign(var, vals);
+        // General values are replaced wholesale, category specific values
+        // per variable.
+        for (const auto& [key, slot] : this->layout_->keys) {
+            this->slot_defined_[slot] = 0;
         }
 
-        this->m_groups.insert(buffer.m_groups.begin(), buffer.m_groups.end());
-        for (const auto& [var, vals] : buffer.group_values) {
-            this->group_values.insert_or_assign(var, vals);
+        for (const auto& [key, value] : buffer) {
+            this->set(key, value);
         }
 
-        for (const auto& [var, vals] : buffer.conn_values) {
-            this->conn_values.insert_or_assign(var, vals);
+        auto append_vars = [this, &buffer](auto index, auto resolve)
+        {
+            for (const auto& [var, entities] : buffer.layout_.get()->*index) {
+                if (const auto* current = lookup(this->layout_.get()->*index, var); current != nullptr) {
+                    for (const auto& [entity, slot] : *current) {
+                        this->slot_defined_[slot] = 0;
+                    }
+                }
+                else {
+                    this->make_layout_unique();
+                    (this->layout_.get()->*index)[var];
+                }
+
+                for (const auto& [entity, slot] : entities) {
+                    if (buffer.is_defined(slot)) {
+                        const auto handle = resolve(entity, var, slot);
+
+                        this->slot_value_[handle.slot_] = buffer.slot_value_[slot];
+                        this->define_slot(handle.slot_);
+                    }
+                }
+            }
+        };
+
+        append_vars(&SlotLayout::wells,
+                    [this](const std::string& well, const std::string& var, std::size_t)
+                    { return this->resolve_well_var(well, var); });
+
+        append_vars(&SlotLayout::groups,
+                    [this, &buffer](const std::string& group, const std::string& var, const std::size_t slot)
+                    {
+                        return this->resolve_group_var(group, var, buffer.layout_->total[slot]
+                                                       ? SummaryConfigNode::Type::Total
+                                                       : SummaryConfigNode::Type::Undefined);
+                    });
+
+        auto clear_vars = [this](const auto& current, const auto& vars)
+        {
+            for (const auto& [var, wells] : vars) {
+                const auto* wellPos = lookup(current, var);
+                if (wellPos == nullptr) {
+                    continue;
+                }
+
+                for (const auto& [well, numbers] : *wellPos) {
+                    for (const auto& [number, slot] : numbers) {
+                        this->slot_defined_[slot] = 0;
+                    }
+                }
+            }
+        };
+
+        clear_vars(this->layout_->conns, buffer.layout_->conns);
+        for (const auto& [var, wells] : buffer.layout_->conns) {
+            for (const auto& [well, conns] : wells) {
+                for (const auto& [global_index, slot] : conns) {
+                    if (! buffer.is_defined(slot)) {
+                        continue;
+                    }
+
+                    const auto handle = this->resolve_conn_var(well, var, buffer.layout_->total[slot]
+                                                               ? SummaryConfigNode::Type::Total
+                                                               : SummaryConfigNode::Type::Undefined,
+                                                               global_index);
+
+                    this->slot_value_[handle.slot_] = buffer.slot_value_[slot];
+                    this->define_slot(handle.slot_);
+                }
+            }
         }
 
-        for (const auto& [var, vals] : buffer.segment_values) {
-            this->segment_values.insert_or_assign(var, vals);
+        clear_vars(this->layout_->segments, buffer.layout_->segments);
+        for (const auto& [var, wells] : buffer.layout_->segments) {
+            for (const auto& [well, segments] : wells) {
+                for (const auto& [segment, slot] : segments) {
+                    if (! buffer.is_defined(slot)) {
+                        continue;
+                    }
+
+                    const auto handle = this->resolve_segment_var(well, var, segment);
+
+                    this->slot_value_[handle.slot_] = buffer.slot_value_[slot];
+                    this->define_slot(handle.slot_);
+                }
+            }
         }
     }
 
     SummaryState::const_iterator SummaryState::begin() const
     {
-        return this->values.begin();
+        return { this->layout_->keys.begin(), this->layout_->keys.end(),
+                 &this->slot_value_, &this->slot_defined_ };
     }
 
     SummaryState::const_iterator SummaryState::end() const
     {
-        return this->values.end();
+        return { this->layout_->keys.end(), this->layout_->keys.end(),
+                 &this->slot_value_, &this->slot_defined_ };
     }
 
     std::size_t SummaryState::num_wells() const
     {
-        return this->m_wells.size();
+        return this->wells().size();
     }
 
     std::size_t SummaryState::size() const
     {
-        return this->values.size();
+        return std::distance(this->begin(), this->end());
     }
 
     bool SummaryState::operator==(const SummaryState& other) const
     {
+        auto values = [](const SummaryState& st, const auto& index)
+        {
+            return materialise(index, st.slot_value_, st.slot_defined_);
+        };
+
+        const auto& lhs = *this->layout_;
+        const auto& rhs = *other.layout_;
+
         return (this->sim_start == other.sim_start)
             && (this->udq_undefined == other.udq_undefined)
             && (this->elapsed == other.elapsed)
-            && (this->values == other.values)
-            && (this->well_values == other.well_values)
-            && (this->m_wells == other.m_wells)
+            && (values(*this, lhs.keys) == values(other, rhs.keys))
+            && (values(*this, lhs.wells) == values(other, rhs.wells))
             && (this->wells() == other.wells())
-            && (this->group_values == other.group_values)
-            && (this->m_groups == other.m_groups)
+            && (values(*this, lhs.groups) == values(other, rhs.groups))
             && (this->groups() == other.groups())
-            && (this->conn_values == other.conn_values)
-            && (this->segment_values == other.segment_values)
-            && (this->region_values == other.region_values)
+            && (values(*this, lhs.conns) == values(other, rhs.conns))
+            && (values(*this, lhs.segments) == values(other, rhs.segments))
+            && (values(*this, lhs.regions) == values(other, rhs.regions))
             ;
     }
 
@@ -952,51 +1178,180 @@ namespace Opm
         auto st = SummaryState{TimeService::from_time_t(101), 1.234};
 
         st.elapsed = 1.0;
-        st.values = {{"test1", 2.0}};
-        st.well_values = {{"test2", {{"test3", 3.0}}}};
-        st.m_wells = {"test4"};
-        st.well_names = {"test5"};
-        st.group_values = {{"test6", {{"test7", 4.0}}}},
-        st.m_groups = {"test7"};
-        st.group_names = {"test8"},
-        st.conn_values = {{"test9", {{"test10", {{5, 6.0}}}}}};
+        st.set("test1", 2.0);
+        st.update_well_var("test3", "test2", 3.0);
+        st.update_well_var("test4", "test2", 3.5);
+        st.erase_well_var("test4", "test2");
+        st.update_group_var("test7", "test6", 4.0);
+        st.update_conn_var("test10", "test9", 5, 6.0);
 
-        {
-            auto& sval = st.segment_values["SU1"];
-            sval.emplace("W1", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 1},  123.456   },
-                    { std::size_t{ 2},   17.29    },
-                    { std::size_t{10}, -  2.71828 },
-                });
+        st.update_segment_var("W1", "SU1",  1, 123.456);
+        st.update_segment_var("W1", "SU1",  2, 17.29);
+        st.update_segment_var("W1", "SU1", 10, - 2.71828);
+        st.update_segment_var("W6", "SU1",  7, 3.1415926535);
+
+        st.update_segment_var("I2", "SUVIS", 17, 29.0);
+        st.update_segment_var("I2", "SUVIS", 42, - 1.618);
+
+        st.update_region_var("NUM", "ROPT", 12, 34.56);
+        st.update_region_var("NUM", "ROPT", 3, 14.15926);
+
+        st.update_region_var("RE2", "RGPR", 17, 29.0);
+        st.update_region_var("RE2", "RGPR", 42, - 1.618);
+
+        return st;
+    }
+
+    SummaryState::Handle SummaryState::make_handle(const std::size_t slot) const
+    {
+        return { this->layout_->id, slot };
+    }
+
+    std::size_t SummaryState::allocate_slot(const bool total,
+                                            const std::optional<std::size_t> key_slot)
+    {
+        this->make_layout_unique();
+
+        auto& layout = *this->layout_;
+        const auto slot = layout.total.size();
+
+        layout.total.push_back(total);
+        layout.key_slot.push_back(key_slot.value_or(slot));
 
-            sval.emplace("W6", std::unordered_map<std::size_t, double> {
-                    { std::size_t{ 7}, 3.1415926535 },
-                });
+        this->slot_value_.push_back(0.0);
+        this->slot_defined_.push_back(0);
+        this->slot_assigned_.push_back(0);
+
+        return slot;
+    }
+
+    std::size_t SummaryState::general_slot(const std::string& key, const bool total)
+    {
+        if (const auto* slot = lookup(this->layout_->keys, key); slot != nullptr) {
+            return *slot;
         }
 
-        {
-            auto& sval = st.segment_values["SUVIS"];
-            sval.emplace("I2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
+        const auto slot = this->allocate_slot(total, std::nullopt);
+        this->layout_->keys.emplace(key, slot);
+
+        return slot;
+    }
+
+    void SummaryState::make_layout_unique()
+    {
+        // The key table is shared with copies of this object.  Never
+        // modify it in place since that would change the copies' view of
+        // their own values.
+        if (this->layout_.use_count() > 1) {
+            this->layout_ = std::make_shared<SlotLayout>(*this->layout_);
+            return;
         }
 
-        {
-            auto& rval = st.region_values["ROPT"]["NUM"];
-            rval.emplace(12, 34.56);
-            rval.emplace(3,  14.15926);
+        // Sole owner.  Copies may have been read and destroyed on other
+        // threads, e.g., by asynchronous output.  Their release of the
+        // shared key table happens before the modification which follows
+        // only if the use count observed above is paired with an acquire
+        // fence, since use_count() itself is a relaxed load.
+        std::atomic_thread_fence(std::memory_order_acquire);
+    }
+
+    void SummaryState::reset_well_names()
+    {
+        this->well_names.reset();
+        this->well_set_version_ = next_well_set_version();
+    }
+
+    void SummaryState::assign_slot(const std::size_t slot,
+                                   const bool        total,
+                                   const double      value)
+    {
+        auto& val_ref = this->slot_value_[slot];
+
+        if (total && this->is_defined(slot)) {
+            val_ref += value;
+        }
+        else {
+            val_ref = value;
         }
 
-        {
-            auto& rval = st.region_values["RGPR"];
-            rval.try_emplace("RE2", std::unordered_map<std::size_t, double> {
-                    { std::size_t{17},  29.0   },
-                    { std::size_t{42}, - 1.618 },
-                });
+        this->define_slot(slot);
+    }
+
+    void SummaryState::update_slots(const std::size_t slot,
+                                    const bool        total,
+                                    const double      value)
+    {
+        const auto key_slot = this->layout_->key_slot[slot];
+
+        if (key_slot != slot) {
+            if (this->slot_assigned_[slot] == 0) {
+                // New well or group.
+                this->reset_well_names();
+                this->group_names.reset();
+            }
+
+            this->assign_slot(key_slot, total, value);
         }
 
-        return st;
+        this->assign_slot(slot, total, value);
+    }
+
+    void SummaryState::define_slot(const std::size_t slot)
+    {
+        this->slot_defined_[slot] = 1;
+        this->slot_assigned_[slot] = 1;
+    }
+
+    void SummaryState::undefine_slot(const std::size_t slot)
+    {
+        this->slot_defined_[slot] = 0;
+        this->slot_assigned_[slot] = 0;
+    }
+
+    bool SummaryState::is_assigned(const NameMap<NameMap<std::size_t>>& index,
+                                   const std::string&                   var) const
+    {
+        const auto* entities = lookup(index, var);
+
+        return (entities != nullptr)
+            && std::any_of(entities->begin(), entities->end(),
+                           [this](const auto& entity)
+                           { return this->slot_assigned_[entity.second] != 0; });
+    }
+
+    std::vector<std::string>
+    SummaryState::entity_names(const NameMap<NameMap<std::size_t>>& index) const
+    {
+        auto names = std::set<std::string>{};
+
+        for (const auto& [var, entities] : index) {
+            for (const auto& [entity, slot] : entities) {
+                if (this->slot_assigned_[slot] != 0) {
+                    names.insert(entity);
+                }
+            }
+        }
+
+        return { names.begin(), names.end() };
+    }
+
+    std::vector<std::string>
+    SummaryState::entity_names(const NameMap<NameMap<std::size_t>>& index,
+                               const std::string&                   var) const
+    {
+        const auto* entities = lookup(index, var);
+        if (entities == nullptr) {
+            return {};
+        }
+
+        std::vector<std::string> l;
+        for (const auto& [entity, slot] : *entities) {
+            if (this->is_defined(slot)) {
+                l.push_back(entity);
+            }
+        }
+
+        return l;
     }
 
     std::ostream& operator<<(std::ostream& stream, const SummaryState& st)
@@ -24,12 +24,16 @@
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <ctime>
 #include <iosfwd>
+#include <iterator>
+#include <memory>
 #include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm {
@@ -66,13 +70,119 @@ class UDQSet;
 //     // accessible through the specialized st.has_well_var("OPY", "WGOR").
 //     st.has("WGOR:OPY") => True
 //     st.has_well_var("OPY", "WGOR") => False
+//
+// All values are stored in a single contiguous array.  The string keys are
+// resolved to positions in this array through a key table which is shared
+// between copies of the SummaryState object until one of them registers a
+// new summary value.  A shared key table is never modified, so copies may
+// be read on other threads while the original is updated.  Clients which
+// repeatedly access the same values, such as the summary evaluation, may
+// resolve the keys once and subsequently use the resulting handles to avoid
+// the string lookups altogether:
+//
+//     const auto wopr = st.resolve_well_var("OPX", "WOPR");
+//
+//     st.update(wopr, 123.4);
+//     st.get(wopr) => 123.4
+//     st.get_well_var("OPX", "WOPR") => 123.4
 
 namespace Opm {
 
 class SummaryState
 {
+private:
+    struct SlotLayout;
+
 public:
-    using const_iterator = std::unordered_map<std::string, double>::const_iterator;
+    // Interned reference to a single summary value.  Handles are created
+    // by the resolve_xxx() and find_xxx() member functions and may be used
+    // with the object which created them, and with copies of that object.
+    // A handle becomes invalid if the object's key table is duplicated,
+    // which happens when an object which shares its key table with a copy
+    // registers a new summary value.  Use is_valid() to check whether or
+    // not a handle must be resolved anew.
+    class Handle
+    {
+    public:
+        Handle() = default;
+
+    private:
+        friend class SummaryState;
+
+        Handle(const std::uint64_t layout, const std::size_t slot)
+            : layout_ { layout }
+            , slot_   { slot }
+        {}
+
+        std::uint64_t layout_{0};
+        std::size_t slot_{0};
+    };
+
+    // Iterates the values which are accessible through the general, colon
+    // separated, key.
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using difference_type = std::ptrdiff_t;
+        using value_type = std::pair<std::string, double>;
+        using reference = std::pair<const std::string&, double>;
+        using pointer = void;
+
+        const_iterator() = default;
+
+        reference operator*() const
+        {
+            return { this->pos_->first, (*this->value_)[this->pos_->second] };
+        }
+
+        const_iterator& operator++()
+        {
+            ++this->pos_;
+            this->skip_undefined();
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto prev = *this;
+            ++*this;
+            return prev;
+        }
+
+        bool operator==(const const_iterator& rhs) const
+        {
+            return this->pos_ == rhs.pos_;
+        }
+
+    private:
+        friend class SummaryState;
+
+        using KeyIter = std::unordered_map<std::string, std::size_t>::const_iterator;
+
+        const_iterator(KeyIter pos, KeyIter end,
+                       const std::vector<double>* value,
+                       const std::vector<unsigned char>* defined)
+            : pos_     { pos }
+            , end_     { end }
+            , value_   { value }
+            , defined_ { defined }
+        {
+            this->skip_undefined();
+        }
+
+        void skip_undefined()
+        {
+            while ((this->pos_ != this->end_) && ! (*this->defined_)[this->pos_->second]) {
+                ++this->pos_;
+            }
+        }
+
+        KeyIter pos_{};
+        KeyIter end_{};
+        const std::vector<double>* value_{nullptr};
+        const std::vector<unsigned char>* defined_{nullptr};
+    };
 
     explicit SummaryState(time_point sim_start_arg, double udqUndefined);
 
@@ -130,8 +240,35 @@ public:
     double get_region_var(const std::string& regSet, const std::string& var, std::size_t region, double) const;
     double get_udq_undefined() const { return udq_undefined; }
 
+    // Interned access.  The resolve_xxx() functions register the summary
+    // value, without assigning it, if it does not already exist, while
+    // the find_xxx() functions return an invalid handle for unknown
+    // values.  The handle based update() follows the same accumulate or
+    // assign rules as the corresponding update_xxx() function.
+    Handle resolve(const std::string& key);
+    Handle resolve_well_var(const std::string& well, const std::string& var);
+    Handle resolve_group_var(const std::string& group, const std::string& var, EclIO::SummaryNode::Type type);
+    Handle resolve_conn_var(const std::string& well, const std::string& var, EclIO::SummaryNode::Type type, std::size_t global_index);
+    Handle resolve_segment_var(const std::string& well, const std::string& var, std::size_t segment);
+    Handle resolve_region_var(const std::string& regSet, const std::string& var, std::size_t region);
+
+    Handle find(const std::string& key) const;
+    Handle find_well_var(const std::string& well, const std::string& var) const;
+    Handle find_group_var(const std::string& group, const std::string& var) const;
+    Handle find_segment_var(const std::string& well, const std::string& var, std::size_t segment) const;
+    Handle find_region_var(const std::string& regSet, const std::string& var, std::size_t region) const;
+
+    bool is_valid(const Handle& handle) const;
+    bool has(const Handle& handle) const;
+    double get(const Handle& handle) const;
+    void update(const Handle& handle, double value);
+
     bool is_undefined_value(const double val) const { return val == udq_undefined; }
 
+    // All wells, and groups, which have been assigned a value for any
+    // variable, including those whose values a later append() replaced.
+    // The variable specific overloads list those which currently have a
+    // value for that variable.
     const std::vector<std::string>& wells() const;
     std::vector<std::string> wells(const std::string& var) const;
     const std::vector<std::string>& groups() const;
@@ -140,59 +277,129 @@ public:
     const_iterator begin() const;
     const_iterator end() const;
     std::size_t num_wells() const;
+
+    // Identifies the wells for which each variable is defined.  Changes
+    // whenever a well variable is assigned for the first time or erased,
+    // so callers may cache the result of wells(var) and use this value to
+    // detect a stale cache without forming the well names.
+    std::uint64_t well_set_version() const { return this->well_set_version_; }
     std::size_t size() const;
     bool operator==(const SummaryState& other) const;
 
     template<class Serializer>
     void serializeOp(Serializer& serializer)
     {
+        if (! serializer.isSerializing()) {
+            // Never overwrite a key table shared with other objects.
+            this->layout_ = std::make_shared<SlotLayout>();
+            this->reset_well_names();
+            this->group_names.reset();
+        }
+
         serializer(sim_start);
         serializer(this->udq_undefined);
         serializer(elapsed);
-        serializer(values);
-        serializer(well_values);
-        serializer(m_wells);
-        serializer(well_names);
-        serializer(group_values);
-        serializer(m_groups);
-        serializer(group_names);
-        serializer(conn_values);
-        serializer(segment_values);
-        serializer(this->region_values);
+        serializer(*this->layout_);
+        serializer(this->slot_value_);
+        serializer(this->slot_defined_);
+        serializer(this->slot_assigned_);
     }
 
     static SummaryState serializationTestObject();
 
 private:
-    time_point sim_start;
-    double udq_undefined{};
-    double elapsed = 0;
-    std::unordered_map<std::string,double> values;
+    template <class T>
+    using NameMap = std::unordered_map<std::string, T>;
 
-    // The first key is the variable and the second key is the well.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> well_values;
-    std::set<std::string> m_wells;
-    mutable std::optional<std::vector<std::string>> well_names;
+    template <class T>
+    using NumberMap = std::unordered_map<std::size_t, T>;
 
-    // The first key is the variable and the second key is the group.
-    std::unordered_map<std::string, std::unordered_map<std::string, double>> group_values;
-    std::set<std::string> m_groups;
-    mutable std::optional<std::vector<std::string>> group_names;
+    // Key table.  Maps the general key and the category specific keys of
+    // each summary value to its slot in the value arrays.
+    struct SlotLayout
+    {
+        SlotLayout();
+        SlotLayout(const SlotLayout& rhs);
+        SlotLayout& operator=(const SlotLayout&) = delete;
+
+        // Unique identifier of this key table.  Not serialized.
+        std::uint64_t id{};
+
+        // Whether or not the value in each slot is accumulated.
+        std::vector<unsigned char> total{};
+
+        // Slot of the general key of each slot's value.  Equal to the
+        // slot itself for slots of general keys.
+        std::vector<std::size_t> key_slot{};
+
+        NameMap<std::size_t> keys{};
+
+        // The first key is the variable and the second key is the well.
+        NameMap<NameMap<std::size_t>> wells{};
+
+        // The first key is the variable and the second key is the group.
+        NameMap<NameMap<std::size_t>> groups{};
+
+        // The first key is the variable and the second key is the well and
+        // the third is the global index. NB: The global_index has offset 1!
+        NameMap<NameMap<NumberMap<std::size_t>>> conns{};
+
+        // The first key is the variable and the second key is the well and
+        // the third is the one-based segment number.
+        NameMap<NameMap<NumberMap<std::size_t>>> segments{};
+
+        // First key is variable (e.g., ROIP), second key is region set
+        // (e.g., FIPNUM, FIPABC), and the third key is the one-based region
+        // number.
+        NameMap<NameMap<NumberMap<std::size_t>>> regions{};
+
+        template<class Serializer>
+        void serializeOp(Serializer& serializer)
+        {
+            serializer(total);
+            serializer(key_slot);
+            serializer(keys);
+            serializer(wells);
+            serializer(groups);
+            serializer(conns);
+            serializer(segments);
+            serializer(regions);
+        }
+    };
 
-    // The first key is the variable and the second key is the well and the
-    // third is the global index. NB: The global_index has offset 1!
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> conn_values;
+    time_point sim_start;
+    double udq_undefined{};
+    double elapsed = 0;
 
-    // The first key is the variable and the second key is the well and the
-    // third is the one-based segment number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> segment_values;
+    std::shared_ptr<SlotLayout> layout_{};
 
-    // First key is variable (e.g., ROIP), second key is region set (e.g.,
-    // FIPNUM, FIPABC), and the third key is the one-based region number.
-    std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<std::size_t, double>>> region_values;
+    // Summary values, and whether or not they currently have a value,
+    // indexed by slot.  A slot is also marked as assigned from its first
+    // assignment until it is erased.  Unlike the current value, this
+    // survives append(), so wells() and groups() list every entity which
+    // has had a value, and resolved slots which have never been assigned
+    // count for neither.
+    std::vector<double> slot_value_{};
+    std::vector<unsigned char> slot_defined_{};
+    std::vector<unsigned char> slot_assigned_{};
 
-    // Reusable buffer for formatting connection keys in update_conn_var to avoid allocation.
-    mutable std::string conn_key_buffer_;
+    mutable std::optional<std::vector<std::string>> well_names;
+    mutable std::optional<std::vector<std::string>> group_names;
+    std::uint64_t well_set_version_{0};
+
+    bool is_defined(std::size_t slot) const { return this->slot_defined_[slot] != 0; }
+    void define_slot(std::size_t slot);
+    void undefine_slot(std::size_t slot);
+    bool is_assigned(const NameMap<NameMap<std::size_t>>& index, const std::string& var) const;
+    Handle make_handle(std::size_t slot) const;
+    std::size_t allocate_slot(bool total, std::optional<std::size_t> key_slot);
+    std::size_t general_slot(const std::string& key, bool total);
+    void make_layout_unique();
+    void reset_well_names();
+    void assign_slot(std::size_t slot, bool total, double value);
+    void update_slots(std::size_t slot, bool total, double value);
+    std::vector<std::string> entity_names(const NameMap<NameMap<std::size_t>>& index) const;
+    std::vector<std::string> entity_names(const NameMap<NameMap<std::size_t>>& index, const std::string& var) const;
 };
 
 std::ostream& operator<<(std::ostream& stream, const SummaryState& st);
@@ -94,6 +94,8 @@ public:
     }
 
 private:
+    friend class UDQProgram;
+
     UDQTokenType type;
 
     std::variant<std::string, double> value;
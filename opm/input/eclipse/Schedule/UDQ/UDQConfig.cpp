@@ -33,6 +33,7 @@
 #include <opm/input/eclipse/Schedule/SummaryState.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQInput.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -45,12 +46,17 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <functional>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <variant>
 #include <vector>
 
 #include <fmt/format.h>
@@ -217,6 +223,121 @@ namespace {
         /// \param[in] create Evaluation function factory.
         EvalAssign(Create create) : create_{ std::move(create) } {}
     };
+
+    /// Whether or not a definition must be evaluated on the calling thread.
+    ///
+    /// Segment and region matchers are created on first use by the
+    /// evaluation context, and the random number generators are shared by
+    /// all definitions, so such definitions cannot run concurrently with
+    /// others.
+    bool requires_serial_evaluation(const Opm::UDQDefine& def)
+    {
+        if (def.var_type() == Opm::UDQVarType::SEGMENT_VAR) {
+            return true;
+        }
+
+        const auto funcs = def.func_tokens();
+        const auto uses_random = std::any_of(funcs.begin(), funcs.end(),
+            [](const Opm::UDQTokenType func)
+        {
+            return (func == Opm::UDQTokenType::elemental_func_randn)
+                || (func == Opm::UDQTokenType::elemental_func_randu)
+                || (func == Opm::UDQTokenType::elemental_func_rrandn)
+                || (func == Opm::UDQTokenType::elemental_func_rrandu);
+        });
+
+        if (uses_random) {
+            return true;
+        }
+
+        auto needs_matcher = [](const std::string& quantity)
+        {
+            const auto type = Opm::UDQ::targetType(quantity);
+            return (type == Opm::UDQVarType::SEGMENT_VAR)
+                || (type == Opm::UDQVarType::REGION_VAR);
+        };
+
+        const auto& tokens = def.tokens();
+        return std::any_of(tokens.begin(), tokens.end(),
+            [&needs_matcher](const Opm::UDQToken& token)
+        {
+            if ((token.type() != Opm::UDQTokenType::ecl_expr) ||
+                ! std::holds_alternative<std::string>(token.value()))
+            {
+                return false;
+            }
+
+            return needs_matcher(std::get<std::string>(token.value()))
+                || (! token.selector().empty() && needs_matcher(token.selector().front()));
+        });
+    }
+
+    /// Assign definitions to evaluation levels.
+    ///
+    /// Definitions on the same level are mutually independent and may be
+    /// evaluated concurrently, provided the results are committed only
+    /// once the whole level is done.  If either of two definitions refers
+    /// to the quantity defined by the other, the later one in input order
+    /// is put on a higher level than the earlier one.  Each definition
+    /// therefore sees exactly the values it would see if all definitions
+    /// were evaluated sequentially in input order.
+    ///
+    /// \param[in] defines Applicable definitions in input order.
+    ///
+    /// \param[in] serial Whether or not each definition must be evaluated
+    /// on the calling thread.  Such definitions retain their relative
+    /// order.
+    ///
+    /// \return Evaluation level of each definition.
+    std::vector<std::size_t>
+    evaluation_levels(const std::vector<const Opm::UDQDefine*>& defines,
+                      const std::vector<bool>&                  serial)
+    {
+        auto position = std::unordered_map<std::string, std::size_t>{};
+        for (auto i = std::size_t{0}; i < defines.size(); ++i) {
+            position.emplace(defines[i]->keyword(), i);
+        }
+
+        // predecessors[j] = earlier definitions which must be committed
+        // before definition 'j' is evaluated.
+        auto predecessors = std::vector<std::vector<std::size_t>>(defines.size());
+
+        auto last_serial = std::optional<std::size_t>{};
+        for (auto i = std::size_t{0}; i < defines.size(); ++i) {
+            for (const auto& token : defines[i]->tokens()) {
+                if ((token.type() != Opm::UDQTokenType::ecl_expr) ||
+                    ! std::holds_alternative<std::string>(token.value()))
+                {
+                    continue;
+                }
+
+                const auto pos = position.find(std::get<std::string>(token.value()));
+                if ((pos == position.end()) || (pos->second == i)) {
+                    continue;
+                }
+
+                const auto [first, second] = std::minmax(i, pos->second);
+                predecessors[second].push_back(first);
+            }
+
+            if (serial[i]) {
+                if (last_serial.has_value()) {
+                    predecessors[i].push_back(*last_serial);
+                }
+
+                last_serial = i;
+            }
+        }
+
+        auto levels = std::vector<std::size_t>(defines.size(), 0);
+        for (auto j = std::size_t{0}; j < defines.size(); ++j) {
+            for (const auto i : predecessors[j]) {
+                levels[j] = std::max(levels[j], levels[i] + 1);
+            }
+        }
+
+        return levels;
+    }
 } // Anonymous namespace
 
 namespace Opm {
@@ -406,14 +527,16 @@ namespace Opm {
     {
         this->add_node(quantity, UDQAction::DEFINE);
 
-        this->m_definitions.insert_or_assign(quantity,
-                                             UDQDefine {
-                                                 this->udq_params,
-                                                 quantity,
-                                                 report_step,
-                                                 location,
-                                                 expression
-                                             });
+        auto pos = this->m_definitions.insert_or_assign(quantity,
+                                                        UDQDefine {
+                                                            this->udq_params,
+                                                            quantity,
+                                                            report_step,
+                                                            location,
+                                                            expression
+                                                        }).first;
+
+        pos->second.compile();
 
         this->define_order.insert(quantity);
     }
@@ -770,6 +893,8 @@ namespace Opm {
         select_var_type |= var_type_bit(UDQVarType::FIELD_VAR);
         select_var_type |= var_type_bit(UDQVarType::SEGMENT_VAR);
 
+        auto defines = std::vector<const UDQDefine*>{};
+
         for (const auto& [keyword, index] : this->input_index) {
             if (index.action != UDQAction::DEFINE) {
                 continue;
@@ -790,8 +915,77 @@ namespace Opm {
                 continue;
             }
 
-            context.update_define(report_step, keyword, def.eval(context));
-            def.clear_next();
+            defines.push_back(&def);
+        }
+
+        auto serial = std::vector<bool>(defines.size());
+        std::transform(defines.begin(), defines.end(), serial.begin(),
+                       [](const UDQDefine* def)
+                       { return requires_serial_evaluation(*def); });
+
+        const auto levels = evaluation_levels(defines, serial);
+        const auto num_levels = levels.empty()
+            ? std::size_t{0}
+            : *std::max_element(levels.begin(), levels.end()) + 1;
+
+        auto results = std::vector<std::optional<UDQSet>>(defines.size());
+        auto errors = std::vector<std::exception_ptr>(defines.size());
+
+        auto eval = [&context, &defines, &results, &errors]
+            (const std::size_t i, UDQProgram::Workspace& workspace)
+        {
+            try {
+                results[i] = defines[i]->eval(context, workspace);
+            }
+            catch (...) {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        // Register file shared by all compiled definitions evaluated on
+        // the calling thread.
+        auto workspace = UDQProgram::Workspace{};
+
+        for (auto level = std::size_t{0}; level < num_levels; ++level) {
+            auto concurrent = std::vector<std::size_t>{};
+            auto sequential = std::vector<std::size_t>{};
+            for (auto i = std::size_t{0}; i < defines.size(); ++i) {
+                if (levels[i] == level) {
+                    (serial[i] ? sequential : concurrent).push_back(i);
+                }
+            }
+
+            const auto num_concurrent = static_cast<std::int64_t>(concurrent.size());
+
+#pragma omp parallel if(num_concurrent > 1)
+            {
+                auto thread_workspace = UDQProgram::Workspace{};
+
+#pragma omp for schedule(dynamic)
+                for (std::int64_t k = 0; k < num_concurrent; ++k) {
+                    eval(concurrent[k], thread_workspace);
+                }
+            }
+
+            for (const auto i : sequential) {
+                eval(i, workspace);
+            }
+
+            // Commit in input order so that the UDQ and summary states are
+            // updated exactly as in a sequential evaluation.
+            for (auto i = std::size_t{0}; i < defines.size(); ++i) {
+                if (levels[i] != level) {
+                    continue;
+                }
+
+                if (errors[i] != nullptr) {
+                    std::rethrow_exception(errors[i]);
+                }
+
+                context.update_define(report_step, defines[i]->keyword(), *std::move(results[i]));
+                results[i].reset();
+                defines[i]->clear_next();
+            }
         }
     }
 
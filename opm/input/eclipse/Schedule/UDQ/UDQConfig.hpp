@@ -554,6 +554,11 @@ namespace Opm {
             // just construct a new instance here.
             if (!serializer.isSerializing()) {
                 udqft = UDQFunctionTable(udq_params);
+
+                // Compiled programs are derived from the definitions.
+                for (auto& definition : m_definitions) {
+                    definition.second.compile();
+                }
             }
         }
 
@@ -655,6 +660,11 @@ namespace Opm {
         /// Evaluates all applicable defining expressions.  Assigns new UDQ
         /// values to both the summary and UDQ state objects.
         ///
+        /// Independent definitions are evaluated concurrently when OpenMP
+        /// is enabled.  The results are committed in input order, and
+        /// every definition sees the same values as it would in a
+        /// sequential evaluation.
+        ///
         /// \param[in] report_step Current report step.
         ///
         /// \param[in] schedule Full dynamic input schedule.
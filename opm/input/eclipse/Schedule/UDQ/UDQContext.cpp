@@ -120,8 +120,9 @@ namespace Opm {
         }
 
         if (this->summary_state.has_well_var(var)) {
-            if (this->summary_state.has_well_var(well, var)) {
-                return this->summary_state.get_well_var(well, var);
+            const auto value = this->summary_state.find_well_var(well, var);
+            if (this->summary_state.has(value)) {
+                return this->summary_state.get(value);
             }
 
             return std::nullopt;
@@ -145,8 +146,9 @@ namespace Opm {
         }
 
         if (this->summary_state.has_group_var(var)) {
-            if (this->summary_state.has_group_var(group, var)) {
-                return this->summary_state.get_group_var(group, var);
+            const auto value = this->summary_state.find_group_var(group, var);
+            if (this->summary_state.has(value)) {
+                return this->summary_state.get(value);
             }
 
             return std::nullopt;
@@ -170,8 +172,10 @@ namespace Opm {
             return std::nullopt;
         }
 
-        if (this->summary_state.has_segment_var(well, var, segment)) {
-            return this->summary_state.get_segment_var(well, var, segment);
+        if (const auto value = this->summary_state.find_segment_var(well, var, segment);
+            this->summary_state.has(value))
+        {
+            return this->summary_state.get(value);
         }
 
         throw std::logic_error {
@@ -186,8 +190,10 @@ namespace Opm {
                                const std::string& var,
                                const std::size_t region) const
     {
-        if (this->summary_state.has_region_var(regSet, var, region)) {
-            return this->summary_state.get_region_var(regSet, var, region);
+        if (const auto value = this->summary_state.find_region_var(regSet, var, region);
+            this->summary_state.has(value))
+        {
+            return this->summary_state.get(value);
         }
 
         throw std::logic_error {
@@ -37,10 +37,13 @@
 #include <cstddef>
 #include <cstring>
 #include <exception>
+#include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <tuple>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <fmt/format.h>
@@ -242,6 +245,21 @@ bool dynamic_type_check(const Opm::UDQVarType lhs,
         || (rhs == Opm::UDQVarType::SCALAR);
 }
 
+[[noreturn]] void rethrow_eval_error(const std::exception&      exc,
+                                     const std::string&         keyword,
+                                     const Opm::KeywordLocation& location)
+{
+    const auto msg = fmt::format("Problem evaluating UDQ {}\n"
+                                 "In {} line {}\n"
+                                 "Internal error: {}",
+                                 keyword,
+                                 location.filename,
+                                 location.lineno,
+                                 exc.what());
+    Opm::OpmLog::error(msg);
+    std::throw_with_nested(exc);
+}
+
 } // Anonymous namespace
 
 namespace Opm {
@@ -345,15 +363,7 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
         }
     }
     catch (const std::exception& exc) {
-        const auto msg = fmt::format("Problem evaluating UDQ {}\n"
-                                     "In {} line {}\n"
-                                     "Internal error: {}",
-                                     this->m_keyword,
-                                     this->m_location.filename,
-                                     this->m_location.lineno,
-                                     exc.what());
-        OpmLog::error(msg);
-        std::throw_with_nested(exc);
+        rethrow_eval_error(exc, this->m_keyword, this->m_location);
     }
 
     if (! res.has_value()) {
@@ -367,6 +377,44 @@ UDQSet UDQDefine::eval(const UDQContext& context) const
     return *std::move(res);
 }
 
+UDQSet UDQDefine::eval(const UDQContext&     context,
+                       UDQProgram::Workspace& workspace) const
+{
+    if (this->program_ != nullptr) {
+        // The program returns nullopt for input it does not support, in
+        // which case the AST evaluates the expression instead.  Errors are
+        // reported as for the AST.
+        auto res = std::optional<UDQSet>{};
+        try {
+            res = this->program_->eval(this->m_keyword, context, workspace);
+        }
+        catch (const std::exception& exc) {
+            rethrow_eval_error(exc, this->m_keyword, this->m_location);
+        }
+
+        if (res.has_value()) {
+            return *std::move(res);
+        }
+    }
+
+    return this->eval(context);
+}
+
+void UDQDefine::compile()
+{
+    this->program_.reset();
+
+    if (this->ast == nullptr) {
+        return;
+    }
+
+    if (auto program = UDQProgram::compile(*this->ast, this->m_var_type);
+        program.has_value())
+    {
+        this->program_ = std::make_shared<const UDQProgram>(*std::move(program));
+    }
+}
+
 const KeywordLocation& UDQDefine::location() const
 {
     return this->m_location;
@@ -23,6 +23,7 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQToken.hpp>
 
@@ -84,7 +85,32 @@ public:
     /// UDQ.
     UDQ::RequisiteEvaluationObjects requiredObjects() const;
 
+    /// Evaluate defining expression by walking its syntax tree.
+    ///
+    /// Reference implementation for the compiled form.
     UDQSet eval(const UDQContext& context) const;
+
+    /// Evaluate defining expression.
+    ///
+    /// Runs the compiled program if there is one and it is able to
+    /// produce a result, and falls back to the syntax tree otherwise.
+    /// Results are the same as those of eval(context).
+    ///
+    /// \param[in] context Evaluation context.
+    ///
+    /// \param[in,out] workspace Register file for the compiled program.
+    /// Should be reused between calls to avoid repeated allocation.
+    UDQSet eval(const UDQContext& context, UDQProgram::Workspace& workspace) const;
+
+    /// Lower the defining expression to a UDQProgram.
+    ///
+    /// Leaves the object without a compiled program if the expression is
+    /// not supported by UDQProgram.
+    void compile();
+
+    /// Whether or not the defining expression has a compiled program.
+    bool compiled() const { return this->program_ != nullptr; }
+
     const std::string& keyword() const;
     const std::string& input_string() const { return this->input_string_; }
     const KeywordLocation& location() const;
@@ -152,6 +178,9 @@ private:
     std::size_t m_report_step{};
     mutable UDQUpdate m_update_status{UDQUpdate::NEXT};
 
+    /// Compiled form of 'ast'.  Derived state, not serialized.
+    std::shared_ptr<const UDQProgram> program_{};
+
     UDQSet scatter_scalar_value(UDQSet&& res, const UDQContext& context) const;
     UDQSet scatter_scalar_well_value(const UDQContext& context, const std::optional<double>& value) const;
     UDQSet scatter_scalar_group_value(const UDQContext& context, const std::optional<double>& value) const;
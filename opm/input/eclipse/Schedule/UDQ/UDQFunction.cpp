@@ -448,16 +448,42 @@ UDQSet UDQBinaryFunction::eval(const UDQSet& lhs, const UDQSet& rhs) const
     return this->func(lhs, rhs);
 }
 
+bool UDQBinaryFunction::equal(const double eps, const double x, const double y)
+{
+    const auto ubound = eps * std::max(std::abs(x), std::abs(y));
+
+    return ! (std::abs(x - y) > ubound);
+}
+
+bool UDQBinaryFunction::lessEqual(const double eps, const double x, const double y)
+{
+    // x <= y ~ x <= y + e <=> ! (y + e < x)
+    return (x == y)
+        || ! (y + eps * std::max(std::abs(x), std::abs(y)) < x);
+}
+
+bool UDQBinaryFunction::greaterEqual(const double eps, const double x, const double y)
+{
+    // x >= y ~ x >= y - e <=> ! (x < y - e).
+    return (x == y)
+        || ! (x < y - eps * std::max(std::abs(x), std::abs(y)));
+}
+
+bool UDQBinaryFunction::less(const double x, const double y)
+{
+    return (x - y) < 0.0;
+}
+
+bool UDQBinaryFunction::greater(const double x, const double y)
+{
+    return (x - y) > 0.0;
+}
+
 UDQSet UDQBinaryFunction::LE(const double eps, const UDQSet& lhs, const UDQSet& rhs)
 {
     return applyBinaryFunction(lhs, rhs, [eps](const UDQScalar& x, const UDQScalar& y)
     {
-        const auto xval = x.get();
-        const auto yval = y.get();
-
-        // x <= y ~ x <= y + e <=> ! (y + e < x)
-        return (xval == yval)
-            || ! (yval + eps * std::max(std::abs(xval), std::abs(yval)) < xval);
+        return lessEqual(eps, x.get(), y.get());
     });
 }
 
@@ -465,12 +491,7 @@ UDQSet UDQBinaryFunction::GE(const double eps, const UDQSet& lhs, const UDQSet&
 {
     return applyBinaryFunction(lhs, rhs, [eps](const UDQScalar& x, const UDQScalar& y)
     {
-        const auto xval = x.get();
-        const auto yval = y.get();
-
-        // x >= y ~ x >= y - e <=> ! (x < y - e).
-        return (xval == yval)
-            || ! (xval < yval - eps * std::max(std::abs(xval), std::abs(yval)));
+        return greaterEqual(eps, x.get(), y.get());
     });
 }
 
@@ -478,12 +499,7 @@ UDQSet UDQBinaryFunction::EQ(const double eps, const UDQSet& lhs, const UDQSet&
 {
     return applyBinaryFunction(lhs, rhs, [eps](const UDQScalar& x, const UDQScalar& y)
     {
-        const auto xval = x.get();
-        const auto yval = y.get();
-
-        const auto ubound = eps * std::max(std::abs(xval), std::abs(yval));
-
-        return ! (std::abs(xval - yval) > ubound);
+        return equal(eps, x.get(), y.get());
     });
 }
 
@@ -512,7 +528,7 @@ UDQSet UDQBinaryFunction::GT(const UDQSet& lhs, const UDQSet& rhs)
 
     for (auto index = 0*numElem; index < numElem; ++index) {
         if (const auto& elem = result[index]; elem.defined()) {
-            result.assign(index, elem.get() > 0.0);
+            result.assign(index, greater(elem.get(), 0.0));
         }
     }
 
@@ -527,7 +543,7 @@ UDQSet UDQBinaryFunction::LT(const UDQSet& lhs, const UDQSet& rhs)
 
     for (auto index = 0*numElem; index < numElem; ++index) {
         if (const auto& elem = result[index]; elem.defined()) {
-            result.assign(index, elem.get() < 0.0);
+            result.assign(index, less(elem.get(), 0.0));
         }
     }
 
@@ -111,6 +111,16 @@ public:
     static UDQSet UMAX(const UDQSet& lhs, const UDQSet& rhs);
     static UDQSet UMIN(const UDQSet& lhs, const UDQSet& rhs);
 
+    // Element comparisons, shared with compiled UDQ programs.  The
+    // tolerance of the epsilon comparisons is relative to the larger
+    // magnitude of the operands.  less() and greater() test the sign of
+    // the difference, like LT() and GT().
+    static bool equal(double eps, double x, double y);
+    static bool lessEqual(double eps, double x, double y);
+    static bool greaterEqual(double eps, double x, double y);
+    static bool less(double x, double y);
+    static bool greater(double x, double y);
+
 private:
     std::function<UDQSet(const UDQSet& lhs, const UDQSet& rhs)> func;
 };
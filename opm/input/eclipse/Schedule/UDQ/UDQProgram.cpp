@@ -0,0 +1,806 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQASTNode.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQContext.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQParams.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace {
+
+bool is_scalar(const Opm::UDQVarType type)
+{
+    return (type == Opm::UDQVarType::SCALAR)
+        || (type == Opm::UDQVarType::FIELD_VAR);
+}
+
+bool is_set(const Opm::UDQVarType type)
+{
+    return (type == Opm::UDQVarType::WELL_VAR)
+        || (type == Opm::UDQVarType::GROUP_VAR);
+}
+
+// Counterpart to UDQScalar::assign(): non-finite values are undefined.
+void load(double* v, unsigned char* d, const std::optional<double>& value)
+{
+    const bool ok = value.has_value() && std::isfinite(*value);
+
+    *v = ok ? *value : 0.0;
+    *d = ok;
+}
+
+void store(double* v, unsigned char* d, const double value, const bool defined)
+{
+    const bool ok = defined && std::isfinite(value);
+
+    *v = ok ? value : 0.0;
+    *d = ok;
+}
+
+// Apply 'fn' elementwise to the registers (v,d) and (w,e), storing the
+// result in (v,d).  A scalar operand is broadcast to the size of the other
+// operand, like udq_cast() does for UDQ sets.
+template <typename Fn>
+void combine(double* v, unsigned char* d,
+             const double* w, const unsigned char* e,
+             const bool broadcast_lhs, const bool broadcast_rhs,
+             const std::size_t n, Fn&& fn)
+{
+    if (broadcast_lhs) {
+        const double x = v[0];
+        const unsigned char dx = d[0];
+        for (std::size_t i = 0; i < n; ++i) {
+            fn(x, dx, w[i], e[i], v[i], d[i]);
+        }
+    }
+    else if (broadcast_rhs) {
+        const double y = w[0];
+        const unsigned char dy = e[0];
+        for (std::size_t i = 0; i < n; ++i) {
+            fn(v[i], d[i], y, dy, v[i], d[i]);
+        }
+    }
+    else {
+        for (std::size_t i = 0; i < n; ++i) {
+            fn(v[i], d[i], w[i], e[i], v[i], d[i]);
+        }
+    }
+}
+
+// Binary function defined where both operands are defined and where
+// 'guard' is finite.  Mirrors applyBinaryFunction() in UDQFunction.cpp,
+// and the plain arithmetic operators when 'guard' and 'fn' coincide.
+template <typename Guard, typename Fn>
+auto guarded(Guard&& guard, Fn&& fn)
+{
+    return [guard, fn](const double x, const unsigned char dx,
+                       const double y, const unsigned char dy,
+                       double& r, unsigned char& dr)
+    {
+        const bool ok = dx && dy && std::isfinite(guard(x, y));
+
+        r = ok ? static_cast<double>(fn(x, y)) : 0.0;
+        dr = ok;
+    };
+}
+
+template <typename Fn>
+auto arithmetic(Fn&& fn)
+{
+    return [fn](const double x, const unsigned char dx,
+                const double y, const unsigned char dy,
+                double& r, unsigned char& dr)
+    {
+        store(&r, &dr, fn(x, y), dx && dy);
+    };
+}
+
+// Union semantics of UADD, UMUL, UMIN and UMAX.
+template <typename Fn>
+auto set_union(Fn&& fn)
+{
+    return [fn](const double x, const unsigned char dx,
+                const double y, const unsigned char dy,
+                double& r, unsigned char& dr)
+    {
+        if (dx && dy) {
+            store(&r, &dr, fn(x, y), true);
+        }
+        else {
+            r = dx ? x : (dy ? y : 0.0);
+            dr = dx || dy;
+        }
+    };
+}
+
+} // Anonymous namespace
+
+namespace Opm {
+
+std::optional<UDQProgram>
+UDQProgram::compile(const UDQASTNode& ast, const UDQVarType target)
+{
+    if ((target != UDQVarType::WELL_VAR) &&
+        (target != UDQVarType::GROUP_VAR) &&
+        (target != UDQVarType::FIELD_VAR))
+    {
+        return std::nullopt;
+    }
+
+    auto program = UDQProgram{};
+    program.target_ = target;
+    program.uses_groups_ = target == UDQVarType::GROUP_VAR;
+
+    auto result = std::optional<UDQVarType>{};
+    try {
+        result = program.lower(ast, target, 0);
+    }
+    catch (const std::exception&) {
+        // Leave malformed expressions to the AST evaluator, which reports
+        // them at evaluation time.
+        return std::nullopt;
+    }
+
+    // Same check as dynamic_type_check() in UDQDefine::eval().
+    if (! result.has_value() ||
+        ((*result != target) && (*result != UDQVarType::SCALAR)))
+    {
+        return std::nullopt;
+    }
+
+    program.result_ = *result;
+
+    return program;
+}
+
+std::optional<UDQVarType>
+UDQProgram::lower(const UDQASTNode& node,
+                  const UDQVarType  target,
+                  const std::size_t reg)
+{
+    static const auto scalar_functions = std::unordered_map<std::string, Op> {
+        {"SUM", Op::Sum}, {"AVEA", Op::AveA}, {"AVEG", Op::AveG}, {"AVEH", Op::AveH},
+        {"MIN", Op::Min}, {"MAX", Op::Max}, {"NORM1", Op::Norm1}, {"NORM2", Op::Norm2},
+        {"NORMI", Op::NormI}, {"PROD", Op::Prod},
+    };
+
+    static const auto elemental_functions = std::unordered_map<std::string, Op> {
+        {"ABS", Op::Abs}, {"DEF", Op::Def}, {"EXP", Op::Exp}, {"IDV", Op::Idv},
+        {"LN", Op::Ln}, {"LOG", Op::Log}, {"NINT", Op::Nint},
+    };
+
+    static const auto binary_functions = std::unordered_map<std::string, Op> {
+        {"+", Op::Add}, {"-", Op::Sub}, {"*", Op::Mul}, {"/", Op::Div}, {"^", Op::Pow},
+        {"<", Op::Lt}, {">", Op::Gt}, {"==", Op::Eq}, {"!=", Op::Ne}, {"<=", Op::Le}, {">=", Op::Ge},
+        {"UADD", Op::UAdd}, {"UMUL", Op::UMul}, {"UMIN", Op::UMin}, {"UMAX", Op::UMax},
+    };
+
+    auto find_function = [&node](const auto& functions) -> std::optional<Op>
+    {
+        const auto* name = std::get_if<std::string>(&node.value);
+        if (name == nullptr) {
+            return std::nullopt;
+        }
+
+        auto pos = functions.find(*name);
+        if (pos == functions.end()) {
+            return std::nullopt;
+        }
+
+        return pos->second;
+    };
+
+    auto type = std::optional<UDQVarType>{};
+
+    if (node.type == UDQTokenType::ecl_expr) {
+        type = this->lower_expression(node, reg);
+    }
+    else if (UDQ::scalarFunc(node.type)) {
+        const auto op = find_function(scalar_functions);
+        if (! op.has_value() || (node.left == nullptr)) {
+            return std::nullopt;
+        }
+
+        const auto arg = this->lower(*node.left, target, reg);
+        if (! arg.has_value()) {
+            return std::nullopt;
+        }
+
+        type = UDQVarType::SCALAR;
+        this->emit({ *op, reg, *type, *arg });
+    }
+    else if (UDQ::elementalUnaryFunc(node.type)) {
+        const auto op = find_function(elemental_functions);
+        if (! op.has_value() || (node.left == nullptr)) {
+            return std::nullopt;
+        }
+
+        type = this->lower(*node.left, target, reg);
+        if (! type.has_value()) {
+            return std::nullopt;
+        }
+
+        this->emit({ *op, reg, *type });
+    }
+    else if (UDQ::binaryFunc(node.type)) {
+        const auto op = find_function(binary_functions);
+        if (! op.has_value() || (node.left == nullptr) || (node.right == nullptr)) {
+            return std::nullopt;
+        }
+
+        const auto lhs = this->lower(*node.left, target, reg);
+        if (! lhs.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto rhs = this->lower(*node.right, target, reg + 1);
+        if (! rhs.has_value()) {
+            return std::nullopt;
+        }
+
+        const auto is_union = (*op == Op::UAdd) || (*op == Op::UMul)
+            || (*op == Op::UMin) || (*op == Op::UMax);
+
+        if ((*lhs == *rhs) || (is_scalar(*lhs) && is_scalar(*rhs))) {
+            type = *lhs;
+        }
+        else if (! is_union && is_scalar(*lhs) && is_set(*rhs)) {
+            type = *rhs;
+        }
+        else if (! is_union && is_scalar(*rhs) && is_set(*lhs)) {
+            type = *lhs;
+        }
+        else {
+            // Well/group mismatch, or union of scalar and set.  Both fail
+            // or have special semantics in the AST evaluator.
+            return std::nullopt;
+        }
+
+        this->emit({ *op, reg, *type, *lhs, *rhs });
+    }
+    else if (node.type == UDQTokenType::number) {
+        const auto* value = std::get_if<double>(&node.value);
+        if ((value == nullptr) ||
+            ! (is_scalar(target) || is_set(target)))
+        {
+            return std::nullopt;
+        }
+
+        type = target;
+        this->uses_groups_ = this->uses_groups_ || (target == UDQVarType::GROUP_VAR);
+        this->emit({ Op::Number, reg, *type, {}, {}, *value });
+    }
+
+    if (type.has_value() && (node.sign != 1.0)) {
+        this->emit({ Op::Scale, reg, *type, {}, {}, node.sign });
+    }
+
+    return type;
+}
+
+std::optional<UDQVarType>
+UDQProgram::lower_expression(const UDQASTNode& node, const std::size_t reg)
+{
+    const auto* key = std::get_if<std::string>(&node.value);
+    if (key == nullptr) {
+        return std::nullopt;
+    }
+
+    auto instr = Instruction { Op::Scalar, reg, UDQVarType::SCALAR };
+    instr.key = *key;
+
+    const auto has_selector = ! node.selector.empty();
+    if (has_selector) {
+        instr.selector = node.selector.front();
+    }
+
+    const auto is_pattern = instr.selector.find('*') != std::string::npos;
+
+    switch (UDQ::targetType(*key)) {
+    case UDQVarType::WELL_VAR:
+        if (! has_selector) {
+            instr.op = Op::Wells;
+            instr.type = UDQVarType::WELL_VAR;
+        }
+        else if (is_pattern) {
+            instr.op = Op::WellPattern;
+            instr.type = UDQVarType::WELL_VAR;
+        }
+        else {
+            instr.op = Op::Well;
+        }
+        break;
+
+    case UDQVarType::GROUP_VAR:
+        if (! has_selector) {
+            instr.op = Op::Groups;
+            instr.type = UDQVarType::GROUP_VAR;
+            this->uses_groups_ = true;
+        }
+        else if (is_pattern) {
+            // Not supported by the AST evaluator either.
+            return std::nullopt;
+        }
+        else {
+            instr.op = Op::Group;
+        }
+        break;
+
+    case UDQVarType::SEGMENT_VAR:
+    case UDQVarType::REGION_VAR:
+    case UDQVarType::TABLE_LOOKUP:
+        return std::nullopt;
+
+    case UDQVarType::FIELD_VAR:
+        instr.op = Op::Field;
+        break;
+
+    default:
+        instr.op = Op::Scalar;
+        break;
+    }
+
+    const auto type = instr.type;
+    this->emit(std::move(instr));
+
+    return type;
+}
+
+void UDQProgram::emit(Instruction&& instr)
+{
+    this->num_registers_ = std::max(this->num_registers_, instr.reg + 1);
+    this->code_.push_back(std::move(instr));
+}
+
+std::optional<UDQSet>
+UDQProgram::eval(const std::string& keyword,
+                 const UDQContext&  context,
+                 Workspace&         workspace) const
+{
+    if (this->uses_groups_) {
+        workspace.groups = context.nonFieldGroups();
+    }
+    else {
+        workspace.groups.clear();
+    }
+
+    const auto& wells = context.wells();
+    const auto stride = std::max({ wells.size(), workspace.groups.size(), std::size_t{1} });
+
+    const auto size = this->num_registers_ * stride;
+    if (workspace.values.size() < size) {
+        workspace.values.resize(size);
+        workspace.defined.resize(size);
+    }
+
+    for (const auto& instr : this->code_) {
+        if (! this->run(instr, context, stride, workspace)) {
+            return std::nullopt;
+        }
+    }
+
+    const auto* v = workspace.values.data();
+    const auto* d = workspace.defined.data();
+
+    switch (this->result_) {
+    case UDQVarType::SCALAR: {
+        // Scalar results are distributed to all elements of a well or
+        // group set, like UDQDefine::scatter_scalar_value() does.
+        const auto value = d[0] ? std::optional<double>{ v[0] } : std::nullopt;
+
+        if (this->target_ == UDQVarType::WELL_VAR) {
+            return value.has_value()
+                ? UDQSet::wells(keyword, wells, *value)
+                : UDQSet::wells(keyword, wells);
+        }
+
+        if (this->target_ == UDQVarType::GROUP_VAR) {
+            return value.has_value()
+                ? UDQSet::groups(keyword, workspace.groups, *value)
+                : UDQSet::groups(keyword, workspace.groups);
+        }
+
+        return UDQSet::scalar(keyword, value);
+    }
+
+    case UDQVarType::FIELD_VAR: {
+        auto res = UDQSet { keyword, UDQVarType::FIELD_VAR, std::size_t{1} };
+        if (d[0]) {
+            res.assign(0, v[0]);
+        }
+
+        return res;
+    }
+
+    case UDQVarType::WELL_VAR:
+    case UDQVarType::GROUP_VAR: {
+        auto res = (this->result_ == UDQVarType::WELL_VAR)
+            ? UDQSet::wells(keyword, wells)
+            : UDQSet::groups(keyword, workspace.groups);
+
+        for (std::size_t i = 0; i < res.size(); ++i) {
+            if (d[i]) {
+                res.assign(i, v[i]);
+            }
+        }
+
+        return res;
+    }
+
+    default:
+        return std::nullopt;
+    }
+}
+
+bool UDQProgram::run(const Instruction& instr,
+                     const UDQContext&  context,
+                     const std::size_t  stride,
+                     Workspace&         workspace) const
+{
+    const auto& wells = context.wells();
+
+    auto elements = [&wells, &workspace](const UDQVarType type) -> std::size_t
+    {
+        switch (type) {
+        case UDQVarType::WELL_VAR:  return wells.size();
+        case UDQVarType::GROUP_VAR: return workspace.groups.size();
+        default:                    return 1;
+        }
+    };
+
+    auto* v = workspace.values.data() + instr.reg*stride;
+    auto* d = workspace.defined.data() + instr.reg*stride;
+    const auto n = elements(instr.type);
+
+    // Defined values of scalar function argument, in order.
+    auto gather = [v, d, &workspace](const std::size_t count) -> const std::vector<double>&
+    {
+        auto& values = workspace.scratch;
+        values.clear();
+        for (std::size_t i = 0; i < count; ++i) {
+            if (d[i]) {
+                values.push_back(v[i]);
+            }
+        }
+
+        return values;
+    };
+
+    const auto broadcast_lhs = is_scalar(instr.lhs) && is_set(instr.rhs);
+    const auto broadcast_rhs = is_scalar(instr.rhs) && is_set(instr.lhs);
+
+    // Binary operations combine the registers 'reg' and 'reg + 1'.  The
+    // AST evaluator fails to broadcast an undefined scalar.
+    const auto* w = v + stride;
+    const auto* e = d + stride;
+    if ((broadcast_lhs && ! d[0]) || (broadcast_rhs && ! e[0])) {
+        return false;
+    }
+
+    auto binary = [&](auto&& fn)
+    {
+        combine(v, d, w, e, broadcast_lhs, broadcast_rhs, n, fn);
+    };
+
+    auto positive = [v, d](const std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            if (d[i] && ! (v[i] > 0.0)) {
+                return false;
+            }
+        }
+
+        return true;
+    };
+
+    switch (instr.op) {
+    case Op::Number:
+        for (std::size_t i = 0; i < n; ++i) {
+            store(v + i, d + i, instr.value, true);
+        }
+        return true;
+
+    case Op::Wells:
+        for (std::size_t i = 0; i < n; ++i) {
+            load(v + i, d + i, context.get_well_var(wells[i], instr.key));
+        }
+        return true;
+
+    case Op::WellPattern: {
+        std::fill_n(v, n, 0.0);
+        std::fill_n(d, n, static_cast<unsigned char>(0));
+
+        // Matching wells are reported in well order, so searching from the
+        // previous match normally finds the next one immediately.
+        auto start = std::size_t{0};
+        for (const auto& wname : context.wells(instr.selector)) {
+            auto pos = std::find(wells.begin() + start, wells.end(), wname);
+            if (pos == wells.end()) {
+                pos = std::find(wells.begin(), wells.begin() + start, wname);
+                if (pos == wells.begin() + start) {
+                    return false;
+                }
+            }
+
+            const auto i = static_cast<std::size_t>(pos - wells.begin());
+            load(v + i, d + i, context.get_well_var(wname, instr.key));
+            start = i + 1;
+        }
+        return true;
+    }
+
+    case Op::Well:
+        load(v, d, context.get_well_var(instr.selector, instr.key));
+        return true;
+
+    case Op::Groups:
+        for (std::size_t i = 0; i < n; ++i) {
+            load(v + i, d + i, context.get_group_var(workspace.groups[i], instr.key));
+        }
+        return true;
+
+    case Op::Group:
+        load(v, d, context.get_group_var(instr.selector, instr.key));
+        return true;
+
+    case Op::Field:
+        load(v, d, context.get(instr.key));
+        return true;
+
+    case Op::Scalar: {
+        const auto value = context.get(instr.key);
+        if (! value.has_value()) {
+            return false;
+        }
+
+        load(v, d, value);
+        return true;
+    }
+
+    case Op::Scale:
+        for (std::size_t i = 0; i < n; ++i) {
+            store(v + i, d + i, v[i] * instr.value, d[i]);
+        }
+        return true;
+
+    case Op::Abs:
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = std::fabs(v[i]);
+        }
+        return true;
+
+    case Op::Def:
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = d[i] ? 1.0 : 0.0;
+        }
+        return true;
+
+    case Op::Idv:
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = d[i] ? 1.0 : 0.0;
+            d[i] = 1;
+        }
+        return true;
+
+    case Op::Exp:
+        for (std::size_t i = 0; i < n; ++i) {
+            store(v + i, d + i, std::exp(v[i]), d[i]);
+        }
+        return true;
+
+    case Op::Ln:
+    case Op::Log:
+        if (! positive(n)) {
+            return false;
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            if (d[i]) {
+                store(v + i, d + i, (instr.op == Op::Ln) ? std::log(v[i]) : std::log10(v[i]), true);
+            }
+        }
+        return true;
+
+    case Op::Nint:
+        for (std::size_t i = 0; i < n; ++i) {
+            v[i] = std::nearbyint(v[i]);
+        }
+        return true;
+
+    case Op::Sum:
+    case Op::AveA:
+    case Op::AveG:
+    case Op::AveH:
+    case Op::Min:
+    case Op::Max:
+    case Op::Norm1:
+    case Op::Norm2:
+    case Op::NormI:
+    case Op::Prod: {
+        // The argument occupies the same register as the result.  Use the
+        // same algorithms as UDQScalarFunction to get bitwise identical
+        // results.
+        const auto& values = gather(elements(instr.lhs));
+        if (values.empty()) {
+            return false;
+        }
+
+        auto result = 0.0;
+        switch (instr.op) {
+        case Op::Sum:
+            result = std::accumulate(values.begin(), values.end(), 0.0);
+            break;
+
+        case Op::AveA:
+            result = std::accumulate(values.begin(), values.end(), 0.0) / values.size();
+            break;
+
+        case Op::AveG:
+            if (std::ranges::find_if(values, [](double x) { return x <= 0; }) != values.end()) {
+                return false;
+            }
+
+            result = std::exp(std::accumulate(values.begin(), values.end(), 0.0,
+                                              [](double x, double y) { return x + std::log(y); })
+                              / values.size());
+            break;
+
+        case Op::AveH:
+            result = values.size() / std::accumulate(values.begin(), values.end(), 0.0,
+                                                     [](double x, double y) { return x + 1.0/y; });
+            break;
+
+        case Op::Min:
+            result = *std::ranges::min_element(values);
+            break;
+
+        case Op::Max:
+            result = *std::ranges::max_element(values);
+            break;
+
+        case Op::Norm1:
+            result = std::accumulate(values.begin(), values.end(), 0.0,
+                                     [](double x, double y) { return x + std::fabs(y); });
+            break;
+
+        case Op::Norm2:
+            result = std::sqrt(std::inner_product(values.begin(), values.end(),
+                                                  values.begin(), 0.0));
+            break;
+
+        case Op::NormI:
+            result = std::accumulate(values.begin(), values.end(), 0.0,
+                                     [](double x, double y) { return std::max(x, std::fabs(y)); });
+            break;
+
+        default:
+            result = std::accumulate(values.begin(), values.end(),
+                                     1.0, std::multiplies<double>{});
+            break;
+        }
+
+        store(v, d, result, true);
+        return true;
+    }
+
+    case Op::Add:
+        binary(arithmetic([](double x, double y) { return x + y; }));
+        return true;
+
+    case Op::Sub:
+        binary(arithmetic([](double x, double y) { return x - y; }));
+        return true;
+
+    case Op::Mul:
+        binary(arithmetic([](double x, double y) { return x * y; }));
+        return true;
+
+    case Op::Div:
+        binary(arithmetic([](double x, double y) { return x / y; }));
+        return true;
+
+    case Op::Pow: {
+        auto pow = [](double x, double y) { return std::pow(x, y); };
+        binary(guarded(pow, pow));
+        return true;
+    }
+
+    case Op::Lt:
+    case Op::Gt: {
+        // As lhs - rhs, followed by a sign test.
+        auto diff = [](double x, double y) { return x - y; };
+        if (instr.op == Op::Lt) {
+            binary(guarded(diff, [](double x, double y) { return UDQBinaryFunction::less(x, y); }));
+        }
+        else {
+            binary(guarded(diff, [](double x, double y) { return UDQBinaryFunction::greater(x, y); }));
+        }
+        return true;
+    }
+
+    case Op::Eq:
+    case Op::Ne:
+    case Op::Le:
+    case Op::Ge: {
+        const auto eps = context.function_table().getParams().cmpEpsilon();
+        auto sum = [](double x, double y) { return x + y; };
+
+        switch (instr.op) {
+        case Op::Eq:
+            binary(guarded(sum, [eps](double x, double y)
+            { return UDQBinaryFunction::equal(eps, x, y); }));
+            break;
+
+        case Op::Ne:
+            binary(guarded(sum, [eps](double x, double y)
+            { return 1.0 - UDQBinaryFunction::equal(eps, x, y); }));
+            break;
+
+        case Op::Le:
+            binary(guarded(sum, [eps](double x, double y)
+            { return UDQBinaryFunction::lessEqual(eps, x, y); }));
+            break;
+
+        default:
+            binary(guarded(sum, [eps](double x, double y)
+            { return UDQBinaryFunction::greaterEqual(eps, x, y); }));
+            break;
+        }
+        return true;
+    }
+
+    case Op::UAdd:
+        binary(set_union([](double x, double y) { return y + x; }));
+        return true;
+
+    case Op::UMul:
+        binary(set_union([](double x, double y) { return y * x; }));
+        return true;
+
+    case Op::UMin:
+        binary(set_union([](double x, double y) { return std::min(y, x); }));
+        return true;
+
+    case Op::UMax:
+        binary(set_union([](double x, double y) { return std::max(y, x); }));
+        return true;
+    }
+
+    return false;
+}
+
+} // namespace Opm
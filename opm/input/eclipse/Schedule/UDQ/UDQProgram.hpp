@@ -0,0 +1,177 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef UDQ_PROGRAM_HPP
+#define UDQ_PROGRAM_HPP
+
+#include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace Opm {
+
+class UDQASTNode;
+class UDQContext;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// Compiled form of a UDQ defining expression.
+///
+/// The expression tree is lowered to a flat sequence of instructions
+/// operating on a register file of dense value arrays and matching
+/// "defined" flags, one element per well or group.  Running the program
+/// does not create intermediate UDQSet objects and, with a reused
+/// Workspace, does not allocate beyond forming the final result.
+///
+/// Only the well, group and field level subset of the UDQ language is
+/// compiled.  Expressions involving segments, regions, table lookups,
+/// sorting, UNDEF or random numbers are left to the AST evaluator in
+/// UDQASTNode, which remains the reference implementation.  The same
+/// goes for situations in which the AST evaluator would fail, such as
+/// scalar functions of an empty set, and these are detected at run time
+/// and reported as "no result" so that the caller can repeat the
+/// evaluation through the AST.
+class UDQProgram
+{
+public:
+    /// Register file and scratch space for running programs.
+    ///
+    /// May be shared by any number of programs, but only by one
+    /// evaluation at a time.
+    struct Workspace
+    {
+        /// Register values.  Element 'i' of register 'r' is at index
+        /// r*stride + i.
+        std::vector<double> values{};
+
+        /// Whether or not the corresponding element of 'values' is
+        /// defined.
+        std::vector<unsigned char> defined{};
+
+        /// Defined elements of scalar function arguments.
+        std::vector<double> scratch{};
+
+        /// Non-field groups of current evaluation context.
+        std::vector<std::string> groups{};
+    };
+
+    /// Lower defining expression to instruction sequence.
+    ///
+    /// \param[in] ast Defining expression.
+    ///
+    /// \param[in] target Variable type of UDQ being defined.
+    ///
+    /// \return Compiled program, or nullopt if the expression uses
+    /// features which the program does not support.
+    static std::optional<UDQProgram> compile(const UDQASTNode& ast, UDQVarType target);
+
+    /// Evaluate program.
+    ///
+    /// Result is identical to that of UDQDefine::eval() using the AST.
+    ///
+    /// \param[in] keyword Name of UDQ being defined.
+    ///
+    /// \param[in] context Evaluation context.
+    ///
+    /// \param[in,out] workspace Register file.
+    ///
+    /// \return UDQ set.  Nullopt if the evaluation must be repeated
+    /// through the AST.
+    std::optional<UDQSet> eval(const std::string& keyword,
+                               const UDQContext&  context,
+                               Workspace&         workspace) const;
+
+    /// Number of instructions in program.
+    std::size_t size() const { return this->code_.size(); }
+
+private:
+    enum class Op : unsigned char
+    {
+        // Loads: reg <- value
+        Number, Wells, WellPattern, Well, Groups, Group, Field, Scalar,
+
+        // Scaling by sign of AST node: reg <- value*reg
+        Scale,
+
+        // Elemental functions: reg <- f(reg)
+        Abs, Def, Exp, Idv, Ln, Log, Nint,
+
+        // Scalar functions: reg <- f(reg)
+        Sum, AveA, AveG, AveH, Min, Max, Norm1, Norm2, NormI, Prod,
+
+        // Binary functions: reg <- f(reg, reg + 1)
+        Add, Sub, Mul, Div, Pow, Lt, Gt, Eq, Ne, Le, Ge,
+        UAdd, UMul, UMin, UMax,
+    };
+
+    struct Instruction
+    {
+        Op op{};
+
+        /// Destination register and first operand.
+        std::size_t reg{};
+
+        /// Variable type of result: SCALAR, FIELD_VAR, WELL_VAR or
+        /// GROUP_VAR.
+        UDQVarType type{UDQVarType::NONE};
+
+        /// Variable types of operands of binary functions.  For scalar
+        /// functions, 'lhs' is the variable type of the argument.
+        UDQVarType lhs{UDQVarType::NONE};
+        UDQVarType rhs{UDQVarType::NONE};
+
+        /// Numeric value or sign.
+        double value{};
+
+        /// Summary vector or UDQ name.
+        std::string key{};
+
+        /// Well or group name or pattern.
+        std::string selector{};
+    };
+
+    std::vector<Instruction> code_{};
+    std::size_t num_registers_{};
+    UDQVarType target_{UDQVarType::NONE};
+    UDQVarType result_{UDQVarType::NONE};
+    bool uses_groups_{false};
+
+    std::optional<UDQVarType>
+    lower(const UDQASTNode& node, UDQVarType target, std::size_t reg);
+
+    std::optional<UDQVarType>
+    lower_expression(const UDQASTNode& node, std::size_t reg);
+
+    void emit(Instruction&& instr);
+
+    bool run(const Instruction&   instr,
+             const UDQContext&    context,
+             std::size_t          stride,
+             Workspace&           workspace) const;
+};
+
+} // namespace Opm
+
+#endif // UDQ_PROGRAM_HPP
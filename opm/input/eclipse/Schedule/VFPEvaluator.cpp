@@ -0,0 +1,541 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // Interpolated value followed by its derivatives with respect to each
+    // of the N table dimensions.
+    template <std::size_t N>
+    using Gradient = std::array<double, N + 1>;
+
+    // Table laid out in row-major order, with offsets between neighbouring
+    // axis points of each dimension.  Offsets are zero for dimensions with
+    // a single axis point.
+    template <std::size_t N>
+    struct Grid
+    {
+        const double* data{nullptr};
+        std::array<std::size_t, N> stride{};
+        std::array<std::size_t, N> upper{};
+    };
+
+    template <std::size_t N>
+    Grid<N> makeGrid(const std::vector<double>& data,
+                     const std::array<const Opm::VFPAxis*, N>& axes)
+    {
+        auto grid = Grid<N>{};
+        grid.data = data.data();
+
+        auto stride = std::size_t{1};
+        for (auto d = N; d-- > 0;) {
+            grid.stride[d] = stride;
+            grid.upper[d] = (axes[d]->size() > 1) ? stride : 0;
+            stride *= axes[d]->size();
+        }
+
+        return grid;
+    }
+
+    // Multilinear interpolation with derivatives.  The 2^N corners of the
+    // enclosing cell are reduced one dimension at a time, innermost first,
+    // such that the corners being combined are neighbours in the table.
+    template <std::size_t N>
+    Gradient<N> interpolate(const Grid<N>& grid,
+                            const std::array<Opm::VFPAxis::Position, N>& pos)
+    {
+        constexpr auto num_corners = std::size_t{1} << N;
+
+        auto base = std::size_t{0};
+        for (std::size_t d = 0; d < N; ++d) {
+            base += pos[d].index * grid.stride[d];
+        }
+
+        // Bit N-1-d of the corner index selects the upper end point of
+        // dimension d.
+        std::array<Gradient<N>, num_corners> corner;
+        for (std::size_t c = 0; c < num_corners; ++c) {
+            auto offset = base;
+            for (std::size_t d = 0; d < N; ++d) {
+                if ((c >> (N - 1 - d)) & 1) {
+                    offset += grid.upper[d];
+                }
+            }
+
+            corner[c][0] = grid.data[offset];
+        }
+
+        for (auto d = N; d-- > 0;) {
+            const auto f = pos[d].factor;
+            const auto remaining = std::size_t{1} << d;
+
+            for (std::size_t c = 0; c < remaining; ++c) {
+                const auto& lo = corner[2*c + 0];
+                const auto& hi = corner[2*c + 1];
+
+                auto reduced = Gradient<N>{};
+                reduced[0] = lo[0] + f*(hi[0] - lo[0]);
+                reduced[1 + d] = (hi[0] - lo[0]) * pos[d].inv_width;
+                for (auto k = d + 1; k < N; ++k) {
+                    reduced[1 + k] = lo[1 + k] + f*(hi[1 + k] - lo[1 + k]);
+                }
+
+                corner[c] = reduced;
+            }
+        }
+
+        return corner[0];
+    }
+
+    // Position of axis point i.
+    Opm::VFPAxis::Position axisPoint(const Opm::VFPAxis& axis, const std::size_t i)
+    {
+        return axis.locate(axis.values()[i]);
+    }
+
+    bool within(const double x, const double a, const double b)
+    {
+        return (std::min(a, b) <= x) && (x <= std::max(a, b));
+    }
+
+    // THP for a given bottom hole pressure.  bhpAt(t) returns the bottom
+    // hole pressure, with derivatives, at THP axis point t.  The profile is
+    // piecewise linear in the THP, so the first interval bracketing the
+    // bottom hole pressure is inverted exactly.  Outside the profile's
+    // range the THP is extrapolated from the closest end interval.  The
+    // derivative with respect to dimension thp_dim of the result is that
+    // with respect to the bottom hole pressure.
+    template <std::size_t N, typename BhpAt>
+    Gradient<N> invertThp(const Opm::VFPAxis& thp_axis,
+                          const std::size_t thp_dim,
+                          const double bhp,
+                          BhpAt&& bhpAt)
+    {
+        const auto& thp = thp_axis.values();
+        const auto nt = thp.size();
+
+        auto result = Gradient<N>{};
+        if (nt == 1) {
+            result[0] = thp[0];
+            return result;
+        }
+
+        auto lo = bhpAt(0);
+        auto hi = bhpAt(1);
+        auto interval = std::size_t{0};
+        const auto first_lo = lo;
+        const auto first_hi = hi;
+
+        auto found = within(bhp, lo[0], hi[0]);
+        for (std::size_t t = 1; !found && (t + 1 < nt); ++t) {
+            lo = hi;
+            hi = bhpAt(t + 1);
+            interval = t;
+            found = within(bhp, lo[0], hi[0]);
+        }
+
+        if (!found) {
+            const auto first_dist = std::min(std::abs(bhp - first_lo[0]), std::abs(bhp - first_hi[0]));
+            const auto last_dist = std::min(std::abs(bhp - lo[0]), std::abs(bhp - hi[0]));
+            if (first_dist < last_dist) {
+                lo = first_lo;
+                hi = first_hi;
+                interval = 0;
+            }
+        }
+
+        const auto width = thp[interval + 1] - thp[interval];
+        const auto delta = hi[0] - lo[0];
+        if (delta == 0.0) {
+            result[0] = thp[interval];
+            return result;
+        }
+
+        const auto s = bhp - lo[0];
+        result[0] = thp[interval] + width * s / delta;
+        for (std::size_t d = 0; d < N; ++d) {
+            result[1 + d] = (d == thp_dim)
+                ? width / delta
+                : -width * (lo[1 + d]*delta + s*(hi[1 + d] - lo[1 + d])) / (delta*delta);
+        }
+
+        return result;
+    }
+
+    // Largest rate on the flow rate axis at which bhpAt(j), the bottom hole
+    // pressure at flow rate axis point j, equals bhp0 + dbhp_dflo * flo.
+    // The difference is piecewise linear in the rate, so each interval is
+    // solved exactly.
+    template <typename BhpAt>
+    std::optional<double> solveFlo(const Opm::VFPAxis& flo_axis,
+                                   const double bhp0,
+                                   const double dbhp_dflo,
+                                   BhpAt&& bhpAt)
+    {
+        const auto& flo = flo_axis.values();
+        auto residual = [&](const std::size_t j)
+        { return bhpAt(j) - (bhp0 + dbhp_dflo*flo[j]); };
+
+        auto hi = residual(flo.size() - 1);
+        if (hi == 0.0) {
+            return flo.back();
+        }
+
+        for (auto j = flo.size() - 1; j-- > 0;) {
+            const auto lo = residual(j);
+            if (lo == 0.0) {
+                return flo[j];
+            }
+
+            if ((lo < 0.0) != (hi < 0.0)) {
+                return flo[j] + lo / (lo - hi) * (flo[j + 1] - flo[j]);
+            }
+
+            hi = lo;
+        }
+
+        return std::nullopt;
+    }
+
+    void checkBatchSize(const std::size_t expected,
+                        std::initializer_list<std::size_t> sizes)
+    {
+        for (const auto size : sizes) {
+            if (size != expected) {
+                throw std::invalid_argument {
+                    fmt::format("Inconsistent VFP evaluation batch sizes "
+                                "{} and {}", expected, size)
+                };
+            }
+        }
+    }
+
+    // Dimensions of the VFPPROD evaluator's table.
+    enum ProdDim : std::size_t { WFR, GFR, ALQ, THP, FLO };
+
+    Opm::VFPProdEvaluator::Result prodResult(const Gradient<5>& g)
+    {
+        return {
+            g[0],
+            g[1 + ProdDim::FLO],
+            g[1 + ProdDim::THP],
+            g[1 + ProdDim::WFR],
+            g[1 + ProdDim::GFR],
+            g[1 + ProdDim::ALQ],
+        };
+    }
+
+    // Dimensions of the VFPINJ evaluator's table.
+    enum InjDim : std::size_t { INJ_THP, INJ_FLO };
+
+    Opm::VFPInjEvaluator::Result injResult(const Gradient<2>& g)
+    {
+        return { g[0], g[1 + InjDim::INJ_FLO], g[1 + InjDim::INJ_THP] };
+    }
+
+} // Anonymous namespace
+
+namespace Opm {
+
+// ---------------------------------------------------------------------------
+// VFPAxis
+// ---------------------------------------------------------------------------
+
+VFPAxis::VFPAxis(const std::vector<double>& values)
+    : m_values(values)
+{
+    if (this->m_values.empty()) {
+        throw std::invalid_argument("VFP table axis must have at least one point");
+    }
+
+    const auto n = this->m_values.size();
+    if (n == 1) {
+        return;
+    }
+
+    this->m_inv_width.resize(n - 1);
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+        const auto width = this->m_values[i + 1] - this->m_values[i];
+        if (width < 0.0) {
+            throw std::invalid_argument("VFP table axis is not sorted");
+        }
+
+        // Repeated axis points are stepped over by locate().
+        this->m_inv_width[i] = (width > 0.0) ? 1.0 / width : 0.0;
+    }
+
+    const auto range = this->m_values.back() - this->m_values.front();
+    if (!(range > 0.0)) {
+        return;
+    }
+
+    // A few buckets per interval keeps the forward scan in locate() short
+    // on unevenly spaced axes.
+    const auto num_buckets = 4 * (n - 1);
+
+    this->m_bucket_origin = this->m_values.front();
+    this->m_bucket_scale = num_buckets / range;
+    this->m_bucket_start.resize(num_buckets);
+
+    auto interval = std::uint32_t{0};
+    for (std::size_t b = 0; b < num_buckets; ++b) {
+        const auto x = this->m_bucket_origin + b / this->m_bucket_scale;
+        while ((interval + 2 < n) && (x >= this->m_values[interval + 1])) {
+            ++interval;
+        }
+
+        this->m_bucket_start[b] = interval;
+    }
+}
+
+VFPAxis::Position VFPAxis::locate(const double x) const
+{
+    const auto n = this->m_values.size();
+    if (n == 1) {
+        return {};
+    }
+
+    auto i = std::size_t{0};
+    const auto t = (x - this->m_bucket_origin) * this->m_bucket_scale;
+    if (t >= static_cast<double>(this->m_bucket_start.size())) {
+        i = n - 2;
+    }
+    else if (t > 0.0) {
+        i = this->m_bucket_start[static_cast<std::size_t>(t)];
+        while ((i + 2 < n) && (x >= this->m_values[i + 1])) {
+            ++i;
+        }
+    }
+
+    return { i, (x - this->m_values[i]) * this->m_inv_width[i], this->m_inv_width[i] };
+}
+
+// ---------------------------------------------------------------------------
+// VFPProdEvaluator
+// ---------------------------------------------------------------------------
+
+VFPProdEvaluator::VFPProdEvaluator(const VFPProdTable& table)
+    : m_flo(table.getFloAxis())
+    , m_thp(table.getTHPAxis())
+    , m_wfr(table.getWFRAxis())
+    , m_gfr(table.getGFRAxis())
+    , m_alq(table.getALQAxis())
+{
+    const auto [nt, nw, ng, na, nf] = table.shape();
+
+    this->m_data.resize(nt * nw * ng * na * nf);
+    auto* value = this->m_data.data();
+    for (std::size_t w = 0; w < nw; ++w) {
+        for (std::size_t g = 0; g < ng; ++g) {
+            for (std::size_t a = 0; a < na; ++a) {
+                for (std::size_t t = 0; t < nt; ++t) {
+                    for (std::size_t f = 0; f < nf; ++f) {
+                        *value++ = table(t, w, g, a, f);
+                    }
+                }
+            }
+        }
+    }
+}
+
+VFPProdEvaluator::Result
+VFPProdEvaluator::bhp(const double flo, const double thp,
+                      const double wfr, const double gfr, const double alq) const
+{
+    const auto grid = makeGrid<5>(this->m_data, { &this->m_wfr, &this->m_gfr, &this->m_alq,
+                                                  &this->m_thp, &this->m_flo });
+
+    return prodResult(interpolate(grid, { this->m_wfr.locate(wfr),
+                                          this->m_gfr.locate(gfr),
+                                          this->m_alq.locate(alq),
+                                          this->m_thp.locate(thp),
+                                          this->m_flo.locate(flo) }));
+}
+
+void VFPProdEvaluator::bhp(std::span<const double> flo,
+                           std::span<const double> thp,
+                           std::span<const double> wfr,
+                           std::span<const double> gfr,
+                           std::span<const double> alq,
+                           std::span<Result> result) const
+{
+    checkBatchSize(result.size(), { flo.size(), thp.size(), wfr.size(), gfr.size(), alq.size() });
+
+    const auto grid = makeGrid<5>(this->m_data, { &this->m_wfr, &this->m_gfr, &this->m_alq,
+                                                  &this->m_thp, &this->m_flo });
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = prodResult(interpolate(grid, { this->m_wfr.locate(wfr[i]),
+                                                   this->m_gfr.locate(gfr[i]),
+                                                   this->m_alq.locate(alq[i]),
+                                                   this->m_thp.locate(thp[i]),
+                                                   this->m_flo.locate(flo[i]) }));
+    }
+}
+
+VFPProdEvaluator::Result
+VFPProdEvaluator::thp(const double flo, const double bhp,
+                      const double wfr, const double gfr, const double alq) const
+{
+    const auto grid = makeGrid<5>(this->m_data, { &this->m_wfr, &this->m_gfr, &this->m_alq,
+                                                  &this->m_thp, &this->m_flo });
+
+    auto pos = std::array {
+        this->m_wfr.locate(wfr),
+        this->m_gfr.locate(gfr),
+        this->m_alq.locate(alq),
+        VFPAxis::Position{},
+        this->m_flo.locate(flo),
+    };
+
+    return prodResult(invertThp<5>(this->m_thp, ProdDim::THP, bhp,
+                                   [&](const std::size_t t)
+                                   {
+                                       pos[ProdDim::THP] = axisPoint(this->m_thp, t);
+                                       return interpolate(grid, pos);
+                                   }));
+}
+
+void VFPProdEvaluator::thp(std::span<const double> flo,
+                           std::span<const double> bhp,
+                           std::span<const double> wfr,
+                           std::span<const double> gfr,
+                           std::span<const double> alq,
+                           std::span<Result> result) const
+{
+    checkBatchSize(result.size(), { flo.size(), bhp.size(), wfr.size(), gfr.size(), alq.size() });
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = this->thp(flo[i], bhp[i], wfr[i], gfr[i], alq[i]);
+    }
+}
+
+std::optional<double>
+VFPProdEvaluator::flo(const double thp, const double wfr, const double gfr, const double alq,
+                      const double bhp0, const double dbhp_dflo) const
+{
+    const auto grid = makeGrid<5>(this->m_data, { &this->m_wfr, &this->m_gfr, &this->m_alq,
+                                                  &this->m_thp, &this->m_flo });
+
+    auto pos = std::array {
+        this->m_wfr.locate(wfr),
+        this->m_gfr.locate(gfr),
+        this->m_alq.locate(alq),
+        this->m_thp.locate(thp),
+        VFPAxis::Position{},
+    };
+
+    return solveFlo(this->m_flo, bhp0, dbhp_dflo,
+                    [&](const std::size_t f)
+                    {
+                        pos[ProdDim::FLO] = axisPoint(this->m_flo, f);
+                        return interpolate(grid, pos)[0];
+                    });
+}
+
+// ---------------------------------------------------------------------------
+// VFPInjEvaluator
+// ---------------------------------------------------------------------------
+
+VFPInjEvaluator::VFPInjEvaluator(const VFPInjTable& table)
+    : m_flo(table.getFloAxis())
+    , m_thp(table.getTHPAxis())
+    , m_data(table.getTable())
+{}
+
+VFPInjEvaluator::Result
+VFPInjEvaluator::bhp(const double flo, const double thp) const
+{
+    const auto grid = makeGrid<2>(this->m_data, { &this->m_thp, &this->m_flo });
+
+    return injResult(interpolate(grid, { this->m_thp.locate(thp), this->m_flo.locate(flo) }));
+}
+
+void VFPInjEvaluator::bhp(std::span<const double> flo,
+                          std::span<const double> thp,
+                          std::span<Result> result) const
+{
+    checkBatchSize(result.size(), { flo.size(), thp.size() });
+
+    const auto grid = makeGrid<2>(this->m_data, { &this->m_thp, &this->m_flo });
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = injResult(interpolate(grid, { this->m_thp.locate(thp[i]),
+                                                  this->m_flo.locate(flo[i]) }));
+    }
+}
+
+VFPInjEvaluator::Result
+VFPInjEvaluator::thp(const double flo, const double bhp) const
+{
+    const auto grid = makeGrid<2>(this->m_data, { &this->m_thp, &this->m_flo });
+
+    auto pos = std::array { VFPAxis::Position{}, this->m_flo.locate(flo) };
+
+    return injResult(invertThp<2>(this->m_thp, InjDim::INJ_THP, bhp,
+                                  [&](const std::size_t t)
+                                  {
+                                      pos[InjDim::INJ_THP] = axisPoint(this->m_thp, t);
+                                      return interpolate(grid, pos);
+                                  }));
+}
+
+void VFPInjEvaluator::thp(std::span<const double> flo,
+                          std::span<const double> bhp,
+                          std::span<Result> result) const
+{
+    checkBatchSize(result.size(), { flo.size(), bhp.size() });
+
+    for (std::size_t i = 0; i < result.size(); ++i) {
+        result[i] = this->thp(flo[i], bhp[i]);
+    }
+}
+
+std::optional<double>
+VFPInjEvaluator::flo(const double thp, const double bhp0, const double dbhp_dflo) const
+{
+    const auto grid = makeGrid<2>(this->m_data, { &this->m_thp, &this->m_flo });
+
+    auto pos = std::array { this->m_thp.locate(thp), VFPAxis::Position{} };
+
+    return solveFlo(this->m_flo, bhp0, dbhp_dflo,
+                    [&](const std::size_t f)
+                    {
+                        pos[InjDim::INJ_FLO] = axisPoint(this->m_flo, f);
+                        return interpolate(grid, pos)[0];
+                    });
+}
+
+} // namespace Opm
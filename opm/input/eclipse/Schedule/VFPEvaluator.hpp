@@ -0,0 +1,231 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_VFP_EVALUATOR_HPP
+#define OPM_VFP_EVALUATOR_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace Opm {
+
+class VFPInjTable;
+class VFPProdTable;
+
+/// Interpolation axis of a VFP table with precomputed lookup.
+///
+/// Locating a value uses a uniform bucket grid over the axis range,
+/// mapping each bucket to the first axis interval it overlaps, followed by
+/// a short forward scan.  Values outside the axis range are located in the
+/// first or last interval, with a weight outside [0, 1], which amounts to
+/// linear extrapolation.
+class VFPAxis
+{
+public:
+    /// Position of a value on the axis.
+    struct Position
+    {
+        /// Index of the lower end point of the interval.
+        std::size_t index{0};
+
+        /// Weight of the upper end point of the interval.
+        double factor{0.0};
+
+        /// Reciprocal of the interval's width.  Zero on single point axes.
+        double inv_width{0.0};
+    };
+
+    VFPAxis() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] values Axis points in increasing order.
+    explicit VFPAxis(const std::vector<double>& values);
+
+    /// Locate a value on the axis.
+    Position locate(double x) const;
+
+    /// Number of axis points.
+    std::size_t size() const
+    {
+        return this->m_values.size();
+    }
+
+    /// Axis points.
+    const std::vector<double>& values() const
+    {
+        return this->m_values;
+    }
+
+private:
+    std::vector<double> m_values{};
+    std::vector<double> m_inv_width{};
+
+    double m_bucket_origin{0.0};
+    double m_bucket_scale{0.0};
+    std::vector<std::uint32_t> m_bucket_start{};
+};
+
+/// Multilinear interpolation in a VFPPROD table.
+///
+/// Precomputes lookup accelerators for all five axes and stores the table
+/// with the THP and flow rate axes innermost.  Well control and network
+/// iterations vary the THP and the rate while the water and gas fractions
+/// and the artificial lift quantity stay fixed, so the corners needed by
+/// successive evaluations lie in a few contiguous rows.
+///
+/// All quantities are in SI units, like in the VFPProdTable.  Values
+/// outside the table's axes are linearly extrapolated.
+class VFPProdEvaluator
+{
+public:
+    /// Interpolated value with derivatives with respect to each argument.
+    struct Result
+    {
+        double value{0.0};
+        double dflo{0.0};
+        double dthp{0.0};
+        double dwfr{0.0};
+        double dgfr{0.0};
+        double dalq{0.0};
+    };
+
+    /// Constructor.
+    ///
+    /// \param[in] table VFP table.
+    explicit VFPProdEvaluator(const VFPProdTable& table);
+
+    /// Bottom hole pressure at given flow rate, THP, water and gas
+    /// fractions and artificial lift quantity.
+    Result bhp(double flo, double thp, double wfr, double gfr, double alq) const;
+
+    /// Bottom hole pressure for a batch of wells.
+    ///
+    /// All input ranges and the result range must have the same size.
+    void bhp(std::span<const double> flo,
+             std::span<const double> thp,
+             std::span<const double> wfr,
+             std::span<const double> gfr,
+             std::span<const double> alq,
+             std::span<Result> result) const;
+
+    /// Tubing head pressure giving a bottom hole pressure at given flow
+    /// rate, water and gas fractions and artificial lift quantity.
+    ///
+    /// The derivatives in the result are those of the THP with respect to
+    /// the bottom hole pressure, in member dthp, and to the flow rate, the
+    /// fractions and the artificial lift quantity.
+    Result thp(double flo, double bhp, double wfr, double gfr, double alq) const;
+
+    /// Tubing head pressure for a batch of wells.
+    ///
+    /// All input ranges and the result range must have the same size.
+    void thp(std::span<const double> flo,
+             std::span<const double> bhp,
+             std::span<const double> wfr,
+             std::span<const double> gfr,
+             std::span<const double> alq,
+             std::span<Result> result) const;
+
+    /// Flow rate at which a well operates at a given THP.
+    ///
+    /// Finds the largest rate within the table's flow rate axis at which
+    /// the table's bottom hole pressure equals that of the reservoir
+    /// inflow, given as bhp0 + dbhp_dflo * flo.  The largest solution is
+    /// the stable operating point of a producing well.  With dbhp_dflo
+    /// equal to zero this is the rate at a fixed bottom hole pressure.
+    ///
+    /// \return Rate, or nullopt if the well cannot flow at this THP.
+    std::optional<double> flo(double thp, double wfr, double gfr, double alq,
+                              double bhp0, double dbhp_dflo) const;
+
+private:
+    VFPAxis m_flo{};
+    VFPAxis m_thp{};
+    VFPAxis m_wfr{};
+    VFPAxis m_gfr{};
+    VFPAxis m_alq{};
+
+    // Table in order (wfr, gfr, alq, thp, flo).
+    std::vector<double> m_data{};
+};
+
+/// Linear interpolation in a VFPINJ table.
+///
+/// Counterpart of VFPProdEvaluator for injection tables.
+class VFPInjEvaluator
+{
+public:
+    /// Interpolated value with derivatives with respect to each argument.
+    struct Result
+    {
+        double value{0.0};
+        double dflo{0.0};
+        double dthp{0.0};
+    };
+
+    /// Constructor.
+    ///
+    /// \param[in] table VFP table.
+    explicit VFPInjEvaluator(const VFPInjTable& table);
+
+    /// Bottom hole pressure at given flow rate and THP.
+    Result bhp(double flo, double thp) const;
+
+    /// Bottom hole pressure for a batch of wells.
+    ///
+    /// All input ranges and the result range must have the same size.
+    void bhp(std::span<const double> flo,
+             std::span<const double> thp,
+             std::span<Result> result) const;
+
+    /// Tubing head pressure giving a bottom hole pressure at given flow
+    /// rate.  Member dthp of the result holds the derivative with respect
+    /// to the bottom hole pressure.
+    Result thp(double flo, double bhp) const;
+
+    /// Tubing head pressure for a batch of wells.
+    ///
+    /// All input ranges and the result range must have the same size.
+    void thp(std::span<const double> flo,
+             std::span<const double> bhp,
+             std::span<Result> result) const;
+
+    /// Flow rate at which a well operates at a given THP.
+    ///
+    /// Finds the largest rate within the table's flow rate axis at which
+    /// the table's bottom hole pressure equals bhp0 + dbhp_dflo * flo.
+    ///
+    /// \return Rate, or nullopt if there is no such rate.
+    std::optional<double> flo(double thp, double bhp0, double dbhp_dflo) const;
+
+private:
+    VFPAxis m_flo{};
+    VFPAxis m_thp{};
+
+    // Table in order (thp, flo).
+    std::vector<double> m_data{};
+};
+
+} // namespace Opm
+
+#endif // OPM_VFP_EVALUATOR_HPP
@@ -36,8 +36,6 @@
 #include <opm/input/eclipse/Parser/ParserKeywords/C.hpp>
 #include <opm/input/eclipse/Parser/ParserKeywords/W.hpp>
 
-#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
-
 #include "../HandlerContext.hpp"
 #include "WellTrajInfo.hpp"
 
@@ -147,8 +145,9 @@ namespace
                     throw OpmInputError(msg, handlerContext.keyword.location());
                 }
 
-                // cellsearchTree is calculated only once and is used to
-                // calculate cell intersections of the specified perforations.
+                // The grid's cell search tree is calculated only once, by
+                // the ScheduleGrid, and is used to calculate cell
+                // intersections of the specified perforations.
                 wellTraj.intersections.clear();
                 wellTraj.wellPathGeometry = new external::RigWellPath;
 
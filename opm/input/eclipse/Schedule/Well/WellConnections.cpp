@@ -778,16 +778,15 @@ The cell ({},{},{}) in well {} is not active and the connection will be ignored)
         wellTraj.wellPathGeometry->setWellPathPoints(points);
         wellTraj.wellPathGeometry->setMeasuredDepths(measured_depths);
 
+        // The AABB search tree of the grid is formed once and shared by
+        // all wells and report steps to avoid redoing an expensive
+        // calculation.
         external::cvf::ref<external::RigEclipseWellLogExtractor> e {
             new external::RigEclipseWellLogExtractor {
-                wellTraj.wellPathGeometry.p(), *ecl_grid, wellTraj.cellSearchTree
+                wellTraj.wellPathGeometry.p(), *ecl_grid, grid.get_cell_search_tree()
             }
         };
 
-        // Keep the AABB search tree of the grid to avoid redoing an
-        // expensive calulation.
-        wellTraj.cellSearchTree = e->getCellSearchTree();
-
         // This gives the intersected grid cells IJK, cell face entrance &
         // exit cell face point and connection length.
         wellTraj.intersections = e->cellIntersectionInfosAlongWellPath();
@@ -745,11 +745,12 @@ void handleWELSPECL(HandlerContext& handlerContext)
             // lgrTag already exists in the map, increase sequence number.
             ++tagPos->second;
         }
-        auto& well = handlerContext.state().wells.get(wellName);
+        auto well = handlerContext.state().wells.get(wellName);
         well.setInsertIndexLGR(tagPos->second);
         well.setInsertIndexAllLGR(index);
         well.flag_lgr_well();
         well.set_lgr_well_tag(lgrTag);
+        handlerContext.state().wells.update(std::move(well));
         index++;
     }
 }
@@ -1362,7 +1363,9 @@ void handleWSEED(HandlerContext& handlerContext)
     }
 
     for (const auto& updated_seed_well : updated_seed_wells) {
-        seeds.get(updated_seed_well).finalizeSeeds();
+        auto seed = std::make_shared<WellFractureSeeds>(seeds(updated_seed_well));
+        seed->finalizeSeeds();
+        seeds.update(updated_seed_well, std::move(seed));
     }
 }
 
@@ -20,7 +20,6 @@
 #ifndef OPM_WELL_TRAJ_INFO_HPP
 #define OPM_WELL_TRAJ_INFO_HPP
 
-#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
 #include <external/resinsight/ReservoirDataModel/RigWellLogExtractor.h>
 #include <external/resinsight/ReservoirDataModel/RigWellPath.h>
 
@@ -29,7 +28,6 @@ namespace Opm {
 struct WellTrajInfo
 {
     std::vector<external::WellPathCellIntersectionInfo> intersections;
-    external::cvf::ref<external::cvf::BoundingBoxTree> cellSearchTree;
     external::cvf::ref<external::RigWellPath> wellPathGeometry;
 };
 
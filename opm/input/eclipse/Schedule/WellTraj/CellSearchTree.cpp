@@ -0,0 +1,98 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/input/eclipse/Schedule/WellTraj/CellSearchTree.hpp>
+
+#include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
+
+#include <external/resinsight/LibCore/cvfVector3.h>
+#include <external/resinsight/LibGeometry/cvfBoundingBox.h>
+#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+Opm::CellSearchTree::CellSearchTree(const EclipseGrid& grid)
+{
+    const auto numCells = static_cast<std::int64_t>(grid.getCartesianSize());
+
+    auto cellBoundingBoxes = std::vector<external::cvf::BoundingBox>(numCells);
+
+#pragma omp parallel for schedule(static)
+    for (std::int64_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        auto& cellBB = cellBoundingBoxes[cellIdx];
+
+        for (const auto& corner : grid.getCornerPositions(cellIdx)) {
+            cellBB.add(external::cvf::Vec3d { corner[0], corner[1], corner[2] });
+        }
+    }
+
+    // Drop cells with invalid geometry, retaining the global cell index of
+    // the others.
+    auto cellIndices = std::vector<std::size_t>{};
+    cellIndices.reserve(numCells);
+
+    auto validCell = std::size_t{0};
+    for (std::int64_t cellIdx = 0; cellIdx < numCells; ++cellIdx) {
+        if (! cellBoundingBoxes[cellIdx].isValid()) {
+            continue;
+        }
+
+        cellBoundingBoxes[validCell++] = cellBoundingBoxes[cellIdx];
+        cellIndices.push_back(cellIdx);
+    }
+
+    cellBoundingBoxes.resize(validCell);
+
+    this->num_cells_ = validCell;
+    this->tree_ = new external::cvf::BoundingBoxTree;
+    this->tree_->buildTreeFromBoundingBoxes(cellBoundingBoxes, &cellIndices);
+}
+
+std::vector<std::size_t>
+Opm::CellSearchTree::findIntersectingCells(const external::cvf::BoundingBox& bb) const
+{
+    auto cells = std::vector<std::size_t>{};
+    this->tree_->findIntersections(bb, &cells);
+
+    return cells;
+}
+
+std::vector<std::vector<std::size_t>>
+Opm::CellSearchTree::findSegmentCells(const std::vector<external::cvf::Vec3d>& points) const
+{
+    if (points.size() < 2) {
+        return {};
+    }
+
+    const auto numSegments = static_cast<std::int64_t>(points.size() - 1);
+    auto segmentCells = std::vector<std::vector<std::size_t>>(numSegments);
+
+#pragma omp parallel for schedule(dynamic)
+    for (std::int64_t segment = 0; segment < numSegments; ++segment) {
+        auto bb = external::cvf::BoundingBox{};
+        bb.add(points[segment + 0]);
+        bb.add(points[segment + 1]);
+
+        this->tree_->findIntersections(bb, &segmentCells[segment]);
+    }
+
+    return segmentCells;
+}
@@ -0,0 +1,91 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_CELL_SEARCH_TREE_HPP
+#define OPM_CELL_SEARCH_TREE_HPP
+
+#include <external/resinsight/LibCore/cvfVector3.h>
+#include <external/resinsight/LibGeometry/cvfBoundingBox.h>
+#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace Opm {
+
+class EclipseGrid;
+
+} // namespace Opm
+
+namespace Opm {
+
+/// Bounding volume hierarchy of the cells in a corner-point grid.
+///
+/// Used to find the cells intersected by a well trajectory (WELTRAJ and
+/// COMPTRAJ keywords).  Forming the hierarchy requires visiting every cell
+/// in the grid, so a single object should be created per grid and shared
+/// by all wells and report steps.  Queries are read-only and may be run
+/// concurrently.
+class CellSearchTree
+{
+public:
+    /// Constructor.
+    ///
+    /// Computes the bounding box of each cell in the grid, in parallel if
+    /// OpenMP is enabled, and forms the hierarchy of those boxes.  Cells
+    /// with invalid geometry are not included.
+    ///
+    /// \param[in] grid Corner-point grid.
+    explicit CellSearchTree(const EclipseGrid& grid);
+
+    /// Find cells whose bounding boxes intersect a box.
+    ///
+    /// \param[in] bb Search box.
+    ///
+    /// \return Global indices of candidate cells, in no particular order.
+    std::vector<std::size_t>
+    findIntersectingCells(const external::cvf::BoundingBox& bb) const;
+
+    /// Find candidate cells for each segment of a piecewise linear path.
+    ///
+    /// Segment 'i' runs from points[i] to points[i + 1].  Segments are
+    /// processed in parallel if OpenMP is enabled.
+    ///
+    /// \param[in] points Path vertices.
+    ///
+    /// \return Global indices of cells whose bounding boxes intersect the
+    /// bounding box of each segment.  One element per segment, and empty
+    /// if there are fewer than two points.
+    std::vector<std::vector<std::size_t>>
+    findSegmentCells(const std::vector<external::cvf::Vec3d>& points) const;
+
+    /// Number of cells in the hierarchy.
+    std::size_t numCells() const { return this->num_cells_; }
+
+private:
+    /// Hierarchy of cell bounding boxes.
+    external::cvf::ref<external::cvf::BoundingBoxTree> tree_{};
+
+    /// Number of cells in the hierarchy.
+    std::size_t num_cells_{0};
+};
+
+} // namespace Opm
+
+#endif // OPM_CELL_SEARCH_TREE_HPP
@@ -27,7 +27,7 @@
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
-#include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
+#include <opm/input/eclipse/Schedule/WellTraj/CellSearchTree.hpp>
 
 #include <external/resinsight/ReservoirDataModel/RigWellLogExtractionTools.h>
 #include <external/resinsight/ReservoirDataModel/RigWellPath.h>
@@ -40,13 +40,15 @@
 #include <external/resinsight/LibGeometry/cvfBoundingBox.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <map>
+#include <vector>
 
 namespace external {
 
  RigEclipseWellLogExtractor::RigEclipseWellLogExtractor( const RigWellPath* wellpath,
                                                          const Opm::EclipseGrid& grid,
-                                                         cvf::ref<cvf::BoundingBoxTree>& cellSearchTree )
+                                                         const Opm::CellSearchTree& cellSearchTree )
     : RigWellLogExtractor( wellpath, "" )
       ,m_grid(grid)
       ,m_cellSearchTree(cellSearchTree)
@@ -59,30 +61,33 @@ void RigEclipseWellLogExtractor::calculateIntersection()
 {
     std::map<RigMDCellIdxEnterLeaveKey, HexIntersectionInfo> uniqueIntersections;
 
-    if ( m_wellPathGeometry->wellPathPoints().empty() ) return;
+    const auto& points = m_wellPathGeometry->wellPathPoints();
+    if ( points.empty() ) return;
 
-    buildCellSearchTree();
+    // Candidate cells of all path segments in one batch, then the exact
+    // line/hexahedron intersections of each segment.  Segments are
+    // independent of each other until they're merged into the map below.
+    const auto closeCellIndices = m_cellSearchTree.findSegmentCells( points );
+    const auto numSegments = static_cast<std::int64_t>( closeCellIndices.size() );
 
-    for ( std::size_t wpp = 0; wpp < m_wellPathGeometry->wellPathPoints().size() - 1; ++wpp )
-    {
-        std::vector<HexIntersectionInfo> intersections;
-        cvf::Vec3d                       p1 = m_wellPathGeometry->wellPathPoints()[wpp];
-        cvf::Vec3d                       p2 = m_wellPathGeometry->wellPathPoints()[wpp + 1];
-
-        cvf::BoundingBox bb;
-
-        bb.add( p1 );
-        bb.add( p2 );
+    std::vector<std::vector<HexIntersectionInfo>> intersections( numSegments );
 
-        std::vector<std::size_t> closeCellIndices = findCloseCellIndices( bb );
+#pragma omp parallel for schedule(dynamic)
+    for ( std::int64_t wpp = 0; wpp < numSegments; ++wpp )
+    {
+        const cvf::Vec3d& p1 = points[wpp];
+        const cvf::Vec3d& p2 = points[wpp + 1];
 
-        for ( const auto& globalCellIndex : closeCellIndices )
+        for ( const auto& globalCellIndex : closeCellIndices[wpp] )
         {
             cvf::Vec3d    hexCorners[8];  //resinsight numbering, see RigCellGeometryTools.cpp
             RigEclipseWellLogExtractor::hexCornersOpmToResinsight( hexCorners, globalCellIndex);
-            RigHexIntersectionTools::lineHexCellIntersection( p1, p2, hexCorners, globalCellIndex, &intersections );
+            RigHexIntersectionTools::lineHexCellIntersection( p1, p2, hexCorners, globalCellIndex, &intersections[wpp] );
         }
+    }
 
+    for ( std::int64_t wpp = 0; wpp < numSegments; ++wpp )
+    {
         // Now, with all the intersections of this piece of line, we need to
         // sort them in order, and set the measured depth and corresponding cell index
 
@@ -92,7 +97,7 @@ void RigEclipseWellLogExtractor::calculateIntersection()
         double md1 = m_wellPathGeometry->measuredDepths()[wpp];
         double md2 = m_wellPathGeometry->measuredDepths()[wpp + 1];
 
-        insertIntersectionsInMap( intersections, p1, md1, p2, md2, &uniqueIntersections );
+        insertIntersectionsInMap( intersections[wpp], points[wpp], md1, points[wpp + 1], md2, &uniqueIntersections );
     }
 
     this->populateReturnArrays( uniqueIntersections );
@@ -188,92 +193,13 @@ void RigEclipseWellLogExtractor::findCellLocalXYZ( const std::array<cvf::Vec3d,
 // Convert opm to resinsight numbering of cornerpoints, see RigCellGeometryTools.cpp
 void RigEclipseWellLogExtractor::hexCornersOpmToResinsight( cvf::Vec3d hexCorners[8], std::size_t cellIndex ) const
 {
-    const auto[i,j,k] = m_grid.getIJK(cellIndex);
-    std::array<std::size_t, 8> opm2resinsight = {0, 1, 3, 2, 4, 5, 7, 6};
+    const std::array<std::size_t, 8> opm2resinsight = {0, 1, 3, 2, 4, 5, 7, 6};
+    const auto cornerPoints = m_grid.getCornerPositions(cellIndex);
 
     for (std::size_t l = 0; l < 8; l++) {
-         std::array<double, 3> cornerPointArray;
-         cornerPointArray = m_grid.getCornerPos(i,j,k,l);
+         const auto& cornerPointArray = cornerPoints[l];
          hexCorners[opm2resinsight[l]]= cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
     }
 }
 
-// Modified version of ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
-void RigEclipseWellLogExtractor::buildCellSearchTree()
-{
-    if (m_cellSearchTree.isNull()) {
-
-        auto nx = m_grid.getNX();
-        auto ny = m_grid.getNY();
-        auto nz = m_grid.getNZ();
-
-        std::size_t cellCount = nx * ny * nz;
-        std::vector<std::size_t>           cellIndicesForBoundingBoxes;
-        std::vector<cvf::BoundingBox> cellBoundingBoxes;
-
-// #pragma omp parallel
-//         {
-            std::size_t threadCellCount = cellCount;
-
-            std::vector<std::size_t>           threadIndicesForBoundingBoxes;
-            std::vector<cvf::BoundingBox> threadBoundingBoxes;
-
-            threadIndicesForBoundingBoxes.reserve( threadCellCount );
-            threadBoundingBoxes.reserve( threadCellCount );
-
-            std::array<double, 3> cornerPointArray;
-            cvf::Vec3d cornerPoint;
-
-// #pragma omp for
-            for (int cIdx = 0; cIdx < (int)cellCount; ++cIdx) {
-                const auto[i,j,k] = m_grid.getIJK(cIdx);
-                cvf::BoundingBox cellBB;
-                for (std::size_t l = 0; l < 8; l++) {
-                     cornerPointArray = m_grid.getCornerPos(i,j,k,l);
-                     cornerPoint = cvf::Vec3d(cornerPointArray[0], cornerPointArray[1], cornerPointArray[2]);
-                     cellBB.add(cornerPoint);
-                }
-
-                if (cellBB.isValid()) {
-                    threadIndicesForBoundingBoxes.emplace_back(cIdx);
-                    threadBoundingBoxes.emplace_back(cellBB);
-                }
-            }
-
-            threadIndicesForBoundingBoxes.shrink_to_fit();
-            threadBoundingBoxes.shrink_to_fit();
-// #pragma omp critical
-//          {
-             cellIndicesForBoundingBoxes.insert( cellIndicesForBoundingBoxes.end(),
-                                                 threadIndicesForBoundingBoxes.begin(),
-                                                 threadIndicesForBoundingBoxes.end() );
-
-             cellBoundingBoxes.insert( cellBoundingBoxes.end(), threadBoundingBoxes.begin(), threadBoundingBoxes.end() );
-        //  }
-    // } #pragma omp parallel
-         m_cellSearchTree = new cvf::BoundingBoxTree;
-         m_cellSearchTree->buildTreeFromBoundingBoxes( cellBoundingBoxes, &cellIndicesForBoundingBoxes );
-    }
-}
-
-// From ApplicationLibCode\ReservoirDataModel\RigMainGrid.cpp
-void RigEclipseWellLogExtractor::findIntersectingCells( const cvf::BoundingBox& inputBB, std::vector<std::size_t>* cellIndices ) const
-{
-    CVF_ASSERT( m_cellSearchTree.notNull() );
-
-    m_cellSearchTree->findIntersections( inputBB, cellIndices );
-}
-
-// Modified version of ApplicationLibCode\ReservoirDataModel\RigEclipseWellLogExtractor.cpp
-std::vector<std::size_t> RigEclipseWellLogExtractor::findCloseCellIndices( const cvf::BoundingBox& bb )
-{
-    std::vector<std::size_t> closeCells;
-    this->findIntersectingCells( bb, &closeCells );
-    return closeCells;
-}
-
- cvf::ref<cvf::BoundingBoxTree> RigEclipseWellLogExtractor::getCellSearchTree()
- {
-    return m_cellSearchTree;
- }
- } //namespace external
+} //namespace external
@@ -20,16 +20,14 @@
 #pragma once
 
 #include <external/resinsight/ReservoirDataModel/RigWellLogExtractor.h>
-#include <external/resinsight/LibGeometry/cvfBoundingBoxTree.h>
 
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
-#include <opm/input/eclipse/Schedule/ScheduleGrid.hpp>
 
 #include <cstddef>
 
 namespace Opm {
+class CellSearchTree;
 class EclipseGrid;
-class ScheduleGrid;
 }
 
 namespace external {
@@ -49,12 +47,10 @@ class BoundingBox;
 class RigEclipseWellLogExtractor : public RigWellLogExtractor
 {
 public:
-    RigEclipseWellLogExtractor( const RigWellPath* wellpath, const Opm::EclipseGrid& grid, cvf::ref<cvf::BoundingBoxTree>& cellSearchTree);
+    RigEclipseWellLogExtractor( const RigWellPath* wellpath, const Opm::EclipseGrid& grid, const Opm::CellSearchTree& cellSearchTree);
 
-    cvf::ref<cvf::BoundingBoxTree> getCellSearchTree();
 private:
     void                calculateIntersection();
-    std::vector<std::size_t> findCloseCellIndices( const cvf::BoundingBox& bb );
     cvf::Vec3d
         calculateLengthInCell( std::size_t cellIndex, const cvf::Vec3d& startPoint, const cvf::Vec3d& endPoint ) const override;
 
@@ -69,11 +65,9 @@ private:
                            cvf::Vec3d&                      localXdirection,
                            cvf::Vec3d&                      localYdirection,
                            cvf::Vec3d&                      localZdirection ) const;
-    void buildCellSearchTree();
-    void findIntersectingCells( const cvf::BoundingBox& inputBB, std::vector<std::size_t>* cellIndices ) const;
     void computeCachedData();
 
     const Opm::EclipseGrid& m_grid;
-    cvf::ref<cvf::BoundingBoxTree> m_cellSearchTree;
+    const Opm::CellSearchTree& m_cellSearchTree;
 };
 } //namespace external
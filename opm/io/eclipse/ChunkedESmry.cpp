@@ -0,0 +1,394 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/ChunkedESmry.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/common/utility/shmatch.hpp>
+#include <opm/io/eclipse/ChunkedSmryFormat.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+Opm::time_point make_date(const std::vector<int>& datetime)
+{
+    const auto ts = Opm::TimeStampUTC{ Opm::TimeStampUTC::YMD{ datetime[2], datetime[1], datetime[0] } }
+        .hour(datetime[3]).minutes(datetime[4]).seconds(datetime[5]);
+
+    return Opm::TimeService::from_time_t(Opm::asTimeT(ts));
+}
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+ChunkedESmry::ChunkedESmry(const std::string& filename)
+    : m_inputFileName { filename }
+{
+    if (m_inputFileName.extension() == "") {
+        m_inputFileName += ".CSMRY";
+    }
+
+    auto fileH = this->openFile();
+
+    char magic[ChunkedSmry::magicSize];
+    fileH.read(magic, ChunkedSmry::magicSize);
+
+    if (! fileH || (std::memcmp(magic, ChunkedSmry::fileMagic, ChunkedSmry::magicSize) != 0)) {
+        OPM_THROW(std::runtime_error,
+                  m_inputFileName.string() + " is not a chunked summary file");
+    }
+
+    const auto version = ChunkedSmry::readValue<std::uint32_t>(fileH);
+    if (version != ChunkedSmry::formatVersion) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Unsupported chunked summary file version {} in {}",
+                              version, m_inputFileName.string()));
+    }
+
+    m_chunkSize = ChunkedSmry::readValue<std::uint32_t>(fileH);
+    const auto nVect = ChunkedSmry::readValue<std::uint32_t>(fileH);
+
+    m_start_vect.resize(7);
+    ChunkedSmry::readValues(fileH, m_start_vect.data(), m_start_vect.size());
+    m_startdat = make_date(m_start_vect);
+
+    m_restart_root = ChunkedSmry::readString(fileH);
+    m_restart_step = ChunkedSmry::readValue<std::int32_t>(fileH);
+
+    m_keyword.reserve(nVect);
+    for (std::size_t n = 0; n < nVect; ++n) {
+        m_keyword.push_back(ChunkedSmry::readString(fileH));
+        m_keyword_index.emplace(m_keyword.back(), n);
+    }
+
+    for (const auto& key : m_keyword) {
+        m_kwunits[key] = ChunkedSmry::readString(fileH);
+    }
+
+    m_headerEnd = static_cast<std::uint64_t>(fileH.tellg());
+
+    m_vectorData.resize(m_keyword.size());
+    m_vectorLoaded.resize(m_keyword.size(), false);
+
+    this->readIndex(fileH);
+}
+
+std::ifstream ChunkedESmry::openFile() const
+{
+    std::ifstream fileH(m_inputFileName, std::ios::in | std::ios::binary);
+
+    if (! fileH) {
+        OPM_THROW(std::runtime_error,
+                  "Unable to open chunked summary file " + m_inputFileName.string());
+    }
+
+    return fileH;
+}
+
+void ChunkedESmry::readIndex(std::ifstream& fileH)
+{
+    fileH.seekg(0, std::ios::end);
+    const auto fileSize = static_cast<std::uint64_t>(fileH.tellg());
+
+    if (fileSize < m_headerEnd + ChunkedSmry::trailerSize) {
+        OPM_THROW(std::runtime_error,
+                  "Missing footer in chunked summary file " + m_inputFileName.string());
+    }
+
+    fileH.seekg(fileSize - ChunkedSmry::trailerSize);
+
+    const auto nChunks = ChunkedSmry::readValue<std::uint64_t>(fileH);
+    const auto nTstep = ChunkedSmry::readValue<std::uint64_t>(fileH);
+    const auto footerOffset = ChunkedSmry::readValue<std::uint64_t>(fileH);
+
+    char magic[ChunkedSmry::magicSize];
+    fileH.read(magic, ChunkedSmry::magicSize);
+
+    if (! fileH ||
+        (std::memcmp(magic, ChunkedSmry::footerMagic, ChunkedSmry::magicSize) != 0) ||
+        (footerOffset + nChunks*sizeof(std::uint64_t) + ChunkedSmry::trailerSize != fileSize))
+    {
+        OPM_THROW(std::runtime_error,
+                  "Corrupt footer in chunked summary file " + m_inputFileName.string());
+    }
+
+    std::vector<std::uint64_t> chunkOffset(nChunks);
+
+    fileH.seekg(footerOffset);
+    ChunkedSmry::readValues(fileH, chunkOffset.data(), chunkOffset.size());
+
+    m_chunks.clear();
+    m_rstep.clear();
+    m_tstep.clear();
+    m_seqIndex.clear();
+
+    m_rstep.reserve(nTstep);
+    m_tstep.reserve(nTstep);
+
+    for (const auto& offset : chunkOffset) {
+        fileH.seekg(offset);
+
+        auto& chunk = m_chunks.emplace_back();
+        chunk.firstStep = m_rstep.size();
+        chunk.nSteps = ChunkedSmry::readValue<std::uint32_t>(fileH);
+
+        if ((chunk.nSteps > m_chunkSize) ||
+            ((chunk.nSteps < m_chunkSize) && (m_chunks.size() < nChunks)))
+        {
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Chunk {} in {} holds {} time steps, expected {}",
+                                  m_chunks.size() - 1, m_inputFileName.string(),
+                                  chunk.nSteps, m_chunkSize));
+        }
+
+        m_rstep.resize(chunk.firstStep + chunk.nSteps);
+        m_tstep.resize(chunk.firstStep + chunk.nSteps);
+
+        ChunkedSmry::readValues(fileH, m_rstep.data() + chunk.firstStep, chunk.nSteps);
+        ChunkedSmry::readValues(fileH, m_tstep.data() + chunk.firstStep, chunk.nSteps);
+
+        chunk.colTableOffset = static_cast<std::uint64_t>(fileH.tellg());
+        chunk.dataOffset = chunk.colTableOffset + (m_keyword.size() + 1)*sizeof(std::uint64_t);
+    }
+
+    if (m_rstep.size() != nTstep) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Chunked summary file {} holds {} time steps, expected {}",
+                              m_inputFileName.string(), m_rstep.size(), nTstep));
+    }
+
+    m_nTstep = m_rstep.size();
+
+    for (std::size_t m = 0; m < m_rstep.size(); ++m) {
+        if (m_rstep[m] > 0) {
+            m_seqIndex.push_back(m);
+        }
+    }
+}
+
+bool ChunkedESmry::refresh()
+{
+    const auto nTstep = m_nTstep;
+
+    auto fileH = this->openFile();
+    this->readIndex(fileH);
+
+    if (m_nTstep == nTstep) {
+        return false;
+    }
+
+    std::fill(m_vectorLoaded.begin(), m_vectorLoaded.end(), false);
+    for (auto& vector : m_vectorData) {
+        vector = std::vector<float>{};
+    }
+
+    return true;
+}
+
+std::size_t ChunkedESmry::keyIndex(const std::string& name) const
+{
+    auto it = m_keyword_index.find(name);
+    if (it == m_keyword_index.end()) {
+        throw std::invalid_argument("summary key '" + name + "' not found");
+    }
+
+    return it->second;
+}
+
+void ChunkedESmry::readColumn(std::istream& fileH,
+                              const Chunk& chunk,
+                              const std::size_t vectorIndex,
+                              float* values) const
+{
+    std::uint64_t colOffset[2];
+
+    fileH.seekg(chunk.colTableOffset + vectorIndex*sizeof(std::uint64_t));
+    ChunkedSmry::readValues(fileH, colOffset, 2);
+
+    std::vector<char> buffer(colOffset[1] - colOffset[0]);
+
+    fileH.seekg(chunk.dataOffset + colOffset[0]);
+    if (! fileH.read(buffer.data(), buffer.size())) {
+        OPM_THROW(std::runtime_error,
+                  "Premature end of chunked summary file " + m_inputFileName.string());
+    }
+
+    ChunkedSmry::decodeColumn(buffer.data(), buffer.size(), chunk.nSteps, values);
+}
+
+const std::vector<float>& ChunkedESmry::get(const std::string& name) const
+{
+    const auto ind = this->keyIndex(name);
+
+    if (! m_vectorLoaded[ind]) {
+        this->loadData({ name });
+    }
+
+    return m_vectorData[ind];
+}
+
+std::vector<float> ChunkedESmry::get(const std::string& name,
+                                     const std::size_t first,
+                                     const std::size_t last) const
+{
+    const auto ind = this->keyIndex(name);
+
+    if ((first > last) || (last > m_nTstep)) {
+        throw std::out_of_range {
+            fmt::format("Time step range [{}, {}) outside summary of {} time steps",
+                        first, last, m_nTstep)
+        };
+    }
+
+    if (m_vectorLoaded[ind]) {
+        return { m_vectorData[ind].begin() + first, m_vectorData[ind].begin() + last };
+    }
+
+    std::vector<float> values(last - first);
+    if (values.empty()) {
+        return values;
+    }
+
+    auto fileH = this->openFile();
+    std::vector<float> chunkValues(m_chunkSize);
+
+    for (auto c = first / m_chunkSize; c <= (last - 1) / m_chunkSize; ++c) {
+        const auto& chunk = m_chunks[c];
+
+        this->readColumn(fileH, chunk, ind, chunkValues.data());
+
+        const auto from = std::max(first, chunk.firstStep);
+        const auto to = std::min(last, chunk.firstStep + chunk.nSteps);
+
+        std::copy(chunkValues.begin() + (from - chunk.firstStep),
+                  chunkValues.begin() + (to - chunk.firstStep),
+                  values.begin() + (from - first));
+    }
+
+    return values;
+}
+
+std::vector<float> ChunkedESmry::get_at_rstep(const std::string& name) const
+{
+    const auto& full_vect = this->get(name);
+
+    std::vector<float> rs_vect;
+    rs_vect.reserve(m_seqIndex.size());
+
+    std::ranges::transform(m_seqIndex, std::back_inserter(rs_vect),
+                           [&full_vect](const auto& r)
+                           { return full_vect[r]; });
+
+    return rs_vect;
+}
+
+const std::string& ChunkedESmry::get_unit(const std::string& name) const
+{
+    auto it = m_kwunits.find(name);
+    if (it == m_kwunits.end()) {
+        throw std::invalid_argument("summary key '" + name + "' not found");
+    }
+
+    return it->second;
+}
+
+void ChunkedESmry::loadData() const
+{
+    this->loadData(m_keyword);
+}
+
+void ChunkedESmry::loadData(const std::vector<std::string>& vectList) const
+{
+    std::vector<std::size_t> loadIndex;
+    for (const auto& name : vectList) {
+        const auto ind = this->keyIndex(name);
+        if (! m_vectorLoaded[ind]) {
+            loadIndex.push_back(ind);
+        }
+    }
+
+    std::sort(loadIndex.begin(), loadIndex.end());
+    loadIndex.erase(std::unique(loadIndex.begin(), loadIndex.end()), loadIndex.end());
+
+    if (loadIndex.empty()) {
+        return;
+    }
+
+    for (const auto& ind : loadIndex) {
+        m_vectorData[ind].resize(m_nTstep);
+    }
+
+    // Chunk by chunk, vector by vector, to read the file front to back.
+    auto fileH = this->openFile();
+    for (const auto& chunk : m_chunks) {
+        for (const auto& ind : loadIndex) {
+            this->readColumn(fileH, chunk, ind, m_vectorData[ind].data() + chunk.firstStep);
+        }
+    }
+
+    for (const auto& ind : loadIndex) {
+        m_vectorLoaded[ind] = true;
+    }
+}
+
+std::vector<time_point> ChunkedESmry::dates() const
+{
+    double time_unit = 24 * 3600;
+    std::vector<time_point> d;
+
+    const auto& time = this->get("TIME");
+    std::ranges::transform(time, std::back_inserter(d),
+                           [this, time_unit](const auto& t)
+                           {
+                               using Seconds = std::chrono::duration<double, std::chrono::seconds::period>;
+                               return this->m_startdat +
+                                      std::chrono::duration_cast<time_point::duration>(Seconds{t * time_unit});
+                           });
+
+    return d;
+}
+
+std::vector<std::string> ChunkedESmry::keywordList(const std::string& pattern) const
+{
+    std::vector<std::string> list;
+    std::ranges::copy_if(m_keyword, std::back_inserter(list),
+                         [&pattern](const auto& key)
+                         { return shmatch(pattern, key); });
+
+    return list;
+}
+
+bool ChunkedESmry::hasKey(const std::string& key) const
+{
+    return m_keyword_index.find(key) != m_keyword_index.end();
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,135 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_CHUNKEDESMRY_HPP
+#define OPM_IO_CHUNKEDESMRY_HPP
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <istream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+/// Reader for chunked, column oriented summary files (.CSMRY).
+///
+/// Only the file header and the chunk index are read on construction.
+/// Summary vectors, or time ranges of summary vectors, are read on demand
+/// and only the chunks covering the requested time steps are accessed.
+class ChunkedESmry
+{
+public:
+    explicit ChunkedESmry(const std::string& filename);
+
+    bool hasKey(const std::string& key) const;
+
+    std::size_t numberOfTimeSteps() const { return m_nTstep; }
+    std::size_t numberOfVectors() const { return m_keyword.size(); }
+    std::size_t chunkSize() const { return m_chunkSize; }
+
+    const std::vector<std::string>& keywordList() const { return m_keyword; }
+    std::vector<std::string> keywordList(const std::string& pattern) const;
+
+    const std::string& get_unit(const std::string& name) const;
+
+    /// All values of named summary vector.  Loaded on first request.
+    const std::vector<float>& get(const std::string& name) const;
+
+    /// Values of named summary vector in time step range [first, last).
+    /// Reads only the chunks covering the range unless the vector is
+    /// already loaded.
+    std::vector<float> get(const std::string& name,
+                           std::size_t first,
+                           std::size_t last) const;
+
+    std::vector<float> get_at_rstep(const std::string& name) const;
+
+    void loadData() const;
+    void loadData(const std::vector<std::string>& vectList) const;
+
+    std::vector<time_point> dates() const;
+
+    time_point startdate() const { return m_startdat; }
+    const std::vector<int>& start_v() const { return m_start_vect; }
+
+    const std::string& restartRoot() const { return m_restart_root; }
+    int restartStep() const { return m_restart_step; }
+
+    /// Time step indices at end of each report step.
+    const std::vector<int>& reportStepIndices() const { return m_seqIndex; }
+
+    /// Pick up time steps written since the file was opened.  Discards
+    /// loaded summary vectors if the number of time steps has changed.
+    ///
+    /// \return Whether or not the number of time steps changed.
+    bool refresh();
+
+private:
+    struct Chunk
+    {
+        std::size_t firstStep{0};
+        std::size_t nSteps{0};
+        std::uint64_t colTableOffset{0};
+        std::uint64_t dataOffset{0};
+    };
+
+    std::filesystem::path m_inputFileName;
+
+    std::size_t m_chunkSize{0};
+    std::size_t m_nTstep{0};
+    std::uint64_t m_headerEnd{0};
+
+    std::vector<std::string> m_keyword;
+    std::unordered_map<std::string, std::size_t> m_keyword_index;
+    std::unordered_map<std::string, std::string> m_kwunits;
+
+    std::vector<Chunk> m_chunks;
+    std::vector<int> m_rstep;
+    std::vector<int> m_tstep;
+    std::vector<int> m_seqIndex;
+
+    mutable std::vector<std::vector<float>> m_vectorData;
+    mutable std::vector<bool> m_vectorLoaded;
+
+    time_point m_startdat;
+    std::vector<int> m_start_vect;
+
+    std::string m_restart_root;
+    int m_restart_step{0};
+
+    std::ifstream openFile() const;
+    void readIndex(std::ifstream& fileH);
+
+    std::size_t keyIndex(const std::string& name) const;
+
+    void readColumn(std::istream& fileH,
+                    const Chunk& chunk,
+                    std::size_t vectorIndex,
+                    float* values) const;
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_CHUNKEDESMRY_HPP
@@ -0,0 +1,230 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/ChunkedSmryFormat.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+namespace {
+
+    // Run-length encoding.  Control byte c < 128 introduces c + 1 literal
+    // bytes, while c >= 128 repeats the following byte c - 125 times.
+    constexpr std::size_t maxLiteral = 128;
+    constexpr std::size_t minRun = 3;
+    constexpr std::size_t maxRun = 130;
+
+    void appendLiteral(const unsigned char* begin, std::size_t count, std::vector<char>& out)
+    {
+        while (count > 0) {
+            const auto n = std::min(count, maxLiteral);
+
+            out.push_back(static_cast<char>(n - 1));
+            out.insert(out.end(), begin, begin + n);
+
+            begin += n;
+            count -= n;
+        }
+    }
+
+    void encodeRle(const unsigned char* in, const std::size_t n, std::vector<char>& out)
+    {
+        std::size_t literalStart = 0;
+        std::size_t i = 0;
+
+        while (i < n) {
+            auto j = i + 1;
+            while ((j < n) && (in[j] == in[i]) && (j - i < maxRun)) {
+                ++j;
+            }
+
+            if (j - i >= minRun) {
+                appendLiteral(in + literalStart, i - literalStart, out);
+
+                out.push_back(static_cast<char>(j - i + 125));
+                out.push_back(static_cast<char>(in[i]));
+
+                literalStart = j;
+            }
+
+            i = j;
+        }
+
+        appendLiteral(in + literalStart, n - literalStart, out);
+    }
+
+    void decodeRle(const unsigned char* in, const std::size_t size,
+                   unsigned char* out, const std::size_t n)
+    {
+        std::size_t pos = 0;
+        std::size_t written = 0;
+
+        while (pos < size) {
+            const auto c = static_cast<std::size_t>(in[pos++]);
+
+            if (c < maxLiteral) {
+                const auto count = c + 1;
+                if ((pos + count > size) || (written + count > n)) {
+                    throw std::runtime_error { "Corrupt literal run in summary column" };
+                }
+
+                std::memcpy(out + written, in + pos, count);
+                pos += count;
+                written += count;
+            }
+            else {
+                const auto count = c - 125;
+                if ((pos >= size) || (written + count > n)) {
+                    throw std::runtime_error { "Corrupt repeat run in summary column" };
+                }
+
+                std::memset(out + written, in[pos++], count);
+                written += count;
+            }
+        }
+
+        if (written != n) {
+            throw std::runtime_error {
+                fmt::format("Summary column holds {} bytes, expected {}", written, n)
+            };
+        }
+    }
+
+    std::vector<char> encodeRaw(const float* values, const std::size_t n)
+    {
+        std::vector<char> out(1 + n*sizeof(float));
+        out[0] = static_cast<char>(Opm::EclIO::ChunkedSmry::Codec::None);
+
+        std::memcpy(out.data() + 1, values, n*sizeof(float));
+
+        if constexpr (std::endian::native == std::endian::big) {
+            Opm::EclIO::flipEndianArray(out.data() + 1, out.data() + 1, n, sizeof(float));
+        }
+
+        return out;
+    }
+
+    std::vector<char> encodeXorDeltaRle(const float* values, const std::size_t n)
+    {
+        // Byte planes of XOR'ed bit patterns.  Plane p holds byte p
+        // (least significant first) of every value.
+        std::vector<unsigned char> planes(n * sizeof(float));
+
+        auto prev = std::uint32_t{0};
+        for (std::size_t i = 0; i < n; ++i) {
+            const auto bits = std::bit_cast<std::uint32_t>(values[i]);
+            const auto delta = bits ^ prev;
+            prev = bits;
+
+            for (std::size_t p = 0; p < sizeof(float); ++p) {
+                planes[p*n + i] = static_cast<unsigned char>(delta >> (8*p));
+            }
+        }
+
+        std::vector<char> out;
+        out.reserve(1 + planes.size() / 4);
+        out.push_back(static_cast<char>(Opm::EclIO::ChunkedSmry::Codec::XorDeltaRle));
+
+        encodeRle(planes.data(), planes.size(), out);
+
+        return out;
+    }
+
+    void decodeXorDeltaRle(const char* data, const std::size_t size,
+                           const std::size_t n, float* values)
+    {
+        std::vector<unsigned char> planes(n * sizeof(float));
+
+        decodeRle(reinterpret_cast<const unsigned char*>(data), size,
+                  planes.data(), planes.size());
+
+        auto prev = std::uint32_t{0};
+        for (std::size_t i = 0; i < n; ++i) {
+            auto delta = std::uint32_t{0};
+            for (std::size_t p = 0; p < sizeof(float); ++p) {
+                delta |= static_cast<std::uint32_t>(planes[p*n + i]) << (8*p);
+            }
+
+            prev ^= delta;
+            values[i] = std::bit_cast<float>(prev);
+        }
+    }
+
+} // Anonymous namespace
+
+std::vector<char>
+Opm::EclIO::ChunkedSmry::encodeColumn(const float* values,
+                                      const std::size_t n,
+                                      const Codec codec)
+{
+    if (codec == Codec::XorDeltaRle) {
+        auto encoded = encodeXorDeltaRle(values, n);
+
+        if (encoded.size() < 1 + n*sizeof(float)) {
+            return encoded;
+        }
+    }
+
+    return encodeRaw(values, n);
+}
+
+void Opm::EclIO::ChunkedSmry::decodeColumn(const char* data,
+                                           const std::size_t size,
+                                           const std::size_t n,
+                                           float* values)
+{
+    if (size < 1) {
+        throw std::runtime_error { "Empty summary column" };
+    }
+
+    switch (static_cast<Codec>(data[0])) {
+    case Codec::None:
+        if (size != 1 + n*sizeof(float)) {
+            throw std::runtime_error {
+                fmt::format("Summary column holds {} bytes, expected {}",
+                            size - 1, n*sizeof(float))
+            };
+        }
+
+        std::memcpy(values, data + 1, n*sizeof(float));
+
+        if constexpr (std::endian::native == std::endian::big) {
+            flipEndianArray(values, values, n, sizeof(float));
+        }
+        break;
+
+    case Codec::XorDeltaRle:
+        decodeXorDeltaRle(data + 1, size - 1, n, values);
+        break;
+
+    default:
+        throw std::runtime_error {
+            fmt::format("Unknown summary column encoding {}",
+                        static_cast<int>(data[0]))
+        };
+    }
+}
@@ -0,0 +1,199 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_CHUNKEDSMRYFORMAT_HPP
+#define OPM_IO_CHUNKEDSMRYFORMAT_HPP
+
+#include <opm/io/eclipse/EclUtil.hpp>
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <istream>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/// \file Layout of chunked, column oriented summary files (.CSMRY).
+///
+/// All integers are stored little-endian.  Strings are stored as a 32-bit
+/// length followed by the characters.
+///
+///   Header
+///     char[8]    "OPMCSMRY"
+///     uint32     format version
+///     uint32     number of time steps per chunk (C)
+///     uint32     number of summary vectors (N)
+///     int32[7]   start date (day, month, year, hour, minute, second,
+///                millisecond) as in the ESMRY START array
+///     string     restart root name (empty if not a restarted run)
+///     int32      restart report step
+///     string[N]  summary keys
+///     string[N]  summary units
+///
+///   Chunk, repeated.  All chunks except the last hold C time steps.
+///     uint32       number of time steps in chunk (n)
+///     int32[n]     report step number, zero if not at end of report step
+///     int32[n]     time step number
+///     uint64[N+1]  column offsets relative to start of column data
+///     column data, one encoded block per summary vector
+///
+///   Footer
+///     uint64[M]  file offsets of the M chunks
+///     uint64     number of chunks (M)
+///     uint64     total number of time steps
+///     uint64     file offset of footer
+///     char[8]    "CSMRYEND"
+///
+/// Each encoded column starts with one byte identifying its encoding.
+/// Values of a summary vector in a time range are therefore reachable
+/// through the footer and a single chunk header, independently of the
+/// number of chunks or summary vectors.
+
+namespace Opm { namespace EclIO { namespace ChunkedSmry {
+
+    inline constexpr char fileMagic[] = "OPMCSMRY";
+    inline constexpr char footerMagic[] = "CSMRYEND";
+    inline constexpr std::size_t magicSize = 8;
+
+    inline constexpr std::uint32_t formatVersion = 1;
+
+    /// Size in bytes of fixed size footer trailer.
+    inline constexpr std::size_t trailerSize = 3*sizeof(std::uint64_t) + magicSize;
+
+    /// Column encodings.
+    enum class Codec : unsigned char {
+        /// Little-endian IEEE single precision values.
+        None = 0,
+
+        /// Bit patterns of successive values are XOR'ed, split into byte
+        /// planes and run-length encoded.  Effective for slowly varying
+        /// and piecewise constant vectors.
+        XorDeltaRle = 1,
+    };
+
+    /// Options for creating chunked summary files.
+    struct WriteOptions
+    {
+        /// Upper limit, in bytes, of the summary values buffered for the
+        /// chunk being written.  Determines the number of time steps per
+        /// chunk, which is therefore inversely proportional to the number
+        /// of summary vectors.  At least one time step is buffered.
+        std::size_t chunkBytes{4 * 1024 * 1024};
+
+        /// Maximum number of time steps per chunk.  Zero for no limit
+        /// other than that implied by chunkBytes.
+        std::size_t chunkSize{0};
+
+        /// Preferred column encoding.  Columns are stored unencoded if
+        /// the encoding does not reduce their size.
+        Codec codec{Codec::XorDeltaRle};
+
+        /// Restart root name and report step.  Empty unless the run is
+        /// restarted from another run.
+        std::string restartRoot{};
+        int restartStep{0};
+    };
+
+    /// Encode column of summary vector values.
+    ///
+    /// \param[in] values Summary vector values.
+    /// \param[in] n Number of values.
+    /// \param[in] codec Preferred encoding.
+    ///
+    /// \return Encoded column, including leading encoding byte.
+    std::vector<char> encodeColumn(const float* values, std::size_t n, Codec codec);
+
+    /// Decode column of summary vector values.
+    ///
+    /// Throws std::runtime_error if the column is corrupt.
+    ///
+    /// \param[in] data Encoded column, including leading encoding byte.
+    /// \param[in] size Number of bytes in encoded column.
+    /// \param[in] n Number of values in column.
+    /// \param[out] values Decoded values.  Must hold \p n elements.
+    void decodeColumn(const char* data, std::size_t size, std::size_t n, float* values);
+
+    /// Write sequence of 4 or 8 byte values in little-endian byte order.
+    template <typename T>
+    void writeValues(std::ostream& os, const T* values, const std::size_t n)
+    {
+        static_assert((sizeof(T) == 4) || (sizeof(T) == 8));
+
+        if constexpr (std::endian::native == std::endian::little) {
+            os.write(reinterpret_cast<const char*>(values), n * sizeof(T));
+        }
+        else {
+            std::vector<T> le(values, values + n);
+            flipEndianArray(le.data(), le.data(), n, sizeof(T));
+            os.write(reinterpret_cast<const char*>(le.data()), n * sizeof(T));
+        }
+    }
+
+    template <typename T>
+    void writeValue(std::ostream& os, const T value)
+    {
+        writeValues(os, &value, 1);
+    }
+
+    inline void writeString(std::ostream& os, const std::string& str)
+    {
+        writeValue(os, static_cast<std::uint32_t>(str.size()));
+        os.write(str.data(), str.size());
+    }
+
+    /// Read sequence of 4 or 8 byte values stored in little-endian byte
+    /// order.  Throws std::runtime_error on premature end of input.
+    template <typename T>
+    void readValues(std::istream& is, T* values, const std::size_t n)
+    {
+        static_assert((sizeof(T) == 4) || (sizeof(T) == 8));
+
+        if (! is.read(reinterpret_cast<char*>(values), n * sizeof(T))) {
+            throw std::runtime_error { "Premature end of chunked summary file" };
+        }
+
+        if constexpr (std::endian::native == std::endian::big) {
+            flipEndianArray(values, values, n, sizeof(T));
+        }
+    }
+
+    template <typename T>
+    T readValue(std::istream& is)
+    {
+        T value{};
+        readValues(is, &value, 1);
+        return value;
+    }
+
+    inline std::string readString(std::istream& is)
+    {
+        std::string str(readValue<std::uint32_t>(is), ' ');
+
+        if (! is.read(str.data(), str.size())) {
+            throw std::runtime_error { "Premature end of chunked summary file" };
+        }
+
+        return str;
+    }
+
+}}} // namespace Opm::EclIO::ChunkedSmry
+
+#endif // OPM_IO_CHUNKEDSMRYFORMAT_HPP
@@ -0,0 +1,303 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/ChunkedSmryOutput.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+#include <opm/io/eclipse/ExtESmry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+    template <typename Smry>
+    void convertSummary(Smry& smry,
+                        const std::string& filename,
+                        const std::vector<int>& start,
+                        const Opm::EclIO::ChunkedSmry::WriteOptions& options)
+    {
+        smry.loadData();
+
+        const auto& keys = smry.keywordList();
+
+        std::vector<std::string> units;
+        units.reserve(keys.size());
+
+        std::vector<const std::vector<float>*> columns;
+        columns.reserve(keys.size());
+
+        for (const auto& key : keys) {
+            units.push_back(smry.get_unit(key));
+            columns.push_back(&smry.get(key));
+        }
+
+        Opm::EclIO::ChunkedSmryOutput output(filename, keys, units, start, options);
+
+        // Time steps are numbered by the report step they belong to.
+        // Only the last time step of each report step retains this number
+        // in the output file.
+        const auto& rstepIndex = smry.reportStepIndices();
+        auto nextRstep = rstepIndex.begin();
+        int reportStep = 1;
+
+        const auto nStep = smry.numberOfTimeSteps();
+        std::vector<float> ts_data(keys.size());
+
+        for (std::size_t step = 0; step < nStep; ++step) {
+            for (std::size_t v = 0; v < columns.size(); ++v) {
+                ts_data[v] = (*columns[v])[step];
+            }
+
+            output.write(ts_data, reportStep, step + 1 == nStep);
+
+            if ((nextRstep != rstepIndex.end()) &&
+                (static_cast<std::size_t>(*nextRstep) == step))
+            {
+                ++nextRstep;
+                ++reportStep;
+            }
+        }
+    }
+
+    std::size_t stepsPerChunk(const Opm::EclIO::ChunkedSmry::WriteOptions& options,
+                              const std::size_t nVect)
+    {
+        auto steps = options.chunkBytes / (sizeof(float) * std::max(nVect, std::size_t{1}));
+
+        if (options.chunkSize > 0) {
+            steps = std::min(steps, options.chunkSize);
+        }
+
+        return std::clamp(steps, std::size_t{1},
+                          static_cast<std::size_t>(std::numeric_limits<std::uint32_t>::max()));
+    }
+
+} // Anonymous namespace
+
+namespace Opm { namespace EclIO {
+
+ChunkedSmryOutput::ChunkedSmryOutput(const std::string& filename,
+                                     const std::vector<std::string>& keys,
+                                     const std::vector<std::string>& units,
+                                     const std::vector<int>& start,
+                                     const ChunkedSmry::WriteOptions& options)
+    : m_last_write     { std::chrono::system_clock::now() }
+    , m_outputFileName { filename }
+    , m_codec          { options.codec }
+    , m_chunkSize      { stepsPerChunk(options, keys.size()) }
+    , m_nVect          { keys.size() }
+{
+    if (units.size() != keys.size()) {
+        OPM_THROW(std::invalid_argument,
+                  "Number of summary units not same as number of summary keys");
+    }
+
+    if (start.size() != 7) {
+        OPM_THROW(std::invalid_argument,
+                  "Start date vector should hold 7 elements, got " +
+                  std::to_string(start.size()));
+    }
+
+    m_fileH.open(m_outputFileName, std::ios::in | std::ios::out |
+                 std::ios::trunc | std::ios::binary);
+
+    if (! m_fileH) {
+        OPM_THROW(std::runtime_error,
+                  "Unable to open chunked summary file " + m_outputFileName);
+    }
+
+    m_fileH.write(ChunkedSmry::fileMagic, ChunkedSmry::magicSize);
+
+    ChunkedSmry::writeValue(m_fileH, ChunkedSmry::formatVersion);
+    ChunkedSmry::writeValue(m_fileH, static_cast<std::uint32_t>(m_chunkSize));
+    ChunkedSmry::writeValue(m_fileH, static_cast<std::uint32_t>(m_nVect));
+    ChunkedSmry::writeValues(m_fileH, start.data(), start.size());
+
+    ChunkedSmry::writeString(m_fileH, options.restartRoot);
+    ChunkedSmry::writeValue(m_fileH, static_cast<std::int32_t>(options.restartStep));
+
+    for (const auto& key : keys) {
+        ChunkedSmry::writeString(m_fileH, key);
+    }
+
+    for (const auto& unit : units) {
+        ChunkedSmry::writeString(m_fileH, unit);
+    }
+
+    m_dataEnd = static_cast<std::uint64_t>(m_fileH.tellp());
+
+    m_rstep.reserve(m_chunkSize);
+    m_tstep.reserve(m_chunkSize);
+    m_chunkData.resize(m_chunkSize * m_nVect);
+
+    this->writeFooter(m_chunkOffset);
+}
+
+ChunkedSmryOutput::~ChunkedSmryOutput()
+{
+    try {
+        this->flush();
+    }
+    catch (...) {
+        // Nothing we can do about it in a destructor.
+    }
+}
+
+void ChunkedSmryOutput::write(const std::vector<float>& ts_data,
+                              const int report_step,
+                              const bool is_final_summary)
+{
+    if (ts_data.size() != m_nVect) {
+        throw std::invalid_argument("size of ts_data vector not same as number of smry vectors");
+    }
+
+    if (! m_rstep.empty() && (m_rstep.back() == report_step)) {
+        m_rstep.back() = 0;
+    }
+
+    // A full chunk is kept in memory until the next time step arrives,
+    // since that time step may reset the chunk's final report step.
+    if (m_rstep.size() == m_chunkSize) {
+        m_fileH.seekp(m_dataEnd);
+        this->writeChunk();
+
+        m_chunkOffset.push_back(m_dataEnd);
+        m_dataEnd = static_cast<std::uint64_t>(m_fileH.tellp());
+
+        this->writeFooter(m_chunkOffset);
+
+        m_rstep.clear();
+        m_tstep.clear();
+    }
+
+    const auto pos = m_rstep.size();
+
+    m_rstep.push_back(report_step);
+    m_tstep.push_back(static_cast<int>(m_nTimeSteps));
+
+    for (std::size_t v = 0; v < m_nVect; ++v) {
+        m_chunkData[v*m_chunkSize + pos] = ts_data[v];
+    }
+
+    ++m_nTimeSteps;
+
+    const std::chrono::duration<double> elapsed_seconds =
+        std::chrono::system_clock::now() - m_last_write;
+
+    if (is_final_summary || (elapsed_seconds.count() > m_min_write_interval)) {
+        this->flush();
+    }
+}
+
+void ChunkedSmryOutput::flush()
+{
+    if (m_rstep.empty()) {
+        m_fileH.flush();
+        return;
+    }
+
+    // Pending time steps are written after the last complete chunk and
+    // overwritten once more time steps arrive.
+    m_fileH.seekp(m_dataEnd);
+    this->writeChunk();
+
+    auto chunkOffset = m_chunkOffset;
+    chunkOffset.push_back(m_dataEnd);
+
+    this->writeFooter(chunkOffset);
+
+    m_last_write = std::chrono::system_clock::now();
+}
+
+void ChunkedSmryOutput::writeChunk()
+{
+    const auto n = m_rstep.size();
+
+    ChunkedSmry::writeValue(m_fileH, static_cast<std::uint32_t>(n));
+    ChunkedSmry::writeValues(m_fileH, m_rstep.data(), n);
+    ChunkedSmry::writeValues(m_fileH, m_tstep.data(), n);
+
+    std::vector<std::vector<char>> columns(m_nVect);
+    std::vector<std::uint64_t> colOffset(m_nVect + 1, 0);
+
+    for (std::size_t v = 0; v < m_nVect; ++v) {
+        columns[v] = ChunkedSmry::encodeColumn(&m_chunkData[v*m_chunkSize], n, m_codec);
+        colOffset[v + 1] = colOffset[v] + columns[v].size();
+    }
+
+    ChunkedSmry::writeValues(m_fileH, colOffset.data(), colOffset.size());
+
+    for (const auto& column : columns) {
+        m_fileH.write(column.data(), column.size());
+    }
+}
+
+void ChunkedSmryOutput::writeFooter(const std::vector<std::uint64_t>& chunkOffset)
+{
+    const auto footerOffset = static_cast<std::uint64_t>(m_fileH.tellp());
+
+    ChunkedSmry::writeValues(m_fileH, chunkOffset.data(), chunkOffset.size());
+    ChunkedSmry::writeValue(m_fileH, static_cast<std::uint64_t>(chunkOffset.size()));
+    ChunkedSmry::writeValue(m_fileH, static_cast<std::uint64_t>(m_nTimeSteps));
+    ChunkedSmry::writeValue(m_fileH, footerOffset);
+
+    m_fileH.write(ChunkedSmry::footerMagic, ChunkedSmry::magicSize);
+    m_fileH.flush();
+
+    if (! m_fileH) {
+        OPM_THROW(std::runtime_error,
+                  "Failed writing chunked summary file " + m_outputFileName);
+    }
+
+    // Discard remains of previously written, longer, incomplete chunks.
+    std::filesystem::resize_file(m_outputFileName,
+                                 static_cast<std::uintmax_t>(m_fileH.tellp()));
+}
+
+void makeChunkedSmryFile(ESmry& smry,
+                         const std::string& filename,
+                         const ChunkedSmry::WriteOptions& options)
+{
+    // ESmry stores seconds and microseconds in a single element.
+    auto start = smry.start_v();
+    start.resize(6);
+
+    const auto microsec = start[5];
+    start[5] = microsec / 1000000;
+    start.push_back((microsec % 1000000) / 1000);
+
+    convertSummary(smry, filename, start, options);
+}
+
+void makeChunkedSmryFile(ExtESmry& smry,
+                         const std::string& filename,
+                         const ChunkedSmry::WriteOptions& options)
+{
+    convertSummary(smry, filename, smry.start_v(), options);
+}
+
+}} // namespace Opm::EclIO
@@ -0,0 +1,135 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_CHUNKEDSMRYOUTPUT_HPP
+#define OPM_IO_CHUNKEDSMRYOUTPUT_HPP
+
+#include <opm/io/eclipse/ChunkedSmryFormat.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace Opm { namespace EclIO {
+
+class ESmry;
+class ExtESmry;
+
+/// Writer for chunked, column oriented summary files (.CSMRY).
+///
+/// Time steps are appended one at a time and buffered until a chunk is
+/// complete, at which point the chunk is compressed and written column by
+/// column.  The chunk size is chosen such that the buffered values fit in
+/// the byte budget of the write options.  The file footer is rewritten
+/// after each chunk, so the file is always readable while the simulation
+/// runs.  Incomplete chunks are written on request and replaced once more
+/// time steps arrive.
+class ChunkedSmryOutput
+{
+public:
+    /// Constructor.  Creates the output file, replacing any existing file.
+    ///
+    /// \param[in] filename Name of output file.
+    /// \param[in] keys Summary vector names.
+    /// \param[in] units Summary vector units.  Same size as \p keys.
+    /// \param[in] start Simulation start in ESMRY format (day, month,
+    ///    year, hour, minute, second, millisecond).
+    /// \param[in] options File layout options.
+    ChunkedSmryOutput(const std::string& filename,
+                      const std::vector<std::string>& keys,
+                      const std::vector<std::string>& units,
+                      const std::vector<int>& start,
+                      const ChunkedSmry::WriteOptions& options);
+
+    /// Destructor.  Writes any pending time steps.
+    ~ChunkedSmryOutput();
+
+    ChunkedSmryOutput(const ChunkedSmryOutput&) = delete;
+    ChunkedSmryOutput& operator=(const ChunkedSmryOutput&) = delete;
+
+    /// Append values of all summary vectors at a single time step.
+    ///
+    /// Report step numbering follows that of ExtSmryOutput.  If two
+    /// consecutive time steps have the same report step, only the latter
+    /// is treated as the end of that report step.
+    ///
+    /// \param[in] ts_data Summary vector values.  One per key.
+    /// \param[in] report_step Report step number of time step.
+    /// \param[in] is_final_summary Whether this is the final time step.
+    ///    Pending time steps are written to disk if so.
+    void write(const std::vector<float>& ts_data,
+               int report_step,
+               bool is_final_summary);
+
+    /// Write pending time steps and footer to disk.
+    void flush();
+
+    std::size_t numberOfTimeSteps() const { return m_nTimeSteps; }
+
+    /// Number of time steps per chunk, derived from the write options.
+    std::size_t chunkSize() const { return m_chunkSize; }
+
+private:
+    static constexpr int m_min_write_interval = 15;  // at least 15 seconds between partial chunk writes
+    std::chrono::time_point<std::chrono::system_clock> m_last_write;
+
+    std::string m_outputFileName;
+    std::fstream m_fileH;
+
+    ChunkedSmry::Codec m_codec;
+    std::size_t m_chunkSize;
+    std::size_t m_nVect;
+    std::size_t m_nTimeSteps{0};
+
+    // File offset of first byte after last complete chunk.
+    std::uint64_t m_dataEnd{0};
+    std::vector<std::uint64_t> m_chunkOffset;
+
+    // Time steps of current, incomplete chunk.  Values are stored column
+    // major with m_chunkSize entries per column.
+    std::vector<int> m_rstep;
+    std::vector<int> m_tstep;
+    std::vector<float> m_chunkData;
+
+    void writeChunk();
+    void writeFooter(const std::vector<std::uint64_t>& chunkOffset);
+};
+
+/// Create chunked summary file from existing summary results.
+///
+/// All summary vectors are loaded into memory during the conversion.
+///
+/// \param[in,out] smry Summary results.
+/// \param[in] filename Name of output file.
+/// \param[in] options File layout options.
+void makeChunkedSmryFile(ESmry& smry,
+                         const std::string& filename,
+                         const ChunkedSmry::WriteOptions& options = {});
+
+/// Create chunked summary file from existing ESMRY file.
+void makeChunkedSmryFile(ExtESmry& smry,
+                         const std::string& filename,
+                         const ChunkedSmry::WriteOptions& options = {});
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_CHUNKEDSMRYOUTPUT_HPP
@@ -41,8 +41,8 @@ namespace Opm::EclIO {
 
 using NNCentry = std::tuple<int, int, int, int, int, int, float>;
 
-EGrid::EGrid(const std::string& filename, const std::string& grid_name)
-    : EclFile(filename), inputFileName { filename }, m_grid_name {grid_name}
+EGrid::EGrid(const std::string& filename, const std::string& grid_name, MemoryMapped mmap)
+    : EclFile(filename, mmap), inputFileName { filename }, m_grid_name {grid_name}
 {
     initFileName = inputFileName.parent_path() / inputFileName.stem();
 
@@ -247,8 +247,12 @@ std::vector<NNCentry> EGrid::get_nnc_ijk()
 
 void EGrid::load_grid_data()
 {
-    coord_array = getImpl(coord_array_index, REAL, real_array, "float");
-    zcorn_array = getImpl(zcorn_array_index, REAL, real_array, "float");
+    // Arrays already loaded are kept, so references to them stay valid.
+    if (coord_array.empty())
+        coord_array = getImpl(coord_array_index, REAL, real_array, "float");
+
+    if (zcorn_array.empty())
+        zcorn_array = getImpl(zcorn_array_index, REAL, real_array, "float");
 }
 
 void EGrid::load_nnc_data()
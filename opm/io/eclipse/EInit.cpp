@@ -24,7 +24,7 @@
 
 namespace Opm::EclIO {
 
-EInit::EInit(const std::string &filename) : EclFile(filename)
+EInit::EInit(const std::string &filename, MemoryMapped mmap) : EclFile(filename, mmap)
 {
     std::string lgrname;
 
@@ -30,7 +30,7 @@
 
 namespace Opm::EclIO {
 
-ERft::ERft(const std::string &filename) : EclFile(filename)
+ERft::ERft(const std::string &filename, MemoryMapped mmap) : EclFile(filename, mmap)
 {
     loadData();
     std::vector<int> first;
@@ -53,8 +53,8 @@ namespace {
 
 namespace Opm::EclIO {
 
-ERst::ERst(const std::string& filename)
-    : EclFile(filename)
+ERst::ERst(const std::string& filename, MemoryMapped mmap)
+    : EclFile(filename, mmap)
 {
     if (this->hasKey("SEQNUM")) {
         this->initUnified();
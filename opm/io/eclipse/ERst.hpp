@@ -37,7 +37,7 @@ namespace Opm { namespace EclIO {
 class ERst : public EclFile
 {
 public:
-    explicit ERst(const std::string& filename);
+    explicit ERst(const std::string& filename, MemoryMapped mmap = MemoryMapped{false});
 
     bool hasReportStepNumber(int number) const;
     bool hasArray(const std::string& name, int number) const;
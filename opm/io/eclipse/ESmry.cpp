@@ -721,31 +721,38 @@ std::string ESmry::read_string_from_disk(std::fstream& fileH, std::uint64_t size
 }
 
 
-void ESmry::loadData(const std::vector<std::string>& vectList) const
+std::vector<int> ESmry::keywordIndices(const std::vector<std::string>& vectList) const
 {
-    auto start = std::chrono::system_clock::now();
-    std::size_t nvect = vectList.size();
-
     std::vector<int> keywIndVect;
-    keywIndVect.reserve(nvect);
-
-    for (auto key : vectList) {
-        if (!hasKey(key))
-            OPM_THROW(std::invalid_argument, "error loading key " + key );
+    keywIndVect.reserve(vectList.size());
 
+    for (const auto& key : vectList) {
         auto it = keyword_index.find(key);
 
-        if (!vectorLoaded[it->second])
-            keywIndVect.push_back(it->second);
+        if (it == keyword_index.end())
+            OPM_THROW(std::invalid_argument, "error loading key " + key );
+
+        keywIndVect.push_back(it->second);
     }
 
-    for (auto ind : keywIndVect)
-        vectorData[ind].reserve(nTstep);
+    return keywIndVect;
+}
+
+std::vector<std::vector<float>>
+ESmry::readVectors(const std::vector<int>& keywIndVect, std::size_t first, std::size_t last) const
+{
+    std::vector<std::vector<float>> values(keywIndVect.size());
+
+    if (keywIndVect.empty() || (first >= last))
+        return values;
+
+    for (auto& vect : values)
+        vect.reserve(last - first);
 
     std::fstream fileH;
 
-    auto specInd = std::get<0>(timeStepList[0]);
-    auto dataFileIndex = std::get<1>(timeStepList[0]);
+    auto specInd = std::get<0>(timeStepList[first]);
+    auto dataFileIndex = std::get<1>(timeStepList[first]);
     std::uint64_t blockSize_f;
 
     {
@@ -759,7 +766,9 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
     else
         fileH.open(dataFileList[dataFileIndex], std::ios::in |  std::ios::binary);
 
-    for (const auto& ministep : timeStepList) {
+    for (auto step = first; step < last; ++step) {
+        const auto& ministep = timeStepList[step];
+
         if (dataFileIndex != std::get<1>(ministep)) {
             fileH.close();
             specInd = std::get<0>(ministep);
@@ -773,12 +782,12 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
         const auto stepFilePos = std::get<2>(ministep);;
 
-        for (auto ind : keywIndVect) {
-            auto it = arrayPos[specInd].find(ind);
+        for (std::size_t n = 0; n < keywIndVect.size(); ++n) {
+            auto it = arrayPos[specInd].find(keywIndVect[n]);
             if (it == arrayPos[specInd].end()) {
                 // undefined vector in current summary file. Typically when loading
                 // base restart run and including base run data. Vectors can be added to restart runs
-                vectorData[ind].push_back(std::nanf(""));
+                values[n].push_back(std::nanf(""));
             }
             else {
                 int paramPos = it->second;
@@ -799,7 +808,7 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
                     const std::size_t size = columnWidthReal;
                     std::vector<char> buffer(size);
                     fileH.read (buffer.data(), size);
-                    vectorData[ind].push_back(std::strtof(buffer.data(), nullptr));
+                    values[n].push_back(std::strtof(buffer.data(), nullptr));
                 }
                 else {
                     const std::uint64_t nFullBlocks = static_cast<std::uint64_t>(paramPos/(MaxBlockSizeReal / sizeOfReal));
@@ -811,7 +820,7 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
                     float value;
                     fileH.read(reinterpret_cast<char*>(&value), sizeOfReal);
 
-                    vectorData[ind].push_back(Opm::EclIO::flipEndianFloat(value));
+                    values[n].push_back(Opm::EclIO::flipEndianFloat(value));
                 }
             }
         }
@@ -819,11 +828,108 @@ void ESmry::loadData(const std::vector<std::string>& vectList) const
 
     fileH.close();
 
-    for (const auto& ind : keywIndVect)
-        vectorLoaded[ind] = true;
+    return values;
+}
+
+void ESmry::loadData(const std::vector<std::string>& vectList) const
+{
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<int> keywIndVect;
+    keywIndVect.reserve(vectList.size());
+
+    for (const auto& ind : keywordIndices(vectList)) {
+        if (!vectorLoaded[ind] && (std::ranges::find(keywIndVect, ind) == keywIndVect.end()))
+            keywIndVect.push_back(ind);
+    }
+
+    auto values = readVectors(keywIndVect, 0, nTstep);
+
+    for (std::size_t n = 0; n < keywIndVect.size(); ++n) {
+        vectorData[keywIndVect[n]] = std::move(values[n]);
+        vectorLoaded[keywIndVect[n]] = true;
+        vectorLru.insert(keywIndVect[n]);
+    }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+}
+
+std::vector<std::vector<float>>
+ESmry::get(const std::vector<std::string>& vectList, std::size_t first, std::size_t last) const
+{
+    if ((first > last) || (last > nTstep)) {
+        OPM_THROW(std::out_of_range,
+                  fmt::format("Time step range [{}, {}) outside summary of {} time steps",
+                              first, last, nTstep));
+    }
+
+    auto start = std::chrono::system_clock::now();
+
+    const auto keywIndVect = keywordIndices(vectList);
+
+    // Vectors already in memory are copied, the remaining ones are read
+    // for the requested time steps only.
+    std::vector<int> readIndVect;
+    std::ranges::copy_if(keywIndVect, std::back_inserter(readIndVect),
+                         [this](const int ind) { return !vectorLoaded[ind]; });
+
+    auto readValues = readVectors(readIndVect, first, last);
+    auto next = readValues.begin();
+
+    std::vector<std::vector<float>> values;
+    values.reserve(keywIndVect.size());
+
+    for (const auto& ind : keywIndVect) {
+        if (vectorLoaded[ind])
+            values.emplace_back(vectorData[ind].begin() + first, vectorData[ind].begin() + last);
+        else
+            values.push_back(std::move(*next++));
+    }
 
     std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
     m_io_loading += elapsed_seconds.count();
+
+    return values;
+}
+
+void ESmry::stream(const std::vector<std::string>& vectList,
+                   std::size_t first, std::size_t last, std::size_t blockSize,
+                   const SmryBlockConsumer& consumer) const
+{
+    if ((first > last) || (last > nTstep)) {
+        OPM_THROW(std::out_of_range,
+                  fmt::format("Time step range [{}, {}) outside summary of {} time steps",
+                              first, last, nTstep));
+    }
+
+    streamTimeStepRange(first, last, blockSize,
+                        [this, &vectList](const std::size_t blockFirst, const std::size_t blockLast)
+                        { return this->get(vectList, blockFirst, blockLast); },
+                        consumer);
+}
+
+std::pair<std::size_t, std::size_t> ESmry::timeStepRange(time_point from, time_point to) const
+{
+    return EclIO::timeStepRange(this->get("TIME"), tp_startdat, from, to);
+}
+
+void ESmry::setCacheCapacity(std::size_t maxVectors)
+{
+    vectorLru = SmryVectorLru { maxVectors };
+
+    for (std::size_t ind = 0; ind < nVect; ++ind) {
+        if (vectorLoaded[ind])
+            vectorLru.insert(ind);
+    }
+
+    vectorLru.trim([this](const int ind) { this->releaseVector(ind); });
+}
+
+void ESmry::releaseVector(int ind) const
+{
+    vectorData[ind] = std::vector<float>{};
+    vectorLoaded[ind] = false;
 }
 
 std::vector<int> ESmry::makeKeywPosVector(int specInd) const
@@ -958,6 +1064,9 @@ void ESmry::loadData() const
     }
 
     std::fill_n(vectorLoaded.begin(), nVect, true);
+
+    for (std::size_t ind = 0; ind < nVect; ++ind)
+        vectorLru.insert(ind);
 }
 
 
@@ -1379,18 +1488,20 @@ const std::string& ESmry::get_unit(const SummaryNode& node) const {
 
 const std::vector<float>& ESmry::get(const std::string& name) const
 {
-    const auto it = std::ranges::find(keyword, name);
-    if (it == keyword.end()) {
+    const auto it = keyword_index.find(name);
+    if (it == keyword_index.end()) {
         OPM_THROW(std::invalid_argument, "keyword " + name + " not found ");
     }
 
-    int ind = std::distance(keyword.begin(), it);
+    int ind = it->second;
 
     if (!vectorLoaded[ind]){
         loadData({name});
         vectorLoaded[ind]=true;
     }
 
+    vectorLru.touch(ind, [this](const int evict) { this->releaseVector(evict); });
+
     return vectorData[ind];
 }
 
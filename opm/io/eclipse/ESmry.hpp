@@ -20,6 +20,7 @@
 #define OPM_IO_ESMRY_HPP
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/SmryQuery.hpp>
 #include <opm/io/eclipse/SummaryNode.hpp>
 
 #include <algorithm>
@@ -31,6 +32,7 @@
 #include <map>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -61,6 +63,30 @@ public:
     void loadData(const std::vector<std::string>& vectList) const;
     void loadData() const;
 
+    /// Values of summary vectors in time step range [first, last).
+    ///
+    /// Reads only the requested time steps of vectors not already
+    /// loaded, and does not add those vectors to the vector cache.
+    std::vector<std::vector<float>>
+    get(const std::vector<std::string>& vectList, std::size_t first, std::size_t last) const;
+
+    /// Pass values of summary vectors in time step range [first, last) to
+    /// consumer in blocks of at most blockSize time steps.  Memory use
+    /// is bounded by the block size rather than by the range.
+    void stream(const std::vector<std::string>& vectList,
+                std::size_t first, std::size_t last, std::size_t blockSize,
+                const SmryBlockConsumer& consumer) const;
+
+    /// Time step range [first, last) of time steps in time window [from, to].
+    std::pair<std::size_t, std::size_t> timeStepRange(time_point from, time_point to) const;
+
+    /// Limit number of summary vectors kept in memory by get().  Least
+    /// recently used vectors are released when the limit is exceeded,
+    /// invalidating references previously returned by get().  Vectors
+    /// loaded through loadData() are kept until the next call to get().
+    /// Zero, the default, means no limit.
+    void setCacheCapacity(std::size_t maxVectors);
+
     bool make_esmry_file();
 
     time_point startdate() const { return tp_startdat; }
@@ -74,6 +100,9 @@ public:
 
     std::size_t numberOfTimeSteps() const { return nTstep; }
 
+    /// Time step indices at end of each report step.
+    const std::vector<int>& reportStepIndices() const { return seqIndex; }
+
     const std::string& get_unit(const std::string& name) const;
     const std::string& get_unit(const SummaryNode& node) const;
 
@@ -96,6 +125,7 @@ private:
     std::vector<std::string> dataFileList;
     mutable std::vector<std::vector<float>> vectorData;
     mutable std::vector<bool> vectorLoaded;
+    mutable SmryVectorLru vectorLru;
     std::vector<TimeStepEntry> timeStepList;
     std::vector<TimeStepEntry> miniStepList;
     std::vector<std::map<int, int>> arrayPos;
@@ -153,6 +183,10 @@ private:
     getListOfArrays(const std::string& filename, bool formatted);
 
     std::vector<int> makeKeywPosVector(int speInd) const;
+    std::vector<int> keywordIndices(const std::vector<std::string>& vectList) const;
+    std::vector<std::vector<float>>
+    readVectors(const std::vector<int>& keywIndVect, std::size_t first, std::size_t last) const;
+    void releaseVector(int ind) const;
     std::string read_string_from_disk(std::fstream& fileH, std::uint64_t size) const;
 
     void read_ministeps_from_disk();
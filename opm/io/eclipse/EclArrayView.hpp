@@ -0,0 +1,273 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_ECLARRAYVIEW_HPP
+#define OPM_IO_ECLARRAYVIEW_HPP
+
+#include <opm/io/eclipse/EclIOdata.hpp>
+#include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace Opm { namespace EclIO {
+
+namespace detail {
+
+    inline std::uint32_t byteSwap(std::uint32_t x)
+    {
+#ifdef _MSC_VER
+        return _byteswap_ulong(x);
+#else
+        return __builtin_bswap32(x);
+#endif
+    }
+
+    inline std::uint64_t byteSwap(std::uint64_t x)
+    {
+#ifdef _MSC_VER
+        return _byteswap_uint64(x);
+#else
+        return __builtin_bswap64(x);
+#endif
+    }
+
+    /// Decode single big-endian element of type T stored at address src.
+    template <typename T>
+    T decodeBigEndian(const char* src)
+    {
+        using Raw = std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>;
+
+        Raw raw;
+        std::memcpy(&raw, src, sizeof raw);
+
+        return std::bit_cast<T>(byteSwap(raw));
+    }
+
+} // namespace detail
+
+/// Read-only view of a numeric array in a memory mapped binary ECLIPSE
+/// file.
+///
+/// On disk the array elements are stored big-endian and split into
+/// Fortran records of at most 1000 elements, each surrounded by four byte
+/// record markers.  The view exposes the array as a contiguous sequence of
+/// native values and converts elements on access.  No element data is
+/// read from disk until it is accessed.
+///
+/// Views keep the underlying file mapping alive and remain valid even if
+/// the originating EclFile object is destroyed.
+///
+/// \tparam T Element type.  One of int (INTE), float (REAL) or double
+///    (DOUB).
+template <typename T>
+class EclArrayView
+{
+public:
+    static_assert(std::is_same_v<T, int> ||
+                  std::is_same_v<T, float> ||
+                  std::is_same_v<T, double>,
+                  "EclArrayView supports INTE, REAL and DOUB arrays only");
+
+    using value_type = T;
+    using size_type = std::size_t;
+
+    class const_iterator
+    {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using reference = T;
+        using pointer = void;
+
+        const_iterator() = default;
+        const_iterator(const EclArrayView* view, size_type ix)
+            : view_ { view }, ix_ { static_cast<difference_type>(ix) }
+        {}
+
+        T operator*() const { return (*this->view_)[this->ix_]; }
+        T operator[](difference_type n) const { return (*this->view_)[this->ix_ + n]; }
+
+        const_iterator& operator++() { ++this->ix_; return *this; }
+        const_iterator operator++(int) { auto t = *this; ++this->ix_; return t; }
+        const_iterator& operator--() { --this->ix_; return *this; }
+        const_iterator operator--(int) { auto t = *this; --this->ix_; return t; }
+
+        const_iterator& operator+=(difference_type n) { this->ix_ += n; return *this; }
+        const_iterator& operator-=(difference_type n) { this->ix_ -= n; return *this; }
+
+        friend const_iterator operator+(const_iterator it, difference_type n) { return it += n; }
+        friend const_iterator operator+(difference_type n, const_iterator it) { return it += n; }
+        friend const_iterator operator-(const_iterator it, difference_type n) { return it -= n; }
+        friend difference_type operator-(const const_iterator& a, const const_iterator& b)
+        {
+            return a.ix_ - b.ix_;
+        }
+
+        bool operator==(const const_iterator& that) const { return this->ix_ == that.ix_; }
+        auto operator<=>(const const_iterator& that) const { return this->ix_ <=> that.ix_; }
+
+    private:
+        const EclArrayView* view_{nullptr};
+        difference_type ix_{0};
+    };
+
+    EclArrayView() = default;
+
+    /// Constructor.
+    ///
+    /// \param[in] file Mapped file containing the array.
+    ///
+    /// \param[in] start Address of leading record marker of the array's
+    ///    first data record.  Must point into \p file.
+    ///
+    /// \param[in] size Number of array elements.
+    ///
+    /// \param[in] elementsPerBlock Maximum number of elements in each
+    ///    Fortran record.
+    EclArrayView(std::shared_ptr<const MappedFile> file,
+                 const char* start,
+                 std::int64_t size,
+                 int elementsPerBlock)
+        : file_             { std::move(file) }
+        , start_            { start }
+        , size_             { static_cast<size_type>(size) }
+        , elementsPerBlock_ { static_cast<size_type>(elementsPerBlock) }
+    {}
+
+    size_type size() const { return this->size_; }
+    bool empty() const { return this->size_ == 0; }
+
+    /// Element at position ix.  No range checking.
+    T operator[](size_type ix) const
+    {
+        return detail::decodeBigEndian<T>(this->address(ix));
+    }
+
+    /// Element at position ix.  Throws std::out_of_range if ix >= size().
+    T at(size_type ix) const
+    {
+        if (ix >= this->size_) {
+            throw std::out_of_range {
+                "Index " + std::to_string(ix) +
+                " outside array view of size " + std::to_string(this->size_)
+            };
+        }
+
+        return (*this)[ix];
+    }
+
+    const_iterator begin() const { return { this, 0 }; }
+    const_iterator end() const { return { this, this->size_ }; }
+
+    /// Decode a range of elements into a caller supplied buffer.
+    ///
+    /// Converts elements in blocks rather than individually, and is the
+    /// preferred way of extracting large ranges.
+    ///
+    /// \param[in] first Index of first element to decode.
+    /// \param[in] count Number of elements to decode.
+    /// \param[out] dest Output buffer.  Must hold at least \p count elements.
+    void copy(size_type first, size_type count, T* dest) const
+    {
+        if ((first > this->size_) || (count > this->size_ - first)) {
+            throw std::out_of_range { "Range outside array view" };
+        }
+
+        while (count > 0) {
+            const auto offset = first % this->elementsPerBlock_;
+            const auto n = std::min(count, this->elementsPerBlock_ - offset);
+
+            flipEndianArray(this->address(first), dest, n, sizeof(T));
+
+            first += n;
+            count -= n;
+            dest  += n;
+        }
+    }
+
+    /// Decode entire array into a newly allocated vector.
+    std::vector<T> toVector() const
+    {
+        std::vector<T> values(this->size_);
+
+        decodeBinaryBlocks(this->start_, static_cast<std::int64_t>(this->size_),
+                           sizeof(T), static_cast<int>(this->elementsPerBlock_),
+                           values.data());
+
+        return values;
+    }
+
+    /// Hint to the operating system that the elements in the range
+    /// [first, first+count) will be accessed soon.
+    void prefetch(size_type first, size_type count) const
+    {
+        if ((this->file_ == nullptr) || (count == 0) || (first >= this->size_)) {
+            return;
+        }
+
+        count = std::min(count, this->size_ - first);
+
+        const auto* begin = this->address(first);
+        const auto* end   = this->address(first + count - 1) + sizeof(T);
+
+        this->file_->willNeed(static_cast<std::uint64_t>(begin - this->file_->data()),
+                              static_cast<std::uint64_t>(end - begin));
+    }
+
+private:
+    std::shared_ptr<const MappedFile> file_{};
+    const char* start_{nullptr};
+    size_type size_{0};
+    size_type elementsPerBlock_{1};
+
+    const char* address(size_type ix) const
+    {
+        constexpr auto markerSize = static_cast<size_type>(sizeOfInte);
+        constexpr auto blockOverhead = 2 * markerSize;
+
+        const auto block = ix / this->elementsPerBlock_;
+        const auto pos = ix % this->elementsPerBlock_;
+
+        return this->start_
+            + block*(this->elementsPerBlock_*sizeof(T) + blockOverhead)
+            + markerSize + pos*sizeof(T);
+    }
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_ECLARRAYVIEW_HPP
@@ -19,6 +19,7 @@
 #include <opm/io/eclipse/EclFile.hpp>
 
 #include <opm/io/eclipse/EclUtil.hpp>
+#include <opm/io/eclipse/MappedFile.hpp>
 #include <opm/common/ErrorMacros.hpp>
 
 #include <algorithm>
@@ -27,10 +28,29 @@
 #include <fstream>
 #include <string>
 #include <numeric>
+#include <type_traits>
 #include <cmath>
 
 #include <fmt/format.h>
 
+namespace {
+
+template <typename T>
+constexpr Opm::EclIO::eclArrType viewArrayType()
+{
+    if constexpr (std::is_same_v<T, int>) {
+        return Opm::EclIO::INTE;
+    }
+    else if constexpr (std::is_same_v<T, float>) {
+        return Opm::EclIO::REAL;
+    }
+    else {
+        return Opm::EclIO::DOUB;
+    }
+}
+
+} // Anonymous namespace
+
 namespace Opm { namespace EclIO {
 
 void EclFile::load(bool preload) {
@@ -116,6 +136,22 @@ EclFile::EclFile(const std::string& filename, bool preload) :
 }
 
 
+EclFile::EclFile(const std::string& filename, EclFile::MemoryMapped mmap, bool preload) :
+    inputFilename(filename)
+{
+    if (!fileExists(filename))
+        throw std::runtime_error(fmt::format("Can not open EclFile: {}", filename));
+
+    formatted = isFormatted(filename);
+
+    if (mmap.value && !formatted) {
+        this->mapped_file = std::make_shared<const MappedFile>(filename);
+    }
+
+    this->load(preload);
+}
+
+
 void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
 {
     fileH.seekg (ifStreamPos[arrIndex], fileH.beg);
@@ -149,6 +185,54 @@ void EclFile::loadBinaryArray(std::fstream& fileH, std::size_t arrIndex)
     arrayLoaded[arrIndex] = true;
 }
 
+bool EclFile::loadMappedArray(std::size_t arrIndex)
+{
+    if (this->mapped_file == nullptr) {
+        return false;
+    }
+
+    switch (array_type[arrIndex]) {
+    case INTE:
+        inte_array[arrIndex] = this->getView<int>(arrIndex).toVector();
+        break;
+    case REAL:
+        real_array[arrIndex] = this->getView<float>(arrIndex).toVector();
+        break;
+    case DOUB:
+        doub_array[arrIndex] = this->getView<double>(arrIndex).toVector();
+        break;
+    default:
+        // Other array types are read through the regular stream path.
+        return false;
+    }
+
+    arrayLoaded[arrIndex] = true;
+    return true;
+}
+
+void EclFile::loadBinaryArrays(const std::vector<std::size_t>& arrIndex)
+{
+    // File stream is opened on first use only, as memory mapped files
+    // usually do not need it.
+    std::fstream fileH;
+
+    for (const auto ind : arrIndex) {
+        if (this->loadMappedArray(ind)) {
+            continue;
+        }
+
+        if (!fileH.is_open()) {
+            fileH.open(inputFilename, std::ios::in |  std::ios::binary);
+
+            if (!fileH) {
+                OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
+            }
+        }
+
+        loadBinaryArray(fileH, ind);
+    }
+}
+
 void EclFile::loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos)
 {
 
@@ -194,18 +278,10 @@ void EclFile::loadData()
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
-        }
+        std::vector<std::size_t> arrIndices(array_name.size());
+        std::iota(arrIndices.begin(), arrIndices.end(), std::size_t{0});
 
-        for (std::size_t i = 0; i < array_name.size(); i++) {
-            loadBinaryArray(fileH, i);
-        }
-
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -237,20 +313,15 @@ void EclFile::loadData(const std::string& name)
 
     } else {
 
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
-        }
+        std::vector<std::size_t> arrIndices;
 
         for (std::size_t i = 0; i < array_name.size(); i++) {
             if (array_name[i] == name) {
-                loadBinaryArray(fileH, i);
+                arrIndices.push_back(i);
             }
         }
 
-        fileH.close();
+        this->loadBinaryArrays(arrIndices);
     }
 }
 
@@ -278,18 +349,7 @@ void EclFile::loadData(const std::vector<int>& arrIndex)
         }
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
-        }
-
-        for (int ind : arrIndex) {
-            loadBinaryArray(fileH, ind);
-        }
-
-        fileH.close();
+        this->loadBinaryArrays({ arrIndex.begin(), arrIndex.end() });
     }
 }
 
@@ -314,16 +374,7 @@ void EclFile::loadData(int arrIndex)
 
 
     } else {
-        std::fstream fileH;
-        fileH.open(inputFilename, std::ios::in |  std::ios::binary);
-
-        if (!fileH) {
-            OPM_THROW(std::runtime_error, "Could not open file: '" + inputFilename +"'");
-        }
-
-        loadBinaryArray(fileH, arrIndex);
-
-        fileH.close();
+        this->loadBinaryArrays({ static_cast<std::size_t>(arrIndex) });
     }
 }
 
@@ -637,6 +688,86 @@ std::size_t EclFile::size() const {
     return this->array_name.size();
 }
 
+template <typename T>
+EclArrayView<T> EclFile::getView(int arrIndex) const
+{
+    if (this->mapped_file == nullptr) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array views require memory mapped input, "
+                              "but file {} is not memory mapped", inputFilename));
+    }
+
+    if ((arrIndex < 0) || (static_cast<std::size_t>(arrIndex) >= array_name.size())) {
+        OPM_THROW(std::invalid_argument,
+                  fmt::format("Array index {} out of range", arrIndex));
+    }
+
+    constexpr auto type = viewArrayType<T>();
+
+    if (array_type[arrIndex] != type) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array with index {} is not of type {}",
+                              arrIndex, (type == INTE) ? "integer"
+                              : (type == REAL) ? "float" : "double"));
+    }
+
+    const auto elementsPerBlock = std::get<1>(block_size_data_binary(type)) / static_cast<int>(sizeof(T));
+    const auto num = array_size[arrIndex];
+    const auto start = ifStreamPos[arrIndex];
+
+    if (start + sizeOnDiskBinary(num, type, sizeof(T)) > this->mapped_file->size()) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Array {} extends beyond end of file {}",
+                              array_name[arrIndex], inputFilename));
+    }
+
+    // Validate record markers once such that element access through the
+    // view does not need to.
+    const char* base = this->mapped_file->data() + start;
+    const char* block = base;
+
+    for (auto rest = num; rest > 0; ) {
+        const auto n = std::min<std::int64_t>(rest, elementsPerBlock);
+        const auto nbytes = static_cast<int>(n * sizeof(T));
+
+        const auto dhead = detail::decodeBigEndian<int>(block);
+        const auto dtail = detail::decodeBigEndian<int>(block + sizeOfInte + nbytes);
+
+        if (dhead != nbytes) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        }
+
+        if (dhead != dtail) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+        }
+
+        block += nbytes + 2*sizeOfInte;
+        rest -= n;
+    }
+
+    return { this->mapped_file, base, num, elementsPerBlock };
+}
+
+template <typename T>
+EclArrayView<T> EclFile::getView(const std::string& name) const
+{
+    auto search = array_index.find(name);
+
+    if (search == array_index.end()) {
+        OPM_THROW(std::invalid_argument, "key '" + name + "' not found");
+    }
+
+    return this->getView<T>(search->second);
+}
+
+template EclArrayView<int> EclFile::getView(int) const;
+template EclArrayView<float> EclFile::getView(int) const;
+template EclArrayView<double> EclFile::getView(int) const;
+
+template EclArrayView<int> EclFile::getView(const std::string&) const;
+template EclArrayView<float> EclFile::getView(const std::string&) const;
+template EclArrayView<double> EclFile::getView(const std::string&) const;
+
 template const std::vector<bool>&
 EclFile::getImpl(int, eclArrType, const std::unordered_map<int,std::vector<bool>>&, const std::string&);
 template const std::vector<float>&
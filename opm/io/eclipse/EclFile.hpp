@@ -19,10 +19,12 @@
 #ifndef OPM_IO_ECLFILE_HPP
 #define OPM_IO_ECLFILE_HPP
 
+#include <opm/io/eclipse/EclArrayView.hpp>
 #include <opm/io/eclipse/EclIOdata.hpp>
 
 #include <algorithm>
 #include <map>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <unordered_map>
@@ -38,9 +40,20 @@ public:
         bool value;
     };
 
+    /// Request memory mapped input.  Only honoured for binary files.
+    ///
+    /// In memory mapped mode numeric arrays are decoded directly from the
+    /// file mapping instead of through a file stream, and INTE, REAL and
+    /// DOUB arrays can be accessed without copying through getView().
+    struct MemoryMapped {
+        bool value;
+    };
+
     explicit EclFile(const std::string& filename, bool preload = false);
     EclFile(const std::string& filename, Formatted fmt, bool preload = false);
+    EclFile(const std::string& filename, MemoryMapped mmap, bool preload = false);
     bool formattedInput() const { return formatted; }
+    bool memoryMapped() const { return mapped_file != nullptr; }
 
     void loadData();                            // load all data
     void loadData(const std::string& arrName);         // load all arrays with array name equal to arrName
@@ -69,6 +82,17 @@ public:
     template <typename T>
     const std::vector<T>& get(const std::string& name);
 
+    /// View of INTE (T = int), REAL (T = float) or DOUB (T = double)
+    /// array without loading it into memory.  Requires memory mapped
+    /// input.  Elements are converted to native byte order on access.
+    template <typename T>
+    EclArrayView<T> getView(int arrIndex) const;
+
+    /// View of named array.  Selects the same array as get(name).
+    /// Requires memory mapped input.
+    template <typename T>
+    EclArrayView<T> getView(const std::string& name) const;
+
     bool hasKey(const std::string &name) const;
     std::size_t count(const std::string& name) const;
 
@@ -93,6 +117,8 @@ protected:
 
     std::vector<std::uint64_t> ifStreamPos;
 
+    std::shared_ptr<const MappedFile> mapped_file{};
+
     std::map<std::string, int> array_index;
 
     template<class T>
@@ -107,6 +133,8 @@ private:
     std::vector<bool> arrayLoaded;
 
     void loadBinaryArray(std::fstream& fileH, std::size_t arrIndex);
+    void loadBinaryArrays(const std::vector<std::size_t>& arrIndex);
+    bool loadMappedArray(std::size_t arrIndex);
     void loadFormattedArray(const std::string& fileStr, std::size_t arrIndex, std::int64_t fromPos);
     void load(bool preload);
 
@@ -264,6 +264,30 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
         OPM_THROW(std::runtime_error, "fstream fileH not open for writing");
     }
 
+    if constexpr (std::is_same_v<T, int> ||
+                  std::is_same_v<T, float> ||
+                  std::is_same_v<T, double>)
+    {
+        // Convert and write whole records in bounded chunks.  Each chunk
+        // is large enough for the conversion to be multithreaded.
+        constexpr std::int64_t blocksPerChunk = 4096;
+        const auto chunkSize = blocksPerChunk * maxNumberOfElements;
+
+        std::vector<char> buffer;
+
+        for (std::int64_t first = 0; first < size; first += chunkSize) {
+            const auto num_chunk = std::min(chunkSize, size - first);
+
+            buffer.resize(sizeOnDiskBinary(num_chunk, arrType, sizeOfElement));
+            encodeBinaryBlocks(data.data() + first, num_chunk, sizeOfElement,
+                               maxNumberOfElements, buffer.data());
+
+            ofileH.write(buffer.data(), buffer.size());
+        }
+
+        return;
+    }
+
     int logi_true_val = ix_standard ? true_value_ix : true_value_ecl;
 
     rest = size * static_cast<std::int64_t>(sizeOfElement);
@@ -283,40 +307,7 @@ void EclOutput::writeBinaryArray(const std::vector<T>& data)
 
         ofileH.write(reinterpret_cast<char*>(&dhead), sizeof(dhead));
 
-        if (arrType == INTE) {
-
-            std::vector<int> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianInt(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(int)) ;
-
-        } else if (arrType == REAL) {
-
-            std::vector<float> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianFloat(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(float)) ;
-
-        } else if (arrType == DOUB) {
-
-            std::vector<double> flipped_data;
-            flipped_data.resize(num, 0);
-
-            for (int m = 0; m < num; ++m) {
-                flipped_data[m] = flipEndianDouble(data[m + offset]);
-            }
-
-            ofileH.write(reinterpret_cast<char*>(flipped_data.data()), flipped_data.size() * sizeof(double)) ;
-
-        } else if (arrType == LOGI) {
+        if (arrType == LOGI) {
 
             std::vector<int> logi_data;
             logi_data.resize(num, 0);
@@ -38,6 +38,143 @@
 #include <intrin.h>
 #endif
 
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define OPM_ECLIO_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define OPM_ECLIO_X86_SIMD 0
+#endif
+
+namespace {
+
+    // Arrays smaller than this are always converted on a single thread.
+    constexpr std::int64_t minParallelElements = 1 << 20;
+
+    using FlipKernel = void (*)(const char* src, char* dest, std::size_t count);
+
+    template <typename Raw>
+    void flipEndianScalar(const char* src, char* dest, std::size_t count)
+    {
+        for (std::size_t i = 0; i < count; ++i) {
+            Raw value;
+            std::memcpy(&value, src + i*sizeof(Raw), sizeof(Raw));
+
+            if constexpr (sizeof(Raw) == 4) {
+                value = static_cast<Raw>(Opm::EclIO::flipEndianInt(static_cast<int>(value)));
+            }
+            else {
+                value = static_cast<Raw>(Opm::EclIO::flipEndianLongInt(static_cast<std::int64_t>(value)));
+            }
+
+            std::memcpy(dest + i*sizeof(Raw), &value, sizeof(Raw));
+        }
+    }
+
+#if OPM_ECLIO_X86_SIMD
+    __attribute__((target("ssse3")))
+    void flipEndianSSSE3_4(const char* src, char* dest, std::size_t count)
+    {
+        const __m128i mask = _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                           11, 10, 9, 8, 15, 14, 13, 12);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 4*i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 4*i), _mm_shuffle_epi8(v, mask));
+        }
+
+        flipEndianScalar<std::uint32_t>(src + 4*i, dest + 4*i, count - i);
+    }
+
+    __attribute__((target("ssse3")))
+    void flipEndianSSSE3_8(const char* src, char* dest, std::size_t count)
+    {
+        const __m128i mask = _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0,
+                                           15, 14, 13, 12, 11, 10, 9, 8);
+        std::size_t i = 0;
+        for (; i + 2 <= count; i += 2) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 8*i));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 8*i), _mm_shuffle_epi8(v, mask));
+        }
+
+        flipEndianScalar<std::uint64_t>(src + 8*i, dest + 8*i, count - i);
+    }
+
+    __attribute__((target("avx2")))
+    void flipEndianAVX2_4(const char* src, char* dest, std::size_t count)
+    {
+        const __m256i mask = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4,
+                                              11, 10, 9, 8, 15, 14, 13, 12,
+                                              3, 2, 1, 0, 7, 6, 5, 4,
+                                              11, 10, 9, 8, 15, 14, 13, 12);
+        std::size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 4*i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 4*i), _mm256_shuffle_epi8(v, mask));
+        }
+
+        flipEndianScalar<std::uint32_t>(src + 4*i, dest + 4*i, count - i);
+    }
+
+    __attribute__((target("avx2")))
+    void flipEndianAVX2_8(const char* src, char* dest, std::size_t count)
+    {
+        const __m256i mask = _mm256_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0,
+                                              15, 14, 13, 12, 11, 10, 9, 8,
+                                              7, 6, 5, 4, 3, 2, 1, 0,
+                                              15, 14, 13, 12, 11, 10, 9, 8);
+        std::size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + 8*i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 8*i), _mm256_shuffle_epi8(v, mask));
+        }
+
+        flipEndianScalar<std::uint64_t>(src + 8*i, dest + 8*i, count - i);
+    }
+#endif // OPM_ECLIO_X86_SIMD
+
+    struct FlipKernels
+    {
+        FlipKernel four{&flipEndianScalar<std::uint32_t>};
+        FlipKernel eight{&flipEndianScalar<std::uint64_t>};
+    };
+
+    // Select fastest byte swapping kernels supported by host CPU.
+    FlipKernels selectFlipKernels()
+    {
+        auto kernels = FlipKernels{};
+
+#if OPM_ECLIO_X86_SIMD
+        __builtin_cpu_init();
+
+        if (__builtin_cpu_supports("avx2")) {
+            kernels.four = &flipEndianAVX2_4;
+            kernels.eight = &flipEndianAVX2_8;
+        }
+        else if (__builtin_cpu_supports("ssse3")) {
+            kernels.four = &flipEndianSSSE3_4;
+            kernels.eight = &flipEndianSSSE3_8;
+        }
+#endif // OPM_ECLIO_X86_SIMD
+
+        return kernels;
+    }
+
+    FlipKernel flipKernel(const int elementSize)
+    {
+        static const auto kernels = selectFlipKernels();
+
+        switch (elementSize) {
+        case 4: return kernels.four;
+        case 8: return kernels.eight;
+        default:
+            throw std::invalid_argument {
+                fmt::format("Unsupported element size {} in endian conversion", elementSize)
+            };
+        }
+    }
+
+} // Anonymous namespace
+
 int Opm::EclIO::flipEndianInt(int num)
 {
 #ifdef _MSC_VER
@@ -81,6 +218,73 @@ double Opm::EclIO::flipEndianDouble(double num)
     return value;
 }
 
+void Opm::EclIO::flipEndianArray(const void* src, void* dest,
+                                  const std::size_t count, const int elementSize)
+{
+    const auto kernel = flipKernel(elementSize);
+    const auto* in = static_cast<const char*>(src);
+    auto* out = static_cast<char*>(dest);
+
+    // Chunk size is a multiple of every SIMD width in use.
+    constexpr std::int64_t chunkSize = 1 << 16;
+    const auto n = static_cast<std::int64_t>(count);
+    const auto numChunks = (n + chunkSize - 1) / chunkSize;
+
+#pragma omp parallel for if(n >= minParallelElements)
+    for (std::int64_t chunk = 0; chunk < numChunks; ++chunk) {
+        const auto first = chunk * chunkSize;
+        const auto offset = static_cast<std::size_t>(first) * elementSize;
+
+        kernel(in + offset, out + offset,
+               static_cast<std::size_t>(std::min(chunkSize, n - first)));
+    }
+}
+
+void Opm::EclIO::decodeBinaryBlocks(const char* src, const std::int64_t num,
+                                     const int elementSize, const int elementsPerBlock,
+                                     void* dest)
+{
+    const auto kernel = flipKernel(elementSize);
+    auto* out = static_cast<char*>(dest);
+
+    const auto blockBytes = static_cast<std::int64_t>(elementsPerBlock) * elementSize + 2*sizeOfInte;
+    const auto numBlocks = (num + elementsPerBlock - 1) / elementsPerBlock;
+
+#pragma omp parallel for if(num >= minParallelElements)
+    for (std::int64_t block = 0; block < numBlocks; ++block) {
+        const auto first = block * elementsPerBlock;
+        const auto n = std::min<std::int64_t>(elementsPerBlock, num - first);
+
+        kernel(src + block*blockBytes + sizeOfInte,
+               out + first*elementSize,
+               static_cast<std::size_t>(n));
+    }
+}
+
+void Opm::EclIO::encodeBinaryBlocks(const void* src, const std::int64_t num,
+                                     const int elementSize, const int elementsPerBlock,
+                                     char* dest)
+{
+    const auto kernel = flipKernel(elementSize);
+    const auto* in = static_cast<const char*>(src);
+
+    const auto blockBytes = static_cast<std::int64_t>(elementsPerBlock) * elementSize + 2*sizeOfInte;
+    const auto numBlocks = (num + elementsPerBlock - 1) / elementsPerBlock;
+
+#pragma omp parallel for if(num >= minParallelElements)
+    for (std::int64_t block = 0; block < numBlocks; ++block) {
+        const auto first = block * elementsPerBlock;
+        const auto n = std::min<std::int64_t>(elementsPerBlock, num - first);
+        const int marker = flipEndianInt(static_cast<int>(n * elementSize));
+
+        char* out = dest + block*blockBytes;
+
+        std::memcpy(out, &marker, sizeOfInte);
+        kernel(in + first*elementSize, out + sizeOfInte, static_cast<std::size_t>(n));
+        std::memcpy(out + sizeOfInte + n*elementSize, &marker, sizeOfInte);
+    }
+}
+
 bool Opm::EclIO::fileExists(const std::string& filename){
 
     std::ifstream fileH(filename.c_str());
@@ -505,25 +709,77 @@ std::vector<T> Opm::EclIO::readBinaryArray(std::fstream& fileH, const std::int64
     return arr;
 }
 
+// Used by ESmry to read individual ministep records.
+template std::vector<int>
+Opm::EclIO::readBinaryArray<int,int>(std::fstream&, const std::int64_t, Opm::EclIO::eclArrType,
+                                     std::function<int(int)>&, int);
+
+
+namespace {
+
+// Read numeric array directly into its final location, one record at a
+// time, and convert the whole array to native byte order at the end.
+template <typename T>
+std::vector<T> readBinaryNumericArray(std::fstream& fileH, const std::int64_t size,
+                                      Opm::EclIO::eclArrType type)
+{
+    const int maxNumberOfElements =
+        std::get<1>(Opm::EclIO::block_size_data_binary(type)) / static_cast<int>(sizeof(T));
+
+    std::vector<T> arr(size);
+
+    std::int64_t offset = 0;
+
+    while (offset < size) {
+        int dhead;
+        fileH.read(reinterpret_cast<char*>(&dhead), sizeof(dhead));
+        dhead = Opm::EclIO::flipEndianInt(dhead);
+        const int num = dhead / static_cast<int>(sizeof(T));
+
+        if ((num > maxNumberOfElements) || (num <= 0)) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, inconsistent header data or incorrect number of elements");
+        }
+
+        const auto rest = size - offset;
+
+        if ((num > rest) || ((num < maxNumberOfElements) && (num != rest))) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, incorrect number of elements");
+        }
+
+        fileH.read(reinterpret_cast<char*>(arr.data() + offset), num * sizeof(T));
+        offset += num;
+
+        int dtail;
+        fileH.read(reinterpret_cast<char*>(&dtail), sizeof(dtail));
+        dtail = Opm::EclIO::flipEndianInt(dtail);
+
+        if (dhead != dtail) {
+            OPM_THROW(std::runtime_error, "Error reading binary data, tail not matching header.");
+        }
+    }
+
+    Opm::EclIO::flipEndianArray(arr.data(), arr.data(), arr.size(), sizeof(T));
+
+    return arr;
+}
+
+} // Anonymous namespace
 
 std::vector<int> Opm::EclIO::readBinaryInteArray(std::fstream &fileH, const std::int64_t size)
 {
-    std::function<int(int)> f = Opm::EclIO::flipEndianInt;
-    return readBinaryArray<int,int>(fileH, size, Opm::EclIO::INTE, f, sizeOfInte);
+    return readBinaryNumericArray<int>(fileH, size, Opm::EclIO::INTE);
 }
 
 
 std::vector<float> Opm::EclIO::readBinaryRealArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<float(float)> f = Opm::EclIO::flipEndianFloat;
-    return readBinaryArray<float,float>(fileH, size, Opm::EclIO::REAL, f, sizeOfReal);
+    return readBinaryNumericArray<float>(fileH, size, Opm::EclIO::REAL);
 }
 
 
 std::vector<double> Opm::EclIO::readBinaryDoubArray(std::fstream& fileH, const std::int64_t size)
 {
-    std::function<double(double)> f = Opm::EclIO::flipEndianDouble;
-    return readBinaryArray<double,double>(fileH, size, Opm::EclIO::DOUB, f, sizeOfDoub);
+    return readBinaryNumericArray<double>(fileH, size, Opm::EclIO::DOUB);
 }
 
 std::vector<bool> Opm::EclIO::readBinaryLogiArray(std::fstream &fileH, const std::int64_t size)
@@ -22,6 +22,7 @@
 
 #include <opm/io/eclipse/EclIOdata.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <string>
@@ -34,6 +35,47 @@ namespace Opm { namespace EclIO {
     std::int64_t flipEndianLongInt(std::int64_t num);
     float flipEndianFloat(float num);
     double flipEndianDouble(double num);
+
+    /// Convert an array of 4 or 8 byte elements between big-endian and
+    /// native byte order.
+    ///
+    /// Uses SIMD instructions when supported by the host CPU, and is
+    /// multithreaded for large arrays when OpenMP is enabled.
+    ///
+    /// \param[in] src Input elements.
+    /// \param[out] dest Output elements.  May be the same as \p src.
+    /// \param[in] count Number of elements.
+    /// \param[in] elementSize Element size in bytes.  Must be 4 or 8.
+    void flipEndianArray(const void* src, void* dest, std::size_t count, int elementSize);
+
+    /// Extract array elements from on-disk binary representation.
+    ///
+    /// Removes the record markers surrounding each block of at most
+    /// elementsPerBlock elements and converts the elements to native byte
+    /// order.  Record markers are not validated.  Blocks are decoded in
+    /// parallel for large arrays when OpenMP is enabled.
+    ///
+    /// \param[in] src Leading record marker of first data block.
+    /// \param[in] num Number of array elements.
+    /// \param[in] elementSize Element size in bytes.  Must be 4 or 8.
+    /// \param[in] elementsPerBlock Maximum number of elements per block.
+    /// \param[out] dest Output elements.  Must hold \p num elements.
+    void decodeBinaryBlocks(const char* src, std::int64_t num, int elementSize,
+                            int elementsPerBlock, void* dest);
+
+    /// Create on-disk binary representation of array elements.
+    ///
+    /// Inverse of decodeBinaryBlocks().  Converts elements to big-endian
+    /// byte order and surrounds each block of at most elementsPerBlock
+    /// elements with record markers.
+    ///
+    /// \param[in] src Native array elements.
+    /// \param[in] num Number of array elements.
+    /// \param[in] elementSize Element size in bytes.  Must be 4 or 8.
+    /// \param[in] elementsPerBlock Maximum number of elements per block.
+    /// \param[out] dest Output buffer.  Must hold sizeOnDiskBinary() bytes.
+    void encodeBinaryBlocks(const void* src, std::int64_t num, int elementSize,
+                            int elementsPerBlock, char* dest);
     bool isEOF(std::fstream* fileH);
     bool fileExists(const std::string& filename);
     bool isFormatted(const std::string& filename);
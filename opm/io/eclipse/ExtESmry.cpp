@@ -549,8 +549,10 @@ void ExtESmry::loadData(const std::vector<std::string>& stringVect)
         ind--;
     }
 
-    for (auto kind : keyIndexVect)
+    for (auto kind : keyIndexVect) {
         m_vectorLoaded[kind] = true;
+        m_vectorLru.insert(kind);
+    }
 
     std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
     m_io_loading += elapsed_seconds.count();
@@ -572,9 +574,230 @@ const std::vector<float>& ExtESmry::get(const std::string& name)
         loadData({name});
     }
 
+    m_vectorLru.touch(index, [this](const int evict) { this->releaseVector(evict); });
+
     return m_vectorData[index];
 }
 
+bool ExtESmry::load_esmry_range(const std::vector<int>& keyIndexVect, int ind,
+                                std::size_t from, std::size_t to,
+                                std::vector<std::vector<float>>& smry_data)
+{
+    std::fstream fileH;
+
+    fileH.open(m_esmry_files[ind], std::ios::in |  std::ios::binary);
+
+    if (!fileH)
+        return false;
+
+    std::string arrName;
+    Opm::EclIO::eclArrType arrType;
+    std::int64_t num_tstep;
+    int sizeOfElement;
+
+    fileH.seekg (m_rstep_offset[ind], fileH.beg);
+
+    try {
+        Opm::EclIO::readBinaryHeader(fileH, arrName, num_tstep, arrType, sizeOfElement);
+    } catch (const std::runtime_error& error)
+    {
+        return false;
+    }
+
+    if (static_cast<std::size_t>(num_tstep) < to)
+        return false;
+
+    const auto smry_arr_size = sizeOnDiskBinary(num_tstep, Opm::EclIO::REAL, sizeOfReal);
+    const std::size_t elementsPerBlock = MaxBlockSizeReal / sizeOfReal;
+    const std::uint64_t blockSizeOnDisk = MaxBlockSizeReal + 2 * sizeOfInte;
+
+    // Only the records holding time steps [from, to) are read.
+    const auto firstBlock = from / elementsPerBlock;
+    const auto numElements = std::min(static_cast<std::size_t>(num_tstep),
+                                      ((to - 1) / elementsPerBlock + 1) * elementsPerBlock)
+                             - firstBlock * elementsPerBlock;
+
+    std::vector<char> buffer(sizeOnDiskBinary(numElements, Opm::EclIO::REAL, sizeOfReal));
+    std::vector<float> blockValues(numElements);
+
+    std::vector<std::vector<float>> range_data(keyIndexVect.size());
+
+    for (std::size_t n = 0 ; n < keyIndexVect.size(); n++) {
+
+        const auto& key = m_keyword[keyIndexVect[n]];
+
+        if ( m_keyword_index[ind].find(key) == m_keyword_index[ind].end() ) {
+
+            range_data[n].resize(to - from, 0.0 );
+
+        } else {
+
+            int key_ind = m_keyword_index[ind].at(key);
+
+            std::uint64_t pos = m_rstep_offset[ind] + smry_arr_size*static_cast<std::uint64_t>(key_ind);
+
+            // adding size of TSTEP and RSTEP INTE data
+            pos = pos + 2 * sizeOnDiskBinary(num_tstep, Opm::EclIO::INTE, sizeOfInte);
+
+            pos = pos + static_cast<std::uint64_t>(2 * 24);  // adding size of binary headers (TSTEP and RSTEP)
+            pos = pos + static_cast<std::uint64_t>(key_ind * 24);  // adding size of binary headers
+
+            fileH.seekg (pos, fileH.beg);
+
+            std::int64_t size;
+
+            try {
+                readBinaryHeader(fileH, arrName, size, arrType, sizeOfElement);
+            } catch (const std::runtime_error& error)
+            {
+                return false;
+            }
+
+            arrName = Opm::EclIO::trimr(arrName);
+
+            std::string checkName = "V" + std::to_string(key_ind);
+
+            if ((arrName != checkName) || (size != num_tstep))
+                return false;
+
+            fileH.seekg (static_cast<std::streamoff>(firstBlock * blockSizeOnDisk), std::ios_base::cur);
+
+            if (!fileH.read(buffer.data(), buffer.size()))
+                return false;
+
+            decodeBinaryBlocks(buffer.data(), numElements, sizeOfReal, elementsPerBlock, blockValues.data());
+
+            const auto offset = from - firstBlock * elementsPerBlock;
+            range_data[n].assign(blockValues.begin() + offset, blockValues.begin() + offset + (to - from));
+        }
+    }
+
+    fileH.close();
+
+    for (std::size_t n = 0 ; n < keyIndexVect.size(); n++)
+        smry_data[n].insert(smry_data[n].end(), range_data[n].begin(), range_data[n].end());
+
+    return true;
+}
+
+std::vector<std::vector<float>>
+ExtESmry::get(const std::vector<std::string>& stringVect, std::size_t first, std::size_t last)
+{
+    if ((first > last) || (last > m_nTstep)) {
+        OPM_THROW(std::out_of_range,
+                  "Time step range [" + std::to_string(first) + ", " + std::to_string(last) +
+                  ") outside summary of " + std::to_string(m_nTstep) + " time steps");
+    }
+
+    auto start = std::chrono::system_clock::now();
+
+    std::vector<int> keyIndexVect;
+    keyIndexVect.reserve(stringVect.size());
+
+    for (const auto& key : stringVect) {
+        if ( m_keyword_index[0].find(key) == m_keyword_index[0].end() )
+            throw std::invalid_argument("summary key '" + key + "' not found");
+
+        keyIndexVect.push_back(m_keyword_index[0].at(key));
+    }
+
+    // Vectors already in memory are copied, the remaining ones are read
+    // for the requested time steps only.
+    std::vector<int> readIndexVect;
+    std::ranges::copy_if(keyIndexVect, std::back_inserter(readIndexVect),
+                         [this](const int kind) { return !m_vectorLoaded[kind]; });
+
+    std::vector<std::vector<float>> smry_data(readIndexVect.size());
+
+    if (!readIndexVect.empty()) {
+        for (auto& vect : smry_data)
+            vect.reserve(last - first);
+
+        // Time steps of base runs precede those of restarted runs.
+        std::size_t offset = 0;
+
+        for (int ind = static_cast<int>(m_tstep_range.size()) - 1; ind > -1; ind--) {
+            const std::size_t nSteps = std::get<1>(m_tstep_range[ind]) + 1;
+            const auto from = std::max(first, offset);
+            const auto to = std::min(last, offset + nSteps);
+
+            if (from < to) {
+                bool res = load_esmry_range(readIndexVect, ind, from - offset, to - offset, smry_data);
+                int n_attempts = 1;
+
+                while ((!res) && (n_attempts < 10)){
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+                    res = load_esmry_range(readIndexVect, ind, from - offset, to - offset, smry_data);
+                    n_attempts ++;
+                }
+
+                if (n_attempts == 10){
+                    OPM_THROW(std::runtime_error,
+                              "when loading data from ESMRY file" + m_esmry_files[ind].string());
+                }
+            }
+
+            offset += nSteps;
+        }
+    }
+
+    auto next = smry_data.begin();
+
+    std::vector<std::vector<float>> values;
+    values.reserve(keyIndexVect.size());
+
+    for (const auto& kind : keyIndexVect) {
+        if (m_vectorLoaded[kind])
+            values.emplace_back(m_vectorData[kind].begin() + first, m_vectorData[kind].begin() + last);
+        else
+            values.push_back(std::move(*next++));
+    }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::system_clock::now() - start;
+    m_io_loading += elapsed_seconds.count();
+
+    return values;
+}
+
+void ExtESmry::stream(const std::vector<std::string>& stringVect,
+                      std::size_t first, std::size_t last, std::size_t blockSize,
+                      const SmryBlockConsumer& consumer)
+{
+    if ((first > last) || (last > m_nTstep)) {
+        OPM_THROW(std::out_of_range,
+                  "Time step range [" + std::to_string(first) + ", " + std::to_string(last) +
+                  ") outside summary of " + std::to_string(m_nTstep) + " time steps");
+    }
+
+    streamTimeStepRange(first, last, blockSize,
+                        [this, &stringVect](const std::size_t blockFirst, const std::size_t blockLast)
+                        { return this->get(stringVect, blockFirst, blockLast); },
+                        consumer);
+}
+
+std::pair<std::size_t, std::size_t> ExtESmry::timeStepRange(time_point from, time_point to)
+{
+    return EclIO::timeStepRange(this->get("TIME"), m_startdat, from, to);
+}
+
+void ExtESmry::setCacheCapacity(std::size_t maxVectors)
+{
+    m_vectorLru = SmryVectorLru { maxVectors };
+
+    for (std::size_t kind = 0; kind < m_nVect; ++kind) {
+        if (m_vectorLoaded[kind])
+            m_vectorLru.insert(kind);
+    }
+
+    m_vectorLru.trim([this](const int evict) { this->releaseVector(evict); });
+}
+
+void ExtESmry::releaseVector(int ind)
+{
+    m_vectorData[ind] = std::vector<float>{};
+    m_vectorLoaded[ind] = false;
+}
+
 std::vector<Opm::time_point> ExtESmry::dates()
 {
     double time_unit = 24 * 3600;
@@ -20,6 +20,7 @@
 #define OPM_IO_ExtESmry_HPP
 
 #include <opm/common/utility/TimeService.hpp>
+#include <opm/io/eclipse/SmryQuery.hpp>
 
 #include <chrono>
 #include <cstddef>
@@ -29,6 +30,7 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace Opm { namespace EclIO {
@@ -55,6 +57,30 @@ public:
     void loadData();
     void loadData(const std::vector<std::string>& stringVect);
 
+    /// Values of summary vectors in time step range [first, last).
+    ///
+    /// Reads only the requested time steps of vectors not already
+    /// loaded, and does not add those vectors to the vector cache.
+    std::vector<std::vector<float>>
+    get(const std::vector<std::string>& stringVect, std::size_t first, std::size_t last);
+
+    /// Pass values of summary vectors in time step range [first, last) to
+    /// consumer in blocks of at most blockSize time steps.  Memory use
+    /// is bounded by the block size rather than by the range.
+    void stream(const std::vector<std::string>& stringVect,
+                std::size_t first, std::size_t last, std::size_t blockSize,
+                const SmryBlockConsumer& consumer);
+
+    /// Time step range [first, last) of time steps in time window [from, to].
+    std::pair<std::size_t, std::size_t> timeStepRange(time_point from, time_point to);
+
+    /// Limit number of summary vectors kept in memory by get().  Least
+    /// recently used vectors are released when the limit is exceeded,
+    /// invalidating references previously returned by get().  Vectors
+    /// loaded through loadData() are kept until the next call to get().
+    /// Zero, the default, means no limit.
+    void setCacheCapacity(std::size_t maxVectors);
+
     time_point startdate() const { return m_startdat; }
     const std::vector<int>& start_v() const { return m_start_vect; }
 
@@ -63,6 +89,9 @@ public:
     std::size_t numberOfTimeSteps() const { return m_nTstep; }
     std::size_t numberOfVectors() const { return m_nVect; }
 
+    /// Time step indices at end of each report step.
+    const std::vector<int>& reportStepIndices() const { return m_seqIndex; }
+
     const std::vector<std::string>& keywordList() const { return m_keyword;}
     std::vector<std::string> keywordList(const std::string& pattern) const;
 
@@ -87,6 +116,7 @@ private:
     std::vector<std::vector<int>> m_tstep_v;
     std::vector<std::vector<float>> m_vectorData;
     std::vector<bool> m_vectorLoaded;
+    SmryVectorLru m_vectorLru;
     std::unordered_map<std::string, std::string> kwunits;
 
     std::size_t m_nVect;
@@ -107,6 +137,12 @@ private:
     bool load_esmry(const std::vector<std::string>& stringVect, const std::vector<int>& keyIndexVect,
                                const std::vector<int>& loadKeyIndex, int ind, int to_ind );
 
+    bool load_esmry_range(const std::vector<int>& keyIndexVect, int ind,
+                          std::size_t from, std::size_t to,
+                          std::vector<std::vector<float>>& smry_data);
+
+    void releaseVector(int ind);
+
     void updatePathAndRootName(std::filesystem::path& dir, std::filesystem::path& rootN);
 };
 
@@ -0,0 +1,109 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/io/eclipse/MappedFile.hpp>
+
+#include <opm/common/ErrorMacros.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fmt/format.h>
+
+#if defined(_WIN32)
+#define OPM_ECLIO_HAVE_MMAP 0
+#else
+#define OPM_ECLIO_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+Opm::EclIO::MappedFile::MappedFile(const std::string& filename)
+{
+#if OPM_ECLIO_HAVE_MMAP
+    const int fd = ::open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Can not open file {} for memory mapping: {}",
+                              filename, std::strerror(errno)));
+    }
+
+    struct stat st{};
+    if (::fstat(fd, &st) != 0) {
+        const auto err = errno;
+        ::close(fd);
+        OPM_THROW(std::runtime_error,
+                  fmt::format("Can not determine size of file {}: {}",
+                              filename, std::strerror(err)));
+    }
+
+    this->size_ = static_cast<std::uint64_t>(st.st_size);
+
+    if (this->size_ > 0) {
+        void* addr = ::mmap(nullptr, this->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            const auto err = errno;
+            ::close(fd);
+            OPM_THROW(std::runtime_error,
+                      fmt::format("Can not memory map file {}: {}",
+                                  filename, std::strerror(err)));
+        }
+
+        this->data_ = static_cast<const char*>(addr);
+    }
+
+    // The mapping stays valid after the descriptor is closed.
+    ::close(fd);
+#else
+    OPM_THROW(std::runtime_error,
+              fmt::format("Memory mapped input of {} is not "
+                          "supported on this platform", filename));
+#endif
+}
+
+Opm::EclIO::MappedFile::~MappedFile()
+{
+#if OPM_ECLIO_HAVE_MMAP
+    if (this->data_ != nullptr) {
+        ::munmap(const_cast<char*>(this->data_), this->size_);
+    }
+#endif
+}
+
+void Opm::EclIO::MappedFile::willNeed([[maybe_unused]] std::uint64_t offset,
+                                      [[maybe_unused]] std::uint64_t count) const
+{
+#if OPM_ECLIO_HAVE_MMAP && defined(MADV_WILLNEED)
+    if ((this->data_ == nullptr) || (offset >= this->size_)) {
+        return;
+    }
+
+    // madvise() requires a page aligned start address.
+    const auto page  = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+    const auto start = offset - (offset % page);
+    const auto end   = std::min(this->size_, offset + count);
+
+    ::madvise(const_cast<char*>(this->data_ + start), end - start, MADV_WILLNEED);
+#endif
+}
@@ -0,0 +1,69 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_MAPPEDFILE_HPP
+#define OPM_IO_MAPPEDFILE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Opm { namespace EclIO {
+
+/// Read-only memory mapping of an entire file.
+///
+/// The mapping is established in the constructor and released in the
+/// destructor.  Objects are neither copyable nor movable, and are intended
+/// to be shared through std::shared_ptr<> by all views into the file.
+class MappedFile
+{
+public:
+    /// Map file into the process' address space.
+    ///
+    /// Throws std::runtime_error if the file cannot be opened or mapped.
+    ///
+    /// \param[in] filename Name of file.
+    explicit MappedFile(const std::string& filename);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile& operator=(MappedFile&&) = delete;
+
+    /// Start of mapped region.  Null if the file is empty.
+    const char* data() const { return this->data_; }
+
+    /// Size of mapped region in bytes.
+    std::uint64_t size() const { return this->size_; }
+
+    /// Advise the operating system that the byte range [offset,
+    /// offset+count) will be needed soon.  No-op if unsupported.
+    void willNeed(std::uint64_t offset, std::uint64_t count) const;
+
+private:
+    const char* data_{nullptr};
+    std::uint64_t size_{0};
+};
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_MAPPEDFILE_HPP
@@ -0,0 +1,178 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_IO_SMRYQUERY_HPP
+#define OPM_IO_SMRYQUERY_HPP
+
+#include <opm/common/utility/TimeService.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/// \file Support for time range and vector subset queries on summary
+/// results (ESmry, ExtESmry).
+
+namespace Opm { namespace EclIO {
+
+/// Receiver of streamed summary query results.
+///
+/// Called once for each block of consecutive time steps.  Element
+/// values[v][i] is the value of the v'th requested summary vector at time
+/// step firstStep + i.  The values are only valid for the duration of the
+/// call.
+using SmryBlockConsumer =
+    std::function<void(std::size_t firstStep,
+                       const std::vector<std::vector<float>>& values)>;
+
+/// Least recently used ordering of summary vectors held in memory.
+///
+/// Tracks vector indices only.  The owner stores the vector data and
+/// releases the vectors reported as evicted.  A capacity of zero means no
+/// limit, in which case no ordering is maintained.
+class SmryVectorLru
+{
+public:
+    SmryVectorLru() = default;
+
+    explicit SmryVectorLru(const std::size_t capacity)
+        : capacity_ { capacity }
+    {}
+
+    std::size_t capacity() const { return this->capacity_; }
+
+    /// Mark vector as most recently used without evicting other vectors.
+    void insert(const int ix)
+    {
+        if (this->capacity_ == 0) {
+            return;
+        }
+
+        auto pos = this->position_.find(ix);
+        if (pos != this->position_.end()) {
+            this->order_.splice(this->order_.begin(), this->order_, pos->second);
+        }
+        else {
+            this->order_.push_front(ix);
+            this->position_.emplace(ix, this->order_.begin());
+        }
+    }
+
+    /// Mark vector as most recently used and evict least recently used
+    /// vectors in excess of capacity.  Never evicts \p ix itself.
+    ///
+    /// \param[in] evict Callback invoked with the index of each evicted
+    ///    vector.
+    template <typename Evict>
+    void touch(const int ix, Evict&& evict)
+    {
+        this->insert(ix);
+        this->trim(std::forward<Evict>(evict));
+    }
+
+    /// Evict least recently used vectors in excess of capacity.
+    template <typename Evict>
+    void trim(Evict&& evict)
+    {
+        if (this->capacity_ == 0) {
+            return;
+        }
+
+        while (this->order_.size() > this->capacity_) {
+            const auto ix = this->order_.back();
+
+            this->order_.pop_back();
+            this->position_.erase(ix);
+
+            evict(ix);
+        }
+    }
+
+private:
+    std::size_t capacity_{0};
+    std::list<int> order_{};
+    std::unordered_map<int, std::list<int>::iterator> position_{};
+};
+
+/// Time step range [first, last) of the time steps within the time
+/// window [from, to].
+///
+/// \param[in] time Elapsed time in days at each time step, i.e., the TIME
+///    summary vector.
+/// \param[in] start Simulation start.
+inline std::pair<std::size_t, std::size_t>
+timeStepRange(const std::vector<float>& time,
+              const time_point start,
+              const time_point from,
+              const time_point to)
+{
+    using Days = std::chrono::duration<double, std::ratio<24 * 3600>>;
+
+    const auto dFrom = std::chrono::duration_cast<Days>(from - start).count();
+    const auto dTo = std::chrono::duration_cast<Days>(to - start).count();
+
+    const auto first = std::lower_bound(time.begin(), time.end(), dFrom,
+                                        [](const float t, const double d) { return t < d; });
+
+    const auto last = std::upper_bound(first, time.end(), dTo,
+                                       [](const double d, const float t) { return d < t; });
+
+    return { static_cast<std::size_t>(first - time.begin()),
+             static_cast<std::size_t>(last - time.begin()) };
+}
+
+/// Pass successive blocks of a time step range to a block reader.
+///
+/// \param[in] first Start of time step range.
+/// \param[in] last End of time step range (one past last time step).
+/// \param[in] blockSize Maximum number of time steps in each block.
+/// \param[in] readBlock Callback reading values in time step range
+///    [blockFirst, blockLast).
+/// \param[in] consumer Receiver of values read by \p readBlock.
+template <typename ReadBlock>
+void streamTimeStepRange(const std::size_t first,
+                         const std::size_t last,
+                         const std::size_t blockSize,
+                         ReadBlock&& readBlock,
+                         const SmryBlockConsumer& consumer)
+{
+    if (blockSize == 0) {
+        throw std::invalid_argument("Block size of summary stream must be positive");
+    }
+
+    auto blockFirst = first;
+    while (blockFirst < last) {
+        const auto blockLast = blockFirst + std::min(blockSize, last - blockFirst);
+
+        consumer(blockFirst, readBlock(blockFirst, blockLast));
+
+        blockFirst = blockLast;
+    }
+}
+
+}} // namespace Opm::EclIO
+
+#endif // OPM_IO_SMRYQUERY_HPP
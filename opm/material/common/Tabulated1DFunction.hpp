@@ -32,8 +32,10 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <iosfwd>
+#include <span>
 #include <stdexcept>
 #include <vector>
 
@@ -124,6 +126,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateSegmentBuckets_();
     }
 
     /*!
@@ -148,6 +152,8 @@ public:
             else if (xValues_[0] > xValues_[numSamples() - 1])
                 reverseSamplingPoints_();
         }
+
+        updateSegmentBuckets_();
     }
 
     /*!
@@ -172,6 +178,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateSegmentBuckets_();
     }
 
     /*!
@@ -208,6 +216,8 @@ public:
             sortInput_();
         else if (xValues_[0] > xValues_[numSamples() - 1])
             reverseSamplingPoints_();
+
+        updateSegmentBuckets_();
     }
 
     /*!
@@ -282,6 +292,33 @@ public:
         return y0 + (y1 - y0)*(x - x0)/(x1 - x0);
     }
 
+    /*!
+     * \brief Evaluate the function at a sequence of positions.
+     *
+     * Equivalent to calling eval(x[i], extrapolate) for each i, but the
+     * segment of each position is searched starting from the segment of
+     * the previous position.  This is considerably faster if consecutive
+     * positions tend to fall in the same or neighbouring segments, as is
+     * typically the case for the cells of a grid.
+     *
+     * \param x The values on the abscissa where the function ought to be evaluated
+     * \param result Function values.  Must have the same size as \p x.
+     * \param extrapolate See eval()
+     */
+    template <class Evaluation>
+    void eval(std::span<const Evaluation> x,
+              std::span<Evaluation> result,
+              bool extrapolate = false) const
+    {
+        assert(x.size() == result.size());
+
+        SegmentIndex segIdx{0};
+        for (std::size_t i = 0; i < x.size(); ++i) {
+            segIdx = findSegmentIndex(x[i], segIdx, extrapolate);
+            result[i] = eval(x[i], segIdx);
+        }
+    }
+
     /*!
      * \brief Evaluate the spline's derivative at a given position.
      *
@@ -437,6 +474,57 @@ public:
 
     template <class Evaluation>
     SegmentIndex findSegmentIndex(const Evaluation& x, bool extrapolate = false) const
+    {
+        checkSegmentSearch_(x, extrapolate);
+        return locateSegment_(x);
+    }
+
+    /*!
+     * \brief Find the segment of a position, starting at a known segment.
+     *
+     * Returns the same segment as findSegmentIndex(x, extrapolate), but
+     * searches outwards from the \p hint segment with exponentially
+     * growing steps before bisecting.  The cost thus grows with the
+     * logarithm of the distance from the hint instead of the logarithm
+     * of the table size.  Use the segment of a nearby position as hint.
+     */
+    template <class Evaluation>
+    SegmentIndex findSegmentIndex(const Evaluation& x,
+                                  SegmentIndex hint,
+                                  bool extrapolate = false) const
+    {
+        checkSegmentSearch_(x, extrapolate);
+
+        const std::size_t n = numSamples();
+        if (x <= xValues_[1])
+            return SegmentIndex{0};
+        else if (x >= xValues_[n - 2])
+            return SegmentIndex{n - 2};
+
+        // The interior segments [x_i, x_{i+1}) are i = 1, ..., n - 3.
+        std::size_t lowerIdx = std::clamp(hint.value, std::size_t{1}, n - 3);
+        std::size_t upperIdx = lowerIdx + 1;
+        if (x < xValues_[lowerIdx]) {
+            for (std::size_t step = 1; x < xValues_[lowerIdx]; step *= 2) {
+                upperIdx = lowerIdx;
+                lowerIdx = (lowerIdx > 1 + step) ? lowerIdx - step : 1;
+            }
+        }
+        else if (x >= xValues_[upperIdx]) {
+            for (std::size_t step = 1; x >= xValues_[upperIdx]; step *= 2) {
+                lowerIdx = upperIdx;
+                upperIdx = std::min(upperIdx + step, n - 2);
+            }
+        }
+        else
+            return SegmentIndex{lowerIdx};
+
+        return bisectSegment_(x, lowerIdx, upperIdx);
+    }
+
+private:
+    template <class Evaluation>
+    void checkSegmentSearch_(const Evaluation& x, bool extrapolate) const
     {
         if (!isfinite(x)) {
             throw std::runtime_error("We can not search for extrapolation/interpolation "
@@ -455,56 +543,71 @@ public:
                                    std::to_string(numSamples()) +
                                    " sampling points");
         }
+    }
 
+    template <class Evaluation>
+    SegmentIndex locateSegment_(const Evaluation& x) const
+    {
         if (x <= xValues_[1])
             return SegmentIndex{0};
         else if (x >= xValues_[xValues_.size() - 2])
             return SegmentIndex{xValues_.size() - 2};
         else {
-            // bisection
+            // bisection, starting from the bracket of the position's
+            // bucket if the table has buckets
             std::size_t lowerIdx = 1;
             std::size_t upperIdx = xValues_.size() - 2;
-            while (lowerIdx + 1 < upperIdx) {
-                std::size_t pivotIdx = (lowerIdx + upperIdx) / 2;
-                if (x < xValues_[pivotIdx])
-                    upperIdx = pivotIdx;
-                else
-                    lowerIdx = pivotIdx;
-            }
+            bucketBracket_(getValue(x), lowerIdx, upperIdx);
+            return bisectSegment_(x, lowerIdx, upperIdx);
+        }
+    }
 
-            if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
-                std::string msg = "Problematic interpolation/extrapolation "
-                                  "segment is found for the input value " +
-                                  std::to_string(Opm::getValue(x)) +
-                                  "\nthe lower index of the found segment is " +
-                                  std::to_string(lowerIdx) +
-                                  ", the size of the table is " +
-                                  std::to_string(numSamples()) +
-                                  ",\nand the end values of the found segment are " +
-                                  std::to_string(xValues_[lowerIdx]) +
-                                  " and " +
-                                  std::to_string(xValues_[lowerIdx + 1]) +
-                                  ", respectively.\n";
-                msg += "Outputting the problematic table for more information "
-                       "(with *** marking the found segment):";
-                for (std::size_t i = 0; i < numSamples(); ++i) {
-                    if (i % 10 == 0)
-                        msg += "\n";
-                    if (i == lowerIdx)
-                        msg += " ***";
-                    msg += " " + std::to_string(xValues_[i]);
-                    if (i == lowerIdx + 1)
-                        msg += " ***";
-                }
-                msg += "\n";
-                OpmLog::debug(msg);
-                throw std::runtime_error(msg);
+    // Bisection for the segment i with x_i <= x < x_{i+1}, given
+    // x_lowerIdx <= x < x_upperIdx.
+    template <class Evaluation>
+    SegmentIndex bisectSegment_(const Evaluation& x,
+                                std::size_t lowerIdx,
+                                std::size_t upperIdx) const
+    {
+        while (lowerIdx + 1 < upperIdx) {
+            std::size_t pivotIdx = (lowerIdx + upperIdx) / 2;
+            if (x < xValues_[pivotIdx])
+                upperIdx = pivotIdx;
+            else
+                lowerIdx = pivotIdx;
+        }
+
+        if (xValues_[lowerIdx] > x || x > xValues_[lowerIdx + 1]) {
+            std::string msg = "Problematic interpolation/extrapolation "
+                              "segment is found for the input value " +
+                              std::to_string(Opm::getValue(x)) +
+                              "\nthe lower index of the found segment is " +
+                              std::to_string(lowerIdx) +
+                              ", the size of the table is " +
+                              std::to_string(numSamples()) +
+                              ",\nand the end values of the found segment are " +
+                              std::to_string(xValues_[lowerIdx]) +
+                              " and " +
+                              std::to_string(xValues_[lowerIdx + 1]) +
+                              ", respectively.\n";
+            msg += "Outputting the problematic table for more information "
+                   "(with *** marking the found segment):";
+            for (std::size_t i = 0; i < numSamples(); ++i) {
+                if (i % 10 == 0)
+                    msg += "\n";
+                if (i == lowerIdx)
+                    msg += " ***";
+                msg += " " + std::to_string(xValues_[i]);
+                if (i == lowerIdx + 1)
+                    msg += " ***";
             }
-            return SegmentIndex{lowerIdx};
+            msg += "\n";
+            OpmLog::debug(msg);
+            throw std::runtime_error(msg);
         }
+        return SegmentIndex{lowerIdx};
     }
 
-private:
     template <class Evaluation>
     Evaluation evalDerivative_(const Evaluation& x, std::size_t segIdx) const
     {
@@ -606,6 +709,63 @@ private:
         }
     }
 
+    /*!
+     * \brief Set up the uniform buckets which narrow down the bisection.
+     *
+     * Large tables get one bucket per sampling point.  Each bucket stores
+     * the segment containing its left edge, so the bisection for a
+     * position only has to search the segments overlapping its bucket.
+     */
+    void updateSegmentBuckets_()
+    {
+        bucketSegment_.clear();
+
+        const std::size_t n = numSamples();
+        if (n < minSamplesForBuckets_)
+            return;
+
+        const Scalar width = (xValues_[n - 1] - xValues_[0]) / n;
+        if (!(width > 0) || !std::isfinite(1 / width))
+            return;
+
+        bucketScale_ = 1 / width;
+        bucketSegment_.resize(n + 1);
+
+        std::size_t segIdx = 0;
+        for (std::size_t b = 0; b <= n; ++b) {
+            const Scalar edge = xValues_[0] + b*width;
+            while (segIdx < n - 2 && xValues_[segIdx + 1] <= edge)
+                ++segIdx;
+
+            bucketSegment_[b] = segIdx;
+        }
+    }
+
+    /*!
+     * \brief Narrow the bisection bracket [lowerIdx, upperIdx] using the
+     *        bucket of a position.
+     *
+     * Keeps the original bracket if the table has no buckets or if
+     * rounding put the position in a neighbouring bucket.
+     */
+    void bucketBracket_(Scalar x, std::size_t& lowerIdx, std::size_t& upperIdx) const
+    {
+        if (bucketSegment_.empty())
+            return;
+
+        const Scalar pos = (x - xValues_[0])*bucketScale_;
+        const std::size_t numBuckets = bucketSegment_.size() - 1;
+        const std::size_t b = std::min(static_cast<std::size_t>(std::max(pos, Scalar{0})),
+                                       numBuckets - 1);
+
+        const std::size_t lower = std::max(bucketSegment_[b], lowerIdx);
+        const std::size_t upper = std::min(bucketSegment_[b + 1] + 1, upperIdx);
+        if (lower < upper && xValues_[lower] <= x && x < xValues_[upper]) {
+            lowerIdx = lower;
+            upperIdx = upper;
+        }
+    }
+
     /*!
      * \brief Resizes the internal vectors to store the sample points.
      */
@@ -615,8 +775,14 @@ private:
         yValues_.resize(nSamples);
     }
 
+    static constexpr std::size_t minSamplesForBuckets_ = 64;
+
     std::vector<Scalar> xValues_;
     std::vector<Scalar> yValues_;
+
+    // Segment of the left edge of each bucket, see updateSegmentBuckets_()
+    std::vector<std::size_t> bucketSegment_;
+    Scalar bucketScale_{0};
 };
 
 } // namespace Opm
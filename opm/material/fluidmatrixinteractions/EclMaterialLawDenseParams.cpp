@@ -0,0 +1,194 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+
+#include <config.h>
+
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawDenseParams.hpp>
+
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+template <class Vector>
+std::size_t allocated(const Vector& v)
+{
+    return v.capacity() * sizeof(typename Vector::value_type);
+}
+
+// Drainage curve parameters, with endpoint scaling, of a two-phase system.
+template <bool enableHysteresis, class Params>
+const auto& drainageParams(const Params& params)
+{
+    if constexpr (enableHysteresis) {
+        return params.drainageParams();
+    }
+    else {
+        return params;
+    }
+}
+
+} // Anonymous namespace
+
+namespace Opm::EclMaterialLaw {
+
+template <class TraitsT>
+bool DenseParams<TraitsT>::
+supports(const Manager<Traits>& manager)
+{
+    const auto approach = manager.threePhaseApproach();
+
+    return !manager.enableHysteresis()
+        && manager.satCurveIsAllPiecewiseLinear()
+        && ((approach == EclMultiplexerApproach::Default) ||
+            (approach == EclMultiplexerApproach::Stone1) ||
+            (approach == EclMultiplexerApproach::Stone2));
+}
+
+template <class TraitsT>
+DenseParams<TraitsT>::
+DenseParams(const Manager<Traits>& manager, const std::size_t numElems)
+    : approach_(manager.threePhaseApproach())
+    , gasOilConfig_(manager.gasOilConfig())
+    , oilWaterConfig_(manager.oilWaterConfig())
+{
+    if (!supports(manager)) {
+        throw std::invalid_argument("Dense material law parameters require piecewise linear "
+                                    "saturation functions without hysteresis and a "
+                                    "Default, Stone1 or Stone2 three-phase model");
+    }
+
+    this->region_.resize(numElems);
+    this->gasOilScaled_.resize(numElems);
+    this->oilWaterScaled_.resize(numElems);
+    this->swl_.resize(numElems);
+    if (this->approach_ == EclMultiplexerApproach::Stone1) {
+        this->krocw_.resize(numElems);
+    }
+
+    std::vector<bool> haveTable;
+
+    for (std::size_t elemIdx = 0; elemIdx < numElems; ++elemIdx) {
+        const auto region = static_cast<std::size_t>(manager.satnumRegionIdx(elemIdx));
+        if (region >= haveTable.size()) {
+            haveTable.resize(region + 1, false);
+            this->gasOilTables_.resize(region + 1);
+            this->oilWaterTables_.resize(region + 1);
+            if (this->approach_ == EclMultiplexerApproach::Stone1) {
+                this->eta_.resize(region + 1, Scalar{1});
+            }
+        }
+
+        auto copyCell = [this, elemIdx, region, &haveTable](const auto& realParams)
+        {
+            const auto& gasOil = drainageParams<Traits::enableHysteresis>(realParams.gasOilParams());
+            const auto& oilWater = drainageParams<Traits::enableHysteresis>(realParams.oilWaterParams());
+
+            this->region_[elemIdx] = region;
+            this->gasOilScaled_[elemIdx] = gasOil.scaledPoints();
+            this->oilWaterScaled_[elemIdx] = oilWater.scaledPoints();
+            this->swl_[elemIdx] = realParams.Swl();
+
+            if constexpr (requires { realParams.krocw(); }) {
+                this->krocw_[elemIdx] = realParams.krocw();
+            }
+
+            if (haveTable[region]) {
+                return;
+            }
+
+            constexpr auto pl = SatCurveMultiplexerApproach::PiecewiseLinear;
+            this->gasOilTables_[region] = { gasOil.effectiveLawParams().template getRealParams<pl>(),
+                                            gasOil.unscaledPoints() };
+            this->oilWaterTables_[region] = { oilWater.effectiveLawParams().template getRealParams<pl>(),
+                                              oilWater.unscaledPoints() };
+
+            if constexpr (requires { realParams.eta(); }) {
+                this->eta_[region] = realParams.eta();
+            }
+
+            haveTable[region] = true;
+        };
+
+        const auto& params = manager.materialLawParams(elemIdx);
+        switch (this->approach_) {
+        case EclMultiplexerApproach::Stone1:
+            copyCell(params.template getRealParams<EclMultiplexerApproach::Stone1>());
+            break;
+
+        case EclMultiplexerApproach::Stone2:
+            copyCell(params.template getRealParams<EclMultiplexerApproach::Stone2>());
+            break;
+
+        default:
+            copyCell(params.template getRealParams<EclMultiplexerApproach::Default>());
+            break;
+        }
+    }
+}
+
+template <class TraitsT>
+std::size_t DenseParams<TraitsT>::
+allocatedBytes() const
+{
+    auto bytes = allocated(this->region_)
+        + allocated(this->gasOilScaled_)
+        + allocated(this->oilWaterScaled_)
+        + allocated(this->swl_)
+        + allocated(this->krocw_)
+        + allocated(this->eta_)
+        + allocated(this->gasOilTables_)
+        + allocated(this->oilWaterTables_);
+
+    auto tableBytes = [&bytes](const auto& tables)
+    {
+        for (const auto& table : tables) {
+            bytes += allocated(table.curve.SwPcwnSamples())
+                + allocated(table.curve.pcwnSamples())
+                + allocated(table.curve.SwKrwSamples())
+                + allocated(table.curve.krwSamples())
+                + allocated(table.curve.SwKrnSamples())
+                + allocated(table.curve.krnSamples());
+        }
+    };
+
+    tableBytes(this->gasOilTables_);
+    tableBytes(this->oilWaterTables_);
+
+    return bytes;
+}
+
+template class DenseParams<ThreePhaseMaterialTraits<double,0,1,2,true,true>>;
+template class DenseParams<ThreePhaseMaterialTraits<float,0,1,2,true,true>>;
+template class DenseParams<ThreePhaseMaterialTraits<double,2,0,1,true,true>>;
+template class DenseParams<ThreePhaseMaterialTraits<float,2,0,1,true,true>>;
+template class DenseParams<ThreePhaseMaterialTraits<double,0,1,2,false,true>>;
+template class DenseParams<ThreePhaseMaterialTraits<float,0,1,2,false,true>>;
+
+} // namespace Opm::EclMaterialLaw
@@ -0,0 +1,300 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::EclMaterialLaw::DenseParams
+ */
+
+#ifndef OPM_ECL_MATERIAL_LAW_DENSE_PARAMS_HPP
+#define OPM_ECL_MATERIAL_LAW_DENSE_PARAMS_HPP
+
+#include <opm/material/fluidmatrixinteractions/EclDefaultMaterial.hpp>
+#include <opm/material/fluidmatrixinteractions/EclEpsConfig.hpp>
+#include <opm/material/fluidmatrixinteractions/EclEpsScalingPoints.hpp>
+#include <opm/material/fluidmatrixinteractions/EclEpsTwoPhaseLaw.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawTwoPhaseTypes.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMultiplexerMaterialParams.hpp>
+#include <opm/material/fluidmatrixinteractions/EclStone1Material.hpp>
+#include <opm/material/fluidmatrixinteractions/EclStone2Material.hpp>
+#include <opm/material/fluidmatrixinteractions/PiecewiseLinearTwoPhaseMaterial.hpp>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace Opm::EclMaterialLaw {
+
+template <class Traits> class Manager;
+
+/*!
+ * \ingroup fluidmatrixinteractions
+ *
+ * \brief Dense copy of the saturation function parameters of all cells,
+ *        evaluated in batches of consecutive cells.
+ *
+ * The per-cell parameters of the Manager hold shared pointers to the
+ * scaling points and the saturation tables, and evaluating a cell dispatches
+ * on the three-phase model and on the type of saturation curve.  This class
+ * stores the piecewise linear tables and unscaled end points once per
+ * saturation region and the scaled end points of all cells in contiguous
+ * arrays.  The three-phase model is resolved once per batch.  The results
+ * are those of Manager::MaterialLaw, which provides the formulas.
+ *
+ * Only runs without hysteresis, with piecewise linear saturation functions
+ * and the Default, Stone1 or Stone2 three-phase models are supported.  Use
+ * supports() to check a Manager.
+ */
+template <class TraitsT>
+class DenseParams
+{
+public:
+    using Traits = TraitsT;
+    using Scalar = typename Traits::Scalar;
+
+    static constexpr int numPhases = Traits::numPhases;
+
+    static_assert(Traits::enableEndpointScaling,
+                  "Dense material law parameters require endpoint scaling support");
+
+    /*!
+     * \brief Whether the saturation functions of a Manager can be copied.
+     */
+    static bool supports(const Manager<Traits>& manager);
+
+    /*!
+     * \brief Copy the parameters of the cells of a Manager.
+     *
+     * \param[in] manager Fully initialised material law manager.
+     * \param[in] numElems Number of cells in the manager.
+     *
+     * Throws std::invalid_argument unless supports(manager).
+     */
+    DenseParams(const Manager<Traits>& manager, std::size_t numElems);
+
+    /*!
+     * \brief Number of cells.
+     */
+    std::size_t numElements() const
+    { return swl_.size(); }
+
+    /*!
+     * \brief Number of bytes allocated for cells and tables.
+     */
+    std::size_t allocatedBytes() const;
+
+    /*!
+     * \brief Relative permeabilities of consecutive cells.
+     *
+     * \param[in] firstElem Index of the first cell.
+     * \param[in] saturations Phase saturations of each cell.
+     * \param[out] kr Relative permeabilities of each cell.  Same size as
+     *             saturations.
+     */
+    template <class Evaluation>
+    void relativePermeabilities(unsigned firstElem,
+                                std::span<const std::array<Evaluation, numPhases>> saturations,
+                                std::span<std::array<Evaluation, numPhases>> kr) const
+    {
+        this->template evaluate_</*relperm=*/true>(firstElem, saturations, kr);
+    }
+
+    /*!
+     * \brief Capillary pressures of consecutive cells.
+     *
+     * \param[in] firstElem Index of the first cell.
+     * \param[in] saturations Phase saturations of each cell.
+     * \param[out] pc Capillary pressures of each cell.  Same size as
+     *             saturations.
+     */
+    template <class Evaluation>
+    void capillaryPressures(unsigned firstElem,
+                            std::span<const std::array<Evaluation, numPhases>> saturations,
+                            std::span<std::array<Evaluation, numPhases>> pc) const
+    {
+        this->template evaluate_</*relperm=*/false>(firstElem, saturations, pc);
+    }
+
+private:
+    using ScalingPoints = EclEpsScalingPoints<Scalar>;
+    using GasOilCurve = PiecewiseLinearTwoPhaseMaterial<typename TwoPhaseTypes<Traits>::GasOilTraits>;
+    using OilWaterCurve = PiecewiseLinearTwoPhaseMaterial<typename TwoPhaseTypes<Traits>::OilWaterTraits>;
+
+    // Saturation table and unscaled end points of one region.
+    template <class Curve>
+    struct Table
+    {
+        typename Curve::Params curve{};
+        ScalingPoints unscaled{};
+    };
+
+    // Two-phase parameters of one cell with the interface expected by
+    // EclEpsTwoPhaseLaw.
+    template <class Curve>
+    class TwoPhaseView
+    {
+    public:
+        TwoPhaseView(const EclEpsConfig& config,
+                     const Table<Curve>& table,
+                     const ScalingPoints& scaled)
+            : config_(&config), table_(&table), scaled_(&scaled)
+        {}
+
+        const EclEpsConfig& config() const
+        { return *config_; }
+
+        const ScalingPoints& unscaledPoints() const
+        { return table_->unscaled; }
+
+        const ScalingPoints& scaledPoints() const
+        { return *scaled_; }
+
+        const typename Curve::Params& effectiveLawParams() const
+        { return table_->curve; }
+
+    private:
+        const EclEpsConfig* config_;
+        const Table<Curve>* table_;
+        const ScalingPoints* scaled_;
+    };
+
+    using GasOilLaw = EclEpsTwoPhaseLaw<GasOilCurve, TwoPhaseView<GasOilCurve>>;
+    using OilWaterLaw = EclEpsTwoPhaseLaw<OilWaterCurve, TwoPhaseView<OilWaterCurve>>;
+
+    // Three-phase parameters of one cell with the interface expected by
+    // the three-phase laws.
+    class CellView
+    {
+    public:
+        CellView(const DenseParams& p, const unsigned elemIdx)
+            : gasOil_(p.gasOilConfig_, p.gasOilTables_[p.region_[elemIdx]], p.gasOilScaled_[elemIdx])
+            , oilWater_(p.oilWaterConfig_, p.oilWaterTables_[p.region_[elemIdx]], p.oilWaterScaled_[elemIdx])
+            , swl_(p.swl_[elemIdx])
+            , eta_(p.eta_.empty() ? Scalar{1} : p.eta_[p.region_[elemIdx]])
+            , krocw_(p.krocw_.empty() ? Scalar{0} : p.krocw_[elemIdx])
+        {}
+
+        const TwoPhaseView<GasOilCurve>& gasOilParams() const
+        { return gasOil_; }
+
+        const TwoPhaseView<OilWaterCurve>& oilWaterParams() const
+        { return oilWater_; }
+
+        Scalar Swl() const
+        { return swl_; }
+
+        Scalar eta() const
+        { return eta_; }
+
+        Scalar krocw() const
+        { return krocw_; }
+
+    private:
+        TwoPhaseView<GasOilCurve> gasOil_;
+        TwoPhaseView<OilWaterCurve> oilWater_;
+        Scalar swl_;
+        Scalar eta_;
+        Scalar krocw_;
+    };
+
+    // Saturations of one cell with the interface of a fluid state.
+    template <class Evaluation>
+    struct SaturationState
+    {
+        using ValueType = Evaluation;
+
+        const std::array<Evaluation, numPhases>& s;
+
+        const Evaluation& saturation(unsigned phaseIdx) const
+        { return s[phaseIdx]; }
+    };
+
+    using DefaultLaw = EclDefaultMaterial<Traits, GasOilLaw, OilWaterLaw, CellView>;
+    using Stone1Law = EclStone1Material<Traits, GasOilLaw, OilWaterLaw, CellView>;
+    using Stone2Law = EclStone2Material<Traits, GasOilLaw, OilWaterLaw, CellView>;
+
+    template <bool relperm, class Evaluation>
+    void evaluate_(const unsigned firstElem,
+                   std::span<const std::array<Evaluation, numPhases>> saturations,
+                   std::span<std::array<Evaluation, numPhases>> values) const
+    {
+        assert(values.size() == saturations.size());
+        assert(firstElem + saturations.size() <= this->numElements());
+
+        switch (approach_) {
+        case EclMultiplexerApproach::Stone1:
+            this->template evaluateLaw_<Stone1Law, relperm>(firstElem, saturations, values);
+            break;
+
+        case EclMultiplexerApproach::Stone2:
+            this->template evaluateLaw_<Stone2Law, relperm>(firstElem, saturations, values);
+            break;
+
+        default:
+            this->template evaluateLaw_<DefaultLaw, relperm>(firstElem, saturations, values);
+            break;
+        }
+    }
+
+    template <class Law, bool relperm, class Evaluation>
+    void evaluateLaw_(const unsigned firstElem,
+                   std::span<const std::array<Evaluation, numPhases>> saturations,
+                   std::span<std::array<Evaluation, numPhases>> values) const
+    {
+        for (std::size_t i = 0; i < saturations.size(); ++i) {
+            const CellView params(*this, firstElem + i);
+            const SaturationState<Evaluation> fs{saturations[i]};
+
+            if constexpr (relperm) {
+                Law::relativePermeabilities(values[i], params, fs);
+            }
+            else {
+                Law::capillaryPressures(values[i], params, fs);
+            }
+        }
+    }
+
+    EclMultiplexerApproach approach_{EclMultiplexerApproach::Default};
+    EclEpsConfig gasOilConfig_{};
+    EclEpsConfig oilWaterConfig_{};
+
+    // Indexed by saturation region.
+    std::vector<Table<GasOilCurve>> gasOilTables_{};
+    std::vector<Table<OilWaterCurve>> oilWaterTables_{};
+    std::vector<Scalar> eta_{};
+
+    // Indexed by cell.
+    std::vector<std::uint32_t> region_{};
+    std::vector<ScalingPoints> gasOilScaled_{};
+    std::vector<ScalingPoints> oilWaterScaled_{};
+    std::vector<Scalar> swl_{};
+    std::vector<Scalar> krocw_{};
+};
+
+} // namespace Opm::EclMaterialLaw
+
+#endif
@@ -31,6 +31,9 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <utility>
+#include <vector>
+
 #include <fmt/format.h>
 
 namespace Opm {
@@ -225,6 +228,29 @@ setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa)
                              static_cast<Scalar>(viscaqa[0].getC2("NACL"))};
 }
 
+template<class Scalar, template<class> class Storage>
+void BrineCo2Pvt<Scalar, Storage>::
+tabulateSaturatedProperties(const typename SaturatedBrineTables<Scalar>::Options& options)
+{
+    // Sample the analytic model, not previous tables.
+    saturatedTables_.clear();
+
+    std::vector<SaturatedBrineTables<Scalar>> tables;
+    tables.reserve(numRegions());
+    for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+        tables.emplace_back(options, [this, regionIdx](const Scalar T, const Scalar p)
+        {
+            return typename SaturatedBrineTables<Scalar>::Values {
+                rsSat(regionIdx, T, p, salinity_[regionIdx]),
+                saturatedInverseFormationVolumeFactor(regionIdx, T, p),
+                saturatedViscosity(regionIdx, T, p)
+            };
+        });
+    }
+
+    saturatedTables_ = std::move(tables);
+}
+
 template class BrineCo2Pvt<double>;
 template class BrineCo2Pvt<float>;
 
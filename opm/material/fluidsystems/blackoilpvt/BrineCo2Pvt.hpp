@@ -45,6 +45,7 @@
 #include <opm/material/binarycoefficients/H2O_CO2.hpp>
 #include <opm/material/binarycoefficients/Brine_CO2.hpp>
 #include <opm/material/fluidsystems/BlackOilFunctions.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/SaturatedBrineTables.hpp>
 
 #include <opm/input/eclipse/EclipseState/Co2StoreConfig.hpp>
 
@@ -189,6 +190,30 @@ public:
 
     void setEzrokhiViscCoeff(const std::vector<EzrokhiTable>& viscaqa);
 
+    /*!
+     * \brief Tabulate the saturated properties of all regions.
+     *
+     * Within the tabulated temperature and pressure range, rsSat() and the
+     * saturated inverse formation volume factor and viscosity are then
+     * interpolated in tables instead of solving the solubility model.  The
+     * tables hold the region's fixed salinity, so they are not used when
+     * the salt concentration is taken from the fluid state.  Call after
+     * all other parameters have been set.
+     */
+    void tabulateSaturatedProperties(const typename SaturatedBrineTables<Scalar>::Options& options);
+
+    /*!
+     * \brief Whether the saturated properties are tabulated.
+     */
+    bool hasSaturatedTables() const
+    { return !saturatedTables_.empty(); }
+
+    /*!
+     * \brief Tables of the saturated properties of a region.
+     */
+    const SaturatedBrineTables<Scalar>& saturatedTables(unsigned regionIdx) const
+    { return saturatedTables_[regionIdx]; }
+
     /*!
      * \brief Return the number of PVT regions which are considered by this PVT-object.
      */
@@ -266,6 +291,11 @@ public:
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature, pressure, saltConcentration);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure, salinity)) {
+            return tables->viscosity(temperature, pressure);
+        }
+#endif
         if (enableEzrokhiViscosity_) {
             const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
             const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
@@ -300,6 +330,13 @@ public:
                                                   const Evaluation& pressure) const
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure,
+                                            Evaluation(salinity_[regionIdx])))
+        {
+            return tables->viscosity(temperature, pressure);
+        }
+#endif
         if (enableEzrokhiViscosity_) {
             const Evaluation& mu_pure = H2O::liquidViscosity(temperature, pressure, extrapolate);
             const Evaluation& nacl_exponent = ezrokhiExponent_(temperature, ezrokhiViscNaClCoeff_);
@@ -324,6 +361,11 @@ public:
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature,
                                                               pressure, saltconcentration);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure, salinity)) {
+            return tables->inverseFormationVolumeFactor(temperature, pressure);
+        }
+#endif
         Evaluation rs_sat = rsSat(regionIdx, temperature, pressure, salinity);
         return (1.0 - convertRsToXoG_(rs_sat,regionIdx)) * density(regionIdx, temperature,
                                                                    pressure, rs_sat, salinity)
@@ -390,6 +432,13 @@ public:
                                                                      const Evaluation& pressure) const
     {
         OPM_TIMEFUNCTION_LOCAL(Subsystem::PvtProps);
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure,
+                                            Evaluation(salinity_[regionIdx])))
+        {
+            return tables->inverseFormationVolumeFactor(temperature, pressure);
+        }
+#endif
         Evaluation rs_sat = rsSat(regionIdx, temperature, pressure, Evaluation(salinity_[regionIdx]));
         return (1.0 - convertRsToXoG_(rs_sat,regionIdx)) * density(regionIdx, temperature, pressure,
                                                                     rs_sat, Evaluation(salinity_[regionIdx]))
@@ -570,6 +619,12 @@ public:
             return 0.0;
         }
 
+#if !OPM_IS_INSIDE_DEVICE_FUNCTION
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure, salinity)) {
+            return tables->rsSat(temperature, pressure);
+        }
+#endif
+
         // calulate the equilibrium composition for the given
         // temperature and pressure.
         Evaluation xgH2O;
@@ -591,6 +646,26 @@ public:
     }
 
 private:
+    /*!
+     * \brief Tables of a region if they apply at the given conditions,
+     *        nullptr otherwise.
+     */
+    template <class Evaluation>
+    const SaturatedBrineTables<Scalar>* tablesFor_(unsigned regionIdx,
+                                                   const Evaluation& temperature,
+                                                   const Evaluation& pressure,
+                                                   const Evaluation& salinity) const
+    {
+        if (saturatedTables_.empty() || enableSaltConcentration_ ||
+            scalarValue(salinity) != salinity_[regionIdx])
+        {
+            return nullptr;
+        }
+
+        const auto& tables = saturatedTables_[regionIdx];
+        return tables.applies(temperature, pressure) ? &tables : nullptr;
+    }
+
     template <class LhsEval>
     OPM_HOST_DEVICE LhsEval ezrokhiExponent_(const LhsEval& temperature,
                                              const ContainerT& ezrokhiCoeff) const
@@ -852,6 +927,7 @@ private:
     Co2StoreConfig::LiquidMixingType liquidMixType_{};
     Co2StoreConfig::SaltMixingType saltMixType_{};
     Params co2Tables_;
+    std::vector<SaturatedBrineTables<Scalar>> saturatedTables_{};
 };
 
 } // namespace Opm
@@ -30,6 +30,9 @@
 #include <opm/input/eclipse/EclipseState/Tables/TableManager.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
+#include <utility>
+#include <vector>
+
 #include <fmt/format.h>
 
 namespace Opm {
@@ -132,6 +135,29 @@ setReferenceDensities(unsigned regionIdx,
     h2ReferenceDensity_[regionIdx] = rhoRefH2;
 }
 
+template<class Scalar>
+void BrineH2Pvt<Scalar>::
+tabulateSaturatedProperties(const typename SaturatedBrineTables<Scalar>::Options& options)
+{
+    // Sample the analytic model, not previous tables.
+    saturatedTables_.clear();
+
+    std::vector<SaturatedBrineTables<Scalar>> tables;
+    tables.reserve(numRegions());
+    for (unsigned regionIdx = 0; regionIdx < numRegions(); ++regionIdx) {
+        tables.emplace_back(options, [this, regionIdx](const Scalar T, const Scalar p)
+        {
+            return typename SaturatedBrineTables<Scalar>::Values {
+                rsSat_(regionIdx, T, p, salinity_[regionIdx]),
+                saturatedInverseFormationVolumeFactor(regionIdx, T, p),
+                saturatedViscosity(regionIdx, T, p)
+            };
+        });
+    }
+
+    saturatedTables_ = std::move(tables);
+}
+
 template class BrineH2Pvt<double>;
 template class BrineH2Pvt<float>;
 
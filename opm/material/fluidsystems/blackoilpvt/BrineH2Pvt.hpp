@@ -36,6 +36,7 @@ copyright holders.
 #include <opm/material/common/UniformTabulated2DFunction.hpp>
 #include <opm/material/common/Valgrind.hpp>
 #include <opm/material/fluidsystems/BlackOilFunctions.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/SaturatedBrineTables.hpp>
 
 #include <cstddef>
 #include <vector>
@@ -111,6 +112,30 @@ public:
     void setEnableSaltConcentration(bool yesno)
     { enableSaltConcentration_ = yesno; }
 
+    /*!
+    * \brief Tabulate the saturated properties of all regions.
+    *
+    * Within the tabulated temperature and pressure range, the saturated gas
+    * dissolution factor, inverse formation volume factor and viscosity are
+    * then interpolated in tables instead of solving the solubility model.
+    * The tables hold the region's fixed salinity, so they are not used when
+    * the salt concentration is taken from the fluid state.  Call after all
+    * other parameters have been set.
+    */
+    void tabulateSaturatedProperties(const typename SaturatedBrineTables<Scalar>::Options& options);
+
+    /*!
+    * \brief Whether the saturated properties are tabulated.
+    */
+    bool hasSaturatedTables() const
+    { return !saturatedTables_.empty(); }
+
+    /*!
+    * \brief Tables of the saturated properties of a region.
+    */
+    const SaturatedBrineTables<Scalar>& saturatedTables(unsigned regionIdx) const
+    { return saturatedTables_[regionIdx]; }
+
     /*!
     * \brief Return the number of PVT regions which are considered by this PVT-object.
     */
@@ -182,6 +207,9 @@ public:
     {
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature,
                                                               pressure, saltConcentration);
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure, salinity)) {
+            return tables->viscosity(temperature, pressure);
+        }
         return Brine::liquidViscosity(temperature, pressure, salinity);
     }
 
@@ -207,6 +235,11 @@ public:
                                   const Evaluation& temperature,
                                   const Evaluation& pressure) const
     {
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure,
+                                            Evaluation(salinity_[regionIdx])))
+        {
+            return tables->viscosity(temperature, pressure);
+        }
         return Brine::liquidViscosity(temperature, pressure, Evaluation(salinity_[regionIdx]));
     }
 
@@ -221,6 +254,9 @@ public:
     {
         const Evaluation salinity = salinityFromConcentration(regionIdx, temperature,
                                                               pressure, saltconcentration);
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure, salinity)) {
+            return tables->inverseFormationVolumeFactor(temperature, pressure);
+        }
         Evaluation rsSat = rsSat_(regionIdx, temperature, pressure, salinity);
         return (1.0 - convertRsToXoG_(rsSat,regionIdx))
              * density_(regionIdx, temperature, pressure, rsSat, salinity)
@@ -288,6 +324,11 @@ public:
                                                      const Evaluation& temperature,
                                                      const Evaluation& pressure) const
     {
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure,
+                                            Evaluation(salinity_[regionIdx])))
+        {
+            return tables->inverseFormationVolumeFactor(temperature, pressure);
+        }
         Evaluation rsSat = rsSat_(regionIdx, temperature,
                                   pressure, Evaluation(salinity_[regionIdx]));
         return (1.0 - convertRsToXoG_(rsSat, regionIdx))
@@ -601,6 +642,10 @@ private:
         if (!enableDissolution_)
             return 0.0;
 
+        if (const auto* tables = tablesFor_(regionIdx, temperature, pressure, salinity)) {
+            return tables->rsSat(temperature, pressure);
+        }
+
         // calulate the equilibrium composition for the given temperature and pressure
         LhsEval xlH2 = BinaryCoeffBrineH2::calculateMoleFractions(temperature, pressure,
                                                                   salinity, extrapolate);
@@ -677,6 +722,26 @@ private:
         return (h_ls1 - X_H2_w*hw + hg*X_H2_w)*1E3; /*J/kg*/
     }
 
+    /*!
+    * \brief Tables of a region if they apply at the given conditions,
+    *        nullptr otherwise.
+    */
+    template <class Evaluation>
+    const SaturatedBrineTables<Scalar>* tablesFor_(unsigned regionIdx,
+                                                   const Evaluation& temperature,
+                                                   const Evaluation& pressure,
+                                                   const Evaluation& salinity) const
+    {
+        if (saturatedTables_.empty() || enableSaltConcentration_ ||
+            scalarValue(salinity) != salinity_[regionIdx])
+        {
+            return nullptr;
+        }
+
+        const auto& tables = saturatedTables_[regionIdx];
+        return tables.applies(temperature, pressure) ? &tables : nullptr;
+    }
+
     template <class LhsEval>
     const LhsEval salinityFromConcentration(unsigned regionIdx,
                                             const LhsEval&T,
@@ -701,6 +766,7 @@ private:
     std::vector<Scalar> salinity_{};
     bool enableDissolution_ = true;
     bool enableSaltConcentration_ = false;
+    std::vector<SaturatedBrineTables<Scalar>> saturatedTables_{};
 };  // end class BrineH2Pvt
 
 }  // end namespace Opm
@@ -0,0 +1,240 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ * \copydoc Opm::SaturatedBrineTables
+ */
+#ifndef OPM_SATURATED_BRINE_TABLES_HPP
+#define OPM_SATURATED_BRINE_TABLES_HPP
+
+#include <opm/material/common/MathToolbox.hpp>
+#include <opm/material/common/UniformTabulated2DFunction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace Opm {
+
+/*!
+ * \brief Tabulated properties of brine saturated with a dissolved gas, as
+ *        functions of temperature and pressure at a fixed salinity.
+ *
+ * Holds the gas dissolution factor, the inverse formation volume factor and
+ * the viscosity on a common uniform grid.  Evaluation uses bilinear
+ * interpolation, so derivatives with respect to temperature and pressure
+ * are those of the interpolant.
+ *
+ * The grid is refined by halving the spacing along the temperature or
+ * pressure axis until the relative interpolation error at the midpoints
+ * between sample points is below a tolerance, or the maximum number of
+ * points is reached.
+ */
+template <class Scalar>
+class SaturatedBrineTables
+{
+public:
+    using Table = UniformTabulated2DFunction<Scalar>;
+
+    //! Saturated properties at one temperature and pressure.
+    struct Values
+    {
+        Scalar rsSat{};
+        Scalar inverseFormationVolumeFactor{};
+        Scalar viscosity{};
+    };
+
+    //! Range and accuracy of the tabulation.
+    struct Options
+    {
+        Scalar minTemperature{};
+        Scalar maxTemperature{};
+        Scalar minPressure{};
+        Scalar maxPressure{};
+
+        //! Maximum relative interpolation error at the midpoints.
+        Scalar tolerance{1e-4};
+
+        //! Maximum number of sample points along each axis.
+        unsigned maxPoints{513};
+    };
+
+    SaturatedBrineTables() = default;
+
+    /*!
+     * \brief Tabulate the saturated properties.
+     *
+     * \param options Range and accuracy.
+     * \param sampler Callable returning the Values at a temperature [K] and
+     *                pressure [Pa].
+     */
+    template <class Sampler>
+    SaturatedBrineTables(const Options& options, const Sampler& sampler)
+    {
+        if (!(options.minTemperature < options.maxTemperature) ||
+            !(options.minPressure < options.maxPressure))
+        {
+            throw std::invalid_argument("Saturated brine tables need a non-empty "
+                                        "temperature and pressure range");
+        }
+
+        const unsigned maxPoints = std::max(options.maxPoints, 3u);
+        unsigned numT = std::min(9u, maxPoints);
+        unsigned numP = std::min(9u, maxPoints);
+
+        while (true) {
+            this->sample_(options, numT, numP, sampler);
+
+            const Scalar errorT = this->midpointError_(sampler, /*alongTemperature=*/true);
+            const Scalar errorP = this->midpointError_(sampler, /*alongTemperature=*/false);
+            this->maxError_ = std::max(errorT, errorP);
+
+            const bool refineT = errorT > options.tolerance && 2*numT - 1 <= maxPoints;
+            const bool refineP = errorP > options.tolerance && 2*numP - 1 <= maxPoints;
+            if (!refineT && !refineP) {
+                break;
+            }
+
+            numT = refineT ? 2*numT - 1 : numT;
+            numP = refineP ? 2*numP - 1 : numP;
+        }
+    }
+
+    /*!
+     * \brief Whether a temperature and pressure lie within the tables.
+     */
+    template <class Evaluation>
+    bool applies(const Evaluation& temperature, const Evaluation& pressure) const
+    {
+        return this->rsSat_.applies(scalarValue(temperature), scalarValue(pressure));
+    }
+
+    template <class Evaluation>
+    Evaluation rsSat(const Evaluation& temperature, const Evaluation& pressure) const
+    { return this->rsSat_.eval(temperature, pressure, /*extrapolate=*/true); }
+
+    template <class Evaluation>
+    Evaluation inverseFormationVolumeFactor(const Evaluation& temperature,
+                                            const Evaluation& pressure) const
+    { return this->invB_.eval(temperature, pressure, /*extrapolate=*/true); }
+
+    template <class Evaluation>
+    Evaluation viscosity(const Evaluation& temperature, const Evaluation& pressure) const
+    { return this->viscosity_.eval(temperature, pressure, /*extrapolate=*/true); }
+
+    /*!
+     * \brief Largest relative interpolation error found at the midpoints
+     *        between sample points.
+     */
+    Scalar maxError() const
+    { return this->maxError_; }
+
+    unsigned numTemperatures() const
+    { return this->rsSat_.numX(); }
+
+    unsigned numPressures() const
+    { return this->rsSat_.numY(); }
+
+private:
+    template <class Sampler>
+    void sample_(const Options& options,
+                 const unsigned numT,
+                 const unsigned numP,
+                 const Sampler& sampler)
+    {
+        for (auto* table : { &this->rsSat_, &this->invB_, &this->viscosity_ }) {
+            table->resize(options.minTemperature, options.maxTemperature, numT,
+                          options.minPressure, options.maxPressure, numP);
+        }
+
+        this->scale_ = Values{};
+        for (unsigned j = 0; j < numP; ++j) {
+            for (unsigned i = 0; i < numT; ++i) {
+                const Values v = sampler(this->rsSat_.iToX(i), this->rsSat_.jToY(j));
+
+                this->rsSat_.setSamplePoint(i, j, v.rsSat);
+                this->invB_.setSamplePoint(i, j, v.inverseFormationVolumeFactor);
+                this->viscosity_.setSamplePoint(i, j, v.viscosity);
+
+                using std::abs;
+                this->scale_.rsSat = std::max(this->scale_.rsSat, abs(v.rsSat));
+                this->scale_.inverseFormationVolumeFactor =
+                    std::max(this->scale_.inverseFormationVolumeFactor,
+                             abs(v.inverseFormationVolumeFactor));
+                this->scale_.viscosity = std::max(this->scale_.viscosity, abs(v.viscosity));
+            }
+        }
+    }
+
+    template <class Sampler>
+    Scalar midpointError_(const Sampler& sampler, const bool alongTemperature) const
+    {
+        // The error is relative to the exact value, but not to values
+        // smaller than a thousandth of the largest sample.  This avoids
+        // spurious refinement where Rs vanishes at low pressure.
+        auto relError = [](const Scalar approx, const Scalar exact, const Scalar scale)
+        {
+            using std::abs;
+            return abs(approx - exact) / std::max(abs(exact), Scalar{1e-3} * scale);
+        };
+
+        const unsigned numT = this->numTemperatures() - (alongTemperature ? 1 : 0);
+        const unsigned numP = this->numPressures() - (alongTemperature ? 0 : 1);
+        const Scalar dT = (this->rsSat_.xMax() - this->rsSat_.xMin()) / (this->numTemperatures() - 1);
+        const Scalar dP = (this->rsSat_.yMax() - this->rsSat_.yMin()) / (this->numPressures() - 1);
+
+        Scalar error = 0;
+        for (unsigned j = 0; j < numP; ++j) {
+            for (unsigned i = 0; i < numT; ++i) {
+                const Scalar T = this->rsSat_.iToX(i) + (alongTemperature ? dT / 2 : Scalar{0});
+                const Scalar p = this->rsSat_.jToY(j) + (alongTemperature ? Scalar{0} : dP / 2);
+                const Values exact = sampler(T, p);
+
+                error = std::max({ error,
+                                   relError(this->rsSat(T, p), exact.rsSat,
+                                            this->scale_.rsSat),
+                                   relError(this->inverseFormationVolumeFactor(T, p),
+                                            exact.inverseFormationVolumeFactor,
+                                            this->scale_.inverseFormationVolumeFactor),
+                                   relError(this->viscosity(T, p), exact.viscosity,
+                                            this->scale_.viscosity) });
+            }
+        }
+
+        return error;
+    }
+
+    Table rsSat_{};
+    Table invB_{};
+    Table viscosity_{};
+
+    // Largest absolute sample of each property.
+    Values scale_{};
+    Scalar maxError_{};
+};
+
+} // namespace Opm
+
+#endif // OPM_SATURATED_BRINE_TABLES_HPP
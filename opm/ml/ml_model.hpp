@@ -31,6 +31,7 @@
 #include <opm/material/densead/Math.hpp>
 
 #include <algorithm>
+#include <array>
 #include <chrono>
 #include <cmath>
 #include <cstddef>
@@ -372,6 +373,107 @@ namespace ML
         std::vector<T> data_;
     };
 
+    namespace detail {
+
+        /// Access to the scalar components of an evaluation, i.e. the value
+        /// and the derivatives of a DenseAd::Evaluation.  Plain floating
+        /// point types have a single component.
+        template <class Evaluation>
+        struct EvalComponents
+        {
+            using Scalar = Evaluation;
+            static constexpr int size = 1;
+
+            static Scalar get(const Evaluation& x, int)
+            {
+                return x;
+            }
+
+            static void set(Evaluation& x, int, const Scalar& v)
+            {
+                x = v;
+            }
+        };
+
+        template <class ValueT, int numVars, unsigned staticSize>
+        requires (numVars > 0)
+        struct EvalComponents<DenseAd::Evaluation<ValueT, numVars, staticSize>>
+        {
+            using Scalar = ValueT;
+            static constexpr int size = numVars + 1;
+
+            static Scalar get(const DenseAd::Evaluation<ValueT, numVars, staticSize>& x, int c)
+            {
+                return c == 0 ? x.value() : x.derivative(c - 1);
+            }
+
+            static void set(DenseAd::Evaluation<ValueT, numVars, staticSize>& x, int c, const Scalar& v)
+            {
+                if (c == 0) {
+                    x.setValue(v);
+                } else {
+                    x.setDerivative(c - 1, v);
+                }
+            }
+        };
+
+        /// C += A * B for row-major matrices A (m x k), B (k x n) and
+        /// C (m x n).
+        ///
+        /// Rows of A are processed in blocks which share a block of rows of
+        /// B, keeping that block of B in cache, and the innermost loop runs
+        /// over contiguous rows of B and C so that it is vectorized by the
+        /// compiler.
+        template <class Scalar>
+        void gemmAccumulate(int m, int k, int n, const Scalar* a, const Scalar* b, Scalar* c)
+        {
+            constexpr int row_block = 32;
+            constexpr int depth_block = 128;
+
+            for (int k0 = 0; k0 < k; k0 += depth_block) {
+                const int k1 = std::min(k, k0 + depth_block);
+                for (int i0 = 0; i0 < m; i0 += row_block) {
+                    const int i1 = std::min(m, i0 + row_block);
+                    for (int i = i0; i < i1; ++i) {
+                        const Scalar* a_row = a + static_cast<std::size_t>(i) * k;
+                        Scalar* c_row = c + static_cast<std::size_t>(i) * n;
+                        for (int p = k0; p < k1; ++p) {
+                            const Scalar a_ip = a_row[p];
+                            const Scalar* b_row = b + static_cast<std::size_t>(p) * n;
+                            for (int j = 0; j < n; ++j) {
+                                c_row[j] += a_ip * b_row[j];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+    } // namespace detail
+
+    /** \class Workspace for batched evaluation
+     * Buffers reused between calls to NNModel::applyBatch(), so that
+     * repeated evaluations of batches of the same size do not allocate.
+     * A workspace must not be shared between concurrent evaluations.
+     */
+    template <class Evaluation>
+    struct NNWorkspace
+    {
+        using Scalar = typename detail::EvalComponents<Evaluation>::Scalar;
+
+        // Outputs of intermediate layers
+        std::array<Tensor<Evaluation>, 2> buffers_;
+
+        // Layer input and output of a single sample, for layers without a
+        // batched implementation
+        Tensor<Evaluation> sample_in_;
+        Tensor<Evaluation> sample_out_;
+
+        // Scalar components of the layer input and output of dense layers
+        std::vector<Scalar> in_components_;
+        std::vector<Scalar> out_components_;
+    };
+
     // NN layer
     // ---------------------
     /** \class Neural Network  Layer base class.
@@ -394,6 +496,12 @@ namespace ML
         virtual bool loadLayer(std::ifstream& file) = 0;
         // Apply the NN layers
         virtual bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) = 0;
+        // Apply the NN layer to a batch of samples, given as the rows of a
+        // 2d tensor.  The default implementation applies the layer to one
+        // sample at a time.
+        virtual bool applyBatch(const Tensor<Evaluation>& in,
+                                Tensor<Evaluation>& out,
+                                NNWorkspace<Evaluation>& workspace);
     };
 
     //! Activation types
@@ -423,6 +531,13 @@ namespace ML
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in,
+                        Tensor<Evaluation>& out,
+                        NNWorkspace<Evaluation>& workspace) override;
+
+        // Applies the activation function in place
+        void activate(std::vector<Evaluation>& data) const;
+
     private:
         ActivationType activation_type_;
     };
@@ -443,6 +558,10 @@ namespace ML
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in,
+                        Tensor<Evaluation>& out,
+                        NNWorkspace<Evaluation>& workspace) override;
+
     private:
         float data_min_;
         float data_max_;
@@ -466,6 +585,10 @@ namespace ML
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in,
+                        Tensor<Evaluation>& out,
+                        NNWorkspace<Evaluation>& workspace) override;
+
     private:
         float data_min_;
         float data_max_;
@@ -486,10 +609,22 @@ namespace ML
 
         bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out) override;
 
+        bool applyBatch(const Tensor<Evaluation>& in,
+                        Tensor<Evaluation>& out,
+                        NNWorkspace<Evaluation>& workspace) override;
+
     private:
+        using Scalar = typename detail::EvalComponents<Evaluation>::Scalar;
+
+        // Copies weights and biases to the scalar type of the batched kernel
+        void convertWeights();
+
         Tensor<float> weights_;
         Tensor<float> biases_;
 
+        std::vector<Scalar> batch_weights_;
+        std::vector<Scalar> batch_biases_;
+
         NNLayerActivation<Evaluation> activation_;
     };
 
@@ -509,8 +644,20 @@ namespace ML
 
         virtual bool apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
 
+        // Applies the model to a batch of samples.  Row i of the 2d tensor
+        // out is the prediction for row i of the 2d tensor in.  The
+        // workspace holds intermediate results and is reused between calls.
+        bool applyBatch(const Tensor<Evaluation>& in,
+                        Tensor<Evaluation>& out,
+                        NNWorkspace<Evaluation>& workspace);
+
+        // Applies the model to a batch of samples using the model's own
+        // workspace.
+        bool applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out);
+
     private:
         std::vector<std::unique_ptr<NNLayer<Evaluation>>> layers_;
+        NNWorkspace<Evaluation> workspace_;
     };
 
     /** \class Neural Network Timer class
@@ -544,6 +691,45 @@ namespace ML
         return !file.fail();
     }
 
+    template <class Evaluation>
+    bool NNLayer<Evaluation>::applyBatch(const Tensor<Evaluation>& in,
+                                         Tensor<Evaluation>& out,
+                                         NNWorkspace<Evaluation>& workspace)
+    {
+        OPM_ERROR_IF(in.dims_.size() != 2, "Invalid batch tensor");
+
+        const int batch_size = in.dims_[0];
+        const int num_in = in.dims_[1];
+
+        Tensor<Evaluation>& sample_in = workspace.sample_in_;
+        Tensor<Evaluation>& sample_out = workspace.sample_out_;
+        sample_in.dims_ = {num_in};
+
+        for (int r = 0; r < batch_size; r++) {
+            const auto row = in.data_.begin() + static_cast<std::ptrdiff_t>(r) * num_in;
+            sample_in.data_.assign(row, row + num_in);
+
+            if (!apply(sample_in, sample_out)) {
+                return false;
+            }
+
+            const int num_out = static_cast<int>(sample_out.data_.size());
+            if (r == 0) {
+                out.resizeI(std::vector<int>{batch_size, num_out});
+            }
+            OPM_ERROR_IF(num_out != out.dims_[1], "Inconsistent layer output size");
+
+            std::ranges::copy(sample_out.data_,
+                              out.data_.begin() + static_cast<std::ptrdiff_t>(r) * num_out);
+        }
+
+        if (batch_size == 0) {
+            out.resizeI(std::vector<int>{0, 0});
+        }
+
+        return true;
+    }
+
     template <class Evaluation>
     bool NNLayerActivation<Evaluation>::loadLayer(std::ifstream& file)
     {
@@ -583,58 +769,71 @@ namespace ML
     bool NNLayerActivation<Evaluation>::apply(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
     {
         out = in;
+        activate(out.data_);
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNLayerActivation<Evaluation>::applyBatch(const Tensor<Evaluation>& in,
+                                                   Tensor<Evaluation>& out,
+                                                   NNWorkspace<Evaluation>&)
+    {
+        return apply(in, out);
+    }
 
+    template <class Evaluation>
+    void NNLayerActivation<Evaluation>::activate(std::vector<Evaluation>& data) const
+    {
         switch (activation_type_) {
         case ActivationType::kLinear:
             break;
         case ActivationType::kRelu:
-            for (std::size_t i = 0; i < out.data_.size(); i++) {
-                if (out.data_[i] < 0.0) {
-                    out.data_[i] = 0.0;
+            for (std::size_t i = 0; i < data.size(); i++) {
+                if (data[i] < 0.0) {
+                    data[i] = 0.0;
                 }
             }
             break;
         case ActivationType::kSoftPlus:
-            for (std::size_t i = 0; i < out.data_.size(); i++) {
-                out.data_[i] = log(1.0 + exp(out.data_[i]));
+            for (std::size_t i = 0; i < data.size(); i++) {
+                data[i] = log(1.0 + exp(data[i]));
             }
             break;
         case ActivationType::kHardSigmoid:
-            for (std::size_t i = 0; i < out.data_.size(); i++) {
+            for (std::size_t i = 0; i < data.size(); i++) {
                 constexpr double sigmoid_scale = 0.2;
-                const Evaluation& x = (out.data_[i] * sigmoid_scale) + 0.5;
+                const Evaluation& x = (data[i] * sigmoid_scale) + 0.5;
 
                 if (x <= 0) {
-                    out.data_[i] = 0.0;
+                    data[i] = 0.0;
                 } else if (x >= 1) {
-                    out.data_[i] = 1.0;
+                    data[i] = 1.0;
                 } else {
-                    out.data_[i] = x;
+                    data[i] = x;
                 }
             }
             break;
         case ActivationType::kSigmoid:
-            for (std::size_t i = 0; i < out.data_.size(); i++) {
-                const Evaluation& x = out.data_[i];
+            for (std::size_t i = 0; i < data.size(); i++) {
+                const Evaluation& x = data[i];
 
                 if (x >= 0) {
-                    out.data_[i] = 1.0 / (1.0 + exp(-x));
+                    data[i] = 1.0 / (1.0 + exp(-x));
                 } else {
                     const Evaluation& z = exp(x);
-                    out.data_[i] = z / (1.0 + z);
+                    data[i] = z / (1.0 + z);
                 }
             }
             break;
         case ActivationType::kTanh:
-            for (std::size_t i = 0; i < out.data_.size(); i++) {
-                out.data_[i] = sinh(out.data_[i]) / cosh(out.data_[i]);
+            for (std::size_t i = 0; i < data.size(); i++) {
+                data[i] = sinh(data[i]) / cosh(data[i]);
             }
             break;
         default:
             break;
         }
-
-        return true;
     }
 
     template <class Evaluation>
@@ -669,6 +868,14 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNLayerScaling<Evaluation>::applyBatch(const Tensor<Evaluation>& in,
+                                                Tensor<Evaluation>& out,
+                                                NNWorkspace<Evaluation>&)
+    {
+        return apply(in, out);
+    }
+
     template <class Evaluation>
     NNLayerUnScaling<Evaluation>::NNLayerUnScaling(
         float data_min, float data_max, float feat_inf, float feat_sup)
@@ -704,12 +911,28 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNLayerUnScaling<Evaluation>::applyBatch(const Tensor<Evaluation>& in,
+                                                  Tensor<Evaluation>& out,
+                                                  NNWorkspace<Evaluation>&)
+    {
+        return apply(in, out);
+    }
+
     template <class Evaluation>
     NNLayerDense<Evaluation>::NNLayerDense(Tensor<float> weights, Tensor<float> biases, ActivationType activation_type)
         : weights_(weights)
         , biases_(biases)
         , activation_(activation_type)
     {
+        convertWeights();
+    }
+
+    template <class Evaluation>
+    void NNLayerDense<Evaluation>::convertWeights()
+    {
+        batch_weights_.assign(weights_.data_.begin(), weights_.data_.end());
+        batch_biases_.assign(biases_.data_.begin(), biases_.data_.end());
     }
 
     template <class Evaluation>
@@ -733,6 +956,8 @@ namespace ML
         biases_.resizeI<std::vector<unsigned int>>({biases_shape});
         OPM_ERROR_IF(!readFile<float>(file, biases_.data_.data(), biases_shape), "Expected biases");
 
+        convertWeights();
+
         OPM_ERROR_IF(!activation_.loadLayer(file), "Failed to load activation");
 
         return true;
@@ -792,6 +1017,95 @@ namespace ML
         return true;
     }
 
+    /**
+     * @brief Applies the forward pass of a dense layer to a batch of samples.
+     *
+     * `in` has shape `(batch_size, input_dim)` and `out` gets shape
+     * `(batch_size, output_dim)`.  The batch is multiplied by the weights as
+     * one matrix product, using a cache-blocked kernel on the scalar type
+     * underlying `Evaluation`.
+     *
+     * For DenseAd::Evaluation the value and each derivative of a sample form
+     * separate rows of the scalar input matrix.  The layer is linear before
+     * the activation, so the derivatives of the output are the products of
+     * the input derivatives and the weights, and all components go through
+     * the same kernel.  The bias is added to the value rows only.
+     */
+    template <class Evaluation>
+    bool NNLayerDense<Evaluation>::applyBatch(const Tensor<Evaluation>& in,
+                                              Tensor<Evaluation>& out,
+                                              NNWorkspace<Evaluation>& workspace)
+    {
+        using Components = detail::EvalComponents<Evaluation>;
+        constexpr int num_components = Components::size;
+
+        const int num_in = weights_.dims_[0];
+        const int num_out = weights_.dims_[1];
+
+        OPM_ERROR_IF(in.dims_.size() != 2, "Invalid batch tensor");
+        OPM_ERROR_IF(in.dims_[1] != num_in,
+                     fmt::format(fmt::runtime("\n Invalid input size "
+                                 "{}"
+                                 " expected "
+                                 "{}"),
+                                 in.dims_[1],
+                                 num_in));
+
+        const int batch_size = in.dims_[0];
+        const int num_rows = batch_size * num_components;
+
+        if (out.dims_.size() != 2 || out.dims_[0] != batch_size || out.dims_[1] != num_out) {
+            out.resizeI(std::vector<int>{batch_size, num_out});
+        }
+
+        const auto initRow = [this, num_out](Scalar* row, int component)
+        {
+            if (component == 0) {
+                std::copy_n(batch_biases_.begin(), num_out, row);
+            } else {
+                std::fill_n(row, num_out, Scalar{0});
+            }
+        };
+
+        if constexpr (num_components == 1) {
+            for (int r = 0; r < batch_size; r++) {
+                initRow(&out.data_[static_cast<std::size_t>(r) * num_out], 0);
+            }
+            detail::gemmAccumulate(batch_size, num_in, num_out,
+                                   in.data_.data(), batch_weights_.data(), out.data_.data());
+        } else {
+            auto& a = workspace.in_components_;
+            auto& c = workspace.out_components_;
+            a.resize(static_cast<std::size_t>(num_rows) * num_in);
+            c.resize(static_cast<std::size_t>(num_rows) * num_out);
+
+            for (int r = 0; r < batch_size; r++) {
+                for (int comp = 0; comp < num_components; comp++) {
+                    const std::size_t row = static_cast<std::size_t>(r) * num_components + comp;
+                    for (int i = 0; i < num_in; i++) {
+                        a[row * num_in + i] = Components::get(in.data_[static_cast<std::size_t>(r) * num_in + i], comp);
+                    }
+                    initRow(&c[row * num_out], comp);
+                }
+            }
+
+            detail::gemmAccumulate(num_rows, num_in, num_out, a.data(), batch_weights_.data(), c.data());
+
+            for (int r = 0; r < batch_size; r++) {
+                for (int comp = 0; comp < num_components; comp++) {
+                    const std::size_t row = static_cast<std::size_t>(r) * num_components + comp;
+                    for (int j = 0; j < num_out; j++) {
+                        Components::set(out.data_[static_cast<std::size_t>(r) * num_out + j], comp, c[row * num_out + j]);
+                    }
+                }
+            }
+        }
+
+        activation_.activate(out.data_);
+
+        return true;
+    }
+
     template <class Evaluation>
     bool NNModel<Evaluation>::loadModel(const std::string& filename)
     {
@@ -861,6 +1175,43 @@ namespace ML
         return true;
     }
 
+    template <class Evaluation>
+    bool NNModel<Evaluation>::applyBatch(const Tensor<Evaluation>& in,
+                                         Tensor<Evaluation>& out,
+                                         NNWorkspace<Evaluation>& workspace)
+    {
+        OPM_ERROR_IF(in.dims_.size() != 2, "Invalid batch tensor");
+        OPM_ERROR_IF(&in == &out, "Batch input and output must be different tensors");
+
+        if (layers_.empty()) {
+            out = in;
+            return true;
+        }
+
+        // Intermediate results alternate between the workspace buffers, the
+        // last layer writes directly to out.
+        const Tensor<Evaluation>* layer_in = &in;
+        for (std::size_t i = 0; i < layers_.size(); i++) {
+            Tensor<Evaluation>& layer_out =
+                (i + 1 == layers_.size()) ? out : workspace.buffers_[i % 2];
+
+            OPM_ERROR_IF(!(layers_[i]->applyBatch(*layer_in, layer_out, workspace)),
+                         fmt::format(fmt::runtime("\n Failed to apply layer "
+                                     "{}"),
+                                     i));
+
+            layer_in = &layer_out;
+        }
+
+        return true;
+    }
+
+    template <class Evaluation>
+    bool NNModel<Evaluation>::applyBatch(const Tensor<Evaluation>& in, Tensor<Evaluation>& out)
+    {
+        return applyBatch(in, out, workspace_);
+    }
+
 } // namespace ML
 
 } // namespace Opm
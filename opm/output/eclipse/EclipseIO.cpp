@@ -35,14 +35,19 @@
 #include <opm/input/eclipse/EclipseState/IOConfig/IOConfig.hpp>
 #include <opm/input/eclipse/EclipseState/SummaryConfig/SummaryConfig.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/RPTConfig.hpp>
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
+#include <opm/input/eclipse/Schedule/SummaryState.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/Well/WellTestState.hpp>
 
 #include <opm/input/eclipse/Units/Dimension.hpp>
 #include <opm/input/eclipse/Units/UnitSystem.hpp>
 
 #include <opm/output/eclipse/AggregateAquiferData.hpp>
+#include <opm/output/eclipse/OutputQueue.hpp>
 #include <opm/output/eclipse/RestartIO.hpp>
 #include <opm/output/eclipse/RestartValue.hpp>
 #include <opm/output/eclipse/Summary.hpp>
@@ -516,6 +521,66 @@ public:
     /// Record full processing of a complete time step.
     void countTimeStep() { ++this->miniStepId_; }
 
+    /// Create RFT, summary and restart file output for a single time step.
+    ///
+    /// Parameters as for EclipseIO::writeTimeStep().
+    void writeTimeStep(const Action::State& action_state,
+                       const WellTestState& wtest_state,
+                       const SummaryState&  st,
+                       const UDQState&      udq_state,
+                       const int            report_step,
+                       const bool           isSubstep,
+                       const double         secs_elapsed,
+                       RestartValue&&       value,
+                       const bool           write_double,
+                       std::optional<int>   time_step,
+                       const bool           forceFinalWrite);
+
+    /// Create summary and restart file output for a single time step of a
+    /// run with local grid refinement.
+    ///
+    /// Parameters as for EclipseIO::writeTimeStep().
+    void writeTimeStep(const Action::State&        action_state,
+                       const WellTestState&        wtest_state,
+                       const SummaryState&         st,
+                       const UDQState&             udq_state,
+                       const int                   report_step,
+                       const bool                  isSubstep,
+                       const double                secs_elapsed,
+                       std::vector<RestartValue>&& value,
+                       const bool                  write_double,
+                       std::optional<int>          time_step,
+                       const bool                  forceFinalWrite);
+
+    /// Create output for a single time step, or queue it for the output
+    /// thread in asynchronous mode.
+    ///
+    /// Parameters as for EclipseIO::writeTimeStep().
+    template <typename Value>
+    void submitTimeStep(const Action::State& action_state,
+                        const WellTestState& wtest_state,
+                        const SummaryState&  st,
+                        const UDQState&      udq_state,
+                        const int            report_step,
+                        const bool           isSubstep,
+                        const double         secs_elapsed,
+                        Value&&              value,
+                        const bool           write_double,
+                        std::optional<int>   time_step,
+                        const bool           forceFinalWrite);
+
+    /// Create time step output on a background thread.
+    ///
+    /// \param[in] max_pending Maximum number of time steps queued for, or
+    /// being written by, the output thread.
+    void enableAsyncOutput(const std::size_t max_pending);
+
+    /// Wait for all queued time step output to be written.
+    ///
+    /// No-op unless in asynchronous mode.  Rethrows the first exception
+    /// raised by the output thread since the last call.
+    void flush();
+
 private:
     /// Run's static properties.
     std::reference_wrapper<const EclipseState> es_;
@@ -575,6 +640,12 @@ private:
     /// Stored as \c float to mimic the summary file's TIME vector.
     float last_summary_output_{std::numeric_limits<float>::lowest()};
 
+    /// Background output thread in asynchronous mode.  Null otherwise.
+    ///
+    /// Declared last, and destroyed first, so that pending output is
+    /// written while the rest of the object is still intact.
+    std::unique_ptr<out::OutputQueue> outputQueue_{};
+
     /// Output static properties to INIT file.
     ///
     /// \param[in] simProps Initial per-cell properties such as
@@ -976,6 +1047,143 @@ void Opm::EclipseIO::Impl::writeRftFile(const double       secs_elapsed,
                  rftFile);
 }
 
+void Opm::EclipseIO::Impl::writeTimeStep(const Action::State& action_state,
+                                         const WellTestState& wtest_state,
+                                         const SummaryState&  st,
+                                         const UDQState&      udq_state,
+                                         const int            report_step,
+                                         const bool           isSubstep,
+                                         const double         secs_elapsed,
+                                         RestartValue&&       value,
+                                         const bool           write_double,
+                                         std::optional<int>   time_step,
+                                         const bool           forceFinalWrite)
+{
+    // RFT file written only if requested and never for substeps.
+    if (const auto& [wantRFT, haveExistingRFT] =
+        this->wantRFTOutput(report_step, isSubstep);
+        wantRFT)
+    {
+        this->writeRftFile(secs_elapsed, report_step,
+                           haveExistingRFT, value.wells);
+    }
+
+    if (this->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
+        this->writeSummaryFile(st, report_step, time_step,
+                               secs_elapsed, isSubstep, forceFinalWrite);
+    }
+
+    if (this->wantRestartOutput(report_step, isSubstep, time_step)) {
+        // Restart file output (RPTRST &c).
+        this->writeRestartFile(action_state, wtest_state, st, udq_state,
+                               report_step, time_step, secs_elapsed,
+                               write_double, std::move(value));
+    }
+
+    if ( this->isFinalWrite(report_step, isSubstep, forceFinalWrite)  &&
+        this->summaryConfig().createRunSummary())
+    {
+        // Write RSM file at end of simulation.
+        this->writeRunSummary();
+    }
+
+    this->countTimeStep();
+}
+
+void Opm::EclipseIO::Impl::writeTimeStep(const Action::State&        action_state,
+                                         const WellTestState&        wtest_state,
+                                         const SummaryState&         st,
+                                         const UDQState&             udq_state,
+                                         const int                   report_step,
+                                         const bool                  isSubstep,
+                                         const double                secs_elapsed,
+                                         std::vector<RestartValue>&& value,
+                                         const bool                  write_double,
+                                         std::optional<int>          time_step,
+                                         const bool                  forceFinalWrite)
+{
+    // RFT file is currently skipped for LGR grids.
+
+    if (this->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
+        this->writeSummaryFile(st, report_step, time_step,
+                               secs_elapsed, isSubstep, forceFinalWrite);
+    }
+
+    if (this->wantRestartOutput(report_step, isSubstep, time_step)) {
+        // Restart file output (RPTRST &c).
+        this->writeRestartFile(action_state, wtest_state, st, udq_state,
+                               report_step, time_step, secs_elapsed,
+                               write_double, std::move(value));
+    }
+
+    if ( this->isFinalWrite(report_step, isSubstep, forceFinalWrite) &&
+        this->summaryConfig().createRunSummary())
+    {
+        // Write RSM file at end of simulation.
+        this->writeRunSummary();
+    }
+
+    this->countTimeStep();
+}
+
+template <typename Value>
+void Opm::EclipseIO::Impl::submitTimeStep(const Action::State& action_state,
+                                          const WellTestState& wtest_state,
+                                          const SummaryState&  st,
+                                          const UDQState&      udq_state,
+                                          const int            report_step,
+                                          const bool           isSubstep,
+                                          const double         secs_elapsed,
+                                          Value&&              value,
+                                          const bool           write_double,
+                                          std::optional<int>   time_step,
+                                          const bool           forceFinalWrite)
+{
+    if (this->outputQueue_ == nullptr) {
+        this->writeTimeStep(action_state, wtest_state, st, udq_state,
+                            report_step, isSubstep, secs_elapsed,
+                            std::move(value), write_double,
+                            time_step, forceFinalWrite);
+        return;
+    }
+
+    // The output thread runs after the caller has moved on to the next
+    // time step, so it gets its own copies of the dynamic state objects.
+    this->outputQueue_->submit
+        ([this, action_state, wtest_state, st, udq_state,
+          report_step, isSubstep, secs_elapsed,
+          value = std::move(value), write_double,
+          time_step, forceFinalWrite]() mutable
+        {
+            this->writeTimeStep(action_state, wtest_state, st, udq_state,
+                                report_step, isSubstep, secs_elapsed,
+                                std::move(value), write_double,
+                                time_step, forceFinalWrite);
+        });
+}
+
+void Opm::EclipseIO::Impl::enableAsyncOutput(const std::size_t max_pending)
+{
+    if (! this->schedule_.get().isFullyLoaded()) {
+        throw std::logic_error {
+            "Asynchronous output requires a fully loaded Schedule"
+        };
+    }
+
+    if (this->outputQueue_ != nullptr) {
+        this->outputQueue_->flush();
+    }
+
+    this->outputQueue_ = std::make_unique<out::OutputQueue>(max_pending);
+}
+
+void Opm::EclipseIO::Impl::flush()
+{
+    if (this->outputQueue_ != nullptr) {
+        this->outputQueue_->flush();
+    }
+}
+
 // ---------------------------------------------------------------------------
 
 void Opm::EclipseIO::Impl::writeInitFile(data::Solution                          simProps,
@@ -1200,35 +1408,10 @@ void Opm::EclipseIO::writeTimeStep(const Action::State& action_state,
         return;
     }
 
-    // RFT file written only if requested and never for substeps.
-    if (const auto& [wantRFT, haveExistingRFT] =
-        this->impl->wantRFTOutput(report_step, isSubstep);
-        wantRFT)
-    {
-        this->impl->writeRftFile(secs_elapsed, report_step,
-                                 haveExistingRFT, value.wells);
-    }
-
-    if (this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
-        this->impl->writeSummaryFile(st, report_step, time_step,
-                                     secs_elapsed, isSubstep, forceFinalWrite);
-    }
-
-    if (this->impl->wantRestartOutput(report_step, isSubstep, time_step)) {
-        // Restart file output (RPTRST &c).
-        this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
-                                     report_step, time_step, secs_elapsed,
-                                     write_double, std::move(value));
-    }
-
-    if ( this->impl->isFinalWrite(report_step, isSubstep, forceFinalWrite)  &&
-        this->impl->summaryConfig().createRunSummary())
-    {
-        // Write RSM file at end of simulation.
-        this->impl->writeRunSummary();
-    }
-
-    this->impl->countTimeStep();
+    this->impl->submitTimeStep(action_state, wtest_state, st, udq_state,
+                               report_step, isSubstep, secs_elapsed,
+                               std::move(value), write_double,
+                               time_step, forceFinalWrite);
 }
 
 void Opm::EclipseIO::writeTimeStep(const Action::State&      action_state,
@@ -1249,33 +1432,27 @@ void Opm::EclipseIO::writeTimeStep(const Action::State&      action_state,
         return;
     }
 
-    // RFT file is currently skipped for LGR grids.
-
-    if (this->impl->wantSummaryOutput(report_step, isSubstep, secs_elapsed, time_step)) {
-        this->impl->writeSummaryFile(st, report_step, time_step,
-                                     secs_elapsed, isSubstep, forceFinalWrite);
-    }
-
-    if (this->impl->wantRestartOutput(report_step, isSubstep, time_step)) {
-        // Restart file output (RPTRST &c).
-        this->impl->writeRestartFile(action_state, wtest_state, st, udq_state,
-                                     report_step, time_step, secs_elapsed,
-                                     write_double, std::move(value));
-    }
+    this->impl->submitTimeStep(action_state, wtest_state, st, udq_state,
+                               report_step, isSubstep, secs_elapsed,
+                               std::move(value), write_double,
+                               time_step, forceFinalWrite);
+}
 
-    if ( this->impl->isFinalWrite(report_step, isSubstep, forceFinalWrite) &&
-        this->impl->summaryConfig().createRunSummary())
-    {
-        // Write RSM file at end of simulation.
-        this->impl->writeRunSummary();
-    }
+void Opm::EclipseIO::enableAsyncOutput(const std::size_t max_pending)
+{
+    this->impl->enableAsyncOutput(max_pending);
+}
 
-    this->impl->countTimeStep();
+void Opm::EclipseIO::flush()
+{
+    this->impl->flush();
 }
 
 void Opm::EclipseIO::
 recordNewDynamicWellConns(const out::Summary::DynamicConns& newConns)
 {
+    // The summary evaluators are shared with pending summary output.
+    this->impl->flush();
     this->impl->recordNewDynamicWellConns(newConns);
 }
 
@@ -1285,6 +1462,7 @@ Opm::EclipseIO::loadRestart(Action::State&                 action_state,
                             const std::vector<RestartKey>& solution_keys,
                             const std::vector<RestartKey>& extra_keys) const
 {
+    this->impl->flush();
     return this->impl->loadRestart(solution_keys, extra_keys,
                                    action_state, summary_state);
 }
@@ -1293,6 +1471,7 @@ Opm::data::Solution
 Opm::EclipseIO::loadRestartSolution(const std::vector<RestartKey>& solution_keys,
                                     const int                      report_step) const
 {
+    this->impl->flush();
     return this->impl->loadRestartSolution(solution_keys, report_step);
 }
 
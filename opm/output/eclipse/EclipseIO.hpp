@@ -330,6 +330,43 @@ public:
                        std::optional<int>        time_step = std::nullopt,
                        const bool                isFinalWriteOut = false);
 
+    /// Create time step output on a background thread.
+    ///
+    /// Subsequent calls to writeTimeStep() copy the action, WTEST, summary
+    /// and UDQ states, take ownership of the RestartValue objects, and
+    /// queue the output for a dedicated output thread, which creates the
+    /// RFT, summary and restart files in order.  The caller continues with
+    /// the next time step meanwhile, except when the maximum number of
+    /// time steps is already pending, in which case writeTimeStep() waits
+    /// for the output thread to catch up.
+    ///
+    /// The EclipseState and Schedule objects passed to the constructor are
+    /// read by the output thread.  Call flush() before modifying them,
+    /// e.g., when applying actions.  The Schedule must be fully loaded,
+    /// see Schedule::loadAll(), as loading report steps on demand would
+    /// modify it.  Summary::eval() may run concurrently with pending
+    /// output.
+    ///
+    /// An exception raised while creating output discards the time steps
+    /// queued after it and is rethrown by the next call to writeTimeStep()
+    /// or flush().
+    ///
+    /// \param[in] max_pending Maximum number of time steps queued for, or
+    /// being written by, the output thread.  The default keeps one time
+    /// step being written while the next is queued.
+    ///
+    /// Throws an exception of type std::logic_error if the Schedule is not
+    /// fully loaded.
+    void enableAsyncOutput(std::size_t max_pending = 2);
+
+    /// Wait until all time step output has been written.
+    ///
+    /// No-op unless asynchronous output is enabled.  Rethrows the first
+    /// exception raised by the output thread since the previous call.
+    /// The destructor also writes all pending output, but can only log
+    /// errors.
+    void flush();
+
     /// Activate pre-allocated summary vector slots for newly established
     /// well connections arising from dynamic fracturing.
     ///
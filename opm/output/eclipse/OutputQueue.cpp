@@ -0,0 +1,132 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include <opm/output/eclipse/OutputQueue.hpp>
+
+#include <opm/common/OpmLog/OpmLog.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+Opm::out::OutputQueue::OutputQueue(const std::size_t max_pending)
+    : max_pending_ { std::max(max_pending, std::size_t{1}) }
+    , thread_      { [this]() { this->run(); } }
+{}
+
+Opm::out::OutputQueue::~OutputQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock { this->mutex_ };
+        this->stop_ = true;
+    }
+
+    this->queued_.notify_one();
+    this->thread_.join();
+
+    if (this->error_ != nullptr) {
+        try {
+            std::rethrow_exception(this->error_);
+        }
+        catch (const std::exception& e) {
+            OpmLog::error(std::string { "Asynchronous output failed: " } + e.what());
+        }
+        catch (...) {
+            OpmLog::error("Asynchronous output failed");
+        }
+    }
+}
+
+void Opm::out::OutputQueue::submit(std::function<void()> task)
+{
+    std::unique_lock<std::mutex> lock { this->mutex_ };
+
+    this->done_.wait(lock, [this]()
+    {
+        return (this->error_ != nullptr)
+            || (this->numPending() < this->max_pending_);
+    });
+
+    this->rethrowError();
+
+    this->tasks_.push_back(std::move(task));
+    lock.unlock();
+
+    this->queued_.notify_one();
+}
+
+void Opm::out::OutputQueue::flush()
+{
+    std::unique_lock<std::mutex> lock { this->mutex_ };
+
+    this->done_.wait(lock, [this]() { return this->numPending() == 0; });
+
+    this->rethrowError();
+}
+
+std::size_t Opm::out::OutputQueue::numPending() const
+{
+    return this->tasks_.size() + (this->running_ ? 1 : 0);
+}
+
+void Opm::out::OutputQueue::rethrowError()
+{
+    if (this->error_ != nullptr) {
+        std::rethrow_exception(std::exchange(this->error_, nullptr));
+    }
+}
+
+void Opm::out::OutputQueue::run()
+{
+    std::unique_lock<std::mutex> lock { this->mutex_ };
+
+    while (true) {
+        this->queued_.wait(lock, [this]()
+        { return this->stop_ || !this->tasks_.empty(); });
+
+        if (this->tasks_.empty()) {
+            // Stopped, and no more tasks to run.
+            return;
+        }
+
+        auto task = std::move(this->tasks_.front());
+        this->tasks_.pop_front();
+        this->running_ = true;
+
+        lock.unlock();
+
+        auto error = std::exception_ptr{};
+        try {
+            task();
+        }
+        catch (...) {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+
+        this->running_ = false;
+        if ((error != nullptr) && (this->error_ == nullptr)) {
+            this->error_ = error;
+            this->tasks_.clear();
+        }
+
+        this->done_.notify_all();
+    }
+}
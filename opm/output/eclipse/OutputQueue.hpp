@@ -0,0 +1,87 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef OPM_OUTPUT_QUEUE_HPP
+#define OPM_OUTPUT_QUEUE_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace Opm { namespace out {
+
+/// Runs output tasks, in the order they are submitted, on a background
+/// thread.
+///
+/// Holds at most a fixed number of pending tasks, including the one being
+/// run.  Submitting more blocks the caller until the output thread catches
+/// up.  An exception thrown by a task discards the tasks queued behind it
+/// and is rethrown to the caller by the next call to submit() or flush().
+class OutputQueue
+{
+public:
+    /// Constructor.
+    ///
+    /// \param[in] max_pending Maximum number of pending tasks.  At least
+    /// one.
+    explicit OutputQueue(std::size_t max_pending);
+
+    OutputQueue(const OutputQueue&) = delete;
+    OutputQueue& operator=(const OutputQueue&) = delete;
+
+    /// Destructor.
+    ///
+    /// Runs all pending tasks before returning.  Errors which have not
+    /// been reported to the caller are logged.
+    ~OutputQueue();
+
+    /// Queue task for the output thread.
+    ///
+    /// Blocks while the maximum number of tasks is pending.
+    void submit(std::function<void()> task);
+
+    /// Wait until all submitted tasks have been run.
+    void flush();
+
+private:
+    std::size_t max_pending_;
+
+    std::mutex mutex_{};
+    std::condition_variable queued_{};
+    std::condition_variable done_{};
+
+    std::deque<std::function<void()>> tasks_{};
+    bool running_{false};
+    bool stop_{false};
+    std::exception_ptr error_{};
+
+    std::thread thread_;
+
+    std::size_t numPending() const;
+    void rethrowError();
+    void run();
+};
+
+}} // namespace Opm::out
+
+#endif // OPM_OUTPUT_QUEUE_HPP
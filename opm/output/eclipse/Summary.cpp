@@ -77,6 +77,7 @@
 #include <chrono>
 #include <cstddef>
 #include <ctime>
+#include <deque>
 #include <exception>
 #include <filesystem>
 #include <functional>
@@ -683,7 +684,7 @@ struct fn_args
     const Opm::out::RegionCache& regionCache;
     const Opm::EclipseGrid& grid;
     const Opm::Schedule& schedule;
-    const std::vector<std::pair<std::string, double>> eff_factors{};
+    const std::vector<std::pair<std::string, double>>& eff_factors;
     const Opm::Inplace* initial_inplace{nullptr};
     const Opm::Inplace& inplace;
     const Opm::UnitSystem& unit_system;
@@ -802,13 +803,14 @@ template <>
     return measure::rate;
 }
 
+// Efficiency factor of named well.  The factors are sorted by well name.
 double efac( const std::vector<std::pair<std::string,double>>& eff_factors, const std::string& name)
 {
-    const auto it = std::ranges::find_if(eff_factors,
-                                         [&name](const auto& elem)
-                                         { return elem.first == name; });
+    const auto it = std::ranges::lower_bound(eff_factors, name, std::less<>{},
+                                             [](const auto& elem) -> const std::string&
+                                             { return elem.first; });
 
-    return (it != eff_factors.end()) ? it->second : 1.0;
+    return ((it != eff_factors.end()) && (it->first == name)) ? it->second : 1.0;
 }
 
 inline bool
@@ -4245,38 +4247,48 @@ bool need_wells(const Opm::EclIO::SummaryNode& node)
     };
 }
 
-void updateValue(const Opm::EclIO::SummaryNode& node, const double value, Opm::SummaryState& st)
+Opm::SummaryState::Handle
+resolveValue(const Opm::EclIO::SummaryNode& node, Opm::SummaryState& st)
 {
     using Cat = Opm::EclIO::SummaryNode::Category;
 
     switch (node.category) {
     case Cat::Well:
-        st.update_well_var(node.wgname, node.keyword, value);
-        break;
+        return st.resolve_well_var(node.wgname, node.keyword);
 
     case Cat::Group:
     case Cat::Node:
-        st.update_group_var(node.wgname, node.keyword, node.type, value);
-        break;
+        return st.resolve_group_var(node.wgname, node.keyword, node.type);
 
     case Cat::Connection:
-        st.update_conn_var(node.wgname, node.keyword, node.type, node.number, value);
-        break;
+        return st.resolve_conn_var(node.wgname, node.keyword, node.type, node.number);
 
     case Cat::Segment:
-        st.update_segment_var(node.wgname, node.keyword, node.number, value);
-        break;
+        return st.resolve_segment_var(node.wgname, node.keyword, node.number);
 
     case Cat::Region:
-        st.update_region_var(node.fip_region.value_or("FIPNUM"),
-                             node.keyword.substr(0, 5),
-                             node.number, value);
-        break;
+        return st.resolve_region_var(node.fip_region.value_or("FIPNUM"),
+                                     node.keyword.substr(0, 5),
+                                     node.number);
 
     default:
-        st.update(node.unique_key(), value);
-        break;
+        return st.resolve(node.unique_key());
+    }
+}
+
+// Update summary node's value in summary state.  The handle is resolved on
+// first use, and again only if the summary state's key table changes, so
+// repeated updates do not need to look up the node's string keys.
+void updateValue(const Opm::EclIO::SummaryNode& node,
+                 const double                   value,
+                 Opm::SummaryState::Handle&     handle,
+                 Opm::SummaryState&             st)
+{
+    if (! st.is_valid(handle)) {
+        handle = resolveValue(node, st);
     }
+
+    st.update(handle, value);
 }
 
 /*
@@ -4307,6 +4319,21 @@ struct EfficiencyFactor
                     const std::vector<const Opm::Well*>& schedule_wells,
                     const int                            sim_step,
                     const Opm::data::Wells&              sim_res);
+
+    static bool needFactors(const Opm::EclIO::SummaryNode& node);
+
+    // Product of well's efficiency factor and the efficiency factors of
+    // the groups between the well and the top of the group tree.
+    // Excludes the efficiency scaling factor from the simulator.
+    static double staticFactor(const Opm::EclIO::SummaryNode& node,
+                               const Opm::Schedule&           schedule,
+                               const Opm::Well&               well,
+                               const int                      sim_step);
+
+    static double scalingFactor(const Opm::data::Wells& sim_res,
+                                const std::string&      well);
+
+    static void sortByWellName(FacColl& factors);
 };
 
 void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
@@ -4317,46 +4344,232 @@ void EfficiencyFactor::setFactors(const Opm::EclIO::SummaryNode&       node,
 {
     this->factors.clear();
 
-    const bool is_field  { node.category == Opm::EclIO::SummaryNode::Category::Field  } ;
-    const bool is_group  { node.category == Opm::EclIO::SummaryNode::Category::Group  } ;
-    const bool is_region { node.category == Opm::EclIO::SummaryNode::Category::Region } ;
-    const bool is_rate   { node.type     != Opm::EclIO::SummaryNode::Type::Total      } ;
-
-    if (!is_field && !is_group && !is_region && is_rate)
+    if (! needFactors(node))
         return;
 
     for (const auto* well : schedule_wells) {
         if (!well->hasBeenDefined(sim_step))
             continue;
 
-        const auto res_it = sim_res.find(well->name());
-        double efficiency_scaling_factor = 1.0;
-        if (res_it != sim_res.end()) {
-            efficiency_scaling_factor = res_it->second.efficiency_scaling_factor;
-        }
+        const double eff_factor = staticFactor(node, schedule, *well, sim_step)
+            * scalingFactor(sim_res, well->name());
 
-        double eff_factor = well->getEfficiencyFactor() * efficiency_scaling_factor;
-        const auto* group_ptr = std::addressof(schedule.getGroup(well->groupName(), sim_step));
+        this->factors.emplace_back(well->name(), eff_factor);
+    }
 
-        while (group_ptr) {
-            if (is_group && is_rate && (group_ptr->name() == node.wgname))
-                break;
+    sortByWellName(this->factors);
+}
+
+bool EfficiencyFactor::needFactors(const Opm::EclIO::SummaryNode& node)
+{
+    const bool is_field  { node.category == Opm::EclIO::SummaryNode::Category::Field  } ;
+    const bool is_group  { node.category == Opm::EclIO::SummaryNode::Category::Group  } ;
+    const bool is_region { node.category == Opm::EclIO::SummaryNode::Category::Region } ;
+    const bool is_rate   { node.type     != Opm::EclIO::SummaryNode::Type::Total      } ;
 
-            eff_factor *= group_ptr->getGroupEfficiencyFactor();
+    return is_field || is_group || is_region || !is_rate;
+}
 
-            const auto parent_group = group_ptr->flow_group();
+double EfficiencyFactor::staticFactor(const Opm::EclIO::SummaryNode& node,
+                                      const Opm::Schedule&           schedule,
+                                      const Opm::Well&               well,
+                                      const int                      sim_step)
+{
+    const bool is_group  { node.category == Opm::EclIO::SummaryNode::Category::Group  } ;
+    const bool is_rate   { node.type     != Opm::EclIO::SummaryNode::Type::Total      } ;
 
-            if (parent_group.has_value())
-                group_ptr = std::addressof(schedule.getGroup( parent_group.value(), sim_step ));
-            else
-                group_ptr = nullptr;
-        }
+    double eff_factor = well.getEfficiencyFactor();
+    const auto* group_ptr = std::addressof(schedule.getGroup(well.groupName(), sim_step));
 
-        this->factors.emplace_back(well->name(), eff_factor);
+    while (group_ptr) {
+        if (is_group && is_rate && (group_ptr->name() == node.wgname))
+            break;
+
+        eff_factor *= group_ptr->getGroupEfficiencyFactor();
+
+        const auto parent_group = group_ptr->flow_group();
+
+        if (parent_group.has_value())
+            group_ptr = std::addressof(schedule.getGroup( parent_group.value(), sim_step ));
+        else
+            group_ptr = nullptr;
     }
+
+    return eff_factor;
+}
+
+double EfficiencyFactor::scalingFactor(const Opm::data::Wells& sim_res,
+                                       const std::string&      well)
+{
+    const auto res_it = sim_res.find(well);
+
+    return (res_it != sim_res.end())
+        ? res_it->second.efficiency_scaling_factor
+        : 1.0;
+}
+
+void EfficiencyFactor::sortByWellName(FacColl& factors)
+{
+    std::ranges::sort(factors, std::less<>{},
+                      [](const Factor& factor) -> const std::string&
+                      { return factor.first; });
 }
 
 namespace Evaluator {
+    /// Schedule dependent input to summary node evaluation.
+    ///
+    /// Holds the wells contributing to each summary node, and the static
+    /// parts of those wells' efficiency factors.  These depend only on the
+    /// well and group objects of the current report step, so the plan is
+    /// compiled once and reused for all evaluations until the report step
+    /// changes or the simulator modifies any of those objects--e.g., when
+    /// closing a well.  Modifications are detected through the version
+    /// numbers of the report step's well and group collections.  Nodes
+    /// needing the same wells, like all field level nodes, share a single
+    /// well set.
+    class EvaluationPlan
+    {
+    public:
+        /// Prepare plan for evaluating summary nodes at a particular
+        /// report step.  Invalidates all well set indices if the schedule
+        /// has changed since the previous evaluation.
+        void prepare(const Opm::Schedule& sched, const int sim_step)
+        {
+            const auto& state = sched[sim_step];
+            const auto version = std::pair { state.wells.version(), state.groups.version() };
+
+            if ((sim_step != this->sim_step_) ||
+                (version != this->version_))
+            {
+                this->sim_step_ = sim_step;
+                this->version_ = version;
+                this->setIndex_.clear();
+                this->sets_.clear();
+                ++this->generation_;
+            }
+
+            ++this->evaluation_;
+        }
+
+        /// Plan generation.  Changes whenever the plan is recompiled.
+        std::size_t generation() const
+        {
+            return this->generation_;
+        }
+
+        /// Index of well set of summary node in the current generation.
+        std::size_t wellSet(const Opm::EclIO::SummaryNode& node,
+                            const Opm::Schedule&           sched,
+                            const Opm::out::RegionCache&   reg)
+        {
+            auto key = wellSetKey(node);
+
+            auto pos = this->setIndex_.find(key);
+            if (pos != this->setIndex_.end()) {
+                return pos->second;
+            }
+
+            auto& set = this->sets_.emplace_back();
+
+            if (need_wells(node)) {
+                set.wells = find_wells(sched, node, this->sim_step_, reg);
+            }
+
+            if (EfficiencyFactor::needFactors(node)) {
+                for (const auto* well : set.wells) {
+                    if (! well->hasBeenDefined(this->sim_step_)) {
+                        continue;
+                    }
+
+                    set.factors.emplace_back(well->name(),
+                                             EfficiencyFactor::staticFactor
+                                             (node, sched, *well, this->sim_step_));
+                }
+
+                EfficiencyFactor::sortByWellName(set.factors);
+
+                set.staticFactor.reserve(set.factors.size());
+                for (const auto& factor : set.factors) {
+                    set.staticFactor.push_back(factor.second);
+                }
+            }
+
+            return this->setIndex_.emplace(std::move(key), this->sets_.size() - 1)
+                .first->second;
+        }
+
+        const std::vector<const Opm::Well*>& wells(const std::size_t setIx) const
+        {
+            return this->sets_[setIx].wells;
+        }
+
+        /// Efficiency factors of well set in the current evaluation.
+        const EfficiencyFactor::FacColl&
+        factors(const std::size_t setIx, const Opm::data::Wells& sim_res)
+        {
+            auto& set = this->sets_[setIx];
+
+            if (set.evaluation != this->evaluation_) {
+                for (auto i = 0*set.factors.size(); i < set.factors.size(); ++i) {
+                    set.factors[i].second = set.staticFactor[i] *
+                        EfficiencyFactor::scalingFactor(sim_res, set.factors[i].first);
+                }
+
+                set.evaluation = this->evaluation_;
+            }
+
+            return set.factors;
+        }
+
+    private:
+        struct WellSet
+        {
+            std::vector<const Opm::Well*> wells{};
+            EfficiencyFactor::FacColl factors{};
+            std::vector<double> staticFactor{};
+            std::size_t evaluation{0};
+        };
+
+        int sim_step_{-1};
+        std::pair<std::size_t, std::size_t> version_{};
+        std::size_t generation_{0};
+        std::size_t evaluation_{0};
+
+        std::unordered_map<std::string, std::size_t> setIndex_{};
+        std::deque<WellSet> sets_{};
+
+        // Nodes with equal keys have the same wells and efficiency factors.
+        static std::string wellSetKey(const Opm::EclIO::SummaryNode& node)
+        {
+            using Cat = Opm::EclIO::SummaryNode::Category;
+
+            const auto is_rate = node.type != Opm::EclIO::SummaryNode::Type::Total;
+            const auto wells = need_wells(node);
+
+            switch (node.category) {
+            case Cat::Well:
+            case Cat::Connection:
+            case Cat::Completion:
+            case Cat::Segment:
+                return fmt::format("W:{}:{}:{}:{}", wells, is_rate, node.wgname,
+                                   node.lgr.has_value() ? node.lgr->name : "");
+
+            case Cat::Group:
+                return fmt::format("G:{}:{}:{}", wells, is_rate, node.wgname);
+
+            case Cat::Field:
+                return fmt::format("F:{}", wells);
+
+            case Cat::Region:
+                return fmt::format("R:{}:{}:{}", wells,
+                                   node.fip_region.value_or(""), node.number);
+
+            default:
+                return fmt::format("N:{}", is_rate);
+            }
+        }
+    };
+
     struct InputData
     {
         const Opm::EclipseState& es;
@@ -4364,6 +4577,7 @@ namespace Evaluator {
         const Opm::EclipseGrid& grid;
         const Opm::out::RegionCache& reg;
         const Opm::Inplace* initial_inplace;
+        EvaluationPlan& plan;
     };
 
     struct SimulatorResults
@@ -4427,22 +4641,19 @@ namespace Evaluator {
                 return;
             }
 
-            const auto wells = need_wells(this->node_)
-                ? find_wells(input.sched, this->node_,
-                             static_cast<int>(sim_step), input.reg)
-                : std::vector<const Opm::Well*>{};
-
-            EfficiencyFactor eFac{};
-            eFac.setFactors(this->node_, input.sched, wells, sim_step, simRes.wellSol);
+            if (this->planGeneration_ != input.plan.generation()) {
+                this->wellSet_ = input.plan.wellSet(this->node_, input.sched, input.reg);
+                this->planGeneration_ = input.plan.generation();
+            }
 
             const fn_args args {
-                wells, this->group_name(), this->node_.keyword,
+                input.plan.wells(this->wellSet_), this->group_name(), this->node_.keyword,
                 stepSize, static_cast<int>(sim_step),
                 this->number(), this->node_.fip_region,
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                input.plan.factors(this->wellSet_, simRes.wellSol),
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits(),
                 simRes.rc_rates
@@ -4451,7 +4662,7 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            updateValue(this->node_, usys.from_si(prm.unit, prm.value), this->handle_, st);
         }
 
         void setNumber(const int numValue)
@@ -4476,10 +4687,15 @@ namespace Evaluator {
 
     private:
         Opm::EclIO::SummaryNode node_;
+        mutable Opm::SummaryState::Handle handle_{};
         ofun                    fcn_;
         bool                    use_number_;
         State                   state_;
 
+        // Node's well set in evaluation plan of particular generation.
+        mutable std::size_t     planGeneration_{0};
+        mutable std::size_t     wellSet_{0};
+
         std::string group_name() const
         {
             using Cat = ::Opm::EclIO::SummaryNode::Category;
@@ -4587,7 +4803,7 @@ namespace Evaluator {
                 st,
                 simRes.wellSol, simRes.wbp, simRes.grpNwrkSol,
                 input.reg, input.grid, input.sched,
-                std::move(eFac.factors),
+                eFac.factors,
                 input.initial_inplace, simRes.inplace,
                 input.sched.getUnits(),
                 simRes.rc_rates,
@@ -4598,11 +4814,12 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  prm  = this->fcn_(args);
 
-            updateValue(this->node_, usys.from_si(prm.unit, prm.value), st);
+            updateValue(this->node_, usys.from_si(prm.unit, prm.value), this->handle_, st);
         }
 
     private:
         Opm::EclIO::SummaryNode node_;
+        mutable Opm::SummaryState::Handle handle_{};
         ofun                    fcn_;
     };
 
@@ -4627,11 +4844,12 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            updateValue(this->node_, usys.from_si(this->m_, xPos->second), this->handle_, st);
         }
 
     private:
         Opm::EclIO::SummaryNode  node_;
+        mutable Opm::SummaryState::Handle handle_{};
         Opm::UnitSystem::measure m_;
 
         Opm::out::Summary::DynamicSimulatorState::BlockValues::key_type lookupKey() const
@@ -4688,11 +4906,12 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second), st);
+            updateValue(this->node_, usys.from_si(this->m_, xPos->second), this->handle_, st);
         }
 
     private:
         Opm::EclIO::SummaryNode  node_;
+        mutable Opm::SummaryState::Handle handle_{};
         Opm::UnitSystem::measure m_;
     };
 
@@ -4717,10 +4936,11 @@ namespace Evaluator {
             }
 
             const auto& usys = input.es.getUnits();
-            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), st);
+            updateValue(this->node_, usys.from_si(this->m_, xPos->second.get(this->node_.keyword)), this->handle_, st);
         }
     private:
         Opm::EclIO::SummaryNode  node_;
+        mutable Opm::SummaryState::Handle handle_{};
         Opm::UnitSystem::measure m_;
     };
 
@@ -4760,11 +4980,12 @@ namespace Evaluator {
             const auto  val  = xPos->second[ix];
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            updateValue(this->node_, usys.from_si(this->m_, val), this->handle_, st);
         }
 
     private:
         Opm::EclIO::SummaryNode  node_;
+        mutable Opm::SummaryState::Handle handle_{};
         Opm::UnitSystem::measure m_;
 
         std::vector<double>::size_type index() const
@@ -4810,7 +5031,7 @@ namespace Evaluator {
             const auto& usys = input.es.getUnits();
             const auto  val  = this->getValue(flow->first, flow->second, stepSize);
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            updateValue(this->node_, usys.from_si(this->m_, val), this->handle_, st);
         }
 
     private:
@@ -4819,6 +5040,7 @@ namespace Evaluator {
         using Direction  = RateWindow::Direction;
 
         Opm::EclIO::SummaryNode node_;
+        mutable Opm::SummaryState::Handle handle_{};
         Opm::UnitSystem::measure m_;
         std::string regname_{};
 
@@ -4988,11 +5210,12 @@ namespace Evaluator {
             const auto  val  = xPos->second;
             const auto& usys = input.es.getUnits();
 
-            updateValue(this->node_, usys.from_si(this->m_, val), st);
+            updateValue(this->node_, usys.from_si(this->m_, val), this->handle_, st);
         }
 
     private:
         Opm::EclIO::SummaryNode  node_;
+        mutable Opm::SummaryState::Handle handle_{};
         Opm::UnitSystem::measure m_;
     };
 
@@ -6073,9 +6296,13 @@ private:
     std::vector<MiniStep>::size_type numUnwritten_{0};
 
     SummaryOutputParameters                  outputParameters_{};
+    mutable Evaluator::EvaluationPlan        plan_{};
     std::unordered_map<std::string, EvalPtr> extra_parameters{};
     std::vector<std::string> valueKeys_{};
     std::vector<std::string> valueUnits_{};
+
+    // Summary state handles of valueKeys_, resolved on first use.
+    std::vector<SummaryState::Handle> valueHandles_{};
     std::vector<MiniStep>    unwritten_{};
 
     std::unique_ptr<Opm::EclIO::OutputStream::SummarySpecification> smspec_{};
@@ -6200,7 +6427,19 @@ internal_store(const SummaryState& st,
 
     const auto nParam = this->valueKeys_.size();
 
+    this->valueHandles_.resize(nParam);
+
     for (auto i = decltype(nParam){0}; i < nParam; ++i) {
+        auto& handle = this->valueHandles_[i];
+        if (! st.is_valid(handle)) {
+            handle = st.find(this->valueKeys_[i]);
+        }
+
+        if (st.has(handle)) {
+            ms.params[i] = st.get(handle);
+            continue;
+        }
+
         if (! st.has(this->valueKeys_[i]))
             // Parameter not yet evaluated (e.g., well/group not
             // yet active).  Nothing to do here.
@@ -6239,6 +6478,10 @@ recordNewDynamicWellConns(const DynamicConns& newConns)
                     const auto& [valueKey, ix] = *param;
 
                     this->valueKeys_[ix] = valueKey;
+
+                    if (ix < this->valueHandles_.size()) {
+                        this->valueHandles_[ix] = SummaryState::Handle{};
+                    }
                 }
                 else {
                     OpmLog::warning(
@@ -6274,9 +6517,11 @@ eval(const int                    sim_step,
     st.update("TIMESTEP", this->es_.get().getUnits()
               .from_si(Opm::UnitSystem::measure::time, duration));
 
+    this->plan_.prepare(this->sched_, sim_step);
+
     const Evaluator::InputData input {
         this->es_, this->sched_, this->grid_, this->regCache_,
-        values.inplace.initial
+        values.inplace.initial, this->plan_
     };
 
     const auto& well_solution = (values.well_solution != nullptr)
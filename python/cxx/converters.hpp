@@ -2,6 +2,9 @@
 #define SUNBEAM_CONVERTERS_HPP
 
 #include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 #include <pybind11/pybind11.h>
 #include <pybind11/numpy.h>
 
@@ -48,6 +51,39 @@ py::array_t<T> numpy_array(const std::vector<T>& input) {
     return output;
 }
 
+
+/*
+  Array taking over the elements of input without copying.  The elements
+  are released with the array.
+*/
+template <class T>
+requires (!std::is_same_v<T, bool>)
+py::array_t<T> numpy_array(std::vector<T>&& input) {
+    auto* data = new std::vector<T>(std::move(input));
+    py::capsule owner(data, [](void* ptr) { delete static_cast<std::vector<T>*>(ptr); });
+
+    return py::array_t<T>(data->size(), data->data(), owner);
+}
+
+
+/*
+  Read-only array viewing the elements of input without copying.  The array
+  keeps owner alive, so input must be held by owner and must not be resized
+  or released while owner lives.  Pass copy = true to get a writable copy
+  instead.
+*/
+template <class T>
+requires (!std::is_same_v<T, bool>)
+py::array_t<T> numpy_view(const std::vector<T>& input, py::handle owner, bool copy = false) {
+    if (copy)
+        return numpy_array(input);
+
+    auto output = py::array_t<T>(input.size(), input.data(), owner);
+    output.attr("flags").attr("writeable") = false;
+
+    return output;
+}
+
 }
 
 #endif //SUNBEAM_CONVERTERS_HPP
@@ -30,6 +30,19 @@ namespace {
 using npArray = std::tuple<py::array, Opm::EclIO::eclArrType>;
 using EclEntry = std::tuple<std::string, Opm::EclIO::eclArrType, int64_t>;
 
+/*
+  The numeric arrays of EclFile, ERst, EGrid and ESmry are returned as
+  read-only views of the vectors held by the reader, see convert::numpy_view().
+  The reader objects are bound to Python with their own holder, so the Python
+  object wrapping a reader is found from its address.  Arrays loaded by the
+  readers stay in memory until the reader is destroyed.
+*/
+template <class T>
+py::object owner(T* ptr)
+{
+    return py::cast(ptr, py::return_value_policy::reference);
+}
+
 class ESmryBind {
 
 public:
@@ -70,12 +83,14 @@ public:
             return m_ext_esmry->numberOfTimeSteps();
     }
 
-    py::array get_smry_vector(const std::string& key)
+    // The vector cache capacity is never set here, so vectors returned by
+    // get() are kept by the reader and can be viewed.
+    py::array get_smry_vector(const std::string& key, bool copy)
     {
         if (m_esmry != nullptr)
-            return convert::numpy_array( m_esmry->get(key) );
+            return convert::numpy_view( m_esmry->get(key), owner(this), copy );
         else
-            return convert::numpy_array( m_ext_esmry->get(key) );
+            return convert::numpy_view( m_ext_esmry->get(key), owner(this), copy );
     }
 
     py::array get_smry_vector_at_rsteps(const std::string& key)
@@ -203,18 +218,18 @@ private:
 };
 
 
-npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index)
+npArray get_vector_index(Opm::EclIO::EclFile * file_ptr, std::size_t array_index, bool copy)
 {
     auto array_type = std::get<1>(file_ptr->getList()[array_index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<int>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<int>(array_index), owner(file_ptr), copy), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<float>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<float>(array_index), owner(file_ptr), copy), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->get<double>(array_index)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->get<double>(array_index), owner(file_ptr), copy), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
         return std::make_tuple (convert::numpy_array( file_ptr->get<bool>(array_index)), array_type);
@@ -243,7 +258,7 @@ size_t get_array_index(const std::vector<EclEntry>& array_list, const std::strin
     return std::distance(array_list.begin(), it);
 }
 
-npArray get_vector_name(Opm::EclIO::EclFile * file_ptr, const std::string& array_name)
+npArray get_vector_name(Opm::EclIO::EclFile * file_ptr, const std::string& array_name, bool copy)
 {
     if (file_ptr->hasKey(array_name) == false)
         throw std::logic_error("Array " + array_name + " not found in EclFile");
@@ -251,10 +266,10 @@ npArray get_vector_name(Opm::EclIO::EclFile * file_ptr, const std::string& array
     auto array_list = file_ptr->getList();
     size_t array_index = get_array_index(array_list, array_name, 0);
 
-    return get_vector_index(file_ptr, array_index);
+    return get_vector_index(file_ptr, array_index, copy);
 }
 
-npArray get_vector_occurrence(Opm::EclIO::EclFile * file_ptr, const std::string& array_name, size_t occurrence)
+npArray get_vector_occurrence(Opm::EclIO::EclFile * file_ptr, const std::string& array_name, size_t occurrence, bool copy)
 {
     if (occurrence >= file_ptr->count(array_name) )
         throw std::logic_error("Occurrence " + std::to_string(occurrence) + " not found in EclFile");
@@ -262,7 +277,7 @@ npArray get_vector_occurrence(Opm::EclIO::EclFile * file_ptr, const std::string&
     auto array_list = file_ptr->getList();
     size_t array_index = get_array_index(array_list, array_name, occurrence);
 
-    return get_vector_index(file_ptr, array_index);
+    return get_vector_index(file_ptr, array_index, copy);
 }
 
 bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> keyword)
@@ -271,7 +286,7 @@ bool erst_contains(Opm::EclIO::ERst * file_ptr, std::tuple<std::string, int> key
     return hasKeyAtReport;
 }
 
-npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rstep)
+npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rstep, bool copy)
 {
     auto arrList = file_ptr->listOfRstArrays(rstep);
 
@@ -281,13 +296,13 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
     auto array_type = std::get<1>(arrList[index]);
 
     if (array_type == Opm::EclIO::INTE)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<int>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<int>(index, rstep), owner(file_ptr), copy), array_type);
 
     if (array_type == Opm::EclIO::REAL)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<float>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<float>(index, rstep), owner(file_ptr), copy), array_type);
 
     if (array_type == Opm::EclIO::DOUB)
-        return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<double>(index, rstep)), array_type);
+        return std::make_tuple (convert::numpy_view( file_ptr->getRestartData<double>(index, rstep), owner(file_ptr), copy), array_type);
 
     if (array_type == Opm::EclIO::LOGI)
         return std::make_tuple (convert::numpy_array( file_ptr->getRestartData<bool>(index, rstep)), array_type);
@@ -299,7 +314,7 @@ npArray get_erst_by_index(Opm::EclIO::ERst * file_ptr, size_t index, size_t rste
 }
 
 
-npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, size_t rstep, size_t occurrence)
+npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, size_t rstep, size_t occurrence, bool copy)
 {
     if (occurrence >= static_cast<size_t>(file_ptr->occurrence_count(key, rstep)))
         throw std::out_of_range("file have less than " + std::to_string(occurrence + 1) + " arrays in selected report step");
@@ -308,7 +323,7 @@ npArray get_erst_vector(Opm::EclIO::ERst * file_ptr, const std::string& key, siz
 
     size_t array_index = get_array_index(array_list, key, occurrence);
 
-    return get_erst_by_index(file_ptr, array_index, rstep);
+    return get_erst_by_index(file_ptr, array_index, rstep, copy);
 }
 
 std::tuple<std::array<double,8>, std::array<double,8>, std::array<double,8>>
@@ -377,7 +392,7 @@ py::array get_cellvolumes_mask(Opm::EclIO::EGrid * file_ptr, std::vector<int> ma
         }
     }
 
-    return convert::numpy_array( celvol );
+    return convert::numpy_array( std::move(celvol) );
 }
 
 py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
@@ -388,6 +403,22 @@ py::array get_cellvolumes(Opm::EclIO::EGrid * file_ptr)
     return get_cellvolumes_mask(file_ptr, mask);
 }
 
+py::array get_coord(Opm::EclIO::EGrid * file_ptr, bool copy)
+{
+    if (file_ptr->get_coord().empty())
+        file_ptr->load_grid_data();
+
+    return convert::numpy_view( file_ptr->get_coord(), owner(file_ptr), copy );
+}
+
+py::array get_zcorn(Opm::EclIO::EGrid * file_ptr, bool copy)
+{
+    if (file_ptr->get_zcorn().empty())
+        file_ptr->load_grid_data();
+
+    return convert::numpy_view( file_ptr->get_zcorn(), owner(file_ptr), copy );
+}
+
 npArray get_rft_vector_WellDate(Opm::EclIO::ERft * file_ptr,const std::string& name,
                                   const std::string& well, int y, int m, int d)
 {
@@ -474,9 +505,9 @@ void python::common::export_IO(py::module& m) {
         .def("__contains__", &Opm::EclIO::EclFile::hasKey, py::arg("name"), EclFile_contains_docstring)
         .def("__len__", &Opm::EclIO::EclFile::size, EclFile_len_docstring)
         .def("count", &Opm::EclIO::EclFile::count, py::arg("name"), EclFile_count_docstring)
-        .def("__get_data", &get_vector_index, py::arg("index"), EclFile_get_data_index_docstring)
-        .def("__get_data", &get_vector_name, py::arg("name"), EclFile_get_data_name_docstring)
-        .def("__get_data", &get_vector_occurrence, py::arg("name"), py::arg("occurrence"), EclFile_get_data_occurrence_docstring);
+        .def("__get_data", &get_vector_index, py::arg("index"), py::arg("copy") = false, EclFile_get_data_index_docstring)
+        .def("__get_data", &get_vector_name, py::arg("name"), py::arg("copy") = false, EclFile_get_data_name_docstring)
+        .def("__get_data", &get_vector_occurrence, py::arg("name"), py::arg("occurrence"), py::arg("copy") = false, EclFile_get_data_occurrence_docstring);
 
     py::class_<Opm::EclIO::ERst>(m, "ERst", ERst_docstring)
         .def(py::init<const std::string &>(), py::arg("filename"), ERst_init_docstring)
@@ -490,8 +521,8 @@ void python::common::export_IO(py::module& m) {
                         (Opm::EclIO::ERst::*)(int) ) &Opm::EclIO::ERst::listOfRstArrays, py::arg("report_step"), ERst_arrays_docstring)
         .def("arrays", (std::vector< std::tuple<std::string, Opm::EclIO::eclArrType, int64_t> >
                         (Opm::EclIO::ERst::*)(int, const std::string&) ) &Opm::EclIO::ERst::listOfRstArrays, py::arg("report_step"), py::arg("lgr_name"), ERst_arrays_with_string_docstring)
-        .def("__get_data", &get_erst_by_index, py::arg("index"), py::arg("report_step"), ERst_get_data_by_index_docstring)
-        .def("__get_data", &get_erst_vector, py::arg("name"), py::arg("report_step"), py::arg("occurrence"), ERst_get_data_vector_docstring);
+        .def("__get_data", &get_erst_by_index, py::arg("index"), py::arg("report_step"), py::arg("copy") = false, ERst_get_data_by_index_docstring)
+        .def("__get_data", &get_erst_vector, py::arg("name"), py::arg("report_step"), py::arg("occurrence"), py::arg("copy") = false, ERst_get_data_vector_docstring);
 
 
    py::class_<ESmryBind>(m, "ESmry", ESmry_docstring)
@@ -499,7 +530,7 @@ void python::common::export_IO(py::module& m) {
         .def("__contains__", &ESmryBind::hasKey, py::arg("key"), ESmry_contains_docstring)
         .def("make_esmry_file", &ESmryBind::make_esmry_file, ESmry_make_esmry_file_docstring)
         .def("__len__", &ESmryBind::numberOfTimeSteps, ESmry_len_docstring)
-        .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), ESmry_get_all_docstring)
+        .def("__get_all", &ESmryBind::get_smry_vector, py::arg("key"), py::arg("copy") = false, ESmry_get_all_docstring)
         .def("__get_at_rstep", &ESmryBind::get_smry_vector_at_rsteps, py::arg("key"), ESmry_get_at_rstep_docstring)
         .def("__start_date", &ESmryBind::smry_start_date, ESmry_start_date_docstring)
         .def("keys", (const std::vector<std::string>& (ESmryBind::*) (void) const)
@@ -523,7 +554,9 @@ void python::common::export_IO(py::module& m) {
         .def("xyz_from_active_index", &get_xyz_from_active_index, py::arg("active_index"), EGrid_xyz_from_active_index_docstring)
         .def("xyz_from_active_index", &get_xyz_from_active_index_mapaxes, py::arg("active_index"), py::arg("apply_mapaxes"), EGrid_xyz_from_active_index_mapaxes_docstring)
         .def("cellvolumes", &get_cellvolumes, EGrid_cellvolumes_docstring)
-        .def("cellvolumes", &get_cellvolumes_mask, py::arg("mask"), EGrid_cellvolumes_mask_docstring);
+        .def("cellvolumes", &get_cellvolumes_mask, py::arg("mask"), EGrid_cellvolumes_mask_docstring)
+        .def("coord", &get_coord, py::arg("copy") = false, EGrid_coord_docstring)
+        .def("zcorn", &get_zcorn, py::arg("copy") = false, EGrid_zcorn_docstring);
 
 
  py::class_<Opm::EclIO::ERft>(m, "ERft", ERft_docstring)
@@ -20,16 +20,24 @@ namespace {
         return false;
     }
 
-    py::array_t<double> get_double_array(const FieldPropsManager& m, const std::string& kw) {
+    /*
+      The arrays are read-only views of the data held by the manager, which
+      is owned by the EclipseState the FieldProperties object keeps alive.
+    */
+    py::object owner(const FieldPropsManager& m) {
+        return py::cast(&m, py::return_value_policy::reference);
+    }
+
+    py::array_t<double> get_double_array(const FieldPropsManager& m, const std::string& kw, bool copy) {
         if (m.has_double(kw))
-            return convert::numpy_array( m.get_double(kw) );
+            return convert::numpy_view( m.get_double(kw), owner(m), copy );
         else
             throw std::invalid_argument("Keyword '" + kw + "'is not of type double.");
     }
 
-    py::array_t<int> get_int_array(const FieldPropsManager& m, const std::string& kw) {
+    py::array_t<int> get_int_array(const FieldPropsManager& m, const std::string& kw, bool copy) {
         if (m.has_int(kw))
-            return convert::numpy_array( m.get_int(kw) );
+            return convert::numpy_view( m.get_int(kw), owner(m), copy );
         else
             throw std::invalid_argument("Keyword '" + kw + "'is not of type int.");
     }
@@ -37,10 +45,10 @@ namespace {
 
     py::array get_array(const FieldPropsManager& m, const std::string& kw) {
         if (m.has_double(kw))
-            return convert::numpy_array(m.get_double(kw));
+            return convert::numpy_view(m.get_double(kw), owner(m));
 
         if (m.has_int(kw))
-            return convert::numpy_array(m.get_int(kw));
+            return convert::numpy_view(m.get_int(kw), owner(m));
 
         throw std::invalid_argument("No such keyword: " + kw);
     }
@@ -56,8 +64,8 @@ void python::common::export_FieldProperties(py::module& module) {
     py::class_< FieldPropsManager >( module, "FieldProperties", FieldProperties_docstring)
     .def( "__contains__", &contains, py::arg("keyword"), FieldProperties_contains_docstring)
     .def("__getitem__", &get_array, py::arg("keyword"), FieldProperties_getitem_docstring)
-    .def( "get_double_array",  &get_double_array, py::arg("keyword"), FieldProperties_get_double_array_docstring)
-    .def( "get_int_array",  &get_int_array, py::arg("keyword"), FieldProperties_get_int_array_docstring)
+    .def( "get_double_array",  &get_double_array, py::arg("keyword"), py::arg("copy") = false, FieldProperties_get_double_array_docstring)
+    .def( "get_int_array",  &get_int_array, py::arg("keyword"), py::arg("copy") = false, FieldProperties_get_int_array_docstring)
     ;
 
 }
@@ -2512,6 +2512,7 @@ class EGrid:
     def cellvolumes(self) -> numpy.ndarray: ...
     @overload
     def cellvolumes(self, mask: List[int]) -> numpy.ndarray: ...
+    def coord(self, copy: bool = ...) -> numpy.ndarray[numpy.float32]: ...
     def export_mapaxes(self) -> List[float[6]]: ...
     def global_index(self, i: int, j: int, k: int) -> int: ...
     def ijk_from_active_index(self, active_index: int) -> List[int[3]]: ...
@@ -2524,6 +2525,7 @@ class EGrid:
     def xyz_from_ijk(self, i: int, j: int, k: int) -> Tuple[List[float[8]],List[float[8]],List[float[8]]]: ...
     @overload
     def xyz_from_ijk(self, i: int, j: int, k: int, apply_mapaxes: bool) -> Tuple[List[float[8]],List[float[8]],List[float[8]]]: ...
+    def zcorn(self, copy: bool = ...) -> numpy.ndarray[numpy.float32]: ...
     @property
     def active_cells(self) -> int: ...
     @property
@@ -2575,9 +2577,9 @@ class ERst:
     def __init__(self, filename: str) -> None: ...
     def __contains(self, tuple: Tuple[str,int]) -> bool: ...
     @overload
-    def __get_data(self, index: int, report_step: int) -> Tuple[numpy.ndarray,eclArrType]: ...
+    def __get_data(self, index: int, report_step: int, copy: bool = ...) -> Tuple[numpy.ndarray,eclArrType]: ...
     @overload
-    def __get_data(self, name: str, report_step: int, occurrence: int) -> Tuple[numpy.ndarray,eclArrType]: ...
+    def __get_data(self, name: str, report_step: int, occurrence: int, copy: bool = ...) -> Tuple[numpy.ndarray,eclArrType]: ...
     def __has_report_step(self, report_step: int) -> bool: ...
     @overload
     def arrays(self, report_step: int) -> List[Tuple[str,eclArrType,int]]: ...
@@ -2591,7 +2593,7 @@ class ERst:
 
 class ESmry:
     def __init__(self, filename: str, load_base_run: bool = ...) -> None: ...
-    def __get_all(self, key: str) -> numpy.ndarray: ...
+    def __get_all(self, key: str, copy: bool = ...) -> numpy.ndarray: ...
     def __get_at_rstep(self, key: str) -> numpy.ndarray: ...
     def __start_date(self) -> Tuple[int,int,int,int,int,int,bool]: ...
     def dates(self) -> List[datetime.datetime]: ...
@@ -2607,11 +2609,11 @@ class ESmry:
 class EclFile:
     def __init__(self, filename: str, preload: bool = ...) -> None: ...
     @overload
-    def __get_data(self, index: int) -> Tuple[numpy.ndarray,eclArrType]: ...
+    def __get_data(self, index: int, copy: bool = ...) -> Tuple[numpy.ndarray,eclArrType]: ...
     @overload
-    def __get_data(self, name: str) -> Tuple[numpy.ndarray,eclArrType]: ...
+    def __get_data(self, name: str, copy: bool = ...) -> Tuple[numpy.ndarray,eclArrType]: ...
     @overload
-    def __get_data(self, name: str, occurrence: int) -> Tuple[numpy.ndarray,eclArrType]: ...
+    def __get_data(self, name: str, occurrence: int, copy: bool = ...) -> Tuple[numpy.ndarray,eclArrType]: ...
     def count(self, name: str) -> int: ...
     def __contains__(self, name: str) -> bool: ...
     def __len__(self) -> int: ...
@@ -2681,8 +2683,8 @@ class EclipseState:
 
 class FieldProperties:
     def __init__(self, *args, **kwargs) -> None: ...
-    def get_double_array(self, keyword: str) -> numpy.ndarray[numpy.float64]: ...
-    def get_int_array(self, keyword: str) -> numpy.ndarray[numpy.int32]: ...
+    def get_double_array(self, keyword: str, copy: bool = ...) -> numpy.ndarray[numpy.float64]: ...
+    def get_int_array(self, keyword: str, copy: bool = ...) -> numpy.ndarray[numpy.int32]: ...
     def __contains__(self, keyword: str) -> bool: ...
     def __getitem__(self, keyword: str) -> numpy.ndarray: ...
 
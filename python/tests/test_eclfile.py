@@ -186,6 +186,27 @@ class TestEclFile(unittest.TestCase):
         self.assertEqual(file1.count("PRESSURE"), 2)
         self.assertEqual(file1.count("XXXX"), 0)
 
+    def test_array_views(self):
+
+        file1 = EclFile(test_path("data/SPE9.UNRST"))
+
+        pres = file1["PRESSURE", 1]
+        self.assertFalse(pres.flags.writeable)
+
+        with self.assertRaises(ValueError):
+            pres[0] = 0.0
+
+        pres_copy, _ = getattr(file1, "__get_data")("PRESSURE", 1, copy=True)
+        self.assertTrue(pres_copy.flags.writeable)
+        self.assertTrue(np.array_equal(pres, pres_copy))
+
+        pres_copy[0] = 0.0
+        self.assertNotEqual(pres[0], 0.0)
+
+        # The view keeps the file object alive.
+        del file1
+        self.assertTrue(np.array_equal(pres[1:], pres_copy[1:]))
+
 
 if __name__ == "__main__":
 
@@ -140,6 +140,29 @@ class TestEGrid(unittest.TestCase):
         self.assertTrue(min(celVol) == 0.0)
         self.assertEqual(np.count_nonzero(celVol), nK)
 
+    def test_coord_zcorn(self):
+
+        grid1 = EGrid(test_path("data/9_EDITNNC.EGRID"))
+
+        nI, nJ, nK = grid1.dimension
+
+        coord = grid1.coord()
+        zcorn = grid1.zcorn()
+
+        self.assertEqual(len(coord), (nI + 1) * (nJ + 1) * 6)
+        self.assertEqual(len(zcorn), nI * nJ * nK * 8)
+        self.assertFalse(coord.flags.writeable)
+        self.assertFalse(zcorn.flags.writeable)
+
+        zcorn_copy = grid1.zcorn(copy=True)
+        self.assertTrue(zcorn_copy.flags.writeable)
+
+        X, Y, Z = grid1.xyz_from_ijk(0, 0, 0)
+        self.assertAlmostEqual(Z[0], zcorn[0], places=3)
+
+        del grid1
+        self.assertTrue(np.array_equal(zcorn, zcorn_copy))
+
 
 if __name__ == "__main__":
 
@@ -228,6 +228,19 @@ class TestEclFile(unittest.TestCase):
             self.assertEqual(key, ref)
 
 
+    def test_vector_views(self):
+
+        smry1 = ESmry(test_path("data/SPE1CASE1.SMSPEC"))
+
+        time = smry1["TIME"]
+        self.assertFalse(time.flags.writeable)
+
+        time_copy = getattr(smry1, "__get_all")("TIME", copy=True)
+        self.assertTrue(time_copy.flags.writeable)
+
+        del smry1
+        self.assertTrue(np.array_equal(time, time_copy))
+
 
 if __name__ == "__main__":
 
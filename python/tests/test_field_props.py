@@ -47,6 +47,23 @@ class TestFieldProps(unittest.TestCase):
         self.assertEqual(324, len(px))
         self.assertEqual(324, len(p.get_int_array('ACTNUM')))
 
+    def test_array_views(self):
+        p = self.props
+        poro = p['PORO']
+        self.assertFalse(poro.flags.writeable)
+        with self.assertRaises(ValueError):
+            poro[0] = 0.0
+
+        poro_copy = p.get_double_array('PORO', copy=True)
+        self.assertTrue(poro_copy.flags.writeable)
+        poro_copy[0] = 0.0
+        self.assertEqual(0.13, p.get_double_array('PORO')[0])
+
+        del p
+        del self.props
+        del self.spe3
+        self.assertEqual(0.13, poro[0])
+
     def test_permx_values(self):
         def md2si(md):
             #millidarcy->SI
@@ -37,6 +37,8 @@
 //#include <opm/material/fluidsystems/blackoilpvt/Co2GasPvt.hpp>
 //#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
 
+#include <opm/material/fluidsystems/blackoilpvt/BrineCo2Pvt.hpp>
+#include <opm/material/fluidsystems/blackoilpvt/BrineH2Pvt.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/GasPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/OilPvtMultiplexer.hpp>
 #include <opm/material/fluidsystems/blackoilpvt/WaterPvtMultiplexer.hpp>
@@ -51,6 +53,7 @@
 #include <opm/input/eclipse/Schedule/Schedule.hpp>
 
 #include <iostream>
+#include <vector>
 
 // values of strings based on the first SPE1 test case of opm-data.  note that in the
 // real world it does not make much sense to specify a fluid phase using more than a
@@ -278,3 +281,58 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Water, Scalar, Types)
     ensurePvtApiGas<Scalar>(co2Pvt);
     ensurePvtApiBrine<Eval>(brinePvt);
 }
+
+template <class BrinePvt>
+void checkTabulatedSaturatedProperties(const BrinePvt& analytic)
+{
+    using Eval = Opm::DenseAd::Evaluation<double,2>;
+
+    Opm::SaturatedBrineTables<double>::Options options;
+    options.minTemperature = 273.15 + 30.0;
+    options.maxTemperature = 273.15 + 90.0;
+    options.minPressure = 50.0e5;
+    options.maxPressure = 300.0e5;
+    options.tolerance = 1.0e-3;
+    options.maxPoints = 129;
+
+    BrinePvt tabulated = analytic;
+    BOOST_CHECK(!tabulated.hasSaturatedTables());
+    tabulated.tabulateSaturatedProperties(options);
+    BOOST_CHECK(tabulated.hasSaturatedTables());
+    BOOST_CHECK_LE(tabulated.saturatedTables(0).maxError(), options.tolerance);
+
+    for (int i = 0; i <= 10; ++i) {
+        for (int j = 0; j <= 10; ++j) {
+            const Eval T = Eval::createVariable(options.minTemperature + 5.93 * i, 0);
+            const Eval p = Eval::createVariable(options.minPressure + 2.47e5 * j, 1);
+
+            const Eval rs = tabulated.saturatedGasDissolutionFactor(0u, T, p);
+            const Eval invB = tabulated.saturatedInverseFormationVolumeFactor(0u, T, p);
+            const Eval mu = tabulated.saturatedViscosity(0u, T, p);
+
+            // midpoint errors estimate, but do not bound, the interpolation error
+            BOOST_CHECK_CLOSE(rs.value(), analytic.saturatedGasDissolutionFactor(0u, T, p).value(), 0.5);
+            BOOST_CHECK_CLOSE(invB.value(), analytic.saturatedInverseFormationVolumeFactor(0u, T, p).value(), 0.5);
+            BOOST_CHECK_CLOSE(mu.value(), analytic.saturatedViscosity(0u, T, p).value(), 0.5);
+
+            // pressure derivative from the table
+            BOOST_CHECK_GT(rs.derivative(1), 0.0);
+        }
+    }
+
+    // outside the tables the analytic model is used
+    const Eval T = 273.15 + 120.0;
+    const Eval p = 400.0e5;
+    BOOST_CHECK_EQUAL(tabulated.saturatedGasDissolutionFactor(0u, T, p).value(),
+                      analytic.saturatedGasDissolutionFactor(0u, T, p).value());
+    BOOST_CHECK_EQUAL(tabulated.saturatedInverseFormationVolumeFactor(0u, T, p).value(),
+                      analytic.saturatedInverseFormationVolumeFactor(0u, T, p).value());
+}
+
+BOOST_AUTO_TEST_CASE(TabulatedSaturatedProperties)
+{
+    const std::vector<double> salinity { 0.1 };
+
+    checkTabulatedSaturatedProperties(Opm::BrineCo2Pvt<double>(salinity));
+    checkTabulatedSaturatedProperties(Opm::BrineH2Pvt<double>(salinity));
+}
@@ -36,6 +36,7 @@
 #include <boost/test/unit_test.hpp>
 
 #include <opm/material/fluidmatrixinteractions/EclEpsGridProperties.hpp>
+#include <opm/material/fluidmatrixinteractions/EclMaterialLawDenseParams.hpp>
 #include <opm/material/fluidmatrixinteractions/EclMaterialLawManager.hpp>
 #include <opm/material/fluidstates/SimpleModularFluidState.hpp>
 
@@ -45,6 +46,10 @@
 #include <opm/input/eclipse/EclipseState/Grid/EclipseGrid.hpp>
 
 #include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
 
 // values of strings taken from the SPE1 test case1 of opm-data
 static constexpr const char* fam1DeckString =
@@ -568,6 +573,79 @@ static constexpr const char* fam2DeckStringGasWater =
     "0.55   0.005  0\n"
     "0.88   0.984  0 /\n";
 
+// Two saturation regions with per-cell end point scaling.  The three-phase
+// model keyword is inserted between the two parts.
+static constexpr const char* denseDeckStringHead =
+    "RUNSPEC\n"
+    "\n"
+    "DIMENS\n"
+    "   10 10 3 /\n"
+    "\n"
+    "TABDIMS\n"
+    "   2 /\n"
+    "\n"
+    "OIL\n"
+    "GAS\n"
+    "WATER\n"
+    "\n"
+    "FIELD\n"
+    "\n"
+    "ENDSCALE\n"
+    "/\n"
+    "\n"
+    "GRID\n"
+    "\n"
+    "DX\n"
+    "       300*1000 /\n"
+    "DY\n"
+    "   300*1000 /\n"
+    "DZ\n"
+    "   100*20 100*30 100*50 /\n"
+    "\n"
+    "TOPS\n"
+    "   100*8325 /\n"
+    "\n"
+    "PORO\n"
+    "  300*0.15 /\n"
+    "\n"
+    "PROPS\n"
+    "\n"
+    "SWOF\n"
+    "0.12  0     1    4.0\n"
+    "0.3   0.05  0.6  2.0\n"
+    "0.6   0.3   0.1  0.5\n"
+    "0.9   0.7   0    0.1\n"
+    "1.0   1.0   0    0 /\n"
+    "0.2   0     1    3.0\n"
+    "0.5   0.2   0.3  1.0\n"
+    "0.8   0.6   0    0.2\n"
+    "1.0   0.9   0    0 /\n"
+    "\n"
+    "SGOF\n"
+    "0     0     1    0\n"
+    "0.2   0.1   0.5  0.1\n"
+    "0.5   0.4   0.1  0.3\n"
+    "0.88  0.9   0    0.6 /\n"
+    "0     0     1    0\n"
+    "0.3   0.2   0.3  0.2\n"
+    "0.8   0.8   0    0.5 /\n"
+    "\n"
+    "SWL\n"
+    "   100*0.12 100*0.15 100*0.22 /\n"
+    "\n"
+    "KRW\n"
+    "   150*0.8 150*0.95 /\n"
+    "\n"
+    "PCW\n"
+    "   100*3 100*5 100*6 /\n"
+    "\n";
+
+static constexpr const char* denseDeckStringTail =
+    "REGIONS\n"
+    "\n"
+    "SATNUM\n"
+    "   150*1 150*2 /\n";
+
 template <class Scalar>
 inline Scalar computeLetCurve(const Scalar S, const Scalar L, const Scalar E, const Scalar T)
 {
@@ -965,3 +1043,93 @@ BOOST_AUTO_TEST_CASE_TEMPLATE(Let, Scalar, Types)
         }
     }
 }
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(DenseParamsBatch, Scalar, Types)
+{
+    using MaterialLaw = typename Fixture<Scalar>::MaterialLaw;
+    using MaterialLawManager = typename Fixture<Scalar>::MaterialLawManager;
+    using DenseParams = Opm::EclMaterialLaw::DenseParams<typename Fixture<Scalar>::MaterialTraits>;
+    using SatArray = std::array<Scalar, Fixture<Scalar>::numPhases>;
+
+    Opm::Parser parser;
+
+    {
+        const auto hysterDeck = parser.parseString(hysterDeckString);
+        const Opm::EclipseState hysterEclState(hysterDeck);
+        const std::size_t n = hysterEclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager hysterMaterialLawManager;
+        hysterMaterialLawManager.initFromState(hysterEclState);
+        hysterMaterialLawManager.initParamsForElements(hysterEclState, n, doOldLookup, doNothing);
+
+        BOOST_CHECK(!DenseParams::supports(hysterMaterialLawManager));
+        BOOST_CHECK_THROW(DenseParams(hysterMaterialLawManager, n), std::invalid_argument);
+    }
+
+    for (const std::string threePhaseModel : { "", "STONE1\n\n", "STONE2\n\n" }) {
+        const auto deck = parser.parseString(std::string(denseDeckStringHead) +
+                                             threePhaseModel + denseDeckStringTail);
+        const Opm::EclipseState eclState(deck);
+        const std::size_t n = eclState.getInputGrid().getCartesianSize();
+
+        MaterialLawManager materialLawManager;
+        materialLawManager.initFromState(eclState);
+        materialLawManager.initParamsForElements(eclState, n, doOldLookup, doNothing);
+
+        BOOST_CHECK(materialLawManager.enableEndPointScaling());
+        BOOST_CHECK(DenseParams::supports(materialLawManager));
+
+        const DenseParams denseParams(materialLawManager, n);
+        BOOST_CHECK_EQUAL(denseParams.numElements(), n);
+        BOOST_CHECK(denseParams.allocatedBytes() > 0);
+
+        std::vector<SatArray> saturations(n);
+        std::vector<SatArray> kr(n);
+        std::vector<SatArray> pc(n);
+
+        for (int i = 0; i <= 20; ++i) {
+            const Scalar Sw = Scalar(i) / 20;
+            for (int j = 0; i + j <= 20; ++j) {
+                const Scalar Sg = Scalar(j) / 20;
+
+                for (std::size_t elemIdx = 0; elemIdx < n; ++elemIdx) {
+                    saturations[elemIdx][Fixture<Scalar>::waterPhaseIdx] = Sw;
+                    saturations[elemIdx][Fixture<Scalar>::oilPhaseIdx] = 1 - Sw - Sg;
+                    saturations[elemIdx][Fixture<Scalar>::gasPhaseIdx] = Sg;
+                }
+
+                // evaluate in two batches to cover a non-zero first cell
+                const auto half = n / 2;
+                const std::span<const SatArray> sat(saturations);
+                denseParams.template relativePermeabilities<Scalar>(0, sat.first(half),
+                                                                    std::span(kr).first(half));
+                denseParams.template relativePermeabilities<Scalar>(half, sat.subspan(half),
+                                                                    std::span(kr).subspan(half));
+                denseParams.template capillaryPressures<Scalar>(0, sat, pc);
+
+                for (unsigned elemIdx = 0; elemIdx < n; ++elemIdx) {
+                    typename Fixture<Scalar>::FluidState fs;
+                    for (unsigned phaseIdx = 0; phaseIdx < Fixture<Scalar>::numPhases; ++phaseIdx) {
+                        fs.setSaturation(phaseIdx, saturations[elemIdx][phaseIdx]);
+                    }
+
+                    SatArray krRef{};
+                    SatArray pcRef{};
+                    MaterialLaw::relativePermeabilities(krRef,
+                                                        materialLawManager.materialLawParams(elemIdx),
+                                                        fs);
+                    MaterialLaw::capillaryPressures(pcRef,
+                                                    materialLawManager.materialLawParams(elemIdx),
+                                                    fs);
+
+                    for (unsigned phaseIdx = 0; phaseIdx < Fixture<Scalar>::numPhases; ++phaseIdx) {
+                        BOOST_CHECK_MESSAGE(std::abs(kr[elemIdx][phaseIdx] - krRef[phaseIdx]) <= 1e-6,
+                                            "Discrepancy between dense and per-cell relative permeabilities");
+                        BOOST_CHECK_MESSAGE(std::abs(pc[elemIdx][phaseIdx] - pcRef[phaseIdx]) <= 1e-6 * (1 + std::abs(pcRef[phaseIdx])),
+                                            "Discrepancy between dense and per-cell capillary pressures");
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,148 @@
+// -*- mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*-
+// vi: set et ts=4 sw=4 sts=4:
+/*
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 2 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+
+  Consult the COPYING file in the top-level source directory of this
+  module for the precise wording of the license and the list of
+  copyright holders.
+*/
+/*!
+ * \file
+ *
+ * \brief Unit test for the segment search and batched evaluation of
+ *        Tabulated1DFunction.
+ */
+#include "config.h"
+
+#include <boost/mpl/list.hpp>
+
+#define BOOST_TEST_MODULE Tabulated1DFunction
+#include <boost/test/unit_test.hpp>
+
+#include <opm/material/common/Tabulated1DFunction.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <span>
+#include <vector>
+
+namespace {
+
+// Non-uniformly spaced sampling points, including a repeated x value.
+template <class Scalar>
+Opm::Tabulated1DFunction<Scalar> makeTable(std::size_t n)
+{
+    std::vector<Scalar> x(n), y(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const Scalar t = Scalar(i)/(n - 1);
+        x[i] = 100*t*t*t + t;
+        y[i] = std::sin(Scalar(5)*t);
+    }
+    x[n/2] = x[n/2 - 1];
+
+    return { x, y, /*sortInputs=*/false };
+}
+
+// Reference segment search: the segment selected by the bisection.
+template <class Scalar>
+std::size_t referenceSegment(const Opm::Tabulated1DFunction<Scalar>& f, Scalar x)
+{
+    const std::size_t n = f.numSamples();
+    if (x <= f.xAt(1))
+        return 0;
+    if (x >= f.xAt(n - 2))
+        return n - 2;
+
+    std::size_t i = 1;
+    while (f.xAt(i + 1) <= x)
+        ++i;
+    return i;
+}
+
+// Positions with locality: a slow random walk with occasional jumps,
+// extending beyond the range of the table.
+template <class Scalar>
+std::vector<Scalar> makePositions(const Opm::Tabulated1DFunction<Scalar>& f)
+{
+    std::mt19937 gen(42);
+    const Scalar lo = f.xMin() - 5;
+    const Scalar hi = f.xMax() + 5;
+    std::uniform_real_distribution<Scalar> jump(lo, hi);
+    std::normal_distribution<Scalar> step(0, (hi - lo)/1000);
+
+    std::vector<Scalar> x(5000);
+    Scalar pos = jump(gen);
+    for (auto& xi : x) {
+        pos = (gen() % 50 == 0) ? jump(gen) : std::clamp(pos + step(gen), lo, hi);
+        xi = pos;
+    }
+
+    // Sampling points exactly, where neighbouring segments meet.
+    for (std::size_t i = 0; i < f.numSamples(); ++i)
+        x.push_back(f.xAt(i));
+
+    return x;
+}
+
+} // Anonymous namespace
+
+using Types = boost::mpl::list<float,double>;
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(SegmentSearch, Scalar, Types)
+{
+    // Small tables are searched by plain bisection, large tables use
+    // buckets to narrow the bisection.
+    for (const std::size_t n : {4, 10, 200, 5000}) {
+        const auto f = makeTable<Scalar>(n);
+        const auto x = makePositions(f);
+
+        Opm::SegmentIndex hint{0};
+        for (const auto xi : x) {
+            const auto expect = referenceSegment(f, xi);
+            BOOST_CHECK_EQUAL(f.findSegmentIndex(xi, /*extrapolate=*/true).value, expect);
+
+            hint = f.findSegmentIndex(xi, hint, /*extrapolate=*/true);
+            BOOST_CHECK_EQUAL(hint.value, expect);
+        }
+
+        // Hints out of range
+        BOOST_CHECK_EQUAL(f.findSegmentIndex(f.xMax(), Opm::SegmentIndex{n + 10}).value,
+                          f.numSamples() - 2);
+    }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(BatchedEval, Scalar, Types)
+{
+    for (const std::size_t n : {4, 200}) {
+        const auto f = makeTable<Scalar>(n);
+        const auto x = makePositions(f);
+
+        std::vector<Scalar> y(x.size());
+        f.eval(std::span<const Scalar>(x), std::span<Scalar>(y), /*extrapolate=*/true);
+
+        for (std::size_t i = 0; i < x.size(); ++i)
+            BOOST_CHECK_EQUAL(y[i], f.eval(x[i], /*extrapolate=*/true));
+    }
+
+    const auto f = makeTable<Scalar>(10);
+    const std::vector<Scalar> outside { f.xMin(), f.xMax() + 1 };
+    std::vector<Scalar> y(outside.size());
+    BOOST_CHECK_THROW(f.eval(std::span<const Scalar>(outside), std::span<Scalar>(y)),
+                      std::logic_error);
+}
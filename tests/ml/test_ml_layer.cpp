@@ -196,3 +196,120 @@ BOOST_AUTO_TEST_CASE(NNLayerDenseApply)
     };
     check_vector_close(out, expected);
 }
+
+BOOST_AUTO_TEST_CASE(NNLayerDenseApplyBatch)
+{
+    using Opm::ML::Tensor;
+    using Opm::ML::NNLayerDense;
+    using Opm::ML::NNWorkspace;
+
+    // Dense: 3 outputs, 4 inputs
+    Tensor<float> W(4,3);
+    for (int i = 0; i < 4; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            W(i,j) = 0.25f*(i + 1) - 0.5f*j;
+        }
+    }
+
+    Tensor<float> b(3);
+    b(0) = 0.5; b(1) = -1.0; b(2) = 0.25;
+
+    NNLayerDense<double> layer(W, b, ActivationType::kTanh);
+    NNWorkspace<double> workspace;
+
+    const int batch_size = 5;
+    Tensor<double> in(batch_size, 4);
+    for (std::size_t k = 0; k < in.data_.size(); ++k) {
+        in.data_[k] = 0.1*k - 0.8;
+    }
+
+    Tensor<double> out;
+    BOOST_REQUIRE(layer.applyBatch(in, out, workspace));
+    BOOST_REQUIRE_EQUAL(out.dims_.size(), 2u);
+    BOOST_REQUIRE_EQUAL(out.dims_[0], batch_size);
+    BOOST_REQUIRE_EQUAL(out.dims_[1], 3);
+
+    for (int r = 0; r < batch_size; ++r) {
+        Tensor<double> sample(4), expected;
+        for (int i = 0; i < 4; ++i) {
+            sample(i) = in(r, i);
+        }
+        BOOST_REQUIRE(layer.apply(sample, expected));
+
+        for (int j = 0; j < 3; ++j) {
+            BOOST_CHECK_CLOSE(out(r, j), expected(j), 1e-10);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NNLayerDenseApplyBatchDerivatives)
+{
+    using Eval = Opm::DenseAd::Evaluation<double, 2>;
+    using Opm::ML::Tensor;
+    using Opm::ML::NNLayerDense;
+    using Opm::ML::NNWorkspace;
+
+    // Dense: 2 outputs, 3 inputs
+    Tensor<float> W(3,2);
+    W(0,0) = 1.0; W(0,1) = 4.0;
+    W(1,0) = 2.0; W(1,1) = 5.0;
+    W(2,0) = 3.0; W(2,1) = 6.0;
+
+    Tensor<float> b(2);
+    b(0) = 0.5; b(1) = -1.0;
+
+    NNLayerDense<Eval> layer(W, b, ActivationType::kSigmoid);
+    NNWorkspace<Eval> workspace;
+
+    const int batch_size = 3;
+    Tensor<Eval> in(batch_size, 3);
+    for (int r = 0; r < batch_size; ++r) {
+        for (int i = 0; i < 3; ++i) {
+            Eval x = 0.2*r - 0.3*i;
+            x.setDerivative(0, 1.0 + i);
+            x.setDerivative(1, 0.5*r - 1.0);
+            in(r, i) = x;
+        }
+    }
+
+    Tensor<Eval> out;
+    BOOST_REQUIRE(layer.applyBatch(in, out, workspace));
+    BOOST_REQUIRE_EQUAL(out.dims_[0], batch_size);
+    BOOST_REQUIRE_EQUAL(out.dims_[1], 2);
+
+    for (int r = 0; r < batch_size; ++r) {
+        Tensor<Eval> sample(3), expected;
+        for (int i = 0; i < 3; ++i) {
+            sample(i) = in(r, i);
+        }
+        BOOST_REQUIRE(layer.apply(sample, expected));
+
+        for (int j = 0; j < 2; ++j) {
+            BOOST_CHECK_CLOSE(out(r, j).value(), expected(j).value(), 1e-10);
+            BOOST_CHECK_CLOSE(out(r, j).derivative(0), expected(j).derivative(0), 1e-10);
+            BOOST_CHECK_CLOSE(out(r, j).derivative(1), expected(j).derivative(1), 1e-10);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(NNLayerScalingApplyBatch)
+{
+    using Opm::ML::Tensor;
+    using Opm::ML::NNLayerScaling;
+    using Opm::ML::NNWorkspace;
+
+    NNLayerScaling<float> layer(0.f, 2.f, 1.f, 2.f);
+    NNWorkspace<float> workspace;
+
+    Tensor<float> in(2, 3);
+    in.data_ = {-1.0f, 0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+
+    Tensor<float> out;
+    BOOST_REQUIRE(layer.applyBatch(in, out, workspace));
+    BOOST_REQUIRE_EQUAL(out.dims_.size(), 2u);
+
+    const std::vector<double> expected = {0.5, 1.0, 1.5, 2.0, 2.5, 3.0};
+    for (std::size_t k = 0; k < expected.size(); ++k) {
+        BOOST_CHECK_CLOSE(out.data_[k], expected[k], 1e-5);
+    }
+}
@@ -36,6 +36,8 @@
 #include <tests/ml/ml_tools/include/test_scalingdense_10x1.hpp>
 
 #include <cstdio>
+#include <filesystem>
+#include <string>
 
 #include <fmt/format.h>
 
@@ -177,6 +179,59 @@ bool tensor_test()
     return true;
 }
 
+template <class Evaluation>
+bool batch_test(const std::string& model_name, const int num_in)
+{
+    std::printf("TEST batch_test %s\n", model_name.c_str());
+
+    NNModel<Evaluation> model;
+    OPM_ERROR_IF(!model.loadModel(std::filesystem::current_path() / "ml/ml_tools/models" / model_name),
+                 "Failed to load model");
+
+    const int batch_size = 7;
+    Tensor<Evaluation> in(batch_size, num_in);
+    for (int r = 0; r < batch_size; r++) {
+        for (int i = 0; i < num_in; i++) {
+            Evaluation x = 0.1 * (r - 3) + 0.05 * i;
+            x.setDerivative(0, 1.0 - 0.1 * i);
+            in(r, i) = x;
+        }
+    }
+
+    // Apply twice to check that reusing the workspace gives the same result
+    Tensor<Evaluation> out;
+    for (int pass = 0; pass < 2; pass++) {
+        OPM_ERROR_IF(!model.applyBatch(in, out), "Failed to apply batch");
+
+        for (int r = 0; r < batch_size; r++) {
+            Tensor<Evaluation> sample(num_in), predict;
+            for (int i = 0; i < num_in; i++) {
+                sample(i) = in(r, i);
+            }
+            OPM_ERROR_IF(!model.apply(sample, predict), "Failed to apply");
+
+            for (int j = 0; j < out.dims_[1]; j++) {
+                OPM_ERROR_IF(fabs(out(r, j).value() - predict(j).value()) > 1e-9,
+                             fmt::format("\n Expected "
+                                         "{}"
+                                         "got "
+                                         "{}",
+                                         predict(j).value(),
+                                         out(r, j).value()));
+                OPM_ERROR_IF(fabs(out(r, j).derivative(0) - predict(j).derivative(0)) > 1e-9,
+                             fmt::format("\n Expected derivative "
+                                         "{}"
+                                         "got "
+                                         "{}",
+                                         predict(j).derivative(0),
+                                         out(r, j).derivative(0)));
+            }
+        }
+    }
+
+    return true;
+}
+
 } // namespace Opm
 
 int main()
@@ -195,6 +250,8 @@ int main()
         test_dense_10x10x10<Evaluation>(&load_time, &apply_time);
         test_dense_activation_10<Evaluation>(&load_time, &apply_time);
         test_scalingdense_10x1<Evaluation>(&load_time, &apply_time);
+        batch_test<Evaluation>("test_dense_10x10x10.model", 10);
+        batch_test<Evaluation>("test_scalingdense_10x1.model", 1);
     }
     catch(...) {
         return 1;
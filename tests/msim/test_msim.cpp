@@ -184,6 +184,59 @@ BOOST_AUTO_TEST_CASE(RUN) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(RUN_ASYNC_OUTPUT) {
+    Parser parser;
+    auto python = std::make_shared<Python>();
+    Deck deck = parser.parseFile("SPE1CASE1.DATA");
+    EclipseState state(deck);
+    Schedule schedule(deck, state, python);
+    SummaryConfig summary_config(deck, schedule, state.fieldProps(), state.aquifer());
+    msim msim(state, schedule);
+
+    msim.well_rate("PROD", data::Rates::opt::oil, prod_opr);
+    msim.well_rate("RFTP", data::Rates::opt::oil, prod_rft);
+    msim.well_rate("RFTI", data::Rates::opt::wat, inj_rfti);
+    msim.well_rate("INJ",  data::Rates::opt::gas, inj_inj);
+    msim.solution("PRESSURE", pressure);
+    {
+        const WorkArea work_area("test_msim_async");
+        EclipseIO io(state, state.getInputGrid(), schedule, summary_config);
+        io.enableAsyncOutput();
+
+        msim.run(io, false);
+
+        for (const auto& fname : {"SPE1CASE1.INIT", "SPE1CASE1.UNRST", "SPE1CASE1.EGRID", "SPE1CASE1.SMSPEC", "SPE1CASE1.UNSMRY", "SPE1CASE1.RSM"})
+            BOOST_CHECK( is_file( fname ));
+
+        {
+            const auto  smry  = EclIO::ESmry("SPE1CASE1");
+            const auto& time  = smry.get("TIME");
+            const auto& press = smry.get("WOPR:PROD");
+
+            BOOST_CHECK( time.size() > 1 );
+            for (auto nstep = time.size(), time_index=0*nstep; time_index < nstep; time_index++) {
+                double seconds_elapsed = time[time_index] * 86400;
+                BOOST_CHECK_CLOSE(seconds_elapsed, press[time_index], 1e-3);
+            }
+
+            const auto rsm = EclIO::ERsm("SPE1CASE1.RSM");
+            BOOST_CHECK( EclIO::cmp( smry, rsm ));
+        }
+
+        {
+            EclIO::ERst rst("SPE1CASE1.UNRST");
+
+            BOOST_CHECK( ! rst.listOfReportStepNumbers().empty() );
+            for (const auto& step : rst.listOfReportStepNumbers()) {
+                const auto& dh    = rst.getRestartData<double>("DOUBHEAD", step, 0);
+                const auto& press = rst.getRestartData<float>("PRESSURE", step, 0);
+
+                BOOST_CHECK_CLOSE( press[0], dh[0] * 86400, 1e-3 );
+            }
+        }
+    }
+}
+
 BOOST_AUTO_TEST_CASE(RUN_SUMTHIN) {
     Parser parser;
     auto python = std::make_shared<Python>();
@@ -48,6 +48,7 @@
 #include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
 #include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
 #include <opm/input/eclipse/Schedule/Action/Actions.hpp>
+#include <opm/input/eclipse/Schedule/Action/ConditionCache.hpp>
 #include <opm/input/eclipse/Schedule/Action/SimulatorUpdate.hpp>
 #include <opm/input/eclipse/Schedule/Action/State.hpp>
 #include <opm/input/eclipse/Schedule/Action/WGNames.hpp>
@@ -2148,3 +2149,99 @@ BOOST_AUTO_TEST_CASE(Eval_RegionVector_In_Condition_Default_RegSet_2)
                             "Condition must be satisfied");
     }
 }
+
+BOOST_AUTO_TEST_CASE(Condition_Cache)
+{
+    const auto deck = Parser{}.parseString(R"(
+ACTIONX
+   'ACTION' /
+   WWCT 'OP*' > 0.75 AND /
+   FOPR < 500 /
+/
+)");
+
+    const auto action = Action::parseActionX(deck["ACTIONX"].back(), {}, 0).first;
+
+    auto st = SummaryState { TimeService::now(), 0.0 };
+    st.update("FOPR", 400.0);
+    st.update_well_var("OP1", "WWCT", 0.8);
+    st.update_well_var("OP2", "WWCT", 0.6);
+    st.update_well_var("WI1", "WWCT", 0.9);
+
+    const auto wlm = WListManager{};
+    const auto context = Action::Context { st, wlm };
+
+    auto cache = Action::ConditionCache{};
+
+    {
+        const auto r = cache.eval(action, context);
+        BOOST_CHECK_MESSAGE(r.conditionSatisfied(), "Condition must be satisfied");
+        BOOST_CHECK_MESSAGE(r == action.eval(context), "Cached result must match direct evaluation");
+        BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{1});
+        BOOST_CHECK_EQUAL(cache.numReused(), std::size_t{0});
+
+        const auto wells = r.matches().wells().asVector();
+        BOOST_CHECK_MESSAGE(wells == std::vector<std::string>{ "OP1" },
+                            "Matching well set must be { OP1 }");
+    }
+
+    // Nothing changed => result reused.
+    {
+        const auto r = cache.eval(action, context);
+        BOOST_CHECK_MESSAGE(r.conditionSatisfied(), "Condition must be satisfied");
+        BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{1});
+        BOOST_CHECK_EQUAL(cache.numReused(), std::size_t{1});
+    }
+
+    // Changed well value => condition re-evaluated against current state.
+    st.update_well_var("OP2", "WWCT", 0.85);
+    {
+        const auto r = cache.eval(action, context);
+        BOOST_CHECK_MESSAGE(r == action.eval(context), "Cached result must match direct evaluation");
+        BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{2});
+
+        auto wells = r.matches().wells().asVector();
+        std::ranges::sort(wells);
+        BOOST_CHECK_MESSAGE(wells == (std::vector<std::string>{ "OP1", "OP2" }),
+                            "Matching well set must be { OP1, OP2 }");
+    }
+
+    // New well matching the pattern => condition re-evaluated.
+    st.update_well_var("OP3", "WWCT", 0.95);
+    {
+        const auto r = cache.eval(action, context);
+        BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{3});
+        BOOST_CHECK_EQUAL(r.matches().wells().asVector().size(), std::size_t{3});
+    }
+
+    // Well value erased => condition re-evaluated.
+    st.erase_well_var("OP3", "WWCT");
+    {
+        const auto r = cache.eval(action, context);
+        BOOST_CHECK_MESSAGE(r == action.eval(context), "Cached result must match direct evaluation");
+        BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{4});
+        BOOST_CHECK_EQUAL(r.matches().wells().asVector().size(), std::size_t{2});
+    }
+
+    // Changed field value => condition no longer satisfied.
+    st.update("FOPR", 600.0);
+    {
+        const auto r = cache.eval(action, context);
+        BOOST_CHECK_MESSAGE(! r.conditionSatisfied(), "Condition must NOT be satisfied");
+        BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{5});
+    }
+
+    // Small changes within tolerance => result reused.
+    auto tolerant = Action::ConditionCache { 0.01 };
+    static_cast<void>(tolerant.eval(action, context));
+    st.update("FOPR", 601.0);
+    {
+        const auto r = tolerant.eval(action, context);
+        BOOST_CHECK_MESSAGE(! r.conditionSatisfied(), "Condition must NOT be satisfied");
+        BOOST_CHECK_EQUAL(tolerant.numReused(), std::size_t{1});
+    }
+
+    cache.clear();
+    static_cast<void>(cache.eval(action, context));
+    BOOST_CHECK_EQUAL(cache.numEvaluated(), std::size_t{6});
+}
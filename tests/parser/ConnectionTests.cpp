@@ -38,6 +38,7 @@
 #include <opm/input/eclipse/Schedule/Well/Well.hpp>
 #include <opm/input/eclipse/Schedule/Well/WDFAC.hpp>
 #include <opm/input/eclipse/Schedule/Well/WellConnections.hpp>
+#include <opm/input/eclipse/Schedule/WellTraj/CellSearchTree.hpp>
 
 #include <opm/common/OpmLog/KeywordLocation.hpp>
 
@@ -52,6 +53,7 @@
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <memory>
@@ -774,6 +776,62 @@ BOOST_AUTO_TEST_CASE(loadCOMPTRAJTESTSPE1_2) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(CellSearchTree_Cartesian)
+{
+    // 4x3x2 cells of size 10x10x5.
+    const Opm::EclipseGrid grid { 4, 3, 2, 10.0, 10.0, 5.0 };
+    const Opm::FieldPropsManager field_props {
+        Opm::Deck{}, Opm::Phases{true, true, true}, grid, Opm::TableManager{}
+    };
+
+    Opm::CompletedCells completed_cells(grid);
+    const auto sg = Opm::ScheduleGrid { grid, field_props, completed_cells };
+
+    const auto& tree = sg.get_cell_search_tree();
+    BOOST_CHECK_EQUAL(tree.numCells(), std::size_t{24});
+    BOOST_CHECK_MESSAGE(&tree == &sg.get_cell_search_tree(),
+                        "Cell search tree must be formed only once");
+
+    auto sorted = [](std::vector<std::size_t> cells)
+    {
+        std::sort(cells.begin(), cells.end());
+        return cells;
+    };
+
+    {
+        auto bb = external::cvf::BoundingBox{};
+        bb.add(external::cvf::Vec3d { 15.0, 15.0, 2.0 });
+        bb.add(external::cvf::Vec3d { 25.0, 15.0, 2.0 });
+
+        const auto expect = std::vector<std::size_t> { 5, 6 };
+        const auto cells = sorted(tree.findIntersectingCells(bb));
+        BOOST_CHECK_EQUAL_COLLECTIONS(cells.begin(), cells.end(),
+                                      expect.begin(), expect.end());
+    }
+
+    const auto points = std::vector {
+        external::cvf::Vec3d {  5.0,  5.0, 1.0 },
+        external::cvf::Vec3d { 15.0,  5.0, 1.0 },
+        external::cvf::Vec3d { 15.0, 25.0, 1.0 },
+    };
+
+    const auto segmentCells = tree.findSegmentCells(points);
+    BOOST_REQUIRE_EQUAL(segmentCells.size(), std::size_t{2});
+
+    const auto expect = std::vector<std::vector<std::size_t>> {
+        { 0, 1 }, { 1, 5, 9 },
+    };
+
+    for (std::size_t segment = 0; segment < segmentCells.size(); ++segment) {
+        const auto cells = sorted(segmentCells[segment]);
+        BOOST_CHECK_EQUAL_COLLECTIONS(cells.begin(), cells.end(),
+                                      expect[segment].begin(), expect[segment].end());
+    }
+
+    BOOST_CHECK_MESSAGE(tree.findSegmentCells({ points.front() }).empty(),
+                        "Single point path must not have any segments");
+}
+
 BOOST_AUTO_TEST_CASE(Compdat_Zero_Perm_Dflt_Action)
 {
     const auto deck = Opm::Parser{}.parseString(R"(RUNSPEC
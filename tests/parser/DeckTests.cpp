@@ -337,6 +337,41 @@ BOOST_AUTO_TEST_CASE(GetSIMultipleDim) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(ScannedItemsShareDescriptor) {
+    ParserItem itemLength("LENGTH", ParserItem::itype::DOUBLE);
+    itemLength.push_backDimension("Length");
+    itemLength.setDefault(2.0);
+
+    UnitSystem metric(UnitSystem::UnitType::UNIT_TYPE_METRIC);
+    UnitSystem field(UnitSystem::UnitType::UNIT_TYPE_FIELD);
+    KeywordLocation loc("KW", "file", 100);
+
+    RawRecord rawRecord1( "1.0", loc );
+    RawRecord rawRecord2( "1*", loc );
+    RawRecord rawRecord3( "1.0", loc );
+
+    const auto item1 = itemLength.scan(rawRecord1, metric, metric);
+    const auto item2 = itemLength.scan(rawRecord2, metric, metric);
+    const auto item3 = itemLength.scan(rawRecord3, field, metric);
+
+    BOOST_CHECK_EQUAL(item1.name(), "LENGTH");
+    BOOST_CHECK_EQUAL(item3.name(), "LENGTH");
+    BOOST_CHECK_EQUAL(&item1.getActiveDimensions(), &item2.getActiveDimensions());
+    BOOST_CHECK(&item1.getActiveDimensions() != &item3.getActiveDimensions());
+
+    BOOST_CHECK_CLOSE(item1.getSIDouble(0), 1.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(item2.getSIDouble(0), 2.0, 1.0e-12);
+    BOOST_CHECK_CLOSE(item3.getSIDouble(0), 0.3048, 1.0e-12);
+
+    // Changing the parser item gives later items a new descriptor.
+    auto itemCopy = itemLength;
+    itemCopy.setInputType(ParserItem::itype::DOUBLE);
+    RawRecord rawRecord4( "1.0", loc );
+    const auto item4 = itemCopy.scan(rawRecord4, metric, metric);
+    BOOST_CHECK(&item1.getActiveDimensions() != &item4.getActiveDimensions());
+    BOOST_CHECK_CLOSE(item4.getSIDouble(0), 1.0, 1.0e-12);
+}
+
 BOOST_AUTO_TEST_CASE(HasValue) {
     DeckItem deckIntItem( "TEST", int() );
     BOOST_CHECK_EQUAL( false , deckIntItem.hasValue(0) );
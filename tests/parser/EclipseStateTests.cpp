@@ -46,6 +46,7 @@ along with OPM.  If not, see <http://www.gnu.org/licenses/>.
 
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
+#include <algorithm>
 #include <cstddef>
 #include <filesystem>
 
@@ -298,6 +299,32 @@ BOOST_AUTO_TEST_CASE(GetProperty) {
         BOOST_CHECK_EQUAL( 2 , satnum[i]);
 }
 
+BOOST_AUTO_TEST_CASE(CompactReleasesInputData) {
+    auto deck = createDeck();
+    EclipseState state(deck);
+    const Schedule schedule(deck, state, std::make_shared<Python>());
+
+    // Deactivating the top layer leaves capacity behind in the field properties.
+    auto actnum = state.fieldProps().actnum();
+    std::fill(actnum.begin(), actnum.begin() + 100, 0);
+    state.reset_actnum(actnum);
+
+    const auto report = state.compact(schedule, deck);
+    BOOST_CHECK( report.deck > 0 );
+    BOOST_CHECK( report.field_props > 0 );
+    BOOST_CHECK_EQUAL( report.total(), report.deck + report.field_props + report.grid );
+    BOOST_CHECK( deck.empty() );
+    BOOST_CHECK( !deck.hasKeyword("PORO") );
+
+    const auto& poro = state.fieldProps().get_double("PORO");
+    BOOST_CHECK_EQUAL( 900U, poro.size() );
+    for (const auto& p : poro)
+        BOOST_CHECK_CLOSE( 0.15, p, 1.0e-8 );
+
+    BOOST_CHECK_EQUAL( "The title", state.getTitle() );
+    BOOST_CHECK_EQUAL( 0U, state.compact(schedule, deck).total() );
+}
+
 BOOST_AUTO_TEST_CASE(GetTransMult) {
     auto deck = createDeck();
     EclipseState state( deck );
@@ -26,6 +26,7 @@
 #include <filesystem>
 #include <iostream>
 #include <opm/common/utility/OpmInputError.hpp>
+#include <opm/input/eclipse/Parser/DeckCache.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 #include <opm/input/eclipse/Parser/ParserKeyword.hpp>
 #include <opm/input/eclipse/Deck/Deck.hpp>
@@ -33,7 +34,12 @@
 #include <opm/input/eclipse/Parser/ErrorGuard.hpp>
 #include <opm/input/eclipse/Parser/InputErrorAction.hpp>
 
+#include <cstdint>
+#include <fstream>
 #include <iostream>
+#include <vector>
+
+#include <tests/WorkArea.hpp>
 
 inline std::string prefix() {
 #if BOOST_VERSION / 100000 == 1 && BOOST_VERSION / 100 % 1000 < 71
@@ -161,3 +167,246 @@ EQUIL
     Opm::Parser parser;
     BOOST_CHECK_THROW(parser.parseString(keywords_string), Opm::OpmInputError);
 }
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeParallel)
+{
+    Opm::Parser parser;
+    Opm::Parser parallelParser;
+    parallelParser.includeThreads(4);
+
+    for (const auto* dataFile : { "includeValid.data",
+                                  "PATHSInInclude.data",
+                                  "includeSymlinkTestdata/symlink3/case.data" })
+    {
+        const auto inputFilePath = prefix() + dataFile;
+
+        const auto serialDeck = parser.parseFile(inputFilePath);
+        const auto parallelDeck = parallelParser.parseFile(inputFilePath);
+
+        BOOST_CHECK_MESSAGE(serialDeck == parallelDeck, "Deck " << dataFile);
+    }
+
+    Opm::ParseContext parseContext;
+    Opm::ErrorGuard errors;
+
+    parseContext.update(Opm::ParseContext::PARSE_MISSING_INCLUDE , Opm::InputErrorAction::THROW_EXCEPTION );
+    BOOST_CHECK_THROW(parallelParser.parseFile(prefix() + "includeInvalid.data", parseContext, errors),
+                      Opm::OpmInputError);
+}
+
+namespace {
+
+void writeFile(const std::string& fileName, const std::string& content)
+{
+    std::ofstream os(fileName);
+    os << content;
+}
+
+void writeCacheDeck(const std::string& includedKeyword)
+{
+    writeFile("CASE.DATA", R"(RUNSPEC
+INCLUDE
+  'include.inc' /
+)");
+
+    writeFile("include.inc", includedKeyword + "\n");
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(DeckCache_storeAndLoad)
+{
+    WorkArea work_area("deck_cache");
+    writeCacheDeck("OIL");
+
+    const auto deck = Opm::Parser{}.parseFile("CASE.DATA");
+    const auto cache = Opm::DeckCache { "CASE.OPMDECK" };
+
+    BOOST_CHECK_MESSAGE(! cache.load(17).has_value(), "Missing cache file must not load");
+
+    const auto input_files = std::vector {
+        Opm::DeckCache::inputFile("CASE.DATA").value(),
+        Opm::DeckCache::inputFile("include.inc").value(),
+    };
+
+    BOOST_CHECK(cache.store(deck, input_files, 17));
+    BOOST_CHECK(std::filesystem::exists(cache.path()));
+
+    {
+        const auto cached = cache.load(17);
+        BOOST_REQUIRE(cached.has_value());
+        BOOST_CHECK(*cached == deck);
+    }
+
+    BOOST_CHECK_MESSAGE(! cache.load(18).has_value(), "Configuration mismatch must not load");
+
+    // Same content, new modification time: still valid.
+    std::filesystem::last_write_time("include.inc",
+                                     std::filesystem::last_write_time("include.inc") + std::chrono::seconds(10));
+    BOOST_CHECK(cache.load(17).has_value());
+
+    // Same size, different content: out of date.
+    writeCacheDeck("GAS");
+    std::filesystem::last_write_time("include.inc",
+                                     std::filesystem::last_write_time("include.inc") + std::chrono::seconds(20));
+    BOOST_CHECK(! cache.load(17).has_value());
+
+    writeFile("CASE.OPMDECK", "garbage");
+    BOOST_CHECK(! cache.load(17).has_value());
+
+    // Block length beyond the end of the file.
+    {
+        std::ofstream os("CASE.OPMDECK", std::ios::binary);
+        const auto length = std::uint64_t{1} << 40;
+        os.write("OPMDECK3", 8);
+        os.write(reinterpret_cast<const char*>(&length), sizeof length);
+        os.write("garbage", 7);
+    }
+    BOOST_CHECK(! cache.load(17).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(DeckCache_digest)
+{
+    // 64-bit FNV-1a over the bytes followed by the size as eight little
+    // endian bytes.
+    BOOST_CHECK_EQUAL(Opm::DeckCache::digest(""), 0xa8c7f832281a39c5ULL);
+    BOOST_CHECK_EQUAL(Opm::DeckCache::digest("OIL\n"), 0x3bf104fb8ff5e367ULL);
+}
+
+BOOST_AUTO_TEST_CASE(DeckCache_recordsInputWhenRead)
+{
+    WorkArea work_area("deck_cache");
+    writeCacheDeck("OIL");
+
+    const auto deck = Opm::Parser{}.parseFile("CASE.DATA");
+    const auto input_files = std::vector {
+        Opm::DeckCache::inputFile("CASE.DATA").value(),
+        Opm::DeckCache::inputFile("include.inc").value(),
+    };
+
+    // The include file changes after it was read, but before the cache is
+    // stored.  The cache must describe the file as it was read.
+    writeCacheDeck("GAS");
+    std::filesystem::last_write_time("include.inc",
+                                     std::filesystem::last_write_time("include.inc") + std::chrono::seconds(10));
+
+    const auto cache = Opm::DeckCache { "CASE.OPMDECK" };
+    BOOST_CHECK(cache.store(deck, input_files, 17));
+    BOOST_CHECK(! cache.load(17).has_value());
+}
+
+BOOST_AUTO_TEST_CASE(DeckCache_parseFile)
+{
+    WorkArea work_area("deck_cache");
+    writeCacheDeck("OIL");
+
+    Opm::Parser parser;
+    parser.deckCacheDirectory("cache");
+
+    const auto deck = parser.parseFile("CASE.DATA");
+    const auto cache_file = Opm::DeckCache::cacheFileName("cache", "CASE.DATA");
+    BOOST_REQUIRE(std::filesystem::exists(cache_file));
+
+    // Storing the deck again would replace the cache file and update its
+    // modification time, so an unchanged time means a cache hit.
+    const auto stored_time = std::filesystem::last_write_time(cache_file) - std::chrono::hours(1);
+    std::filesystem::last_write_time(cache_file, stored_time);
+
+    const auto cached_deck = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(std::filesystem::last_write_time(cache_file) == stored_time);
+    BOOST_CHECK(cached_deck == deck);
+    BOOST_CHECK(cached_deck.hasKeyword("OIL"));
+    BOOST_CHECK_EQUAL(cached_deck.getDataFile(), deck.getDataFile());
+
+    writeCacheDeck("WATER");
+    const auto new_deck = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(new_deck.hasKeyword("WATER"));
+    BOOST_CHECK(! new_deck.hasKeyword("OIL"));
+
+    // Reading only some of the sections must not pick up the full deck.
+    writeFile("CASE.DATA", R"(RUNSPEC
+INCLUDE
+  'include.inc' /
+GRID
+PROPS
+SOLUTION
+SCHEDULE
+)");
+    const auto full = parser.parseFile("CASE.DATA");
+    BOOST_CHECK(full.hasKeyword("SCHEDULE"));
+
+    const auto runspec = parser.parseFile("CASE.DATA", Opm::ParseContext{},
+                                          { Opm::Ecl::SectionType::RUNSPEC });
+    BOOST_CHECK(runspec.hasKeyword("WATER"));
+    BOOST_CHECK(! runspec.hasKeyword("SCHEDULE"));
+}
+
+BOOST_AUTO_TEST_CASE(DeckCache_parseContext)
+{
+    WorkArea work_area("deck_cache");
+    writeCacheDeck("OIL\nNOSUCHKW");
+
+    Opm::Parser parser;
+    parser.deckCacheDirectory("cache");
+    const auto cache_file = Opm::DeckCache::cacheFileName("cache", "CASE.DATA");
+
+    // A deck which triggers an error handler is not cached, even if the
+    // handler ignores the problem.
+    auto lenient = Opm::ParseContext{};
+    lenient.update(Opm::ParseContext::PARSE_UNKNOWN_KEYWORD, Opm::InputErrorAction::IGNORE);
+    {
+        Opm::ErrorGuard errors;
+        const auto deck = parser.parseFile("CASE.DATA", lenient, errors);
+        BOOST_CHECK(deck.hasKeyword("OIL"));
+        BOOST_CHECK(! std::filesystem::exists(cache_file));
+    }
+
+    auto strict = Opm::ParseContext{};
+    strict.update(Opm::ParseContext::PARSE_UNKNOWN_KEYWORD, Opm::InputErrorAction::THROW_EXCEPTION);
+    BOOST_CHECK_THROW(parser.parseFile("CASE.DATA", strict), Opm::OpmInputError);
+
+    // Decks parsed with different ParseContext settings do not share a
+    // cache entry.
+    writeCacheDeck("OIL");
+    static_cast<void>(parser.parseFile("CASE.DATA", lenient));
+    BOOST_REQUIRE(std::filesystem::exists(cache_file));
+
+    const auto stored_time = std::filesystem::last_write_time(cache_file) - std::chrono::hours(1);
+    std::filesystem::last_write_time(cache_file, stored_time);
+
+    static_cast<void>(parser.parseFile("CASE.DATA", strict));
+    BOOST_CHECK(std::filesystem::last_write_time(cache_file) != stored_time);
+}
+
+BOOST_AUTO_TEST_CASE(ParserKeyword_includeParallelSkip)
+{
+    WorkArea work_area("include_parallel_skip");
+
+    writeFile("CASE.DATA", R"(RUNSPEC
+SKIP
+INCLUDE
+  'skipped.inc' /
+ENDSKIP
+INCLUDE
+  'used.inc' /
+)");
+
+    writeFile("skipped.inc", R"(INCLUDE
+  'nested.inc' /
+GAS
+)");
+    writeFile("nested.inc", "DISGAS\n");
+    writeFile("used.inc", "OIL\n");
+
+    Opm::Parser parser;
+    Opm::Parser parallelParser;
+    parallelParser.includeThreads(4);
+
+    const auto serialDeck = parser.parseFile("CASE.DATA");
+    const auto parallelDeck = parallelParser.parseFile("CASE.DATA");
+
+    BOOST_CHECK(serialDeck == parallelDeck);
+    BOOST_CHECK(parallelDeck.hasKeyword("OIL"));
+    BOOST_CHECK(! parallelDeck.hasKeyword("GAS"));
+    BOOST_CHECK(! parallelDeck.hasKeyword("DISGAS"));
+}
@@ -95,6 +95,15 @@ ParserKeyword createTable(const std::string& name,
     return pkw;
 }
 
+int lazyKeywordCount = 0;
+
+ParserKeyword createLazyKeyword() {
+    ++lazyKeywordCount;
+    auto pkw = createDynamicSized("FJAS");
+    pkw.addDeckName("SAJF");
+    return pkw;
+}
+
 }
 
 BOOST_AUTO_TEST_SUITE(General_Facilities)
@@ -143,6 +152,61 @@ BOOST_AUTO_TEST_CASE(getAllDeckNames_hasNoKeywords_returnsEmptyList) {
     BOOST_CHECK_EQUAL(0U, parser.getAllDeckNames().size());
 }
 
+BOOST_AUTO_TEST_CASE(addLazyParserKeyword_constructsKeywordOnFirstLookup) {
+    Parser parser( false );
+    lazyKeywordCount = 0;
+    parser.addLazyParserKeyword({ "FJAS", "SAJF" }, &createLazyKeyword);
+
+    BOOST_CHECK(parser.isRecognizedKeyword("FJAS"));
+    BOOST_CHECK(parser.hasKeyword("SAJF"));
+    BOOST_CHECK_EQUAL(2U, parser.size());
+    BOOST_CHECK_EQUAL(0, lazyKeywordCount);
+
+    const auto& keyword = parser.getParserKeywordFromDeckName("SAJF");
+    BOOST_CHECK_EQUAL("FJAS", keyword.getName());
+    BOOST_CHECK_EQUAL(&keyword, &parser.getKeyword("FJAS"));
+    BOOST_CHECK_EQUAL(1, lazyKeywordCount);
+
+    parser.addParserKeyword( createFixedSized( "SAJF", 1 ) );
+    BOOST_CHECK_EQUAL("SAJF", parser.getKeyword("SAJF").getName());
+    BOOST_CHECK_EQUAL(&keyword, &parser.getKeyword("FJAS"));
+    BOOST_CHECK_EQUAL(1, lazyKeywordCount);
+}
+
+BOOST_AUTO_TEST_CASE(copyAndMoveParser_keepsKeywords) {
+    lazyKeywordCount = 0;
+
+    auto original = std::make_unique<Parser>( false );
+    original->addLazyParserKeyword({ "FJAS", "SAJF" }, &createLazyKeyword);
+    original->addParserKeyword( createFixedSized( "EQUIL", 1 ) );
+    auto wildCard = createFixedSized( "HELLO", std::size_t{1} );
+    wildCard.clearDeckNames();
+    wildCard.setMatchRegex("WORLD.+");
+    original->addParserKeyword( std::move(wildCard) );
+
+    Parser copy { *original };
+    Parser assigned( false );
+    assigned = *original;
+    original.reset();
+
+    BOOST_CHECK_EQUAL(3U, copy.size());
+    BOOST_CHECK_EQUAL("EQUIL", copy.getKeyword("EQUIL").getName());
+    BOOST_CHECK_EQUAL("HELLO", copy.getKeyword("WORLDABC").getName());
+    BOOST_CHECK(copy.isRecognizedKeyword("WORLDABC"));
+    BOOST_CHECK_EQUAL("FJAS", copy.getKeyword("SAJF").getName());
+    BOOST_CHECK_EQUAL(1, lazyKeywordCount);
+
+    BOOST_CHECK_EQUAL("FJAS", assigned.getKeyword("FJAS").getName());
+    BOOST_CHECK_EQUAL(2, lazyKeywordCount);
+    BOOST_CHECK(&assigned.getKeyword("FJAS") != &copy.getKeyword("FJAS"));
+
+    const auto* keyword = &copy.getKeyword("FJAS");
+    Parser moved { std::move(copy) };
+    BOOST_CHECK_EQUAL(keyword, &moved.getKeyword("SAJF"));
+    BOOST_CHECK_EQUAL("EQUIL", moved.getKeyword("EQUIL").getName());
+    BOOST_CHECK_EQUAL(2, lazyKeywordCount);
+}
+
 
 
 /************************ JSON config related tests **********************'*/
@@ -702,6 +766,48 @@ BOOST_AUTO_TEST_CASE(Scan_All_WithDefaults) {
     BOOST_CHECK_EQUAL(25, deckIntItem.get< int >(21));
 }
 
+BOOST_AUTO_TEST_CASE(Scan_All_Bulk_SameAsTokenwise) {
+    ParserItem itemDouble("ITEM", DOUBLE);
+    itemDouble.setSizeType(ParserItem::item_size::ALL);
+    itemDouble.setDefault(0.25);
+
+    const std::string input = "1.5 3*2.0e-1 2* 1.25D2\n-7 +4 *\t1*0.125 ";
+    UnitSystem unit_system;
+
+    RawRecord bulkRecord( input, KeywordLocation("KW", "File", 100) );
+    const auto bulkItem = itemDouble.scan(bulkRecord, unit_system, unit_system);
+    BOOST_CHECK_EQUAL(bulkRecord.size(), 0U);
+
+    // Splitting the record first bypasses the bulk scanner.
+    RawRecord tokenRecord( input, KeywordLocation("KW", "File", 100) );
+    BOOST_CHECK_EQUAL(tokenRecord.size(), 8U);
+    const auto tokenItem = itemDouble.scan(tokenRecord, unit_system, unit_system);
+
+    BOOST_REQUIRE_EQUAL(bulkItem.data_size(), 11U);
+    BOOST_CHECK(bulkItem.getData<double>() == tokenItem.getData<double>());
+    BOOST_CHECK(bulkItem.getValueStatus() == tokenItem.getValueStatus());
+
+    BOOST_CHECK_EQUAL(bulkItem.get<double>(2), 0.2);
+    BOOST_CHECK(bulkItem.defaultApplied(4));
+    BOOST_CHECK_EQUAL(bulkItem.get<double>(6), 125.0);
+    BOOST_CHECK_EQUAL(bulkItem.get<double>(8), 4.0);
+    BOOST_CHECK(bulkItem.defaultApplied(9));
+    BOOST_CHECK_EQUAL(bulkItem.get<double>(10), 0.125);
+
+    ParserItem itemInt("ITEM", INT);
+    itemInt.setSizeType(ParserItem::item_size::ALL);
+
+    for (const auto* malformed : { "1 0*3 2", "1 *3 2", "1 2.5 3", "1 2*x" }) {
+        RawRecord record( malformed, KeywordLocation("KW", "File", 100) );
+        BOOST_CHECK_THROW(itemInt.scan(record, unit_system, unit_system), std::invalid_argument);
+    }
+
+    for (const auto* nonFinite : { "1 INF 2", "1 2*NAN", "nan", "1 -Infinity" }) {
+        RawRecord record( nonFinite, KeywordLocation("KW", "File", 100) );
+        BOOST_CHECK_THROW(itemDouble.scan(record, unit_system, unit_system), std::invalid_argument);
+    }
+}
+
 BOOST_AUTO_TEST_CASE(Scan_SINGLE_CorrectIntSetInDeckItem) {
     ParserItem itemInt(std::string("ITEM2"), INT);
 
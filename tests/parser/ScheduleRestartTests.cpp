@@ -52,6 +52,8 @@
 #include <opm/input/eclipse/Deck/Deck.hpp>
 #include <opm/input/eclipse/Deck/FileDeck.hpp>
 
+#include <opm/input/eclipse/Parser/ErrorGuard.hpp>
+#include <opm/input/eclipse/Parser/ParseContext.hpp>
 #include <opm/input/eclipse/Parser/Parser.hpp>
 
 #include <algorithm>
@@ -244,6 +246,33 @@ BOOST_AUTO_TEST_CASE(LoadActionRestartSim)
     action_state.load_rst(rst_actions, rst_state);
 }
 
+BOOST_AUTO_TEST_CASE(LoadLazyRestartSim)
+{
+    Parser parser;
+    auto python = std::make_shared<Python>();
+
+    auto restart_deck = parser.parseFile("UDQ_ACTIONX_RESTART.DATA");
+    EclipseState ecl_state(restart_deck);
+    auto rst_file = std::make_shared<EclIO::ERst>("UDQ_ACTIONX.X0007");
+    auto rst_view = std::make_shared<EclIO::RestartFileView>(std::move(rst_file), 7);
+    auto rst_state = RestartIO::RstState::load(std::move(rst_view), ecl_state.runspec(), parser);
+
+    const Schedule eager(restart_deck, ecl_state, python, false, /*slave_mode=*/false, true, {}, &rst_state);
+
+    ErrorGuard errors;
+    const Schedule lazy(restart_deck, ecl_state.getInputGrid(), ecl_state.fieldProps(),
+                        ecl_state.aquifer().numericalAquifers(), ecl_state.runspec(),
+                        ParseContext{}, errors, python, false, /*slave_mode=*/false,
+                        true, {}, &rst_state, &ecl_state.tracer(), /*lazyLoad=*/true);
+
+    BOOST_CHECK(! lazy.isFullyLoaded());
+    BOOST_REQUIRE_EQUAL(lazy.size(), eager.size());
+    for (std::size_t report_step = 0; report_step < eager.size(); ++report_step) {
+        BOOST_CHECK_MESSAGE(lazy[report_step] == eager[report_step],
+                            "Report step " << report_step << " differs");
+    }
+}
+
 BOOST_AUTO_TEST_CASE(LoadUDQRestartSim0)
 {
     const auto& [sched, restart_sched, _] =
@@ -48,6 +48,9 @@
 
 #include <opm/input/eclipse/Python/Python.hpp>
 
+#include <opm/input/eclipse/Schedule/Action/ActionResult.hpp>
+#include <opm/input/eclipse/Schedule/Action/ActionX.hpp>
+#include <opm/input/eclipse/Schedule/Action/Actions.hpp>
 #include <opm/input/eclipse/Schedule/CompletedCells.hpp>
 #include <opm/input/eclipse/Schedule/GasLiftOpt.hpp>
 #include <opm/input/eclipse/Schedule/Group/GTNode.hpp>
@@ -91,6 +94,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -7232,3 +7236,322 @@ END
         BOOST_CHECK_CLOSE(s->width(), 1819.202122, 1.0e-8);
     }
 }
+
+BOOST_AUTO_TEST_CASE(Lazy_Loading)
+{
+    const auto deck = Parser{}.parseString(createDeckWithWells());
+
+    EclipseGrid grid(10, 10, 10);
+    const TableManager table (deck);
+    const FieldPropsManager fp(deck, Phases{true, true, true}, grid, table);
+    const Runspec runspec (deck);
+
+    const auto eager = make_schedule(createDeckWithWells());
+
+    auto make_lazy = [&deck, &grid, &fp, &runspec]()
+    {
+        ErrorGuard errors{};
+        return Schedule { deck, grid, fp, NumericalAquifers{}, runspec,
+                          ParseContext{}, errors, std::make_shared<Python>(),
+                          /* lowActionParsingStrictness = */ false,
+                          /* slave_mode = */ false,
+                          /* keepKeywords = */ true,
+                          /* output_interval = */ {},
+                          /* rst = */ nullptr,
+                          /* tracer_config = */ nullptr,
+                          /* lazyLoad = */ true };
+    };
+
+    auto lazy = make_lazy();
+
+    BOOST_CHECK(! lazy.isFullyLoaded());
+    BOOST_CHECK_EQUAL(lazy.size(), eager.size());
+    BOOST_CHECK_EQUAL(lazy.seconds(3), eager.seconds(3));
+    BOOST_CHECK_EQUAL(lazy.stepLength(2), eager.stepLength(2));
+    BOOST_CHECK(! lazy.isFullyLoaded());
+
+    // Well names at the end of the Schedule come from the deck.
+    BOOST_CHECK(lazy.wellNames() == eager.wellNames());
+    BOOST_CHECK_EQUAL(lazy.numWells(), eager.numWells());
+    BOOST_CHECK(lazy.hasWell("WX2"));
+    BOOST_CHECK(! lazy.hasWell("W_4"));
+    BOOST_CHECK(! lazy.isFullyLoaded());
+
+    // Loading later report steps keeps references to loaded ones valid.
+    const auto& first = lazy[0];
+    BOOST_CHECK(! lazy.hasWell("WX2", 2));
+    BOOST_CHECK(&first == &lazy[0]);
+    BOOST_CHECK(first.wells.has("W_1"));
+    BOOST_CHECK(lazy.hasWell("WX2", 3));
+    BOOST_CHECK(lazy.isFullyLoaded());
+
+    BOOST_CHECK(lazy == eager);
+
+    // Released report steps retain their times only.
+    lazy.releaseBefore(2);
+    BOOST_CHECK_EQUAL(lazy.seconds(1), eager.seconds(1));
+    BOOST_CHECK_THROW(lazy.getWell("W_1", 1), std::logic_error);
+    BOOST_CHECK_THROW(lazy.getWells(0), std::logic_error);
+    BOOST_CHECK_EQUAL(lazy.getWell("W_1", 2).name(), "W_1");
+    BOOST_CHECK_THROW(lazy.loadAll(), std::logic_error);
+    BOOST_CHECK_THROW(lazy.begin(), std::logic_error);
+    BOOST_CHECK(lazy.wellNames() == eager.wellNames());
+
+    // Queries spanning the entire Schedule load all report steps.
+    auto lazy_end = make_lazy();
+    BOOST_CHECK_EQUAL(lazy_end.getWellsatEnd().size(), eager.getWellsatEnd().size());
+    BOOST_CHECK(lazy_end.isFullyLoaded());
+}
+
+BOOST_AUTO_TEST_CASE(Lazy_Loading_Actions)
+{
+    const auto deck = Parser{}.parseString(R"(
+RUNSPEC
+OIL
+WATER
+GAS
+DIMENS
+  10 10 10 /
+START             -- 0
+10 MAI 2007 /
+GRID
+DXV
+10*100.0 /
+DYV
+10*100.0 /
+DZV
+10*10.0 /
+DEPTHZ
+121*2000.0 /
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+SCHEDULE
+WELSPECS
+     'W_1'        'OP'   1   1  1*       'OIL'  7* /
+     'W_2'        'OP'   2   2  1*       'OIL'  7* /
+/
+COMPDAT
+ 'W_1'  1  1   1   1 'OPEN' 1*    1*   0.311 /
+ 'W_2'  2  2   1   1 'OPEN' 1*    1*   0.311 /
+/
+WCONPROD
+     'W_1'  'OPEN'  'ORAT'  100  4*  50 /
+     'W_2'  'OPEN'  'ORAT'  100  4*  50 /
+/
+ACTIONX
+'A'  10 /
+WWCT 'W_1' > 0.75 /
+/
+WELOPEN
+     'W_1'  'SHUT' /
+/
+WCONPROD
+     'W_2'  'OPEN'  'ORAT'  200  4*  50 /
+/
+ENDACTIO
+DATES             -- 1
+ 10  'JUN'  2007 /
+/
+DATES             -- 2,3
+  10  JLY 2007 /
+  10  AUG 2007 /
+/
+WCONPROD
+     'W_2'  'OPEN'  'ORAT'  300  4*  50 /
+/
+WELSPECS
+     'W_3'        'OP'   3   3  1*       'OIL'  7* /
+/
+DATES             -- 4
+  10  SEP 2007 /
+/
+)");
+
+    const auto es = EclipseState { deck };
+
+    auto make_schedule = [&deck, &es](const bool lazyLoad)
+    {
+        ErrorGuard errors{};
+        return Schedule { deck, es.getInputGrid(), es.fieldProps(),
+                          es.aquifer().numericalAquifers(), es.runspec(),
+                          ParseContext{}, errors, std::make_shared<Python>(),
+                          /* lowActionParsingStrictness = */ false,
+                          /* slave_mode = */ false,
+                          /* keepKeywords = */ true,
+                          /* output_interval = */ {},
+                          /* rst = */ nullptr,
+                          &es.tracer(),
+                          lazyLoad };
+    };
+
+    auto check_same_states = [](const Schedule& lazy, const Schedule& eager)
+    {
+        BOOST_REQUIRE_EQUAL(lazy.size(), eager.size());
+        for (std::size_t report_step = 0; report_step < eager.size(); ++report_step) {
+            BOOST_CHECK_MESSAGE(lazy[report_step] == eager[report_step],
+                                "Report step " << report_step << " differs");
+        }
+    };
+
+    const auto target_wellpi = std::unordered_map<std::string, double> {
+        { "W_1", 1.0 }, { "W_2", 2.0 },
+    };
+
+    auto eager = make_schedule(false);
+    auto lazy = make_schedule(true);
+
+    // The action runs in a loaded report step, and the later report steps
+    // are loaded from the modified one.
+    BOOST_CHECK(lazy[1].wells("W_1").getStatus() == Well::Status::OPEN);
+    BOOST_CHECK(! lazy.isFullyLoaded());
+
+    for (auto* sched : { &eager, &lazy }) {
+        const auto action = (*sched)[1].actions.get()["A"];
+        sched->applyAction(1, action, Action::Result{true}.matches(),
+                           target_wellpi, /* iterateSchedule = */ true);
+    }
+
+    BOOST_CHECK(! lazy.isFullyLoaded());
+    BOOST_CHECK(lazy.getWell("W_1", 3).getStatus() == Well::Status::SHUT);
+    BOOST_CHECK(lazy.hasWell("W_3", 4));
+    check_same_states(lazy, eager);
+
+    // Keywords inserted from a PYACTION.
+    const auto keywords_deck = Parser{}.parseString(R"(
+SCHEDULE
+WELOPEN
+     'W_2'  'SHUT' /
+/
+)");
+
+    // Wells refer to their Schedule's unit system, so use new objects
+    // rather than assigning to the existing ones.
+    auto eager_py = make_schedule(false);
+    auto lazy_py = make_schedule(true);
+    BOOST_CHECK(lazy_py[2].wells("W_2").getStatus() == Well::Status::OPEN);
+
+    for (auto* sched : { &eager_py, &lazy_py }) {
+        auto keywords = std::vector<std::unique_ptr<DeckKeyword>>{};
+        keywords.push_back(std::make_unique<DeckKeyword>(keywords_deck["WELOPEN"].back()));
+
+        auto wellpi = target_wellpi;
+        sched->applyKeywords(keywords, wellpi, /* action_mode = */ true, 2);
+    }
+
+    BOOST_CHECK(! lazy_py.isFullyLoaded());
+    BOOST_CHECK(lazy_py.getWell("W_2", 2).getStatus() == Well::Status::SHUT);
+    check_same_states(lazy_py, eager_py);
+}
+
+BOOST_AUTO_TEST_CASE(Lazy_Loading_Compact)
+{
+    auto deck = Parser{}.parseString(R"(
+RUNSPEC
+OIL
+WATER
+GAS
+DIMENS
+  10 10 10 /
+START             -- 0
+10 MAI 2007 /
+GRID
+DXV
+10*100.0 /
+DYV
+10*100.0 /
+DZV
+10*10.0 /
+DEPTHZ
+121*2000.0 /
+PORO
+    1000*0.1 /
+PERMX
+    1000*1 /
+PERMY
+    1000*0.1 /
+PERMZ
+    1000*0.01 /
+SCHEDULE
+WELSPECS
+     'W_1'        'OP'   1   1  1*       'OIL'  7* /
+/
+COMPDAT
+ 'W_1'  1  1   1   1 'OPEN' 1*    1*   0.311 /
+/
+DATES             -- 1, 2
+  10  JUN 2007 /
+  10  AUG 2007 /
+/
+WELSPECS
+     'W_2'        'OP'   5   5  1*       'OIL'  7* /
+/
+COMPDAT
+ 'W_2'  5  5   1   3 'OPEN' 1*    1*   0.311 /
+/
+DATES             -- 3
+  1 SEP 2007 /
+/
+)");
+
+    auto es = EclipseState { deck };
+    const auto eager = Schedule { deck, es, std::make_shared<Python>() };
+
+    auto errors = ErrorGuard{};
+    auto lazy = Schedule { deck, es.getInputGrid(), es.fieldProps(),
+                           es.aquifer().numericalAquifers(), es.runspec(),
+                           ParseContext{}, errors, std::make_shared<Python>(),
+                           /* lowActionParsingStrictness = */ false,
+                           /* slave_mode = */ false,
+                           /* keepKeywords = */ true,
+                           /* output_interval = */ {},
+                           /* rst = */ nullptr,
+                           &es.tracer(),
+                           /* lazyLoad = */ true };
+
+    // The remaining report steps need the field properties.
+    const auto report = es.compact(lazy, deck);
+    BOOST_CHECK( report.deck > 0 );
+    BOOST_CHECK_EQUAL( report.field_props, 0U );
+    BOOST_CHECK_EQUAL( report.grid, 0U );
+
+    BOOST_CHECK(! lazy.isFullyLoaded());
+    BOOST_CHECK(lazy[3] == eager[3]);
+    BOOST_CHECK(lazy.isFullyLoaded());
+    BOOST_CHECK_CLOSE(lazy.getWell("W_2", 3).getConnections()[0].CF(),
+                      eager.getWell("W_2", 3).getConnections()[0].CF(), 1.0e-8);
+
+    BOOST_CHECK( es.compact(lazy).field_props > 0 );
+}
+
+BOOST_AUTO_TEST_CASE(ScheduleState_Map_Version)
+{
+    const auto schedule = make_schedule(createDeckWithWells());
+
+    auto state = schedule[3];
+    const auto version = state.wells.version();
+    BOOST_CHECK_EQUAL(version, schedule[3].wells.version());
+
+    // Looking up elements through a mutable state leaves the version alone.
+    BOOST_CHECK_EQUAL(state.wells.get("W_1").name(), "W_1");
+    BOOST_CHECK_EQUAL(state.wells.get_ptr("W_1")->name(), "W_1");
+    BOOST_CHECK_EQUAL(state.wells().size(), schedule[3].wells().size());
+    BOOST_CHECK_EQUAL(state.wells.version(), version);
+
+    // Replacing an element changes the version.
+    auto well = state.wells("W_1");
+    state.wells.update(std::move(well));
+    BOOST_CHECK(state.wells.version() != version);
+
+    // Restoring the original element does not bring back the old version.
+    const auto replaced = state.wells.version();
+    state.wells.update("W_1", schedule[3].wells);
+    BOOST_CHECK(state.wells.version() != version);
+    BOOST_CHECK(state.wells.version() != replaced);
+    BOOST_CHECK_EQUAL(schedule[3].wells.version(), version);
+}
@@ -120,6 +120,12 @@ BOOST_AUTO_TEST_CASE( readValueToken_basic_validity_tests ) {
     BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "3.3d0" ) ), 1e-6 );
     BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "3.3E0" ) ), 1e-6 );
     BOOST_CHECK_CLOSE( 3.3, Opm::readValueToken<double>( std::string( "3.3D0" ) ), 1e-6 );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "INF" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "-inf" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "infinity" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "NAN" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "+nan" ) ), std::invalid_argument );
+    BOOST_CHECK_THROW( Opm::readValueToken<double>( std::string( "1.0D400" ) ), std::invalid_argument );
     BOOST_CHECK_EQUAL( "OLGA", Opm::readValueToken<std::string>( std::string( "OLGA" ) ) );
     BOOST_CHECK_EQUAL( "OLGA", Opm::readValueToken<std::string>( std::string( "'OLGA'" ) ) );
     BOOST_CHECK_EQUAL( "123*456", Opm::readValueToken<std::string>( std::string( "123*456" ) ) );
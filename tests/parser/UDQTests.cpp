@@ -46,6 +46,8 @@
 #include <opm/input/eclipse/Schedule/UDQ/UDQEnums.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunction.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQFunctionTable.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQParams.hpp>
+#include <opm/input/eclipse/Schedule/UDQ/UDQProgram.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQSet.hpp>
 #include <opm/input/eclipse/Schedule/UDQ/UDQState.hpp>
 #include <opm/input/eclipse/Schedule/Well/NameOrder.hpp>
@@ -2570,6 +2572,47 @@ DEFINE FU_PAR2 FU_PAR3 /
     BOOST_CHECK_EQUAL(st.get("FU_PAR2"), 100);
 }
 
+BOOST_AUTO_TEST_CASE(UDQ_DEFINE_DEPENDENCY_ORDER) {
+    // Definitions may be evaluated concurrently, but must see the same
+    // values as in a sequential evaluation in input order.  In particular
+    // FU_A sees the value of FU_B from the previous evaluation.
+    std::string deck_string = R"(
+SCHEDULE
+UDQ
+DEFINE FU_A FU_B + 1 /
+DEFINE FU_B FOPR * 2 /
+DEFINE FU_C FU_B + FU_A /
+DEFINE FU_D FU_C * 3 /
+DEFINE FU_E FOPR - 1 /
+DEFINE FU_F FU_D + FU_E /
+/
+)";
+    auto schedule = make_schedule(deck_string);
+    const auto& udq = schedule.getUDQConfig(0);
+    const auto undefined_value =  udq.params().undefinedValue();
+    SummaryState st(TimeService::now(), undefined_value);
+    UDQState udq_state(undefined_value);
+    st.update("FOPR", 100);
+    auto segmentMatcherFactory = []() { return std::make_unique<SegmentMatcher>(ScheduleState {}); };
+    auto regionSetMatcherFactory = []() { return std::make_unique<RegionSetMatcher>(FIPRegionStatistics {}); };
+
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), undefined_value);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 200);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), undefined_value);
+    BOOST_CHECK_EQUAL(st.get("FU_D"), undefined_value);
+    BOOST_CHECK_EQUAL(st.get("FU_E"), 99);
+    BOOST_CHECK_EQUAL(st.get("FU_F"), undefined_value);
+
+    udq.eval(0, {}, {}, segmentMatcherFactory, regionSetMatcherFactory, st, udq_state);
+    BOOST_CHECK_EQUAL(st.get("FU_A"), 201);
+    BOOST_CHECK_EQUAL(st.get("FU_B"), 200);
+    BOOST_CHECK_EQUAL(st.get("FU_C"), 401);
+    BOOST_CHECK_EQUAL(st.get("FU_D"), 1203);
+    BOOST_CHECK_EQUAL(st.get("FU_E"), 99);
+    BOOST_CHECK_EQUAL(st.get("FU_F"), 1302);
+}
+
 BOOST_AUTO_TEST_CASE(UDQ_UNDEFINED2) {
     std::string deck_string = R"(
 SCHEDULE
@@ -3613,3 +3656,87 @@ DEFINE SUSHI (SOFR 'W1' 42) + ((SWCT W1 11)/((SGLR W2) + 1.0)) /
                             R"(Well "W2" must not have any associate segments in "SUSHI" UDQ)");
     }
 }
+
+BOOST_AUTO_TEST_CASE(UDQ_COMPILED_EVAL_CONSISTENCY)
+{
+    // Compiled programs must produce exactly the same UDQ sets as the
+    // reference AST evaluator.
+    KeywordLocation location;
+    UDQParams udqp;
+    UDQFunctionTable udqft(udqp);
+    SummaryState st(TimeService::now(), udqp.undefinedValue());
+    UDQState udq_state(udqp.undefinedValue());
+    WellMatcher wm(NameOrder({"P1", "P2", "P3", "I1"}));
+
+    auto group_order = GroupOrder { std::size_t{3} };
+    group_order.add("G1");
+    group_order.add("G2");
+
+    UDQContext context(udqft, wm, group_order, {}, UDQContext::MatcherFactories{}, st, udq_state);
+
+    // WOPR is undefined in I1 and zero in P2.
+    st.update_well_var("P1", "WOPR", 100.0);
+    st.update_well_var("P2", "WOPR", 0.0);
+    st.update_well_var("P3", "WOPR", 250.5);
+    st.update_well_var("P1", "WWCT", 0.5);
+    st.update_well_var("P2", "WWCT", 0.9);
+    st.update_well_var("P3", "WWCT", 0.1);
+    st.update_well_var("I1", "WWCT", 0.0);
+    st.update_well_var("P1", "WBHP", 210.0);
+    st.update_well_var("P2", "WBHP", 190.0);
+    st.update_well_var("P3", "WBHP", 205.0);
+    st.update_well_var("I1", "WBHP", 300.0);
+    st.update_group_var("G1", "GOPR", 350.5);
+    st.update_group_var("G2", "GOPR", 0.0);
+    st.update("FOPR", 350.5);
+
+    struct Case
+    {
+        std::string keyword;
+        std::vector<std::string> expression;
+        bool compiled;
+    };
+
+    const auto cases = std::vector<Case> {
+        { "WU1",  { "WOPR", "*", "2", "+", "WWCT" }, true },
+        { "WU2",  { "WOPR", "/", "WWCT" }, true },
+        { "WU3",  { "WOPR", "'P*'", "-", "WBHP", "P1" }, true },
+        { "WU4",  { "SUM", "(", "WOPR", ")", "/", "FOPR" }, true },
+        { "WU5",  { "-", "WOPR", "P3", "+", "ABS", "(", "WWCT", "-", "0.5", ")" }, true },
+        { "WU6",  { "(", "WOPR", ">", "100", ")", "*", "(", "WWCT", "<=", "0.5", ")" }, true },
+        { "WU7",  { "WOPR", "UADD", "WWCT" }, true },
+        { "WU8",  { "WOPR", "^", "0.5", "+", "WOPR", "UMIN", "WBHP" }, true },
+        { "WU9",  { "NINT", "(", "EXP", "(", "WWCT", ")", ")" }, true },
+        { "WU10", { "IDV", "(", "WOPR", ")", "+", "DEF", "(", "WOPR", ")" }, true },
+        { "WU11", { "WOPR", "==", "WOPR", "P2", "UMAX", "(", "WWCT", "!=", "0.5", ")" }, true },
+        { "WU12", { "SORTA", "(", "WOPR", ")" }, false },
+        { "GU1",  { "GOPR", "*", "1.5", "-", "GOPR", "G1" }, true },
+        { "GU2",  { "MAX", "(", "GOPR", ")", "+", "2" }, true },
+        { "FU1",  { "FOPR", "+", "SUM", "(", "WOPR", ")" }, true },
+        { "FU2",  { "2", "*", "3" }, true },
+        { "FU3",  { "NORM2", "(", "WWCT", ")", "+", "AVEA", "(", "WOPR", ")",
+                    "+", "AVEH", "(", "WBHP", ")", "-", "PROD", "(", "WWCT", "'P*'", ")" }, true },
+    };
+
+    auto workspace = UDQProgram::Workspace{};
+    for (const auto& c : cases) {
+        BOOST_TEST_MESSAGE("UDQ " << c.keyword);
+
+        auto def = UDQDefine { udqp, c.keyword, 0, location, c.expression };
+        const auto expect = def.eval(context);
+
+        def.compile();
+        BOOST_CHECK_EQUAL(def.compiled(), c.compiled);
+
+        const auto res = def.eval(context, workspace);
+        BOOST_CHECK_MESSAGE(res == expect, "Compiled evaluation of " << c.keyword
+                            << " must match AST evaluation");
+    }
+
+    // Errors are reported through the AST evaluator.  LN(0) in P2.
+    auto def_ln = UDQDefine { udqp, "WULN", 0, location, { "LN", "(", "WOPR", ")" } };
+    def_ln.compile();
+    BOOST_CHECK(def_ln.compiled());
+    BOOST_CHECK_THROW(def_ln.eval(context), std::exception);
+    BOOST_CHECK_THROW(def_ln.eval(context, workspace), std::exception);
+}
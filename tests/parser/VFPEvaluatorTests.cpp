@@ -0,0 +1,330 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#define BOOST_TEST_MODULE VFPEvaluatorTests
+
+#include <boost/test/unit_test.hpp>
+
+#include <opm/input/eclipse/Schedule/VFPEvaluator.hpp>
+#include <opm/input/eclipse/Schedule/VFPInjTable.hpp>
+#include <opm/input/eclipse/Schedule/VFPProdTable.hpp>
+
+#include <opm/input/eclipse/Deck/Deck.hpp>
+#include <opm/input/eclipse/Parser/Parser.hpp>
+#include <opm/input/eclipse/Units/UnitSystem.hpp>
+
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Multilinear in each argument, hence reproduced exactly by multilinear
+// interpolation, also when extrapolating.
+double bhpFunction(const double flo, const double thp,
+                   const double wfr, const double gfr, const double alq)
+{
+    return 50.0 + 2.0*thp + 0.1*flo + 0.01*flo*thp + 3.0*wfr - 0.5*gfr*flo
+        + 0.2*alq + 0.05*wfr*gfr*alq;
+}
+
+Opm::VFPProdTable makeProdTable()
+{
+    const auto flo = std::vector<double> { 1.0, 5.0, 10.0, 25.0, 30.0, 100.0 };
+    const auto thp = std::vector<double> { 10.0, 20.0, 50.0 };
+    const auto wfr = std::vector<double> { 0.0, 0.5 };
+    const auto gfr = std::vector<double> { 0.1, 0.2, 0.4 };
+    const auto alq = std::vector<double> { 0.0 };
+
+    auto data = std::vector<double>{};
+    for (const auto t : thp) {
+        for (const auto w : wfr) {
+            for (const auto g : gfr) {
+                for (const auto a : alq) {
+                    for (const auto f : flo) {
+                        data.push_back(bhpFunction(f, t, w, g, a));
+                    }
+                }
+            }
+        }
+    }
+
+    using Table = Opm::VFPProdTable;
+    return { 1, 1000.0,
+             Table::FLO_TYPE::FLO_OIL, Table::WFR_TYPE::WFR_WCT,
+             Table::GFR_TYPE::GFR_GOR, Table::ALQ_TYPE::ALQ_UNDEF,
+             flo, thp, wfr, gfr, alq, data };
+}
+
+Opm::VFPInjTable makeInjTable()
+{
+    const auto input = std::string { R"(
+VFPINJ
+-- Table Depth  Rate   TAB  UNITS  BODY
+       5  32.9   WAT   THP METRIC   BHP /
+-- Rate axis
+1 3 5 /
+-- THP axis
+7 11 /
+-- Table data with THP# <values 1-num_rates>
+1 1.5 2.5 3.5 /
+2 4.5 5.5 6.5 /
+)" };
+
+    const auto deck = Opm::Parser{}.parseString(input);
+    return { deck["VFPINJ"].back(), Opm::UnitSystem::newMETRIC() };
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(Axis)
+
+BOOST_AUTO_TEST_CASE(Locate)
+{
+    const auto axis = Opm::VFPAxis { { 0.0, 1.0, 1.5, 10.0 } };
+
+    const auto inside = axis.locate(1.25);
+    BOOST_CHECK_EQUAL(inside.index, std::size_t{1});
+    BOOST_CHECK_CLOSE(inside.factor, 0.5, 1.0e-12);
+    BOOST_CHECK_CLOSE(inside.inv_width, 2.0, 1.0e-12);
+
+    const auto point = axis.locate(1.5);
+    BOOST_CHECK_EQUAL(point.index, std::size_t{2});
+    BOOST_CHECK_EQUAL(point.factor, 0.0);
+
+    const auto last = axis.locate(10.0);
+    BOOST_CHECK_EQUAL(last.index, std::size_t{2});
+    BOOST_CHECK_CLOSE(last.factor, 1.0, 1.0e-12);
+
+    const auto below = axis.locate(-1.0);
+    BOOST_CHECK_EQUAL(below.index, std::size_t{0});
+    BOOST_CHECK_CLOSE(below.factor, -1.0, 1.0e-12);
+
+    const auto above = axis.locate(18.5);
+    BOOST_CHECK_EQUAL(above.index, std::size_t{2});
+    BOOST_CHECK_CLOSE(above.factor, 2.0, 1.0e-12);
+}
+
+BOOST_AUTO_TEST_CASE(Single_Point_And_Repeated_Points)
+{
+    const auto single = Opm::VFPAxis { { 3.0 } };
+    BOOST_CHECK_EQUAL(single.locate(17.0).index, std::size_t{0});
+    BOOST_CHECK_EQUAL(single.locate(17.0).factor, 0.0);
+
+    const auto repeated = Opm::VFPAxis { { 0.0, 1.0, 1.0, 2.0 } };
+    const auto pos = repeated.locate(1.5);
+    BOOST_CHECK_EQUAL(pos.index, std::size_t{2});
+    BOOST_CHECK_CLOSE(pos.factor, 0.5, 1.0e-12);
+
+    BOOST_CHECK_THROW(Opm::VFPAxis { std::vector<double>{} }, std::invalid_argument);
+    BOOST_CHECK_THROW((Opm::VFPAxis { { 1.0, 0.0 } }), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Axis
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Production)
+
+BOOST_AUTO_TEST_CASE(Interpolation_And_Derivatives)
+{
+    const auto table = makeProdTable();
+    const auto vfp = Opm::VFPProdEvaluator { table };
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> flo(-10.0, 120.0);
+    std::uniform_real_distribution<double> thp(0.0, 60.0);
+    std::uniform_real_distribution<double> wfr(-0.1, 0.7);
+    std::uniform_real_distribution<double> gfr(0.0, 0.5);
+
+    for (int i = 0; i < 200; ++i) {
+        const auto f = flo(gen);
+        const auto t = thp(gen);
+        const auto w = wfr(gen);
+        const auto g = gfr(gen);
+        const auto a = 0.0;
+
+        const auto bhp = vfp.bhp(f, t, w, g, a);
+        BOOST_CHECK_CLOSE(bhp.value, bhpFunction(f, t, w, g, a), 1.0e-9);
+
+        BOOST_CHECK_SMALL(bhp.dflo - (0.1 + 0.01*t - 0.5*g), 1.0e-10);
+        BOOST_CHECK_SMALL(bhp.dthp - (2.0 + 0.01*f), 1.0e-10);
+        BOOST_CHECK_SMALL(bhp.dwfr - (3.0 + 0.05*g*a), 1.0e-10);
+        BOOST_CHECK_SMALL(bhp.dgfr - (-0.5*f + 0.05*w*a), 1.0e-10);
+        BOOST_CHECK_EQUAL(bhp.dalq, 0.0);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Table_Points)
+{
+    const auto table = makeProdTable();
+    const auto vfp = Opm::VFPProdEvaluator { table };
+
+    const auto [nt, nw, ng, na, nf] = table.shape();
+    for (std::size_t t = 0; t < nt; ++t) {
+        for (std::size_t w = 0; w < nw; ++w) {
+            for (std::size_t g = 0; g < ng; ++g) {
+                for (std::size_t f = 0; f < nf; ++f) {
+                    const auto bhp = vfp.bhp(table.getFloAxis()[f], table.getTHPAxis()[t],
+                                             table.getWFRAxis()[w], table.getGFRAxis()[g],
+                                             table.getALQAxis()[0]);
+
+                    BOOST_CHECK_CLOSE(bhp.value, table(t, w, g, 0, f), 1.0e-12);
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Batch)
+{
+    const auto vfp = Opm::VFPProdEvaluator { makeProdTable() };
+
+    const auto flo = std::vector<double> { 2.0, 7.5, 28.0, 150.0 };
+    const auto thp = std::vector<double> { 15.0, 10.0, 45.0, 70.0 };
+    const auto wfr = std::vector<double> { 0.1, 0.2, 0.3, 0.4 };
+    const auto gfr = std::vector<double> { 0.15, 0.2, 0.3, 0.35 };
+    const auto alq = std::vector<double>(4, 0.0);
+
+    auto bhp = std::vector<Opm::VFPProdEvaluator::Result>(flo.size());
+    vfp.bhp(flo, thp, wfr, gfr, alq, bhp);
+
+    auto thp_out = std::vector<Opm::VFPProdEvaluator::Result>(flo.size());
+    auto bhp_value = std::vector<double>(flo.size());
+    for (std::size_t i = 0; i < flo.size(); ++i) {
+        const auto expect = vfp.bhp(flo[i], thp[i], wfr[i], gfr[i], alq[i]);
+        BOOST_CHECK_EQUAL(bhp[i].value, expect.value);
+        BOOST_CHECK_EQUAL(bhp[i].dflo, expect.dflo);
+        BOOST_CHECK_EQUAL(bhp[i].dthp, expect.dthp);
+        bhp_value[i] = bhp[i].value;
+    }
+
+    vfp.thp(flo, bhp_value, wfr, gfr, alq, thp_out);
+    for (std::size_t i = 0; i < flo.size(); ++i) {
+        BOOST_CHECK_CLOSE(thp_out[i].value, thp[i], 1.0e-9);
+    }
+
+    auto too_short = std::vector<Opm::VFPProdEvaluator::Result>(flo.size() - 1);
+    BOOST_CHECK_THROW(vfp.bhp(flo, thp, wfr, gfr, alq, too_short), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(Inverse_THP)
+{
+    const auto vfp = Opm::VFPProdEvaluator { makeProdTable() };
+
+    const auto f = 12.0;
+    const auto w = 0.25;
+    const auto g = 0.3;
+    const auto a = 0.0;
+
+    for (const auto t : { 5.0, 10.0, 17.0, 33.0, 50.0, 80.0 }) {
+        const auto bhp = bhpFunction(f, t, w, g, a);
+        const auto thp = vfp.thp(f, bhp, w, g, a);
+
+        BOOST_CHECK_CLOSE(thp.value, t, 1.0e-9);
+
+        // THP = (bhp - rest) / (2 + 0.01*flo)
+        const auto slope = 2.0 + 0.01*f;
+        BOOST_CHECK_CLOSE(thp.dthp, 1.0 / slope, 1.0e-9);
+        BOOST_CHECK_CLOSE(thp.dwfr, -(3.0 + 0.05*g*a) / slope, 1.0e-9);
+
+        BOOST_CHECK_SMALL(thp.dflo - (-0.1 + 0.5*g - 0.01*t) / slope, 1.0e-10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Inverse_Rate)
+{
+    const auto vfp = Opm::VFPProdEvaluator { makeProdTable() };
+
+    const auto t = 20.0;
+    const auto w = 0.0;
+    const auto g = 0.1;
+    const auto a = 0.0;
+
+    // Fixed bottom hole pressure.
+    {
+        const auto target = bhpFunction(40.0, t, w, g, a);
+        const auto flo = vfp.flo(t, w, g, a, target, 0.0);
+
+        BOOST_REQUIRE(flo.has_value());
+        BOOST_CHECK_CLOSE(*flo, 40.0, 1.0e-9);
+    }
+
+    // Inflow relation crossing the VFP curve at rate 20.
+    {
+        const auto dbhp_dflo = -1.0;
+        const auto bhp0 = bhpFunction(20.0, t, w, g, a) + 20.0;
+        const auto flo = vfp.flo(t, w, g, a, bhp0, dbhp_dflo);
+
+        BOOST_REQUIRE(flo.has_value());
+        BOOST_CHECK_CLOSE(*flo, 20.0, 1.0e-9);
+    }
+
+    // Inflow pressure below the VFP curve at all rates.
+    BOOST_CHECK(! vfp.flo(t, w, g, a, 0.0, 0.0).has_value());
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Production
+
+// ===========================================================================
+
+BOOST_AUTO_TEST_SUITE(Injection)
+
+BOOST_AUTO_TEST_CASE(Interpolation)
+{
+    const auto table = makeInjTable();
+    const auto vfp = Opm::VFPInjEvaluator { table };
+
+    const auto& flo = table.getFloAxis();
+    const auto& thp = table.getTHPAxis();
+
+    for (std::size_t t = 0; t < thp.size(); ++t) {
+        for (std::size_t f = 0; f < flo.size(); ++f) {
+            BOOST_CHECK_CLOSE(vfp.bhp(flo[f], thp[t]).value, table(t, f), 1.0e-12);
+        }
+    }
+
+    const auto f = 0.5 * (flo[0] + flo[1]);
+    const auto t = 0.25*thp[0] + 0.75*thp[1];
+    const auto bhp = vfp.bhp(f, t);
+
+    const auto lo = 0.5 * (table(0, 0) + table(0, 1));
+    const auto hi = 0.5 * (table(1, 0) + table(1, 1));
+    BOOST_CHECK_CLOSE(bhp.value, 0.25*lo + 0.75*hi, 1.0e-12);
+    BOOST_CHECK_CLOSE(bhp.dthp, (hi - lo) / (thp[1] - thp[0]), 1.0e-12);
+
+    const auto dflo = 0.25 * (table(0, 1) - table(0, 0)) + 0.75 * (table(1, 1) - table(1, 0));
+    BOOST_CHECK_CLOSE(bhp.dflo, dflo / (flo[1] - flo[0]), 1.0e-12);
+
+    const auto inv = vfp.thp(f, bhp.value);
+    BOOST_CHECK_CLOSE(inv.value, t, 1.0e-9);
+    BOOST_CHECK_CLOSE(inv.dthp, 1.0 / bhp.dthp, 1.0e-9);
+
+    const auto rate = vfp.flo(t, bhp.value, 0.0);
+    BOOST_REQUIRE(rate.has_value());
+    BOOST_CHECK_CLOSE(*rate, f, 1.0e-9);
+
+    auto batch = std::vector<Opm::VFPInjEvaluator::Result>(1);
+    vfp.bhp(std::vector<double>{ f }, std::vector<double>{ t }, batch);
+    BOOST_CHECK_EQUAL(batch[0].value, bhp.value);
+}
+
+BOOST_AUTO_TEST_SUITE_END() // Injection
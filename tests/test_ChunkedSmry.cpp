@@ -0,0 +1,225 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE Test Chunked Summary
+#include <boost/test/unit_test.hpp>
+
+#include <opm/io/eclipse/ChunkedESmry.hpp>
+#include <opm/io/eclipse/ChunkedSmryFormat.hpp>
+#include <opm/io/eclipse/ChunkedSmryOutput.hpp>
+#include <opm/io/eclipse/ESmry.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "tests/WorkArea.hpp"
+
+using Opm::EclIO::ChunkedESmry;
+using Opm::EclIO::ChunkedSmryOutput;
+using Opm::EclIO::ESmry;
+
+namespace ChunkedSmry = Opm::EclIO::ChunkedSmry;
+
+namespace {
+
+    std::vector<float> roundTrip(const std::vector<float>& values,
+                                 const ChunkedSmry::Codec codec,
+                                 std::size_t& encodedSize)
+    {
+        const auto encoded = ChunkedSmry::encodeColumn(values.data(), values.size(), codec);
+        encodedSize = encoded.size();
+
+        std::vector<float> decoded(values.size());
+        ChunkedSmry::decodeColumn(encoded.data(), encoded.size(), decoded.size(), decoded.data());
+
+        return decoded;
+    }
+
+    const std::vector<int> startDate { 1, 1, 2020, 0, 0, 0, 0 };
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(ColumnCodec)
+{
+    // Piecewise constant, typical of rate controlled wells.
+    std::vector<float> rates(1000, 0.0f);
+    for (std::size_t i = 300; i < rates.size(); ++i) {
+        rates[i] = (i < 700) ? 2500.0f : 1250.0f;
+    }
+
+    // Cumulative volumes, monotonically increasing.
+    std::vector<float> totals(1000);
+    for (std::size_t i = 0; i < totals.size(); ++i) {
+        totals[i] = 1.0e3f * std::sqrt(static_cast<float>(i));
+    }
+
+    std::size_t size = 0;
+
+    BOOST_CHECK(roundTrip(rates, ChunkedSmry::Codec::XorDeltaRle, size) == rates);
+    BOOST_CHECK_LT(size, rates.size());
+
+    BOOST_CHECK(roundTrip(totals, ChunkedSmry::Codec::XorDeltaRle, size) == totals);
+    BOOST_CHECK_LE(size, 1 + totals.size()*sizeof(float));
+
+    BOOST_CHECK(roundTrip(totals, ChunkedSmry::Codec::None, size) == totals);
+    BOOST_CHECK_EQUAL(size, 1 + totals.size()*sizeof(float));
+
+    const auto empty = std::vector<float>{};
+    BOOST_CHECK(roundTrip(empty, ChunkedSmry::Codec::XorDeltaRle, size).empty());
+
+    auto corrupt = ChunkedSmry::encodeColumn(rates.data(), rates.size(),
+                                             ChunkedSmry::Codec::XorDeltaRle);
+    corrupt.pop_back();
+
+    std::vector<float> decoded(rates.size());
+    BOOST_CHECK_THROW(ChunkedSmry::decodeColumn(corrupt.data(), corrupt.size(),
+                                                decoded.size(), decoded.data()),
+                      std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE(WriteAndRead)
+{
+    WorkArea work;
+
+    const std::vector<std::string> keys  { "TIME", "FOPR", "WBHP:PROD" };
+    const std::vector<std::string> units { "DAYS", "SM3/DAY", "BARSA" };
+
+    const std::size_t nStep = 23;
+
+    ChunkedSmry::WriteOptions options;
+    options.chunkSize = 5;
+
+    auto value = [](std::size_t v, std::size_t step)
+    {
+        return static_cast<float>(v*1000 + step) + 0.5f;
+    };
+
+    // Two time steps per report step.
+    auto reportStep = [](std::size_t step) { return static_cast<int>(step / 2) + 1; };
+
+    {
+        ChunkedSmryOutput output("TEST.CSMRY", keys, units, startDate, options);
+
+        for (std::size_t step = 0; step < nStep; ++step) {
+            std::vector<float> ts_data;
+            for (std::size_t v = 0; v < keys.size(); ++v) {
+                ts_data.push_back(value(v, step));
+            }
+
+            output.write(ts_data, reportStep(step), false);
+
+            if (step == 11) {
+                // Readable while the simulation runs, including the
+                // incomplete final chunk.
+                output.flush();
+
+                ChunkedESmry partial("TEST.CSMRY");
+                BOOST_CHECK_EQUAL(partial.numberOfTimeSteps(), 12U);
+                BOOST_CHECK_EQUAL(partial.get("FOPR")[11], value(1, 11));
+            }
+        }
+
+        BOOST_CHECK_THROW(output.write({ 1.0f }, 100, false), std::invalid_argument);
+    }
+
+    ChunkedESmry smry("TEST");
+
+    BOOST_CHECK_EQUAL(smry.numberOfTimeSteps(), nStep);
+    BOOST_CHECK_EQUAL(smry.numberOfVectors(), keys.size());
+    BOOST_CHECK(smry.keywordList() == keys);
+    BOOST_CHECK(smry.keywordList("W*") == std::vector<std::string>{ "WBHP:PROD" });
+    BOOST_CHECK(smry.hasKey("FOPR"));
+    BOOST_CHECK(! smry.hasKey("FGPR"));
+    BOOST_CHECK_EQUAL(smry.get_unit("WBHP:PROD"), "BARSA");
+    BOOST_CHECK(smry.start_v() == startDate);
+
+    BOOST_CHECK_THROW(smry.get("FGPR"), std::invalid_argument);
+    BOOST_CHECK_THROW(smry.get("FOPR", 10, 24), std::out_of_range);
+
+    // Time range spanning three chunks, read before full vector is loaded.
+    const auto slice = smry.get("WBHP:PROD", 4, 16);
+    BOOST_REQUIRE_EQUAL(slice.size(), 12U);
+    for (std::size_t i = 0; i < slice.size(); ++i) {
+        BOOST_CHECK_EQUAL(slice[i], value(2, 4 + i));
+    }
+
+    BOOST_CHECK(smry.get("FOPR", 7, 7).empty());
+
+    for (std::size_t v = 0; v < keys.size(); ++v) {
+        const auto& vect = smry.get(keys[v]);
+        BOOST_REQUIRE_EQUAL(vect.size(), nStep);
+
+        for (std::size_t step = 0; step < nStep; ++step) {
+            BOOST_CHECK_EQUAL(vect[step], value(v, step));
+        }
+    }
+
+    BOOST_CHECK(smry.get("FOPR", 4, 16) == std::vector<float>(smry.get("FOPR").begin() + 4,
+                                                              smry.get("FOPR").begin() + 16));
+
+    // Last time step of each report step.
+    const std::vector<int> seqIndex { 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 22 };
+    BOOST_CHECK(smry.reportStepIndices() == seqIndex);
+
+    const auto rstepFopr = smry.get_at_rstep("FOPR");
+    BOOST_REQUIRE_EQUAL(rstepFopr.size(), seqIndex.size());
+    for (std::size_t i = 0; i < seqIndex.size(); ++i) {
+        BOOST_CHECK_EQUAL(rstepFopr[i], value(1, seqIndex[i]));
+    }
+
+    BOOST_CHECK(! smry.refresh());
+}
+
+BOOST_AUTO_TEST_CASE(ConvertFromSmspec)
+{
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+
+    ESmry smry("SPE1CASE1.SMSPEC");
+
+    // Byte budget of 16 time steps.
+    ChunkedSmry::WriteOptions options;
+    options.chunkBytes = 16 * sizeof(float) * smry.keywordList().size();
+
+    Opm::EclIO::makeChunkedSmryFile(smry, "SPE1CASE1.CSMRY", options);
+
+    ChunkedESmry csmry("SPE1CASE1.CSMRY");
+
+    BOOST_CHECK_EQUAL(csmry.chunkSize(), std::size_t{16});
+
+    BOOST_CHECK_EQUAL(csmry.numberOfTimeSteps(), smry.numberOfTimeSteps());
+    BOOST_CHECK(csmry.keywordList() == smry.keywordList());
+    BOOST_CHECK(csmry.startdate() == smry.startdate());
+
+    for (const auto& key : smry.keywordList()) {
+        BOOST_CHECK_MESSAGE(csmry.get(key) == smry.get(key), "Vector " << key);
+        BOOST_CHECK_EQUAL(csmry.get_unit(key), smry.get_unit(key));
+    }
+
+    BOOST_CHECK(csmry.get_at_rstep("FOPR") == smry.get_at_rstep("FOPR"));
+
+    const auto dates = csmry.dates();
+    BOOST_CHECK(dates == smry.dates());
+}
@@ -30,11 +30,13 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <tuple>
+#include <utility>
 
 #include <math.h>
 #include <stdio.h>
@@ -641,3 +643,80 @@ BOOST_AUTO_TEST_CASE(Test_all_available_w_restart) {
 
     BOOST_CHECK_EQUAL( smry3.all_steps_available(), false);
 }
+
+BOOST_AUTO_TEST_CASE(TestESmry_TimeRangeQuery) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+    work.copyIn("SPE1CASE1_RST60.SMSPEC");
+    work.copyIn("SPE1CASE1_RST60.UNSMRY");
+
+    // Restarted run including base run, time steps from two summary files
+    ESmry ref("SPE1CASE1_RST60.SMSPEC", true);
+    ESmry smry("SPE1CASE1_RST60.SMSPEC", true);
+
+    const std::vector<std::string> keys { "WGPR:PROD", "FGOR", "FGPR", "TIME" };
+    const std::size_t nstep = smry.numberOfTimeSteps();
+
+    // Partially loaded, copied from memory for FGOR
+    smry.get("FGOR");
+
+    const auto values = smry.get(keys, 50, 80);
+    BOOST_REQUIRE_EQUAL(values.size(), keys.size());
+
+    for (std::size_t k = 0; k < keys.size(); ++k) {
+        const auto& full = ref.get(keys[k]);
+        BOOST_REQUIRE_EQUAL(values[k].size(), 30U);
+
+        for (std::size_t i = 0; i < values[k].size(); ++i) {
+            if (std::isnan(full[50 + i]))
+                BOOST_CHECK(std::isnan(values[k][i]));
+            else
+                BOOST_CHECK_EQUAL(values[k][i], full[50 + i]);
+        }
+    }
+
+    BOOST_CHECK(smry.get(keys, 10, 10)[0].empty());
+    BOOST_CHECK_THROW(smry.get(keys, 10, nstep + 1), std::out_of_range);
+    BOOST_CHECK_THROW(smry.get({"NO_SUCH_KEY"}, 0, 1), std::invalid_argument);
+
+    std::vector<float> streamed;
+    std::size_t nextStep = 3;
+    smry.stream({"WBHP:PROD"}, 3, nstep, 7,
+                [&streamed, &nextStep](const std::size_t firstStep,
+                                       const std::vector<std::vector<float>>& block)
+                {
+                    BOOST_CHECK_EQUAL(firstStep, nextStep);
+                    BOOST_CHECK_LE(block[0].size(), 7U);
+
+                    streamed.insert(streamed.end(), block[0].begin(), block[0].end());
+                    nextStep += block[0].size();
+                });
+
+    const auto& wbhp = ref.get("WBHP:PROD");
+    BOOST_CHECK(streamed == std::vector<float>(wbhp.begin() + 3, wbhp.end()));
+
+    const auto dates = ref.dates();
+    const auto [first, last] = smry.timeStepRange(dates[20], dates[40]);
+    BOOST_CHECK_EQUAL(first, 20U);
+    BOOST_CHECK_EQUAL(last, 41U);
+
+    const auto [first2, last2] = smry.timeStepRange(dates[20] + std::chrono::hours(1), dates.back() + std::chrono::hours(1));
+    BOOST_CHECK_EQUAL(first2, 21U);
+    BOOST_CHECK_EQUAL(last2, nstep);
+
+    // At most two vectors in memory, evicted vectors are reloaded on demand
+    smry.setCacheCapacity(2);
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        for (const auto& key : keys) {
+            const auto vect = smry.get(key);
+            const auto& refVect = ref.get(key);
+
+            BOOST_REQUIRE_EQUAL(vect.size(), refVect.size());
+            for (std::size_t i = 0; i < vect.size(); ++i) {
+                if (!std::isnan(refVect[i]))
+                    BOOST_CHECK_EQUAL(vect[i], refVect[i]);
+            }
+        }
+    }
+}
@@ -27,6 +27,7 @@
 #include <opm/io/eclipse/EclOutput.hpp>
 
 #include <algorithm>
+#include <bit>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
@@ -34,6 +35,7 @@
 #include <tuple>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
 #include <numeric>
 
 #include <math.h>
@@ -199,6 +201,65 @@ BOOST_AUTO_TEST_CASE(TestEclFile_BINARY)
     BOOST_CHECK_EQUAL(vect5b.size(), 312U);
 }
 
+BOOST_AUTO_TEST_CASE(TestEclFile_MEMORY_MAPPED)
+{
+    std::string testFile="ECLFILE.INIT";
+
+    EclFile file1(testFile);
+    EclFile file2(testFile, EclFile::MemoryMapped{true});
+
+    BOOST_CHECK(!file1.memoryMapped());
+    BOOST_CHECK(file2.memoryMapped());
+
+    // views are not available for stream based input
+
+    BOOST_CHECK_THROW(file1.getView<float>("PORV"), std::runtime_error);
+
+    // check that exeption is thrown when member function getView is used with wrong type
+
+    BOOST_CHECK_THROW(file2.getView<int>("PORV"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<double>("ICON"), std::runtime_error);
+    BOOST_CHECK_THROW(file2.getView<float>("XPORV"), std::invalid_argument);
+
+    // arrays loaded from the memory mapped file must be identical to
+    // those read through the file stream
+
+    BOOST_CHECK(file1.get<int>("ICON") == file2.get<int>("ICON"));
+    BOOST_CHECK(file1.get<float>("PORV") == file2.get<float>("PORV"));
+    BOOST_CHECK(file1.get<double>("XCON") == file2.get<double>("XCON"));
+    BOOST_CHECK(file1.get<bool>("LOGIHEAD") == file2.get<bool>("LOGIHEAD"));
+    BOOST_CHECK(file1.get<std::string>("KEYWORDS") == file2.get<std::string>("KEYWORDS"));
+
+    // PORV spans several records on disk
+
+    const auto& porv = file1.get<float>("PORV");
+    const auto porvView = file2.getView<float>("PORV");
+
+    BOOST_CHECK_EQUAL(porvView.size(), 3146U);
+    BOOST_CHECK(std::ranges::equal(porvView, porv));
+    BOOST_CHECK_EQUAL(porvView.at(1500), porv[1500]);
+    BOOST_CHECK_THROW(porvView.at(3146), std::out_of_range);
+
+    std::vector<float> part(1200);
+    porvView.copy(990, part.size(), part.data());
+    BOOST_CHECK(std::equal(part.begin(), part.end(), porv.begin() + 990));
+
+    BOOST_CHECK_THROW(porvView.copy(3000, 147, part.data()), std::out_of_range);
+
+    const auto xconView = file2.getView<double>(3);
+    BOOST_CHECK(xconView.toVector() == file1.get<double>("XCON"));
+
+    // views remain valid after the file object is destroyed
+
+    auto iconView = EclFile(testFile, EclFile::MemoryMapped{true}).getView<int>("ICON");
+    BOOST_CHECK(iconView.toVector() == file1.get<int>("ICON"));
+
+    // memory mapping is not used for formatted files
+
+    EclFile file3("ECLFILE.FINIT", EclFile::MemoryMapped{true});
+    BOOST_CHECK(!file3.memoryMapped());
+}
+
 BOOST_AUTO_TEST_CASE(TestEclFile_FORMATTED)
 {
     std::string testFile1="ECLFILE.INIT";
@@ -532,6 +593,81 @@ BOOST_AUTO_TEST_CASE(TestEcl_Write_CHAR)
     }
 }
 
+BOOST_AUTO_TEST_CASE(BulkEndianConversion)
+{
+    // sizes chosen to exercise both the SIMD loops and the scalar tails
+
+    for (const std::size_t n : { 0, 1, 3, 7, 8, 9, 17, 1000, 4099 }) {
+        std::vector<int> ivect(n);
+        std::iota(ivect.begin(), ivect.end(), -1234567);
+
+        std::vector<int> iflip(n);
+        flipEndianArray(ivect.data(), iflip.data(), n, sizeof(int));
+
+        for (std::size_t i = 0; i < n; i++) {
+            BOOST_CHECK_EQUAL(iflip[i], flipEndianInt(ivect[i]));
+        }
+
+        std::vector<double> dvect(n);
+        for (std::size_t i = 0; i < n; i++) {
+            dvect[i] = 1.0e-3 * i - 17.25;
+        }
+
+        auto dflip = dvect;
+        flipEndianArray(dflip.data(), dflip.data(), n, sizeof(double));
+
+        for (std::size_t i = 0; i < n; i++) {
+            BOOST_CHECK_EQUAL(dflip[i], flipEndianDouble(dvect[i]));
+        }
+    }
+
+    BOOST_CHECK_THROW(flipEndianArray(nullptr, nullptr, 0, 2), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(EncodeDecodeBinaryBlocks)
+{
+    const std::int64_t num = 2500;
+    const int elementsPerBlock = MaxBlockSizeReal / sizeOfReal;
+
+    std::vector<float> fvect(num);
+    for (std::int64_t i = 0; i < num; i++) {
+        fvect[i] = 0.5f * i - 3.0f;
+    }
+
+    std::vector<char> buffer(sizeOnDiskBinary(num, REAL, sizeOfReal));
+    encodeBinaryBlocks(fvect.data(), num, sizeOfReal, elementsPerBlock, buffer.data());
+
+    // Expected on-disk representation: blocks of at most elementsPerBlock
+    // big-endian values, each enclosed by big-endian record markers
+    // holding the block size in bytes.
+
+    std::vector<char> expected;
+    auto append_be32 = [&expected](const std::uint32_t value)
+    {
+        for (const int shift : { 24, 16, 8, 0 }) {
+            expected.push_back(static_cast<char>((value >> shift) & 0xFFu));
+        }
+    };
+
+    for (std::int64_t first = 0; first < num; first += elementsPerBlock) {
+        const auto count = std::min(num - first, static_cast<std::int64_t>(elementsPerBlock));
+        const auto blockSize = static_cast<std::uint32_t>(count * sizeOfReal);
+
+        append_be32(blockSize);
+        for (std::int64_t i = first; i < first + count; ++i) {
+            append_be32(std::bit_cast<std::uint32_t>(fvect[i]));
+        }
+        append_be32(blockSize);
+    }
+
+    BOOST_REQUIRE_EQUAL(buffer.size(), expected.size());
+    BOOST_CHECK(buffer == expected);
+
+    std::vector<float> decoded(num);
+    decodeBinaryBlocks(expected.data(), num, sizeOfReal, elementsPerBlock, decoded.data());
+    BOOST_CHECK(decoded == fvect);
+}
+
 BOOST_AUTO_TEST_CASE(CombinedVectorID)
 {
     BOOST_CHECK_EQUAL(combineSummaryNumbers(1, 2), 393'217);
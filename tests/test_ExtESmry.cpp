@@ -30,6 +30,7 @@
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <cstddef>
 #include <fstream>
 #include <iomanip>
@@ -37,6 +38,7 @@
 #include <math.h>
 #include <stdio.h>
 #include <tuple>
+#include <utility>
 
 #include "tests/WorkArea.hpp"
 
@@ -384,3 +386,64 @@ BOOST_AUTO_TEST_CASE(TestESmry_3) {
     for (std::size_t n = 63; n < fopt.size(); n++)
         BOOST_REQUIRE_CLOSE(fopt[n], fopt_rst_ref[n-63], 0.01);
 }
+
+BOOST_AUTO_TEST_CASE(TestExtESmry_TimeRangeQuery) {
+    WorkArea work;
+    work.copyIn("SPE1CASE1.SMSPEC");
+    work.copyIn("SPE1CASE1.UNSMRY");
+    work.copyIn("SPE1CASE1_RST60.ESMRY");
+
+    ESmry smry1("SPE1CASE1.SMSPEC");
+    smry1.make_esmry_file();
+
+    // Restarted run including base run, time steps from two ESMRY files
+    ExtESmry ref("SPE1CASE1_RST60.ESMRY", true);
+    ExtESmry esmry("SPE1CASE1_RST60.ESMRY", true);
+
+    const std::vector<std::string> keys { "WGPR:PROD", "FGOR", "FGPR", "TIME" };
+    const std::size_t nstep = esmry.numberOfTimeSteps();
+
+    // Partially loaded, copied from memory for FGOR
+    esmry.get("FGOR");
+
+    for (const auto& [from, to] : { std::pair<std::size_t, std::size_t>{ 50, 80 },
+                                    std::pair<std::size_t, std::size_t>{ 0, nstep },
+                                    std::pair<std::size_t, std::size_t>{ 70, 71 } })
+    {
+        const auto values = esmry.get(keys, from, to);
+        BOOST_REQUIRE_EQUAL(values.size(), keys.size());
+
+        for (std::size_t k = 0; k < keys.size(); ++k) {
+            const auto& full = ref.get(keys[k]);
+            BOOST_CHECK(values[k] == std::vector<float>(full.begin() + from, full.begin() + to));
+        }
+    }
+
+    BOOST_CHECK_THROW(esmry.get(keys, 10, nstep + 1), std::out_of_range);
+    BOOST_CHECK_THROW(esmry.get({"NO_SUCH_KEY"}, 0, 1), std::invalid_argument);
+
+    std::vector<float> streamed;
+    esmry.stream({"WBHP:PROD"}, 3, nstep, 7,
+                 [&streamed](const std::size_t, const std::vector<std::vector<float>>& block)
+                 {
+                     BOOST_CHECK_LE(block[0].size(), 7U);
+                     streamed.insert(streamed.end(), block[0].begin(), block[0].end());
+                 });
+
+    const auto& wbhp = ref.get("WBHP:PROD");
+    BOOST_CHECK(streamed == std::vector<float>(wbhp.begin() + 3, wbhp.end()));
+
+    const auto dates = ref.dates();
+    const auto [first, last] = esmry.timeStepRange(dates[20], dates[40]);
+    BOOST_CHECK_EQUAL(first, 20U);
+    BOOST_CHECK_EQUAL(last, 41U);
+
+    // At most two vectors in memory, evicted vectors are reloaded on demand
+    esmry.setCacheCapacity(2);
+    for (int repeat = 0; repeat < 2; ++repeat) {
+        for (const auto& key : keys) {
+            const auto vect = esmry.get(key);
+            BOOST_CHECK(vect == ref.get(key));
+        }
+    }
+}
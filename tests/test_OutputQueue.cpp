@@ -0,0 +1,156 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE OutputQueueTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/output/eclipse/OutputQueue.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Task which runs until the test opens the gate.
+class Gate
+{
+public:
+    void open() { this->promise_.set_value(); }
+
+    auto task()
+    {
+        return [gate = this->future_]() { gate.wait(); };
+    }
+
+private:
+    std::promise<void> promise_{};
+    std::shared_future<void> future_{ promise_.get_future().share() };
+};
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_CASE(Runs_Tasks_In_Order)
+{
+    auto order = std::vector<int>{};
+
+    Opm::out::OutputQueue queue { 2 };
+    for (auto i = 0; i < 5; ++i) {
+        queue.submit([&order, i]() { order.push_back(i); });
+    }
+
+    queue.flush();
+
+    BOOST_CHECK_EQUAL(order.size(), std::size_t{5});
+    for (auto i = 0; i < 5; ++i) {
+        BOOST_CHECK_EQUAL(order[i], i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Error_Rethrown_By_Flush)
+{
+    auto gate = Gate{};
+    auto ran = std::atomic<int>{0};
+
+    Opm::out::OutputQueue queue { 3 };
+    queue.submit(gate.task());
+    queue.submit([]() { throw std::runtime_error { "Write failed" }; });
+    queue.submit([&ran]() { ++ran; });
+    gate.open();
+
+    BOOST_CHECK_THROW(queue.flush(), std::runtime_error);
+
+    // Tasks queued behind the failing one are discarded, and the error is
+    // reported only once.
+    BOOST_CHECK_EQUAL(ran.load(), 0);
+    BOOST_CHECK_NO_THROW(queue.flush());
+
+    queue.submit([&ran]() { ++ran; });
+    queue.flush();
+    BOOST_CHECK_EQUAL(ran.load(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Error_Rethrown_By_Submit)
+{
+    auto ran = std::atomic<int>{0};
+
+    // With a single pending task, the next submit() waits for the failing
+    // task to finish and so always sees its error.
+    Opm::out::OutputQueue queue { 1 };
+    queue.submit([]() { throw std::runtime_error { "Write failed" }; });
+
+    BOOST_CHECK_THROW(queue.submit([&ran]() { ++ran; }), std::runtime_error);
+
+    queue.flush();
+    BOOST_CHECK_EQUAL(ran.load(), 0);
+
+    queue.submit([&ran]() { ++ran; });
+    queue.flush();
+    BOOST_CHECK_EQUAL(ran.load(), 1);
+}
+
+BOOST_AUTO_TEST_CASE(Submit_Blocks_At_Max_Pending)
+{
+    auto gate = Gate{};
+    auto ran = std::atomic<int>{0};
+    auto submitted = std::atomic<bool>{false};
+
+    Opm::out::OutputQueue queue { 2 };
+    queue.submit(gate.task());
+    queue.submit([&ran]() { ++ran; });
+
+    // Two tasks are pending, one running and one queued, so a third
+    // submit() must wait until the first one finishes.
+    auto producer = std::thread { [&queue, &ran, &submitted]() {
+        queue.submit([&ran]() { ++ran; });
+        submitted = true;
+    }};
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    BOOST_CHECK(! submitted.load());
+    BOOST_CHECK_EQUAL(ran.load(), 0);
+
+    gate.open();
+    producer.join();
+    BOOST_CHECK(submitted.load());
+
+    queue.flush();
+    BOOST_CHECK_EQUAL(ran.load(), 2);
+}
+
+BOOST_AUTO_TEST_CASE(Destructor_Runs_Pending_Tasks)
+{
+    auto gate = Gate{};
+    auto ran = std::atomic<int>{0};
+
+    {
+        Opm::out::OutputQueue queue { 3 };
+        queue.submit(gate.task());
+        queue.submit([&ran]() { ++ran; });
+        queue.submit([&ran]() { ++ran; });
+        gate.open();
+    }
+
+    BOOST_CHECK_EQUAL(ran.load(), 2);
+}
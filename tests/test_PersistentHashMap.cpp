@@ -0,0 +1,195 @@
+/*
+  Copyright 2026 Equinor ASA.
+
+  This file is part of the Open Porous Media project (OPM).
+
+  OPM is free software: you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  OPM is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with OPM.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#include "config.h"
+
+#define BOOST_TEST_MODULE PersistentHashMapTest
+#include <boost/test/unit_test.hpp>
+
+#include <opm/common/utility/PersistentHashMap.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Hash function with many collisions, exercising both deep trie paths and
+// the collision lists at the bottom of the trie.
+struct PoorHash
+{
+    std::size_t operator()(const int key) const
+    {
+        return static_cast<std::size_t>(key % 7) * 0x9E3779B97F4A7C15ull;
+    }
+};
+
+template <typename Map>
+std::map<int, int> contents(const Map& m)
+{
+    auto result = std::map<int, int>{};
+    for (const auto& [key, value] : m) {
+        result.emplace(key, value);
+    }
+
+    return result;
+}
+
+template <typename Map>
+void checkAgainstReference(const int seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int> key(0, 300);
+    std::uniform_int_distribution<int> op(0, 9);
+
+    auto m = Map{};
+    auto ref = std::map<int, int>{};
+
+    for (int i = 0; i < 5000; ++i) {
+        const auto k = key(gen);
+        if (op(gen) < 6) {
+            m.insert_or_assign(k, i);
+            ref.insert_or_assign(k, i);
+        }
+        else {
+            BOOST_CHECK_EQUAL(m.erase(k), ref.erase(k) > 0);
+        }
+
+        BOOST_REQUIRE_EQUAL(m.size(), ref.size());
+    }
+
+    BOOST_CHECK(contents(m) == ref);
+
+    for (int k = 0; k <= 300; ++k) {
+        const auto* value = m.find(k);
+        const auto pos = ref.find(k);
+
+        BOOST_REQUIRE_EQUAL(value != nullptr, pos != ref.end());
+        if (value != nullptr) {
+            BOOST_CHECK_EQUAL(*value, pos->second);
+        }
+    }
+}
+
+} // Anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(PersistentHashMapTests)
+
+BOOST_AUTO_TEST_CASE(Basic_Operations)
+{
+    auto m = Opm::PersistentHashMap<std::string, int>{};
+    BOOST_CHECK(m.empty());
+    BOOST_CHECK(m.begin() == m.end());
+    BOOST_CHECK(m.find("A") == nullptr);
+
+    m.insert_or_assign("A", 1);
+    m.insert_or_assign("B", 2);
+    m.insert_or_assign("A", 3);
+
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{2});
+    BOOST_CHECK(m.contains("B"));
+    BOOST_CHECK_EQUAL(*m.find("A"), 3);
+
+    BOOST_CHECK(m.erase("A"));
+    BOOST_CHECK(! m.erase("A"));
+    BOOST_CHECK(! m.contains("A"));
+    BOOST_CHECK_EQUAL(m.size(), std::size_t{1});
+
+    m.clear();
+    BOOST_CHECK(m.empty());
+}
+
+BOOST_AUTO_TEST_CASE(Reference_Map)
+{
+    for (const auto seed : { 1, 2, 3 }) {
+        checkAgainstReference<Opm::PersistentHashMap<int, int>>(seed);
+        checkAgainstReference<Opm::PersistentHashMap<int, int, PoorHash>>(seed);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(Copies_Are_Independent)
+{
+    auto m1 = Opm::PersistentHashMap<int, int, PoorHash>{};
+    for (int k = 0; k < 100; ++k) {
+        m1.insert_or_assign(k, k);
+    }
+
+    auto m2 = m1;
+    BOOST_CHECK(m2.isSameAs(m1));
+
+    m2.insert_or_assign(5, 50);
+    m2.erase(6);
+    m2.insert_or_assign(1000, 1000);
+    BOOST_CHECK(! m2.isSameAs(m1));
+
+    BOOST_CHECK_EQUAL(m1.size(), std::size_t{100});
+    BOOST_CHECK_EQUAL(*m1.find(5), 5);
+    BOOST_CHECK(m1.contains(6));
+    BOOST_CHECK(! m1.contains(1000));
+
+    BOOST_CHECK_EQUAL(m2.size(), std::size_t{100});
+    BOOST_CHECK_EQUAL(*m2.find(5), 50);
+    BOOST_CHECK(! m2.contains(6));
+}
+
+BOOST_AUTO_TEST_CASE(Diff)
+{
+    auto base = Opm::PersistentHashMap<int, int, PoorHash>{};
+    for (int k = 0; k < 200; ++k) {
+        base.insert_or_assign(k, k);
+    }
+
+    auto self = base;
+    self.insert_or_assign(3, 30);
+    self.insert_or_assign(17, 17);  // Same value, not a difference
+    self.insert_or_assign(500, 500);
+    self.erase(42);
+    self.erase(43);
+
+    auto upserted = std::map<int, int>{};
+    auto erased = std::vector<int>{};
+    Opm::PersistentHashMap<int, int, PoorHash>::diff
+        (base, self,
+         [&upserted](const auto& elem) { upserted.insert(elem); },
+         [&erased](const int key) { erased.push_back(key); });
+
+    const auto expectUpserted = std::map<int, int> { {3, 30}, {500, 500} };
+    BOOST_CHECK(upserted == expectUpserted);
+
+    std::sort(erased.begin(), erased.end());
+    const auto expectErased = std::vector<int> { 42, 43 };
+    BOOST_CHECK_EQUAL_COLLECTIONS(erased.begin(), erased.end(),
+                                  expectErased.begin(), expectErased.end());
+
+    // Applying the differences to the base reproduces the derived map.
+    auto applied = base;
+    for (const auto& [key, value] : upserted) {
+        applied.insert_or_assign(key, value);
+    }
+    for (const auto key : erased) {
+        applied.erase(key);
+    }
+
+    BOOST_CHECK(contents(applied) == contents(self));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -8227,6 +8227,130 @@ BOOST_AUTO_TEST_CASE(append_summary_state)
     BOOST_CHECK_EQUAL(st_both.get_group_var("G1", "WOPR"), 3000);
 }
 
+BOOST_AUTO_TEST_CASE(SummaryState_Handles)
+{
+    SummaryState st(TimeService::now(), 0.0);
+
+    const auto wopr = st.resolve_well_var("OP_1", "WOPR");
+    const auto wopt = st.resolve_well_var("OP_1", "WOPT");
+    const auto gopt = st.resolve_group_var("G1", "GOPT", EclIO::SummaryNode::Type::Total);
+    const auto copr = st.resolve_conn_var("OP_1", "COPR", EclIO::SummaryNode::Type::Rate, 123);
+    const auto sofr = st.resolve_segment_var("OP_1", "SOFR", 2);
+    const auto roip = st.resolve_region_var("FIPNUM", "ROIP", 3);
+    const auto fopr = st.resolve("FOPR");
+
+    // Resolving does not assign a value.
+    BOOST_CHECK(st.is_valid(wopr));
+    BOOST_CHECK(!st.has(wopr));
+    BOOST_CHECK(!st.has_well_var("OP_1", "WOPR"));
+    BOOST_CHECK(!st.has("WOPR:OP_1"));
+    BOOST_CHECK_EQUAL(st.num_wells(), 0U);
+    BOOST_CHECK_THROW(st.get(wopr), std::invalid_argument);
+
+    st.update(wopr, 100);
+    st.update(wopr, 150);
+    st.update(wopt, 100);
+    st.update(wopt, 150);
+    st.update(gopt, 10);
+    st.update(gopt, 15);
+    st.update(copr, 12.5);
+    st.update(sofr, 2.5);
+    st.update(roip, 1.0e6);
+    st.update(fopr, 1000);
+
+    BOOST_CHECK_EQUAL(st.get(wopr), 150);
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_1", "WOPR"), 150);
+    BOOST_CHECK_EQUAL(st.get("WOPR:OP_1"), 150);
+    BOOST_CHECK_EQUAL(st.get(wopt), 250);
+    BOOST_CHECK_EQUAL(st.get("WOPT:OP_1"), 250);
+    BOOST_CHECK_EQUAL(st.get_group_var("G1", "GOPT"), 25);
+    BOOST_CHECK_EQUAL(st.get_conn_var("OP_1", "COPR", 123), 12.5);
+    BOOST_CHECK_EQUAL(st.get("COPR:OP_1:123"), 12.5);
+    BOOST_CHECK_EQUAL(st.get_segment_var("OP_1", "SOFR", 2), 2.5);
+    BOOST_CHECK_EQUAL(st.get_region_var("FIPNUM", "ROIP", 3), 1.0e6);
+    BOOST_CHECK_EQUAL(st.get("ROIP:3"), 1.0e6);
+    BOOST_CHECK_EQUAL(st.get("FOPR"), 1000);
+    BOOST_CHECK_EQUAL(st.num_wells(), 1U);
+    BOOST_CHECK_EQUAL(st.groups().size(), 1U);
+    BOOST_CHECK_EQUAL(st.size(), 7U);
+
+    // String and handle APIs refer to the same values.
+    st.update_well_var("OP_1", "WOPR", 200);
+    BOOST_CHECK_EQUAL(st.get(wopr), 200);
+    BOOST_CHECK(st.has(st.find_well_var("OP_1", "WOPR")));
+    BOOST_CHECK(!st.is_valid(st.find_well_var("OP_2", "WOPR")));
+    BOOST_CHECK(!st.is_valid(st.find("FGPR")));
+
+    // Copies share handles until one of them registers a new value.
+    auto copy = st;
+    BOOST_CHECK(copy.is_valid(wopr));
+    copy.update(wopr, 300);
+    BOOST_CHECK_EQUAL(copy.get(wopr), 300);
+    BOOST_CHECK_EQUAL(st.get(wopr), 200);
+
+    copy.update_well_var("OP_2", "WOPR", 1);
+    BOOST_CHECK(!copy.is_valid(wopr));
+    BOOST_CHECK(st.is_valid(wopr));
+    BOOST_CHECK(!st.has_well_var("OP_2", "WOPR"));
+    BOOST_CHECK_THROW(copy.update(wopr, 1), std::invalid_argument);
+
+    const auto wopr_copy = copy.resolve_well_var("OP_1", "WOPR");
+    BOOST_CHECK_EQUAL(copy.get(wopr_copy), 300);
+
+    // Handles are specific to the originating object and its copies.
+    SummaryState other(TimeService::now(), 0.0);
+    other.update_well_var("OP_1", "WOPR", 1);
+    BOOST_CHECK(!other.is_valid(wopr));
+}
+
+BOOST_AUTO_TEST_CASE(SummaryState_Assigned_Entities)
+{
+    SummaryState st(TimeService::now(), 0.0);
+
+    // Resolved but never assigned keys are not reported.
+    st.resolve_well_var("OP_1", "WOPR");
+    st.resolve_group_var("G1", "GOPR", EclIO::SummaryNode::Type::Rate);
+    BOOST_CHECK(!st.has_well_var("WOPR"));
+    BOOST_CHECK(!st.has_group_var("GOPR"));
+    BOOST_CHECK(st.wells().empty());
+    BOOST_CHECK(st.groups().empty());
+    BOOST_CHECK(st.wells("WOPR").empty());
+
+    st.update_well_var("OP_1", "WOPR", 100);
+    st.update_group_var("G1", "GOPR", 10);
+    BOOST_CHECK(st.has_well_var("WOPR"));
+    BOOST_CHECK(st.has_group_var("GOPR"));
+
+    // Appending a buffer without OP_1 and G1 replaces their current values
+    // but keeps them in the list of known entities.
+    SummaryState buffer(TimeService::now(), 0.0);
+    buffer.update_well_var("OP_2", "WOPR", 200);
+    buffer.update_group_var("G2", "GOPR", 20);
+    st.append(buffer);
+
+    BOOST_CHECK(!st.has_well_var("OP_1", "WOPR"));
+    BOOST_CHECK(!st.has_group_var("G1", "GOPR"));
+    BOOST_CHECK_EQUAL(st.get_well_var("OP_2", "WOPR"), 200);
+
+    const auto wells = st.wells();
+    BOOST_CHECK_EQUAL(wells.size(), 2U);
+    BOOST_CHECK(std::find(wells.begin(), wells.end(), "OP_1") != wells.end());
+    BOOST_CHECK(std::find(wells.begin(), wells.end(), "OP_2") != wells.end());
+    BOOST_CHECK_EQUAL(st.num_wells(), 2U);
+
+    const auto groups = st.groups();
+    BOOST_CHECK_EQUAL(groups.size(), 2U);
+    BOOST_CHECK(std::find(groups.begin(), groups.end(), "G1") != groups.end());
+
+    const auto wopr_wells = st.wells("WOPR");
+    BOOST_CHECK_EQUAL(wopr_wells.size(), 1U);
+    BOOST_CHECK_EQUAL(wopr_wells.front(), "OP_2");
+
+    // Erasing the last value of a well removes it.
+    BOOST_CHECK(st.erase_well_var("OP_2", "WOPR"));
+    BOOST_CHECK_EQUAL(st.wells().size(), 1U);
+}
+
 BOOST_AUTO_TEST_SUITE_END() // Summary_State
 
 // ====================================================================